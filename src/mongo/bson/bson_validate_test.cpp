@@ -779,6 +779,17 @@ TEST(BSONValidateFast, ErrorTooShort) {
     ASSERT_NOT_OK(validateBSON(badCopy, x.objsize() - 1));
 }
 
+TEST(BSONValidateFast, FieldNameLengths) {
+    // Field names are scanned a word at a time, so cover names ending at every offset in a word,
+    // both in the middle of the object and as the last element before the EOO.
+    for (size_t len = 0; len < 40; ++len) {
+        std::string name(len, 'f');
+        BSONObj obj = BSON(name << 1 << "x" << true << name + "y" << BSONNULL);
+        ASSERT_OK(validateBSON(obj));
+        ASSERT_NOT_OK(validateBSON(obj.objdata(), obj.objsize() - 1));
+    }
+}
+
 TEST(BSONValidateExtended, RegexOptions) {
     // Checks that RegEx with invalid options strings (either an unknown flag or not in alphabetical
     // order) throws a warning.
@@ -141,4 +141,35 @@ typename std::pair<typename CMaterializer::Element, typename CMaterializer::Elem
         reinterpret_cast<const char*>(bin.data), bin.length, std::move(allocator), comparator);
 }
 
+/**
+ * Evaluates '<element> <op> rhs' for every element stored in this BSONColumn, decoding numeric
+ * values straight from the Simple8b blocks into selection bitmaps without materializing them.
+ * Returns boost::none if the column contains any value that isn't a number with a matching
+ * comparand in 'rhs', callers are then expected to fall back to a full decompression.
+ */
+inline boost::optional<NumericCompareResult> compareNumeric(const char* buffer,
+                                                            size_t size,
+                                                            NumericCompareOp op,
+                                                            const NumericComparand& rhs) {
+    switch (op) {
+        case NumericCompareOp::kLt:
+            return bsoncolumn_internal::compareNumeric<NumericCompareOp::kLt>(buffer, size, rhs);
+        case NumericCompareOp::kLte:
+            return bsoncolumn_internal::compareNumeric<NumericCompareOp::kLte>(buffer, size, rhs);
+        case NumericCompareOp::kGt:
+            return bsoncolumn_internal::compareNumeric<NumericCompareOp::kGt>(buffer, size, rhs);
+        case NumericCompareOp::kGte:
+            return bsoncolumn_internal::compareNumeric<NumericCompareOp::kGte>(buffer, size, rhs);
+        case NumericCompareOp::kEq:
+            return bsoncolumn_internal::compareNumeric<NumericCompareOp::kEq>(buffer, size, rhs);
+    }
+    MONGO_UNREACHABLE;
+}
+inline boost::optional<NumericCompareResult> compareNumeric(BSONBinData bin,
+                                                            NumericCompareOp op,
+                                                            const NumericComparand& rhs) {
+    tassert(9600200, "Invalid BSON type for column", bin.type == BinDataType::Column);
+    return compareNumeric(reinterpret_cast<const char*>(bin.data), bin.length, op, rhs);
+}
+
 }  // namespace mongo::bsoncolumn
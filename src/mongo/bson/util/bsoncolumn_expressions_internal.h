@@ -32,6 +32,40 @@
 #include "mongo/base/compare_numbers.h"
 #include "mongo/bson/util/bsoncolumn.h"
 
+namespace mongo::bsoncolumn {
+
+/**
+ * Comparison operators supported by compareNumeric().
+ */
+enum class NumericCompareOp { kLt, kLte, kGt, kGte, kEq };
+
+/**
+ * Right-hand side of a numeric comparison performed by compareNumeric(). Integer elements (int32
+ * and int64) are compared against 'integer' and double elements are compared against 'floating'.
+ * A comparand should only be provided when the comparison against it is exact for the
+ * corresponding element type, if an element is encountered for which no comparand was provided
+ * the comparison is aborted.
+ */
+struct NumericComparand {
+    boost::optional<int64_t> integer;
+    boost::optional<double> floating;
+};
+
+/**
+ * Selection bitmaps produced by compareNumeric(), 64 elements per word with the first element in
+ * the least significant bit.
+ */
+struct NumericCompareResult {
+    // Bit is set when the element is present and satisfies the comparison.
+    std::vector<uint64_t> matches;
+    // Bit is unset when the element is missing.
+    std::vector<uint64_t> present;
+    // Total number of elements in the BSONColumn.
+    size_t count = 0;
+};
+
+}  // namespace mongo::bsoncolumn
+
 namespace mongo::bsoncolumn::bsoncolumn_internal {
 
 /*
@@ -731,6 +765,212 @@ private:
     const StringDataComparator* _comparator;
 };
 
+/*
+ * Collector type that evaluates a numeric comparison against every appended value without
+ * materializing them. Values are staged in fixed-size batches that are compared in tight
+ * branch-free loops the compiler can vectorize, producing one word of the selection bitmap per
+ * batch. Encountering a value that can't be compared natively marks the collector as unsupported,
+ * the remaining values are then ignored.
+ */
+template <NumericCompareOp Op>
+class NumericCompareCollector {
+public:
+    static constexpr size_t kBatchSize = 64;
+
+    explicit NumericCompareCollector(const NumericComparand& rhs)
+        : _allocator(new ElementStorage()),
+          _hasIntegerRhs(rhs.integer.has_value()),
+          _hasFloatingRhs(rhs.floating.has_value()),
+          _integerRhs(rhs.integer.value_or(0)),
+          _floatingRhs(rhs.floating.value_or(0.0)) {}
+
+    static constexpr bool kCollectsPositionInfo = false;
+
+    void eof() {
+        _flush();
+    }
+
+    void append(int32_t val) {
+        append(static_cast<int64_t>(val));
+    }
+
+    void append(int64_t val) {
+        _supported = _supported && _hasIntegerRhs;
+        _last = {val, 0.0, false, true};
+        _stage();
+    }
+
+    void append(double val) {
+        _supported = _supported && _hasFloatingRhs;
+        _last = {0, val, true, true};
+        _stage();
+    }
+
+    // All other types can't be compared natively.
+    void append(bool val) {
+        _unsupported();
+    }
+    void append(Decimal128 val) {
+        _unsupported();
+    }
+    void append(Timestamp val) {
+        _unsupported();
+    }
+    void append(Date_t val) {
+        _unsupported();
+    }
+    void append(OID val) {
+        _unsupported();
+    }
+    void append(StringData val) {
+        _unsupported();
+    }
+    void append(const BSONBinData& val) {
+        _unsupported();
+    }
+    void append(const BSONCode& val) {
+        _unsupported();
+    }
+
+    template <typename T>
+    void append(const BSONElement& val) {
+        if constexpr (std::is_same_v<T, int32_t>) {
+            append(val._numberInt());
+        } else if constexpr (std::is_same_v<T, int64_t>) {
+            append(static_cast<int64_t>(val._numberLong()));
+        } else if constexpr (std::is_same_v<T, double>) {
+            append(val._numberDouble());
+        } else {
+            _unsupported();
+        }
+    }
+
+    void appendPreallocated(const BSONElement& val) {
+        _unsupported();
+    }
+
+    void appendMissing() {
+        _last = {};
+        _stage();
+    }
+
+    void appendLast() {
+        _stage();
+    }
+
+    bool isLastMissing() {
+        return !_last.present;
+    }
+
+    // Only used after interleaved mode, which means the column contains objects.
+    template <typename T>
+    void setLast(const BSONElement& val) {
+        _supported = false;
+        _last = {};
+    }
+
+    // Position info is not supported
+    void appendPositionInfo(int32_t n) {}
+
+    ElementStorage& getAllocator() {
+        return *_allocator;
+    }
+
+    /**
+     * Returns the selection bitmaps, or boost::none if a value that can't be compared natively was
+     * encountered.
+     */
+    boost::optional<NumericCompareResult> result() {
+        if (!_supported) {
+            return boost::none;
+        }
+        return std::move(_result);
+    }
+
+private:
+    struct LastValue {
+        int64_t integer = 0;
+        double floating = 0.0;
+        bool isFloating = false;
+        bool present = false;
+    };
+
+    template <typename T>
+    static bool _compare(T lhs, T rhs) {
+        if constexpr (Op == NumericCompareOp::kLt) {
+            return lhs < rhs;
+        } else if constexpr (Op == NumericCompareOp::kLte) {
+            return lhs <= rhs;
+        } else if constexpr (Op == NumericCompareOp::kGt) {
+            return lhs > rhs;
+        } else if constexpr (Op == NumericCompareOp::kGte) {
+            return lhs >= rhs;
+        } else {
+            return lhs == rhs;
+        }
+    }
+
+    void _unsupported() {
+        _supported = false;
+        _last = {};
+        _stage();
+    }
+
+    // Stages the last value into the current batch. Both lanes are always written so the batch
+    // compare loops below never read uninitialized memory.
+    void _stage() {
+        const uint64_t bit = uint64_t{1} << _pos;
+        _integers[_pos] = _last.integer;
+        _floatings[_pos] = _last.floating;
+        _floatingMask |= _last.isFloating ? bit : 0;
+        _presentMask |= _last.present ? bit : 0;
+        if (++_pos == kBatchSize) {
+            _flush();
+        }
+    }
+
+    void _flush() {
+        if (_pos == 0) {
+            return;
+        }
+
+        uint64_t integerMatches = 0;
+        for (size_t i = 0; i < _pos; ++i) {
+            integerMatches |= static_cast<uint64_t>(_compare(_integers[i], _integerRhs)) << i;
+        }
+        uint64_t floatingMatches = 0;
+        for (size_t i = 0; i < _pos; ++i) {
+            floatingMatches |= static_cast<uint64_t>(_compare(_floatings[i], _floatingRhs)) << i;
+        }
+
+        _result.matches.push_back(
+            ((integerMatches & ~_floatingMask) | (floatingMatches & _floatingMask)) & _presentMask);
+        _result.present.push_back(_presentMask);
+        _result.count += _pos;
+
+        _pos = 0;
+        _floatingMask = 0;
+        _presentMask = 0;
+    }
+
+    boost::intrusive_ptr<ElementStorage> _allocator;
+
+    const bool _hasIntegerRhs;
+    const bool _hasFloatingRhs;
+    const int64_t _integerRhs;
+    const double _floatingRhs;
+
+    int64_t _integers[kBatchSize];
+    double _floatings[kBatchSize];
+    uint64_t _floatingMask = 0;
+    uint64_t _presentMask = 0;
+    size_t _pos = 0;
+
+    LastValue _last;
+    bool _supported = true;
+    NumericCompareResult _result;
+};
+
 template <class CMaterializer>
 requires Materializer<CMaterializer>
 typename CMaterializer::Element first(const char* buffer,
@@ -1047,4 +1287,13 @@ typename std::pair<typename CMaterializer::Element, typename CMaterializer::Elem
     return collector.minmax();
 }
 
+template <NumericCompareOp Op>
+boost::optional<NumericCompareResult> compareNumeric(const char* buffer,
+                                                     size_t size,
+                                                     const NumericComparand& rhs) {
+    NumericCompareCollector<Op> collector(rhs);
+    BSONColumnBlockBased(buffer, size).decompress(collector);
+    return collector.result();
+}
+
 }  // namespace mongo::bsoncolumn::bsoncolumn_internal
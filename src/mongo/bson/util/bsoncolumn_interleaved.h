@@ -1047,7 +1047,11 @@ const char* BlockBasedInterleavedDecompressor::decompressFast(
             } else {
                 heap.emplace_back(scalarIdx, elem);
             }
-            heap.back().setLastValueFromBSONElem();
+            // Streams that are not materialized are only counted, they never need a last value to
+            // apply deltas to.
+            if (!heap.back()._buffers.empty()) {
+                heap.back().setLastValueFromBSONElem();
+            }
             for (auto&& b : heap.back()._buffers) {
                 // Set the "last" element to be whatever is here in the reference object without
                 // actually appending it.
@@ -1072,7 +1076,9 @@ const char* BlockBasedInterleavedDecompressor::decompressFast(
             for (auto&& b : state._buffers) {
                 b->template append<BSONElement>(state._refElem);
             }
-            state.setLastValueFromBSONElem();
+            if (!state._buffers.empty()) {
+                state.setLastValueFromBSONElem();
+            }
             ++state._valueCount;
             control += state._refElem.size();
         } else {
@@ -9184,5 +9184,66 @@ TEST_F(BSONColumnTest, TestCollector) {
 }
 
 
+TEST_F(BSONColumnTest, CompareNumeric) {
+    // Enough values to span several batches, with runs of repeated values, skips and a type change.
+    std::vector<boost::optional<int64_t>> values;
+    for (int i = 0; i < 300; ++i) {
+        if (i % 7 == 3) {
+            cb.skip();
+            values.push_back(boost::none);
+            continue;
+        }
+        int64_t val = i < 150 ? i / 10 : i;
+        cb.append(i < 200 ? createElementInt64(val) : createElementInt32(val));
+        values.push_back(val);
+    }
+    auto binData = cb.finalize();
+
+    auto res = compareNumeric(static_cast<const char*>(binData.data),
+                              binData.length,
+                              NumericCompareOp::kLte,
+                              NumericComparand{.integer = 12});
+    ASSERT(res);
+    ASSERT_EQ(res->count, values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        const bool present = (res->present[i / 64] >> (i % 64)) & 1;
+        const bool match = (res->matches[i / 64] >> (i % 64)) & 1;
+        ASSERT_EQ(present, values[i].has_value()) << i;
+        ASSERT_EQ(match, values[i] && *values[i] <= 12) << i;
+    }
+
+    // Integers can't be compared without an integer comparand.
+    ASSERT_FALSE(compareNumeric(static_cast<const char*>(binData.data),
+                                binData.length,
+                                NumericCompareOp::kLt,
+                                NumericComparand{.floating = 1.5}));
+
+    BSONColumnBuilder doubles;
+    doubles.append(createElementDouble(1.5));
+    doubles.skip();
+    doubles.append(createElementDouble(-2.25));
+    doubles.append(createElementDouble(10.0));
+    auto doublesBinData = doubles.finalize();
+
+    res = compareNumeric(static_cast<const char*>(doublesBinData.data),
+                         doublesBinData.length,
+                         NumericCompareOp::kGt,
+                         NumericComparand{.floating = 1.5});
+    ASSERT(res);
+    ASSERT_EQ(res->count, 4U);
+    ASSERT(res->present == std::vector<uint64_t>{0b1101});
+    ASSERT(res->matches == std::vector<uint64_t>{0b1000});
+
+    // Non-numeric values abort the comparison.
+    BSONColumnBuilder strings;
+    strings.append(createElementString("a"));
+    strings.append(createElementString("b"));
+    auto stringsBinData = strings.finalize();
+    ASSERT_FALSE(compareNumeric(static_cast<const char*>(stringsBinData.data),
+                                stringsBinData.length,
+                                NumericCompareOp::kEq,
+                                NumericComparand{.integer = 1, .floating = 1.0}));
+}
+
 }  // namespace
 }  // namespace mongo::bsoncolumn
@@ -539,7 +539,9 @@ protected:
         minSize += BufferAllocator::kBuffHolderSize;
 
         // We find the next power of two greater than the requested size, as it's
-        // commonly more friendly with the underlying (system) memory allocators.
+        // commonly more friendly with the underlying (system) memory allocators. Small buffers
+        // are not pooled here: the server's allocator already serves them from per-thread,
+        // size-classed caches, which is what a builder-level pool would duplicate.
         size_t reallocSize = 1ull << (64 - countLeadingZeros64(minSize - 1));
 
         // Even though allocating some memory between BSONObjMaxUserSize and
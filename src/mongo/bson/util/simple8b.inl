@@ -805,6 +805,34 @@ T decodeLastSlot(uint64_t encoded) {
     return 0;
 }
 
+// Returns the number of values repeated by an RLE block, 'encoded' must have its selector removed.
+inline size_t rleCount(uint64_t encoded) {
+    return ((encoded & 0xf) + 1) * simple8b_internal::kRleMultiplier;
+}
+
+// Visits 'lastValue' 'count' times, as an RLE block does with the last slot of the previous block.
+template <typename T, typename Visit, typename VisitZero, typename VisitMissing>
+inline size_t visitRepeated(T lastValue,
+                            size_t count,
+                            const Visit& visit,
+                            const VisitZero& visitZero,
+                            const VisitMissing& visitMissing) {
+    if (lastValue == kMissing) {
+        for (size_t i = 0; i < count; ++i) {
+            visitMissing();
+        }
+    } else if (lastValue == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            visitZero();
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            visit(lastValue);
+        }
+    }
+    return count;
+}
+
 // Decodes and visits all slots in simple8b block.
 template <typename T, typename Visit, typename VisitZero, typename VisitMissing>
 inline size_t decodeAndVisit(uint64_t encoded,
@@ -969,22 +997,11 @@ inline size_t decodeAndVisit(uint64_t encoded,
             return decoder60.visitAll<T>(encoded, visit, visitZero, visitMissing);
             break;
         case simple8b_internal::kRleSelector: {
-            const T lastValue = decodeLastSlot<T>(*prevNonRLE);
-            size_t count = ((encoded & 0xf) + 1) * simple8b_internal::kRleMultiplier;
-            if (lastValue == kMissing) {
-                for (size_t i = 0; i < count; ++i) {
-                    visitMissing();
-                }
-            } else if (lastValue == 0) {
-                for (size_t i = 0; i < count; ++i) {
-                    visitZero();
-                }
-            } else {
-                for (size_t i = 0; i < count; ++i) {
-                    visit(lastValue);
-                }
-            }
-            return count;
+            return visitRepeated<T>(decodeLastSlot<T>(*prevNonRLE),
+                                    rleCount(encoded),
+                                    visit,
+                                    visitZero,
+                                    visitMissing);
             break;
         }
         default:
@@ -1237,8 +1254,26 @@ inline size_t visitAll(const char* buffer,
     const char* end = buffer + size;
     while (buffer != end) {
         uint64_t encoded = ConstDataView(buffer).read<LittleEndian<uint64_t>>();
-        numVisited += decodeAndVisit<T>(encoded, &prevNonRLE, visit, visitZero, visitMissing);
         buffer += sizeof(uint64_t);
+        if ((encoded & simple8b_internal::kBaseSelectorMask) != simple8b_internal::kRleSelector) {
+            numVisited += decodeAndVisit<T>(encoded, &prevNonRLE, visit, visitZero, visitMissing);
+            continue;
+        }
+
+        // Every block in a run of RLE blocks repeats the last slot of the same previous block, so
+        // the run is counted up front and the repeated value is only decoded once.
+        size_t count = rleCount(encoded >> 4);
+        while (buffer != end) {
+            encoded = ConstDataView(buffer).read<LittleEndian<uint64_t>>();
+            if ((encoded & simple8b_internal::kBaseSelectorMask) !=
+                simple8b_internal::kRleSelector) {
+                break;
+            }
+            count += rleCount(encoded >> 4);
+            buffer += sizeof(uint64_t);
+        }
+        numVisited += visitRepeated<T>(
+            decodeLastSlot<T>(prevNonRLE), count, visit, visitZero, visitMissing);
     }
     return numVisited;
 }
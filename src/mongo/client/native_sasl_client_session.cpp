@@ -78,6 +78,7 @@ void cacheToBSON(SCRAMClientCache<HashBlock>* cache, StringData name, BSONObjBui
     sub.append("count", stats.count);
     sub.append("hits", stats.hits);
     sub.append("misses", stats.misses);
+    sub.append("sharedHits", stats.sharedHits);
 }
 
 /**
@@ -29,7 +29,10 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "mongo/crypto/mechanism_scram.h"
 #include "mongo/platform/mutex.h"
@@ -60,6 +63,11 @@ namespace mongo {
  * server is going to advertise the same salt value upon
  * reauthentication.  This might be useful for mobile clients where
  * CPU usage is a concern."
+ *
+ * The secrets are a pure function of the presecrets, so when the target host has no matching
+ * entry, the secrets recorded for another host with the same presecrets are reused. Members of a
+ * cluster authenticating with the same keyfile share their SCRAM parameters, which lets
+ * connections to a newly elected primary or a newly added shard member skip the computation.
  */
 template <typename HashBlock>
 class SCRAMClientCache {
@@ -67,6 +75,37 @@ private:
     using HostToSecretsPair = std::pair<scram::Presecrets<HashBlock>, scram::Secrets<HashBlock>>;
     using HostToSecretsMap = stdx::unordered_map<HostAndPort, HostToSecretsPair>;
 
+    /**
+     * Identifies the presecrets of the secrets shared by the hosts which advertise them.
+     */
+    struct ParametersKey {
+        explicit ParametersKey(const scram::Presecrets<HashBlock>& presecrets)
+            : salt(presecrets.getSalt()),
+              iterationCount(presecrets.getIterationCount()),
+              passwordDigest(presecrets.getPasswordDigest()) {}
+
+        bool operator==(const ParametersKey& other) const {
+            return salt == other.salt && iterationCount == other.iterationCount &&
+                passwordDigest == other.passwordDigest;
+        }
+
+        template <typename H>
+        friend H AbslHashValue(H h, const ParametersKey& key) {
+            return H::combine(std::move(h), key.salt, key.iterationCount, key.passwordDigest);
+        }
+
+        std::vector<std::uint8_t> salt;
+        size_t iterationCount;
+        HashBlock passwordDigest;
+    };
+
+    struct SharedSecrets {
+        scram::Secrets<HashBlock> secrets;
+        // Number of hosts whose entry has these parameters.
+        size_t hostCount{0};
+    };
+    using ParametersToSecretsMap = stdx::unordered_map<ParametersKey, SharedSecrets>;
+
 public:
     struct Stats {
         // Count of cache entries
@@ -75,36 +114,41 @@ public:
         int64_t hits{0};
         // Number of cache misses
         int64_t misses{0};
+        // Number of cache misses served by the secrets of another host with the same parameters
+        int64_t sharedHits{0};
     };
 
     /**
      * Returns precomputed SCRAMSecrets, if one has already been
      * stored for the specified hostname and the provided presecrets
-     * match those recorded for the hostname. Otherwise, no secrets
-     * are returned.
+     * match those recorded for the hostname, or failing that, if any
+     * other host has an entry for the same presecrets. Otherwise, no
+     * secrets are returned.
      */
     scram::Secrets<HashBlock> getCachedSecrets(
         const HostAndPort& target, const scram::Presecrets<HashBlock>& presecrets) const {
         const stdx::lock_guard<Latch> lock(_hostToSecretsMutex);
 
         // Search the cache for a record associated with the host we're trying to connect to.
-        auto foundSecret = _hostToSecrets.find(target);
-        if (foundSecret == _hostToSecrets.end()) {
-            ++_stats.misses;
-            return {};
-        }
-
         // Presecrets contain parameters provided by the server, which may change. If the
         // cached presecrets don't match the presecrets we have on hand, we must not return the
-        // stale cached secrets. We'll need to rerun the SCRAM computation.
-        const auto& foundPresecrets = foundSecret->second.first;
-        if (foundPresecrets == presecrets) {
+        // stale cached secrets.
+        auto foundSecret = _hostToSecrets.find(target);
+        if (foundSecret != _hostToSecrets.end() && foundSecret->second.first == presecrets) {
             ++_stats.hits;
             return foundSecret->second.second;
-        } else {
-            ++_stats.misses;
-            return {};
         }
+        ++_stats.misses;
+
+        // The host is unknown or its parameters changed. Another host may already have given us
+        // the same parameters, in which case the caller need not rerun the SCRAM computation.
+        auto foundShared = _parametersToSecrets.find(ParametersKey(presecrets));
+        if (foundShared != _parametersToSecrets.end()) {
+            ++_stats.sharedHits;
+            return foundShared->second.secrets;
+        }
+
+        return {};
     }
 
     /**
@@ -116,6 +160,11 @@ public:
                           scram::Secrets<HashBlock> secrets) {
         const stdx::lock_guard<Latch> lock(_hostToSecretsMutex);
 
+        ParametersKey key(presecrets);
+        auto& shared = _parametersToSecrets[key];
+        shared.secrets = secrets;
+        ++shared.hostCount;
+
         typename HostToSecretsMap::iterator it;
         bool insertionSuccessful;
         auto cacheRecord = std::make_pair(std::move(presecrets), std::move(secrets));
@@ -124,6 +173,7 @@ public:
         // If there was already a cache entry for the target HostAndPort, we should overwrite it.
         // We have fresher presecrets and secrets.
         if (!insertionSuccessful) {
+            _releaseSharedSecrets(ParametersKey(it->second.first));
             it->second = std::move(cacheRecord);
         }
     }
@@ -139,8 +189,23 @@ public:
     }
 
 private:
+    /**
+     * Drops a host's reference to the shared secrets for 'key', and the secrets themselves once
+     * no host refers to them.
+     */
+    void _releaseSharedSecrets(const ParametersKey& key) {
+        auto it = _parametersToSecrets.find(key);
+        invariant(it != _parametersToSecrets.end());
+        if (--it->second.hostCount == 0) {
+            _parametersToSecrets.erase(it);
+        }
+    }
+
     mutable Mutex _hostToSecretsMutex = MONGO_MAKE_LATCH("SCRAMClientCache::_hostToSecretsMutex");
     HostToSecretsMap _hostToSecrets;
+    // Secrets indexed by their parameters, so that hosts advertising the same parameters share
+    // them without a scan of '_hostToSecrets'.
+    ParametersToSecretsMap _parametersToSecrets;
     mutable Stats _stats;
 };
 
@@ -221,6 +221,14 @@ boost::optional<std::vector<ServerDescriptionPtr>> SdamServerSelector::selectSer
         // latency window should always leave at least one result
         invariant(results.size());
         std::shuffle(std::begin(results), std::end(results), _random.urbg());
+
+        // Callers use the first server, so ordering the first two random servers by round trip
+        // time picks the faster of two random choices. A slow server in the latency window then
+        // only comes first if it is paired with an even slower one.
+        if (sdamServerSelectionUsePowerOfTwoChoices.load() && results.size() > 1 &&
+            LatencyWindow::rttCompareFn(results[1], results[0])) {
+            std::swap(results[0], results[1]);
+        }
         return results;
     }
 
@@ -237,6 +245,9 @@ boost::optional<ServerDescriptionPtr> SdamServerSelector::selectServer(
     const ReadPreferenceSetting& criteria,
     const std::vector<HostAndPort>& excludedHosts) {
     auto servers = selectServers(topologyDescription, criteria, excludedHosts);
+    if (servers && sdamServerSelectionUsePowerOfTwoChoices.load()) {
+        return servers->front();
+    }
     return servers ? boost::optional<ServerDescriptionPtr>(_randomSelect(*servers)) : boost::none;
 }
 
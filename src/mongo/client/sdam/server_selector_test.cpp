@@ -49,6 +49,7 @@
 #include "mongo/client/sdam/topology_state_machine.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/wire_version.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
@@ -323,6 +324,56 @@ TEST_F(ServerSelectorTestFixture, ShouldSelectRandomlyWhenMultipleOptionsAreAvai
     ASSERT_FALSE(frequencyInfo[HostAndPort("s3")]);
 }
 
+TEST_F(ServerSelectorTestFixture, ShouldNotSelectSlowestServerWithPowerOfTwoChoices) {
+    RAIIServerParameterControllerForTest powerOfTwoChoices(
+        "sdamServerSelectionUsePowerOfTwoChoices", true);
+
+    TopologyStateMachine stateMachine(sdamConfiguration);
+    auto topologyDescription = std::make_shared<TopologyDescription>(sdamConfiguration);
+
+    const auto s0Latency = Milliseconds(1);
+    auto primary = ServerDescriptionBuilder()
+                       .withAddress(HostAndPort("s0"))
+                       .withType(ServerType::kRSPrimary)
+                       .withLastUpdateTime(Date_t::now())
+                       .withLastWriteDate(Date_t::now())
+                       .withRtt(s0Latency)
+                       .withSetName("set")
+                       .withHost(HostAndPort("s0"))
+                       .withHost(HostAndPort("s1"))
+                       .withHost(HostAndPort("s2"))
+                       .withMinWireVersion(WireVersion::SUPPORTS_OP_MSG)
+                       .withMaxWireVersion(WireVersion::LATEST_WIRE_VERSION)
+                       .withElectionId(kOidOne)
+                       .withSetVersion(100)
+                       .instance();
+    stateMachine.onServerDescription(*topologyDescription, primary);
+
+    const auto s1Latency = Milliseconds((s0Latency + sdamConfiguration.getLocalThreshold()) / 2);
+    stateMachine.onServerDescription(
+        *topologyDescription,
+        make_with_latency(s1Latency, HostAndPort("s1"), ServerType::kRSSecondary));
+
+    // s2 is in the latency window, but it is slower than both other servers.
+    const auto s2Latency = s0Latency + sdamConfiguration.getLocalThreshold();
+    stateMachine.onServerDescription(
+        *topologyDescription,
+        make_with_latency(s2Latency, HostAndPort("s2"), ServerType::kRSSecondary));
+
+    std::map<HostAndPort, int> frequencyInfo;
+    for (int i = 0; i < NUM_ITERATIONS; i++) {
+        auto servers = selector.selectServers(topologyDescription,
+                                              ReadPreferenceSetting(ReadPreference::Nearest));
+        ASSERT(servers);
+        ASSERT_EQ(servers->size(), 3u);
+        frequencyInfo[servers->front()->getAddress()]++;
+    }
+
+    ASSERT(frequencyInfo[HostAndPort("s0")]);
+    ASSERT(frequencyInfo[HostAndPort("s1")]);
+    ASSERT_FALSE(frequencyInfo[HostAndPort("s2")]);
+}
+
 TEST_F(ServerSelectorTestFixture, ShouldNotSelectExcludedHostsNearest) {
     TopologyStateMachine stateMachine(sdamConfiguration);
     auto topologyDescription = std::make_shared<TopologyDescription>(sdamConfiguration);
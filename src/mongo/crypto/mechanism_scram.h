@@ -113,6 +113,22 @@ public:
         return output;
     }
 
+    const std::vector<std::uint8_t>& getSalt() const {
+        return _salt;
+    }
+
+    size_t getIterationCount() const {
+        return _iterationCount;
+    }
+
+    /**
+     * Returns a digest of the password, which identifies it without the password itself.
+     */
+    HashBlock getPasswordDigest() const {
+        return HashBlock::computeHash(reinterpret_cast<const std::uint8_t*>(_password.data()),
+                                      _password.size());
+    }
+
     static std::vector<std::uint8_t> generateSecureRandomSalt() {
         std::vector<std::uint8_t> salt(saltLength());
         SecureRandom().fill(salt.data(), salt.size());
@@ -38,10 +38,13 @@
 #include <boost/move/utility_core.hpp>
 
 #include "mongo/db/service_context_test_fixture.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace {
@@ -63,5 +66,35 @@ DEATH_TEST_F(IngressAdmissionControllerTest,
         admissionController.admitOperation(opCtx.get()), AssertionException, 9143000);
 }
 
+TEST_F(IngressAdmissionControllerTest, RejectsOperationsOnceQueueIsFull) {
+    RAIIServerParameterControllerForTest maxQueueDepth{"ingressAdmissionControllerMaxQueueDepth",
+                                                       1};
+    auto opCtx = makeOperationContext();
+    auto& admissionController = IngressAdmissionController::get(opCtx.get());
+    admissionController.resizeTicketPool(opCtx.get(), 0);
+
+    // Queue one operation, which fills the queue.
+    stdx::thread waiter([&] {
+        auto client = getServiceContext()->getService()->makeClient("waiter");
+        auto waiterOpCtx = client->makeOperationContext();
+        auto ticket = admissionController.admitOperation(waiterOpCtx.get());
+    });
+    auto queueLength = [&] {
+        BSONObjBuilder stats;
+        admissionController.appendStats(stats);
+        return stats.obj()["normalPriority"]["queueLength"].numberLong();
+    };
+    while (queueLength() < 1) {
+        sleepmillis(1);
+    }
+
+    ASSERT_THROWS_CODE(admissionController.admitOperation(opCtx.get()),
+                       AssertionException,
+                       ErrorCodes::AdmissionQueueOverflow);
+
+    admissionController.resizeTicketPool(opCtx.get(), 1);
+    waiter.join();
+}
+
 }  // namespace
 }  // namespace mongo
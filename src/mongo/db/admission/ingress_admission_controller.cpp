@@ -34,7 +34,9 @@
 #include "mongo/db/admission/ingress_admission_context.h"
 #include "mongo/db/admission/ingress_admission_control_gen.h"
 #include "mongo/db/service_context.h"
+#include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/str.h"
 
 namespace mongo {
 
@@ -82,6 +84,16 @@ Ticket IngressAdmissionController::admitOperation(OperationContext* opCtx) {
         return std::move(*ticket);
     }
 
+    // Shed load rather than queue behind an already long line of operations, which would likely
+    // time out before being admitted anyway.
+    if (auto maxQueueDepth = gIngressAdmissionControllerMaxQueueDepth.load();
+        maxQueueDepth > 0 && _ticketHolder->queued() >= maxQueueDepth) {
+        _rejected.fetchAndAddRelaxed(1);
+        uasserted(ErrorCodes::AdmissionQueueOverflow,
+                  str::stream() << "Too many operations are waiting for ingress admission, "
+                                << "maximum queue depth is " << maxQueueDepth);
+    }
+
     return _ticketHolder->waitForTicket(opCtx, &admCtx);
 }
 
@@ -91,6 +103,7 @@ void IngressAdmissionController::resizeTicketPool(OperationContext* opCtx, int32
 
 void IngressAdmissionController::appendStats(BSONObjBuilder& b) const {
     _ticketHolder->appendStats(b);
+    b.append("totalRejected", _rejected.loadRelaxed());
 }
 
 Status IngressAdmissionController::onUpdateTicketPoolSize(int32_t newValue) try {
@@ -33,6 +33,7 @@
 
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/concurrency/admission_context.h"
 #include "mongo/util/concurrency/semaphore_ticketholder.h"
 
@@ -51,7 +52,8 @@ public:
      * Attempts to acquire an ingress admission ticket for the operation. Blocks until a ticket is
      * acquired, or the operation is interrupted, in which case it throws an AssertionException.
      * Operations with kExempt admission priority will always acquire a ticket without waiting and
-     * without reducing the number of available tickets.
+     * without reducing the number of available tickets. Throws AdmissionQueueOverflow instead of
+     * waiting if 'ingressAdmissionControllerMaxQueueDepth' operations are already queued.
      */
     Ticket admitOperation(OperationContext* opCtx);
 
@@ -79,6 +81,9 @@ public:
 
 private:
     std::unique_ptr<SemaphoreTicketHolder> _ticketHolder{nullptr};
+
+    // Number of operations rejected because the queue was at its maximum depth.
+    AtomicWord<int64_t> _rejected{0};
 };
 
 }  // namespace mongo
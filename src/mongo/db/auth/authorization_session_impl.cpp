@@ -871,9 +871,15 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
     _contract.addPrivilege(privilege);
 
     const auto& rp = privilege.getResourcePattern();
+    if (auto it = _authorizedActionsCache.find(rp); it != _authorizedActionsCache.end() &&
+        it->second.isSupersetOf(privilege.getActions())) {
+        return true;
+    }
+
     auth::ResourcePatternSearchList search(rp);
     ActionSet unmetRequirements = privilege.getActions();
-    for (const auto& priv : _getDefaultPrivileges()) {
+    const auto defaultPrivileges = _getDefaultPrivileges();
+    for (const auto& priv : defaultPrivileges) {
         for (auto patternIt = search.cbegin(); patternIt != search.cend(); ++patternIt) {
             if (priv.getResourcePattern() != *patternIt) {
                 continue;
@@ -896,10 +902,20 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
                        (user->getName().tenantId() != rp.tenantId()))) {
         return unmetRequirements.empty();
     }
-    return std::any_of(search.cbegin(), search.cend(), [&](const auto& pattern) {
+    const bool authorized = std::any_of(search.cbegin(), search.cend(), [&](const auto& pattern) {
         unmetRequirements.removeAllActionsFromSet(user->getActionsForResource(pattern));
         return unmetRequirements.empty();
     });
+
+    // Only remember grants that come from the authenticated user alone. The default privileges
+    // depend on the localhost exception, which can close without the user changing.
+    if (authorized && defaultPrivileges.empty()) {
+        if (_authorizedActionsCache.size() >= kMaxAuthorizedActionsCacheSize) {
+            _authorizedActionsCache.clear();
+        }
+        _authorizedActionsCache[rp].addAllActionsFromSet(privilege.getActions());
+    }
+    return authorized;
 }
 
 void AuthorizationSessionImpl::setImpersonatedUserData(const UserName& username,
@@ -1081,6 +1097,8 @@ void AuthorizationSessionImpl::verifyContract(const AuthorizationContract* contr
 }
 
 void AuthorizationSessionImpl::_updateInternalAuthorizationState() {
+    _authorizedActionsCache.clear();
+
     // Update the authenticated role names vector to reflect current state.
     _authenticatedRoleNames.clear();
     if (_authenticatedUser == boost::none) {
@@ -56,6 +56,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/time_support.h"
 
@@ -186,11 +187,17 @@ public:
         return _expirationTime;
     }
 
+    static constexpr size_t kMaxAuthorizedActionsCacheSize = 64;
+
+    size_t getAuthorizedActionsCacheSizeForTest() const {
+        return _authorizedActionsCache.size();
+    }
+
 protected:
     friend class AuthorizationSessionImplTestHelper;
 
     // Updates internal cached authorization state, i.e.:
-    // - _nonTenantClusterActions, see below.
+    // - _nonTenantClusterActions and _authorizedActionsCache, see below.
     // - _authenticatedRoleNames, which stores all roles held by users who are authenticated on this
     // connection.
     // - _authenticationMode -- we just update this to None if there are no users on the connection.
@@ -247,6 +254,12 @@ private:
     // It is a union of ClusterResource and AnyResource permissions.
     ActionSet _nonTenantClusterActions;
 
+    // Actions the authenticated user was found to be authorized for, per resource pattern, so that
+    // repeated checks skip the search over the user's privileges. Cleared whenever the
+    // authenticated user changes or is refreshed, and when it grows past
+    // kMaxAuthorizedActionsCacheSize entries.
+    stdx::unordered_map<ResourcePattern, ActionSet> _authorizedActionsCache;
+
     // The expiration time for this session, expressed as a Unix timestamp. After this time passes,
     // the session will be expired and requests will fail until the expiration time is refreshed.
     // If boost::none, then the session never expires (default behavior).
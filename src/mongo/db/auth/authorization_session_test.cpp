@@ -32,6 +32,7 @@
 #include <initializer_list>
 #include <memory>
 #include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -398,6 +399,96 @@ TEST_F(AuthorizationSessionTest, InvalidateUserByNameWithMechanismData) {
     testInvalidateUser(std::move(mechanismData));
 }
 
+TEST_F(AuthorizationSessionTest, AuthorizedActionsCacheDropsRevokedRoles) {
+    ASSERT_OK(createUser(kSpencerTest, {{"readWrite", "test"}}));
+    ASSERT_OK(authzSession->addAndAuthorizeUser(_opCtx.get(), kSpencerTestRequest, boost::none));
+    ASSERT_TRUE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::insert));
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 1U);
+
+    // Revoke the write privileges and invalidate the user, so that the next request refreshes it.
+    int ignored;
+    ASSERT_OK(managerState->remove(
+        _opCtx.get(), NamespaceString::kAdminUsersNamespace, BSONObj(), BSONObj(), &ignored));
+    ASSERT_OK(createUser(kSpencerTest, {{"read", "test"}}));
+    AuthorizationManager::get(_opCtx->getService())->invalidateUserByName(kSpencerTest);
+    authzSession->startRequest(_opCtx.get());
+
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 0U);
+    ASSERT_FALSE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::insert));
+    ASSERT_TRUE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::find));
+    authzSession->logoutDatabase(_client.get(), kTestDB, "Kill the test!"_sd);
+}
+
+TEST_F(AuthorizationSessionTest, AuthorizedActionsCacheIsClearedOnLogout) {
+    ASSERT_OK(createUser(kUser1Test, {{"readWrite", "test"}}));
+    ASSERT_OK(createUser(kUser2Test, {{"read", "test"}}));
+    ASSERT_OK(authzSession->addAndAuthorizeUser(_opCtx.get(), kUser1TestRequest, boost::none));
+    ASSERT_TRUE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::insert));
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 1U);
+
+    authzSession->logoutDatabase(_client.get(), kTestDB, "Log out user1"_sd);
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 0U);
+    ASSERT_FALSE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::insert));
+
+    // The next user must not be granted what was cached for the previous one.
+    ASSERT_OK(authzSession->addAndAuthorizeUser(_opCtx.get(), kUser2TestRequest, boost::none));
+    ASSERT_FALSE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::insert));
+    ASSERT_TRUE(
+        authzSession->isAuthorizedForActionsOnResource(testFooCollResource, ActionType::find));
+    authzSession->logoutDatabase(_client.get(), kTestDB, "Kill the test!"_sd);
+}
+
+TEST_F(AuthorizationSessionTest, AuthorizedActionsCacheIgnoresLocalhostException) {
+    ASSERT_OK(createUser(kSpencerTest, {{"read", "admin"}}));
+    ASSERT_OK(authzSession->addAndAuthorizeUser(_opCtx.get(), kSpencerTestRequest, boost::none));
+
+    // 'find' comes from the user, while 'createUser' is only granted by the localhost exception.
+    const auto adminDBResource = ResourcePattern::forDatabaseName(DatabaseName::kAdmin);
+    const ActionSet actions{ActionType::find, ActionType::createUser};
+    sessionState->setReturnValueForShouldAllowLocalhost(true);
+    ASSERT_TRUE(authzSession->isAuthorizedForActionsOnResource(adminDBResource, actions));
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 0U);
+
+    // Once the localhost exception closes, the user alone is not authorized.
+    sessionState->setReturnValueForShouldAllowLocalhost(false);
+    ASSERT_FALSE(authzSession->isAuthorizedForActionsOnResource(adminDBResource, actions));
+    ASSERT_TRUE(authzSession->isAuthorizedForActionsOnResource(adminDBResource, ActionType::find));
+    authzSession->logoutDatabase(_client.get(), kTestDB, "Kill the test!"_sd);
+}
+
+TEST_F(AuthorizationSessionTest, AuthorizedActionsCacheIsClearedWhenFull) {
+    ASSERT_OK(createUser(kSpencerTest, {{"readWrite", "test"}}));
+    ASSERT_OK(authzSession->addAndAuthorizeUser(_opCtx.get(), kSpencerTestRequest, boost::none));
+
+    const auto collResource = [](size_t i) {
+        return ResourcePattern::forExactNamespace(
+            NamespaceString::createNamespaceString_forTest(testDB, "coll" + std::to_string(i)));
+    };
+    constexpr auto kMaxSize = AuthorizationSessionImpl::kMaxAuthorizedActionsCacheSize;
+    for (size_t i = 0; i < kMaxSize; ++i) {
+        ASSERT_TRUE(
+            authzSession->isAuthorizedForActionsOnResource(collResource(i), ActionType::insert));
+    }
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), kMaxSize);
+
+    // The next grant clears the full cache before being remembered.
+    ASSERT_TRUE(
+        authzSession->isAuthorizedForActionsOnResource(collResource(kMaxSize), ActionType::insert));
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 1U);
+
+    // Grants which were dropped from the cache are still found by searching the user privileges.
+    ASSERT_TRUE(
+        authzSession->isAuthorizedForActionsOnResource(collResource(0), ActionType::insert));
+    ASSERT_EQ(authzSession->getAuthorizedActionsCacheSizeForTest(), 2U);
+    authzSession->logoutDatabase(_client.get(), kTestDB, "Kill the test!"_sd);
+}
+
 TEST_F(AuthorizationSessionTest, UseOldUserInfoInFaceOfConnectivityProblems) {
     // Add a readWrite user
     ASSERT_OK(createUser({"spencer", "test"}, {{"readWrite", "test"}}));
@@ -636,9 +636,8 @@ void testSetAndGetWithDifferentParameters() {
     cache.setCachedSecrets(host, presecrets, secrets);
     ASSERT_TRUE(cache.getCachedSecrets(host, presecrets));
 
-    // Alter each of: host, password, salt, iterationCount.
+    // Alter each of: password, salt, iterationCount.
     // Any one of which should fail to retreive from cache.
-    ASSERT_FALSE(cache.getCachedSecrets(HostAndPort("localhost:27018"), presecrets));
     ASSERT_FALSE(cache.getCachedSecrets(host, scram::Presecrets<HashBlock>("aab", salt, 10000)));
     const auto badSalt = scram::Presecrets<HashBlock>::generateSecureRandomSalt();
     ASSERT_FALSE(cache.getCachedSecrets(host, scram::Presecrets<HashBlock>("aaa", badSalt, 10000)));
@@ -650,6 +649,43 @@ TEST(SCRAMCache, testSetAndGetWithDifferentParameters) {
     testSetAndGetWithDifferentParameters<SHA256Block>();
 }
 
+template <typename HashBlock>
+void testGetForOtherHostWithSameParameters() {
+    SCRAMClientCache<HashBlock> cache;
+    const auto salt = scram::Presecrets<HashBlock>::generateSecureRandomSalt();
+    HostAndPort host("localhost:27017");
+    HostAndPort otherHost("localhost:27018");
+
+    const auto presecrets = scram::Presecrets<HashBlock>("aaa", salt, 10000);
+    const auto secrets = scram::Secrets<HashBlock>(presecrets);
+    cache.setCachedSecrets(host, presecrets, secrets);
+
+    // Another host advertising the same parameters reuses the computed secrets.
+    const auto cachedSecrets = cache.getCachedSecrets(otherHost, presecrets);
+    ASSERT_TRUE(cachedSecrets);
+    ASSERT_TRUE(secrets.clientKey() == cachedSecrets.clientKey());
+    ASSERT_TRUE(secrets.serverKey() == cachedSecrets.serverKey());
+    ASSERT_TRUE(secrets.storedKey() == cachedSecrets.storedKey());
+
+    // But not when its parameters differ.
+    const auto otherSalt = scram::Presecrets<HashBlock>::generateSecureRandomSalt();
+    ASSERT_FALSE(
+        cache.getCachedSecrets(otherHost, scram::Presecrets<HashBlock>("aaa", otherSalt, 10000)));
+
+    // Only lookups served by the target host's own entry count as hits.
+    ASSERT_TRUE(cache.getCachedSecrets(host, presecrets));
+    const auto stats = cache.getStats();
+    ASSERT_EQ(stats.count, 1);
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 2);
+    ASSERT_EQ(stats.sharedHits, 1);
+}
+
+TEST(SCRAMCache, testGetForOtherHostWithSameParameters) {
+    testGetForOtherHostWithSameParameters<SHA1Block>();
+    testGetForOtherHostWithSameParameters<SHA256Block>();
+}
+
 template <typename HashBlock>
 void testSetAndReset() {
     SCRAMClientCache<HashBlock> cache;
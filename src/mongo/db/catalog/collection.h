@@ -317,6 +317,11 @@ public:
 
     virtual bool requiresIdIndex() const = 0;
 
+    /**
+     * Reads the document at 'loc' from the storage engine in the operation's snapshot. Documents
+     * are not cached above the storage engine: which version of a document is visible depends on
+     * each reader's snapshot and read timestamp, so a shared copy could not be handed out safely.
+     */
     virtual Snapshotted<BSONObj> docFor(OperationContext* opCtx, const RecordId& loc) const = 0;
 
     /**
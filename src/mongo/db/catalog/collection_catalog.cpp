@@ -77,6 +77,7 @@
 #include "mongo/logv2/log_tag.h"
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/compiler.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/rwmutex.h"
 #include "mongo/stdx/condition_variable.h"
@@ -106,31 +107,66 @@ const SharedCollectionDecorations::Decoration<AtomicWord<bool>>
 namespace {
 constexpr auto kNumDurableCatalogScansDueToMissingMapping = "numScansDueToMissingMapping"_sd;
 
+// Versions are unique across all LatestCollectionCatalog instances, so that a lease taken from one
+// ServiceContext is never mistaken for a lease on another.
+AtomicWord<uint64_t> nextLatestCatalogVersion{1};
+
 class LatestCollectionCatalog {
 public:
+    /**
+     * A reference to the latest catalog as of a version. The catalog is held through a control
+     * block owned by the lease holder, so that copying it only touches a reference count private to
+     * the holder instead of the one shared by every reader of the catalog.
+     */
+    struct Lease {
+        uint64_t version = 0;
+        std::shared_ptr<CollectionCatalog> catalog;
+    };
+
     std::shared_ptr<CollectionCatalog> load() const {
         std::shared_lock lk(_mutex);  // NOLINT
         return _catalog;
     }
 
+    Lease renew() const {
+        Lease lease;
+        std::shared_ptr<CollectionCatalog> catalog;
+        {
+            std::shared_lock lk(_mutex);  // NOLINT
+            lease.version = _version.load();
+            catalog = _catalog;
+        }
+        auto holder = std::make_shared<std::shared_ptr<CollectionCatalog>>(std::move(catalog));
+        lease.catalog = std::shared_ptr<CollectionCatalog>(holder, holder->get());
+        return lease;
+    }
+
+    bool isStale(const Lease& lease) const {
+        return lease.version != _version.load();
+    }
+
     bool compareAndSet(const std::shared_ptr<CollectionCatalog>& oldCatalog,
                        std::shared_ptr<CollectionCatalog>&& newCatalog) {
         std::lock_guard lk(_mutex);
         if (oldCatalog != _catalog)
             return false;
         _catalog = std::move(newCatalog);
+        _version.store(nextLatestCatalogVersion.fetchAndAdd(1));
         return true;
     }
 
     void store(std::shared_ptr<CollectionCatalog>&& newCatalog) {
         std::lock_guard lk(_mutex);
         _catalog = std::move(newCatalog);
+        _version.store(nextLatestCatalogVersion.fetchAndAdd(1));
     }
 
 private:
     mutable RWMutex _mutex;
     // TODO SERVER-56428: Replace with std::atomic<std::shared_ptr> when supported in our toolchain
     std::shared_ptr<CollectionCatalog> _catalog = std::make_shared<CollectionCatalog>();
+    // Changes every time '_catalog' does. Only written while holding '_mutex' exclusively.
+    AtomicWord<uint64_t> _version{nextLatestCatalogVersion.fetchAndAdd(1)};
 };
 const ServiceContext::Decoration<LatestCollectionCatalog> getCatalogStore =
     ServiceContext::declareDecoration<LatestCollectionCatalog>();
@@ -138,6 +174,12 @@ const ServiceContext::Decoration<LatestCollectionCatalog> getCatalogStore =
 const RecoveryUnit::Snapshot::Decoration<std::shared_ptr<const CollectionCatalog>> stashedCatalog =
     RecoveryUnit::Snapshot::declareDecoration<std::shared_ptr<const CollectionCatalog>>();
 
+// Lease on the latest catalog for the lifetime of a storage snapshot. Tying it to the snapshot
+// rather than to the thread or operation means an idle operation never keeps an old catalog, and
+// the collections dropped from it, alive.
+const RecoveryUnit::Snapshot::Decoration<LatestCollectionCatalog::Lease> latestCatalogLease =
+    RecoveryUnit::Snapshot::declareDecoration<LatestCollectionCatalog::Lease>();
+
 /**
  * Returns true if the collection is compatible with the read timestamp.
  */
@@ -566,7 +608,12 @@ std::shared_ptr<const CollectionCatalog> CollectionCatalog::get(OperationContext
 }
 
 std::shared_ptr<const CollectionCatalog> CollectionCatalog::latest(OperationContext* opCtx) {
-    return latest(opCtx->getServiceContext());
+    const auto& storage = getCatalogStore(opCtx->getServiceContext());
+    auto& lease = latestCatalogLease(shard_role_details::getRecoveryUnit(opCtx)->getSnapshot());
+    if (MONGO_unlikely(storage.isStale(lease))) {
+        lease = storage.renew();
+    }
+    return lease.catalog;
 }
 
 void CollectionCatalog::stash(OperationContext* opCtx,
@@ -36,6 +36,7 @@
 
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
 
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/catalog/collection.h"
@@ -49,6 +50,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/uuid.h"
 
@@ -171,6 +173,36 @@ void BM_CollectionCatalogLookupCollectionByUUID(benchmark::State& state) {
     }
 }
 
+void BM_CollectionCatalogLookupCollectionByNamespaceMultiThreaded(benchmark::State& state) {
+    constexpr int kNumCollections = 1000;
+    const NamespaceString nss = NamespaceString::createNamespaceString_forTest(
+        "collection_catalog_bm", std::to_string(kNumCollections / 2));
+
+    // The first thread sets up the catalog shared by all threads. The others can only make their
+    // clients once the benchmark loop starts, which is after the first thread finished the setup.
+    static ServiceContext* serviceContext = nullptr;
+    if (state.thread_index == 0) {
+        serviceContext = setupServiceContext();
+        ThreadClient threadClient(serviceContext->getService());
+        createCollections(threadClient->makeOperationContext().get(), kNumCollections);
+    }
+
+    boost::optional<ThreadClient> threadClient;
+    ServiceContext::UniqueOperationContext opCtx;
+    for (auto _ : state) {
+        if (MONGO_unlikely(!opCtx)) {
+            state.PauseTiming();
+            threadClient.emplace(serviceContext->getService());
+            opCtx = (*threadClient)->makeOperationContext();
+            state.ResumeTiming();
+        }
+        benchmark::ClobberMemory();
+        auto coll =
+            CollectionCatalog::get(opCtx.get())->lookupCollectionByNamespace(opCtx.get(), nss);
+        invariant(coll);
+    }
+}
+
 void BM_CollectionCatalogIterateCollections(benchmark::State& state) {
     auto serviceContext = setupServiceContext();
     ThreadClient threadClient(serviceContext->getService());
@@ -194,6 +226,7 @@ BENCHMARK(BM_CollectionCatalogCreateDropCollection)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_CollectionCatalogCreateNCollections)->Ranges({{{1}, {32'768}}});
 BENCHMARK(BM_CollectionCatalogLookupCollectionByNamespace)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_CollectionCatalogLookupCollectionByUUID)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogLookupCollectionByNamespaceMultiThreaded)->ThreadRange(1, 64);
 BENCHMARK(BM_CollectionCatalogIterateCollections)->Ranges({{{1}, {100'000}}});
 
 }  // namespace mongo
@@ -387,6 +387,28 @@ TEST_F(CollectionCatalogTest, InsertAfterLookup) {
     ASSERT_EQUALS(*catalog.lookupNSSByUUID(opCtx.get(), colUUID), nss);
 }
 
+TEST_F(CollectionCatalogTest, LatestIsLeasedForTheSnapshot) {
+    auto first = CollectionCatalog::latest(opCtx.get());
+    ASSERT_EQ(CollectionCatalog::latest(opCtx.get()), first);
+    const auto* firstCatalog = first.get();
+    std::weak_ptr<const CollectionCatalog> firstLease = first;
+    first.reset();
+
+    // A write makes the lease stale, and renewing it releases the old one.
+    CollectionCatalog::write(opCtx.get(), [](CollectionCatalog&) {});
+    auto second = CollectionCatalog::latest(opCtx.get());
+    ASSERT_NE(second.get(), firstCatalog);
+    ASSERT_EQ(second, CollectionCatalog::latest(getServiceContext()));
+    ASSERT_TRUE(firstLease.expired());
+
+    // The lease does not outlive the snapshot.
+    std::weak_ptr<const CollectionCatalog> secondLease = second;
+    second.reset();
+    ASSERT_FALSE(secondLease.expired());
+    shard_role_details::getRecoveryUnit(opCtx.get())->abandonSnapshot();
+    ASSERT_TRUE(secondLease.expired());
+}
+
 TEST_F(CollectionCatalogTest, OnDropCollection) {
     CollectionPtr yieldableColl(catalog.lookupCollectionByUUID(opCtx.get(), colUUID));
     ASSERT(yieldableColl);
@@ -45,6 +45,8 @@
 #include <boost/optional/optional.hpp>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/base/init.h"  // IWYU pragma: keep
+#include "mongo/base/initializer.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/simple_bsonelement_comparator.h"
 #include "mongo/bson/timestamp.h"
@@ -91,11 +93,14 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/future.h"
 #include "mongo/util/log_and_backoff.h"
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/scopeguard.h"
@@ -194,6 +199,36 @@ bool shouldRelaxConstraints(OperationContext* opCtx, const CollectionPtr& collec
     return !isPrimary;
 }
 
+// Bounds on the documents a collection scan buffers before generating their keys concurrently.
+constexpr size_t kKeyGenerationBatchMaxDocs = 1000;
+constexpr size_t kKeyGenerationBatchMaxBytes = 16 * 1024 * 1024;
+
+// Generates the keys of index builds concurrently. It is started and shut down with the
+// ServiceContext.
+const auto keyGenerationThreadPool =
+    ServiceContext::declareDecoration<std::unique_ptr<ThreadPool>>();
+const ServiceContext::ConstructorActionRegisterer keyGenerationThreadPoolRegisterer{
+    "IndexBuildKeyGenerationThreadPool",
+    [](ServiceContext* service) {
+        ThreadPool::Options options;
+        options.poolName = "IndexBuildKeyGeneration";
+        options.threadNamePrefix = "IndexBuildKeyGeneration-";
+        options.minThreads = 0;
+        options.maxThreads = 64;
+        options.onCreateThread = [service](const std::string& name) {
+            Client::initThread(name, service->getService(ClusterRole::ShardServer));
+        };
+        keyGenerationThreadPool(service) = std::make_unique<ThreadPool>(std::move(options));
+        keyGenerationThreadPool(service)->startup();
+    },
+    [](ServiceContext* service) {
+        if (auto& pool = keyGenerationThreadPool(service)) {
+            pool->shutdown();
+            pool->join();
+            pool.reset();
+        }
+    }};
+
 }  // namespace
 
 MultiIndexBlock::~MultiIndexBlock() {
@@ -738,6 +773,39 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
     const auto onSuppressedError =
         makeOnSuppressedErrorFn(saveCursorBeforeWrite, restoreCursorAfterWrite);
 
+    // When building several indexes, the scanned documents are buffered into batches whose keys
+    // are generated concurrently for the different indexes.
+    const size_t numKeyGenerationThreads = std::min(
+        static_cast<size_t>(maxIndexBuildKeyGenerationThreads.load()), _indexes.size());
+    std::vector<BSONObj> batchDocs;
+    std::vector<RecordId> batchLocs;
+    size_t batchBytes = 0;
+    auto insertBatch = [&] {
+        uassertStatusOK(_insertBatch(opCtx,
+                                     collection,
+                                     batchDocs,
+                                     batchLocs,
+                                     numKeyGenerationThreads,
+                                     onSuppressedError,
+                                     shouldRelaxConstraints));
+
+        for (const auto& doc : batchDocs) {
+            _failPointHangDuringBuild(opCtx,
+                                      &hangIndexBuildDuringCollectionScanPhaseAfterInsertion,
+                                      "after",
+                                      doc,
+                                      progress->get(WithLock::withoutLock())->hits())
+                .ignore();
+
+            stdx::unique_lock<Client> lk(*opCtx->getClient());
+            progress->get(lk)->hit();
+        }
+
+        batchDocs.clear();
+        batchLocs.clear();
+        batchBytes = 0;
+    };
+
     RecordId loc;
     PlanExecutor::ExecState state;
     while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
@@ -753,12 +821,25 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
             progress->get(lk)->setTotalWhileRunning(collection->numRecords(opCtx));
         }
 
-        uassertStatusOK(
-            _failPointHangDuringBuild(opCtx,
-                                      &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
-                                      "before",
-                                      objToIndex,
-                                      progress->get(WithLock::withoutLock())->hits()));
+        uassertStatusOK(_failPointHangDuringBuild(
+            opCtx,
+            &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
+            "before",
+            objToIndex,
+            progress->get(WithLock::withoutLock())->hits() + batchDocs.size()));
+
+        if (numKeyGenerationThreads > 1) {
+            // The buffered documents must outlive the cursor positions they were read at.
+            _prepareInsert(opCtx, collection, objToIndex, loc);
+            batchBytes += objToIndex.objsize();
+            batchDocs.push_back(objToIndex.getOwned());
+            batchLocs.push_back(loc);
+            if (batchDocs.size() >= kKeyGenerationBatchMaxDocs ||
+                batchBytes >= kKeyGenerationBatchMaxBytes) {
+                insertBatch();
+            }
+            continue;
+        }
 
         // The external sorter is not part of the storage engine and therefore does not need
         // a WriteUnitOfWork to write keys. In case there are constraint violations being
@@ -784,6 +865,10 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
             progress->get(lk)->hit();
         }
     }
+
+    if (!batchDocs.empty()) {
+        insertBatch();
+    }
 }
 
 Status MultiIndexBlock::insertSingleDocumentForInitialSyncOrRecovery(
@@ -807,6 +892,43 @@ Status MultiIndexBlock::_insert(
     const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints) {
     invariant(!_buildIsCleanedUp);
 
+    _prepareInsert(opCtx, collection, doc, loc);
+
+    for (size_t i = 0; i < _indexes.size(); i++) {
+        if (_indexes[i].filterExpression && !_indexes[i].filterExpression->matchesBSON(doc)) {
+            continue;
+        }
+
+        Status idxStatus = Status::OK();
+
+        // When calling insert, BulkBuilderImpl's Sorter performs file I/O that may result in an
+        // exception.
+        try {
+            idxStatus = _indexes[i].bulk->insert(opCtx,
+                                                 collection,
+                                                 _indexes[i].entryForScan,
+                                                 doc,
+                                                 loc,
+                                                 _indexes[i].options,
+                                                 onSuppressedError,
+                                                 shouldRelaxConstraints);
+        } catch (...) {
+            return exceptionToStatus();
+        }
+
+        if (!idxStatus.isOK())
+            return idxStatus;
+    }
+
+    _lastRecordIdInserted = loc;
+
+    return Status::OK();
+}
+
+void MultiIndexBlock::_prepareInsert(OperationContext* opCtx,
+                                     const CollectionPtr& collection,
+                                     const BSONObj& doc,
+                                     const RecordId& loc) {
     // The detection of mixed-schema data needs to be done before applying the partial filter
     // expression below. Only check for mixed-schema data if it's possible for the time-series
     // collection to have it.
@@ -838,34 +960,149 @@ Status MultiIndexBlock::_insert(
             _indexes[i].entryForScan = _indexes[i].block->getEntry(opCtx, collection);
         }
     }
+}
 
+Status MultiIndexBlock::_insertBatch(
+    OperationContext* opCtx,
+    const CollectionPtr& collection,
+    const std::vector<BSONObj>& docs,
+    const std::vector<RecordId>& locs,
+    size_t numThreads,
+    const IndexAccessMethod::OnSuppressedErrorFn& onSuppressedError,
+    const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints) {
+    invariant(!_buildIsCleanedUp);
+    invariant(docs.size() == locs.size());
+
+    // Partial indexes only get the documents matching their filter. The filters are evaluated here
+    // so that the worker threads only ever generate keys.
+    std::vector<std::vector<BSONObj>> filteredDocs(_indexes.size());
+    std::vector<std::vector<RecordId>> filteredLocs(_indexes.size());
     for (size_t i = 0; i < _indexes.size(); i++) {
-        if (_indexes[i].filterExpression && !_indexes[i].filterExpression->matchesBSON(doc)) {
+        if (!_indexes[i].filterExpression) {
             continue;
         }
+        for (size_t j = 0; j < docs.size(); j++) {
+            if (_indexes[i].filterExpression->matchesBSON(docs[j])) {
+                filteredDocs[i].push_back(docs[j]);
+                filteredLocs[i].push_back(locs[j]);
+            }
+        }
+    }
+    auto docsFor = [&](size_t i) -> const std::vector<BSONObj>& {
+        return _indexes[i].filterExpression ? filteredDocs[i] : docs;
+    };
+    auto locsFor = [&](size_t i) -> const std::vector<RecordId>& {
+        return _indexes[i].filterExpression ? filteredLocs[i] : locs;
+    };
 
-        Status idxStatus = Status::OK();
+    // Task t generates the keys of every index i such that i % numTasks == t. The first task runs
+    // on this thread, the other ones on the key generation pool.
+    const size_t numTasks = std::min(std::max(numThreads, static_cast<size_t>(1)), _indexes.size());
+    std::vector<size_t> numInserted(_indexes.size(), 0);
+    auto generateKeys = [&](OperationContext* taskOpCtx, size_t task) {
+        for (size_t i = task; i < _indexes.size(); i += numTasks) {
+            numInserted[i] = _indexes[i].bulk->insertConcurrently(
+                taskOpCtx, collection, _indexes[i].entryForScan, docsFor(i), locsFor(i));
+        }
+    };
 
-        // When calling insert, BulkBuilderImpl's Sorter performs file I/O that may result in an
-        // exception.
-        try {
-            idxStatus = _indexes[i].bulk->insert(opCtx,
-                                                 collection,
-                                                 _indexes[i].entryForScan,
-                                                 doc,
-                                                 loc,
-                                                 _indexes[i].options,
-                                                 onSuppressedError,
-                                                 shouldRelaxConstraints);
-        } catch (...) {
-            return exceptionToStatus();
+    // The other tasks run on operations of their own, which are killed when this operation is
+    // interrupted or fails, so that they stop generating keys that will not be used.
+    auto mutex = MONGO_MAKE_LATCH("MultiIndexBlock::_insertBatch");
+    std::vector<OperationContext*> taskOpCtxs;
+    boost::optional<ErrorCodes::Error> killCode;
+    auto killTaskOpCtx = [&](WithLock, OperationContext* taskOpCtx) {
+        ClientLock clientLock(taskOpCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, taskOpCtx, *killCode);
+    };
+    auto killTasks = [&](const Status& status) {
+        stdx::lock_guard lk(mutex);
+        killCode = ErrorCodes::isInterruption(status.code()) ? status.code()
+                                                             : ErrorCodes::Interrupted;
+        for (auto taskOpCtx : taskOpCtxs) {
+            killTaskOpCtx(lk, taskOpCtx);
         }
+    };
 
-        if (!idxStatus.isOK())
-            return idxStatus;
+    auto& pool = keyGenerationThreadPool(opCtx->getServiceContext());
+    std::vector<Future<void>> futures;
+    for (size_t task = 1; task < numTasks; task++) {
+        auto pf = makePromiseFuture<void>();
+        pool->schedule([&, task, promise = std::move(pf.promise)](Status status) mutable {
+            promise.setWith([&] {
+                uassertStatusOK(status);
+                auto taskOpCtx = cc().makeOperationContext();
+                {
+                    stdx::lock_guard lk(mutex);
+                    taskOpCtxs.push_back(taskOpCtx.get());
+                    if (killCode) {
+                        killTaskOpCtx(lk, taskOpCtx.get());
+                    }
+                }
+                ON_BLOCK_EXIT([&] {
+                    stdx::lock_guard lk(mutex);
+                    taskOpCtxs.erase(
+                        std::find(taskOpCtxs.begin(), taskOpCtxs.end(), taskOpCtx.get()));
+                });
+                generateKeys(taskOpCtx.get(), task);
+            });
+        });
+        futures.push_back(std::move(pf.future));
     }
 
-    _lastRecordIdInserted = loc;
+    // The tasks reference this frame, so they must all complete before returning.
+    Status status = Status::OK();
+    try {
+        generateKeys(opCtx, 0);
+    } catch (...) {
+        status = exceptionToStatus();
+        killTasks(status);
+    }
+    for (auto& future : futures) {
+        if (status.isOK()) {
+            if (auto waitStatus = future.waitNoThrow(opCtx); !waitStatus.isOK()) {
+                status = std::move(waitStatus);
+                killTasks(status);
+            }
+        }
+        auto taskStatus = future.getNoThrow();
+        if (status.isOK() && !taskStatus.isOK()) {
+            status = std::move(taskStatus);
+            killTasks(status);
+        }
+    }
+    if (!status.isOK()) {
+        return status;
+    }
+
+    // Insert the documents whose keys could not be generated concurrently, and all the ones after
+    // them, on this thread where key generation errors can be handled.
+    for (size_t i = 0; i < _indexes.size(); i++) {
+        const auto& indexDocs = docsFor(i);
+        const auto& indexLocs = locsFor(i);
+        for (size_t j = numInserted[i]; j < indexDocs.size(); j++) {
+            Status idxStatus = Status::OK();
+            try {
+                idxStatus = _indexes[i].bulk->insert(opCtx,
+                                                     collection,
+                                                     _indexes[i].entryForScan,
+                                                     indexDocs[j],
+                                                     indexLocs[j],
+                                                     _indexes[i].options,
+                                                     onSuppressedError,
+                                                     shouldRelaxConstraints);
+            } catch (...) {
+                return exceptionToStatus();
+            }
+
+            if (!idxStatus.isOK())
+                return idxStatus;
+        }
+    }
+
+    if (!locs.empty()) {
+        _lastRecordIdInserted = locs.back();
+    }
 
     return Status::OK();
 }
@@ -360,6 +360,27 @@ private:
         const IndexAccessMethod::OnSuppressedErrorFn& onSuppressedError,
         const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr);
 
+    /**
+     * Does the per-document work of _insert() that is independent of the indexes being built.
+     */
+    void _prepareInsert(OperationContext* opCtx,
+                        const CollectionPtr& collection,
+                        const BSONObj& wholeDocument,
+                        const RecordId& loc);
+
+    /**
+     * Inserts a batch of documents, already passed to _prepareInsert(), into the bulk builders of
+     * all the indexes. The keys of up to 'numThreads' indexes are generated concurrently, the
+     * bulk builders of different indexes sharing no state.
+     */
+    Status _insertBatch(OperationContext* opCtx,
+                        const CollectionPtr& collection,
+                        const std::vector<BSONObj>& docs,
+                        const std::vector<RecordId>& locs,
+                        size_t numThreads,
+                        const IndexAccessMethod::OnSuppressedErrorFn& onSuppressedError,
+                        const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints);
+
     /**
      * Performs a collection scan on the given collection and inserts the relevant index keys into
      * the external sorter.
@@ -41,10 +41,12 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
@@ -214,5 +216,69 @@ TEST_F(MultiIndexBlockTest, InitWriteConflictException) {
     indexer->abortIndexBuild(operationContext(), coll, MultiIndexBlock::kNoopOnCleanUpFn);
 }
 
+TEST_F(MultiIndexBlockTest, GenerateKeysConcurrently) {
+    RAIIServerParameterControllerForTest keyGenerationThreads("maxIndexBuildKeyGenerationThreads",
+                                                              3);
+
+    // Enough documents for several key generation batches.
+    const int numDocs = 2500;
+    std::vector<InsertStatement> docs;
+    for (int i = 0; i < numDocs; ++i) {
+        docs.emplace_back(
+            BSON("_id" << i << "a" << i << "b" << BSON_ARRAY(i << -i) << "c" << i % 2));
+    }
+    ASSERT_OK(storageInterface()->insertDocuments(operationContext(), getNSS(), docs));
+
+    auto indexer = getIndexer();
+    indexer->setIndexBuildMethod(IndexBuildMethod::kForeground);
+
+    AutoGetCollection autoColl(operationContext(), getNSS(), MODE_X);
+    CollectionWriter coll(operationContext(), autoColl);
+
+    const auto version = static_cast<int>(IndexDescriptor::kLatestIndexVersion);
+    std::vector<BSONObj> specs = {
+        BSON("key" << BSON("a" << 1) << "name"
+                   << "a_1"
+                   << "v" << version),
+        BSON("key" << BSON("b" << 1) << "name"
+                   << "b_1"
+                   << "v" << version),
+        BSON("key" << BSON("c" << 1) << "name"
+                   << "c_1"
+                   << "v" << version << "partialFilterExpression" << BSON("c" << 1))};
+    {
+        WriteUnitOfWork wunit(operationContext());
+        ASSERT_OK(
+            indexer->init(operationContext(), coll, specs, MultiIndexBlock::kNoopOnInitFn)
+                .getStatus());
+        wunit.commit();
+    }
+
+    ASSERT_OK(indexer->insertAllDocumentsInCollection(operationContext(), coll.get()));
+    ASSERT_OK(indexer->checkConstraints(operationContext(), coll.get()));
+    {
+        WriteUnitOfWork wunit(operationContext());
+        ASSERT_OK(indexer->commit(operationContext(),
+                                  coll.getWritableCollection(operationContext()),
+                                  MultiIndexBlock::kNoopOnCreateEachFn,
+                                  MultiIndexBlock::kNoopOnCommitFn));
+        wunit.commit();
+    }
+
+    auto numKeys = [&](StringData indexName) {
+        auto desc = coll->getIndexCatalog()->findIndexByName(operationContext(), indexName);
+        ASSERT(desc);
+        return desc->getEntry()
+            ->accessMethod()
+            ->asSortedData()
+            ->getSortedDataInterface()
+            ->numEntries(operationContext());
+    };
+    ASSERT_EQ(numDocs, numKeys("a_1"));
+    // The document with _id 0 has a single key, since 0 == -0.
+    ASSERT_EQ(2 * numDocs - 1, numKeys("b_1"));
+    ASSERT_EQ(numDocs / 2, numKeys("c_1"));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -193,6 +193,10 @@ public:
 
     /**
      * Obtains a collection consistent with the snapshot.
+     *
+     * Background validation reads at the last stable recovery timestamp through ordinary snapshot
+     * reads, so the history back to that timestamp must stay available until validation completes.
+     * The record store and every index are traversed by this one operation, one after another.
      */
     Status initializeCollection(OperationContext* opCtx);
 
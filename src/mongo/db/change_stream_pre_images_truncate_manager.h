@@ -99,6 +99,10 @@ private:
      * Tries to retrieve truncate markers for the tenant - or initialize the truncate markers if
      * they don't yet exist.
      *
+     * Initialization happens on the first truncation pass of the pre-images remover rather than
+     * during startup, so it doesn't delay the node from becoming available. Large collections are
+     * sampled, so the cost is proportional to the number of markers rather than documents.
+     *
      * Returns a shared_ptr to truncate markers for the tenant's pre-images collection. If truncate
      * markers don't exist (either the collection doesn't exist or the collection was dropped during
      * the initialization process), returns nullptr.
@@ -256,8 +256,8 @@ void BM_acquireMultiCollection(benchmark::State& state) {
     CollectionAcquisitionBenchmark{state}(BM_acquireMultiCollectionFunc);
 }
 
-BENCHMARK(BM_acquireCollectionLockFree)->ThreadRange(1, 16);
-BENCHMARK(BM_acquireCollection)->ThreadRange(1, 16);
-BENCHMARK(BM_acquireMultiCollection)->ThreadRange(1, 16);
+BENCHMARK(BM_acquireCollectionLockFree)->ThreadRange(1, 64);
+BENCHMARK(BM_acquireCollection)->ThreadRange(1, 64);
+BENCHMARK(BM_acquireMultiCollection)->ThreadRange(1, 64);
 }  // namespace
 }  // namespace mongo::repl
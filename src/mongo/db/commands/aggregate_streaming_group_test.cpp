@@ -0,0 +1,190 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
+#include "mongo/db/catalog/catalog_test_fixture.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/bson_test_util.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss =
+    NamespaceString::createNamespaceString_forTest("unittests.streamingGroup");
+
+/**
+ * Runs aggregations through the full command path to check when a $group reading from an index
+ * scan is executed as a $_internalStreamingGroup.
+ */
+class AggregateStreamingGroupTest : public CatalogTestFixture {
+protected:
+    void setUp() override {
+        CatalogTestFixture::setUp();
+
+        // Documents with d in [0, 3], and two documents whose 'd' is null or missing.
+        DBDirectClient client(operationContext());
+        std::vector<BSONObj> docs;
+        for (int i = 0; i < 20; ++i) {
+            docs.push_back(BSON("_id" << i << "d" << i % 4 << "ts" << i << "v" << 1));
+        }
+        docs.push_back(BSON("_id" << 20 << "d" << BSONNULL << "ts" << 20 << "v" << 1));
+        docs.push_back(BSON("_id" << 21 << "ts" << 21 << "v" << 1));
+        client.insert(kNss, docs);
+    }
+
+    void createIndex(const BSONObj& key) {
+        DBDirectClient client(operationContext());
+        BSONObj result;
+        ASSERT(client.runCommand(
+            kNss.dbName(),
+            BSON("createIndexes" << kNss.coll() << "indexes"
+                                 << BSON_ARRAY(BSON("key" << key << "name" << "testIndex"))
+                                 << "commitQuorum" << 0),
+            result))
+            << result;
+    }
+
+    std::vector<BSONObj> runAggregate(const BSONArray& pipeline) {
+        DBDirectClient client(operationContext());
+        BSONObj result;
+        ASSERT(client.runCommand(
+            kNss.dbName(),
+            BSON("aggregate" << kNss.coll() << "pipeline" << pipeline << "cursor" << BSONObj()),
+            result))
+            << result;
+        std::vector<BSONObj> docs;
+        for (auto&& doc : result["cursor"]["firstBatch"].Array()) {
+            docs.push_back(doc.Obj().getOwned());
+        }
+        return docs;
+    }
+
+    /**
+     * Returns the name of the stage the explained 'pipeline' executes its $group as.
+     */
+    std::string explainGroupStageName(const BSONArray& pipeline) {
+        DBDirectClient client(operationContext());
+        BSONObj result;
+        ASSERT(client.runCommand(kNss.dbName(),
+                                 BSON("aggregate" << kNss.coll() << "pipeline" << pipeline
+                                                  << "explain" << true),
+                                 result))
+            << result;
+        for (auto&& stage : result["stages"].Array()) {
+            auto name = stage.Obj().firstElementFieldName();
+            if (name == "$group"_sd || name == "$_internalStreamingGroup"_sd) {
+                return name;
+            }
+        }
+        FAIL("No group stage in explain") << result;
+        return "";
+    }
+
+private:
+    RAIIServerParameterControllerForTest _classicEngine{"internalQueryFrameworkControl",
+                                                        "forceClassicEngine"};
+    RAIIServerParameterControllerForTest _streamingGroup{
+        "internalQueryEnableStreamingGroupFromIndexOrder", true};
+};
+
+TEST_F(AggregateStreamingGroupTest, StreamsGroupClusteredByIndexOrder) {
+    createIndex(BSON("d" << 1 << "ts" << 1));
+    const auto pipeline = BSON_ARRAY(fromjson("{$match: {d: {$gte: 0}}}")
+                                     << fromjson("{$group: {_id: '$d', total: {$sum: '$v'}}}")
+                                     << fromjson("{$sort: {_id: 1}}"));
+
+    ASSERT_EQ(explainGroupStageName(pipeline), "$_internalStreamingGroup");
+
+    auto results = runAggregate(pipeline);
+    ASSERT_EQ(results.size(), 4U);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_BSONOBJ_EQ(results[i], BSON("_id" << i << "total" << 5));
+    }
+}
+
+TEST_F(AggregateStreamingGroupTest, DoesNotStreamWhenDisabled) {
+    RAIIServerParameterControllerForTest streamingGroup{
+        "internalQueryEnableStreamingGroupFromIndexOrder", false};
+    createIndex(BSON("d" << 1 << "ts" << 1));
+    const auto pipeline = BSON_ARRAY(fromjson("{$match: {d: {$gte: 0}}}")
+                                     << fromjson("{$group: {_id: '$d', total: {$sum: '$v'}}}"));
+
+    ASSERT_EQ(explainGroupStageName(pipeline), "$group");
+}
+
+TEST_F(AggregateStreamingGroupTest, DoesNotStreamWhenBoundsIncludeNullishKeys) {
+    createIndex(BSON("d" << 1 << "ts" << 1));
+    // The null and missing 'd' values would be rejected by a streaming group.
+    const auto pipeline = BSON_ARRAY(fromjson("{$match: {d: {$in: [null, 1]}}}")
+                                     << fromjson("{$group: {_id: '$d', total: {$sum: '$v'}}}")
+                                     << fromjson("{$sort: {_id: 1}}"));
+
+    ASSERT_EQ(explainGroupStageName(pipeline), "$group");
+
+    auto results = runAggregate(pipeline);
+    ASSERT_EQ(results.size(), 2U);
+    ASSERT_BSONOBJ_EQ(results[0], fromjson("{_id: null, total: 2}"));
+    ASSERT_BSONOBJ_EQ(results[1], fromjson("{_id: 1, total: 5}"));
+}
+
+TEST_F(AggregateStreamingGroupTest, DoesNotStreamOverWildcardIndex) {
+    createIndex(BSON("$**" << 1));
+    const auto pipeline = BSON_ARRAY(fromjson("{$match: {d: {$gte: 0}}}")
+                                     << fromjson("{$group: {_id: '$d', total: {$sum: '$v'}}}")
+                                     << fromjson("{$sort: {_id: 1}}"));
+
+    ASSERT_EQ(explainGroupStageName(pipeline), "$group");
+    ASSERT_EQ(runAggregate(pipeline).size(), 4U);
+}
+
+TEST_F(AggregateStreamingGroupTest, DoesNotStreamOverHashedIndex) {
+    createIndex(BSON("d" << "hashed"));
+    const auto pipeline = BSON_ARRAY(fromjson("{$match: {d: 1}}")
+                                     << fromjson("{$group: {_id: '$d', total: {$sum: '$v'}}}"));
+
+    ASSERT_EQ(explainGroupStageName(pipeline), "$group");
+
+    auto results = runAggregate(pipeline);
+    ASSERT_EQ(results.size(), 1U);
+    ASSERT_BSONOBJ_EQ(results[0], BSON("_id" << 1 << "total" << 5));
+}
+
+}  // namespace
+}  // namespace mongo
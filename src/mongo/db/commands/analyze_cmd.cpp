@@ -254,7 +254,9 @@ public:
 
                 uassertStatusOK(getStatusFromCommandResult(analyzeResult));
 
-                // Invalidate statistics in the cache for the analyzed path
+                // Invalidate statistics in the cache for the analyzed path. This command is the
+                // only writer of 'system.statistics' collections; nothing refreshes them as the
+                // collection changes, so statistics are as fresh as the last manual analyze.
                 stats::StatsCatalog& statsCatalog = stats::StatsCatalog::get(opCtx);
                 uassertStatusOK(statsCatalog.invalidatePath(nss, key->toString()));
 
@@ -57,6 +57,7 @@
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/client.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/commands/count_result_cache.h"
 #include "mongo/db/commands/run_aggregate.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/curop_failpoint_helpers.h"
@@ -79,9 +80,11 @@
 #include "mongo/db/query/query_settings/query_settings_gen.h"
 #include "mongo/db/query/view_response_formatter.h"
 #include "mongo/db/read_concern_support_result.h"
+#include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/read_concern_level.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/collection_sharding_state.h"
+#include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/query_analysis_writer.h"
 #include "mongo/db/s/scoped_collection_metadata.h"
 #include "mongo/db/service_context.h"
@@ -91,7 +94,9 @@
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/s/analyze_shard_key_common_gen.h"
 #include "mongo/s/query_analysis_sampler_util.h"
+#include "mongo/s/shard_version.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/clock_source.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/decorable.h"
 #include "mongo/util/fail_point.h"
@@ -107,6 +112,53 @@ namespace {
 // Failpoint which causes to hang "count" cmd after acquiring the DB lock.
 MONGO_FAIL_POINT_DEFINE(hangBeforeCollectionCount);
 
+/**
+ * Returns the parts of 'request' which determine its result, for looking it up in the
+ * CountResultCache. A count sent by a router only counts the documents this shard owns at the
+ * shard version it was sent with, so its key also holds that version.
+ */
+BSONObj makeCountResultCacheKey(OperationContext* opCtx,
+                                const NamespaceString& nss,
+                                const CountCommandRequest& request) {
+    BSONObjBuilder bob;
+    bob.append(CountCommandRequest::kQueryFieldName, request.getQuery());
+    if (auto skip = request.getSkip()) {
+        bob.append(CountCommandRequest::kSkipFieldName, *skip);
+    }
+    if (auto limit = request.getLimit()) {
+        bob.append(CountCommandRequest::kLimitFieldName, *limit);
+    }
+    bob.append(CountCommandRequest::kHintFieldName, request.getHint());
+    if (auto collation = request.getCollation()) {
+        bob.append(CountCommandRequest::kCollationFieldName, *collation);
+    }
+    if (OperationShardingState::isComingFromRouter(opCtx)) {
+        bob.append("shardFilter", true);
+        if (auto shardVersion = OperationShardingState::get(opCtx).getShardVersion(nss)) {
+            shardVersion->serialize(ShardVersion::kShardVersionField, &bob);
+        }
+    }
+    return bob.obj();
+}
+
+/**
+ * Counts may only be served from the CountResultCache when they read the latest data on this node,
+ * since that is what the cached results were computed against.
+ */
+void assertCanUseCountResultCache(OperationContext* opCtx, const CountCommandRequest& request) {
+    const auto& readConcernArgs = repl::ReadConcernArgs::get(opCtx);
+    const auto level = readConcernArgs.getLevel();
+    uassert(ErrorCodes::InvalidOptions,
+            "maxStalenessMS is only supported with read concern level \"local\" or \"available\"",
+            (level == repl::ReadConcernLevel::kLocalReadConcern ||
+             level == repl::ReadConcernLevel::kAvailableReadConcern) &&
+                !readConcernArgs.getArgsAfterClusterTime() &&
+                !readConcernArgs.getArgsAtClusterTime() && !readConcernArgs.getArgsOpTime());
+    uassert(ErrorCodes::InvalidOptions,
+            "maxStalenessMS is not supported with Queryable Encryption",
+            !request.getEncryptionInformation());
+}
+
 /**
  * Implements the MongoD side of the count command.
  */
@@ -380,6 +432,26 @@ public:
                         CollectionShardingState::OrphanCleanupPolicy::kDisallowOrphanCleanup));
         }
 
+        // A count which tolerates staleness is answered from a recent identical count if there is
+        // one. Otherwise the result of running it is remembered for later counts.
+        boost::optional<BSONObj> countResultCacheKey;
+        const auto countStartTime = opCtx->getServiceContext()->getFastClockSource()->now();
+        if (auto maxStalenessMS = request.getMaxStalenessMS(); maxStalenessMS && collection) {
+            assertCanUseCountResultCache(opCtx, request);
+            countResultCacheKey = makeCountResultCacheKey(opCtx, nss, request);
+            if (auto cachedCount = CountResultCache::get(opCtx->getServiceContext())
+                                       ->lookup(collection->uuid(),
+                                                *countResultCacheKey,
+                                                countStartTime - Milliseconds(*maxStalenessMS))) {
+                {
+                    stdx::lock_guard<Client> lk(*opCtx->getClient());
+                    curOp->setPlanSummary_inlock("COUNT_RESULT_CACHE");
+                }
+                result.appendNumber("n", *cachedCount);
+                return true;
+            }
+        }
+
         auto statusWithPlanExecutor = getExecutorCount(
             makeExpressionContextForGetExecutor(opCtx,
                                                 request.getCollation().value_or(BSONObj()),
@@ -399,6 +471,10 @@ public:
         }
 
         auto countResult = exec->executeCount();
+        if (countResultCacheKey) {
+            CountResultCache::get(opCtx->getServiceContext())
+                ->insert(collection->uuid(), *countResultCacheKey, countResult, countStartTime);
+        }
 
         PlanSummaryStats summaryStats;
         exec->getPlanExplainer().getSummaryStats(&summaryStats);
@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/commands/count_result_cache.h"
+
+#include <utility>
+
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/decorable.h"
+
+namespace mongo {
+namespace {
+
+const auto getCountResultCache = ServiceContext::declareDecoration<CountResultCache>();
+
+auto& countResultCacheHits = *MetricBuilder<Counter64>{"query.countResultCache.hits"};
+auto& countResultCacheMisses = *MetricBuilder<Counter64>{"query.countResultCache.misses"};
+
+}  // namespace
+
+CountResultCache* CountResultCache::get(ServiceContext* service) {
+    return &getCountResultCache(service);
+}
+
+CountResultCache::CountResultCache()
+    : CountResultCache(static_cast<std::size_t>(internalQueryCountResultCacheMaxEntries.load())) {}
+
+CountResultCache::CountResultCache(std::size_t maxEntries) : _entries(maxEntries) {}
+
+std::string CountResultCache::_makeKey(const UUID& uuid, const BSONObj& request) {
+    std::string key;
+    auto uuidData = uuid.toCDR();
+    key.reserve(uuidData.length() + request.objsize());
+    key.append(uuidData.data<char>(), uuidData.length());
+    key.append(request.objdata(), request.objsize());
+    return key;
+}
+
+boost::optional<long long> CountResultCache::lookup(const UUID& uuid,
+                                                    const BSONObj& request,
+                                                    Date_t oldestAcceptable) {
+    const auto key = _makeKey(uuid, request);
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _entries.find(key);
+    if (it == _entries.end() || it->second.computedAt < oldestAcceptable) {
+        countResultCacheMisses.increment();
+        return boost::none;
+    }
+    countResultCacheHits.increment();
+    return _entries.promote(it)->second.count;
+}
+
+void CountResultCache::insert(const UUID& uuid,
+                              const BSONObj& request,
+                              long long count,
+                              Date_t computedAt) {
+    auto key = _makeKey(uuid, request);
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _entries.find(key);
+    // A concurrent count may have stored a more recent result.
+    if (it != _entries.end() && it->second.computedAt > computedAt) {
+        return;
+    }
+    _entries.add(std::move(key), Entry{count, computedAt});
+}
+
+std::size_t CountResultCache::size() const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    return _entries.size();
+}
+
+}  // namespace mongo
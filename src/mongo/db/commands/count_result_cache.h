@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <string>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/lru_cache.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Remembers the results of recent count commands so that counts which tolerate a bounded amount of
+ * staleness, via the 'maxStalenessMS' option, can be answered without running a plan. Results are
+ * keyed by collection UUID and the parts of the request that affect the count, so dropping and
+ * re-creating a collection never serves a result from the old one. Writes do not invalidate
+ * results; callers bound how old a result may be instead.
+ */
+class CountResultCache {
+public:
+    static CountResultCache* get(ServiceContext* service);
+
+    /**
+     * Holds at most 'internalQueryCountResultCacheMaxEntries' results.
+     */
+    CountResultCache();
+
+    explicit CountResultCache(std::size_t maxEntries);
+
+    /**
+     * Returns the count stored for 'request' on the collection 'uuid' if it was computed no
+     * earlier than 'oldestAcceptable'.
+     */
+    boost::optional<long long> lookup(const UUID& uuid,
+                                      const BSONObj& request,
+                                      Date_t oldestAcceptable);
+
+    /**
+     * Stores 'count' as the result of 'request' on the collection 'uuid' as of 'computedAt',
+     * evicting the least recently used result if the cache is full.
+     */
+    void insert(const UUID& uuid, const BSONObj& request, long long count, Date_t computedAt);
+
+    std::size_t size() const;
+
+private:
+    struct Entry {
+        long long count;
+        Date_t computedAt;
+    };
+
+    static std::string _makeKey(const UUID& uuid, const BSONObj& request);
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("CountResultCache::_mutex");
+    LRUCache<std::string, Entry> _entries;
+};
+
+}  // namespace mongo
@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/commands/count_result_cache.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+const Date_t kNow = Date_t::fromMillisSinceEpoch(100000);
+
+TEST(CountResultCacheTest, LookupHonorsStalenessBound) {
+    CountResultCache cache(10);
+    const auto uuid = UUID::gen();
+    const auto request = fromjson("{query: {tenantId: 1}, hint: {}}");
+
+    ASSERT_FALSE(cache.lookup(uuid, request, kNow));
+
+    cache.insert(uuid, request, 42, kNow);
+    ASSERT_EQ(cache.lookup(uuid, request, kNow - Seconds(1)).value_or(-1), 42);
+    ASSERT_EQ(cache.lookup(uuid, request, kNow).value_or(-1), 42);
+    ASSERT_FALSE(cache.lookup(uuid, request, kNow + Milliseconds(1)));
+}
+
+TEST(CountResultCacheTest, ResultsAreKeyedByCollectionAndRequest) {
+    CountResultCache cache(10);
+    const auto uuid = UUID::gen();
+    const auto request = fromjson("{query: {tenantId: 1}, hint: {}}");
+    cache.insert(uuid, request, 42, kNow);
+
+    ASSERT_FALSE(cache.lookup(UUID::gen(), request, kNow));
+    ASSERT_FALSE(cache.lookup(uuid, fromjson("{query: {tenantId: 2}, hint: {}}"), kNow));
+    ASSERT_FALSE(cache.lookup(uuid, fromjson("{query: {tenantId: 1}, limit: 5, hint: {}}"), kNow));
+}
+
+TEST(CountResultCacheTest, OlderResultDoesNotReplaceNewerOne) {
+    CountResultCache cache(10);
+    const auto uuid = UUID::gen();
+    const auto request = fromjson("{query: {}, hint: {}}");
+
+    cache.insert(uuid, request, 2, kNow);
+    cache.insert(uuid, request, 1, kNow - Seconds(1));
+    ASSERT_EQ(cache.lookup(uuid, request, kNow).value_or(-1), 2);
+
+    cache.insert(uuid, request, 3, kNow + Seconds(1));
+    ASSERT_EQ(cache.lookup(uuid, request, kNow).value_or(-1), 3);
+}
+
+TEST(CountResultCacheTest, EvictsLeastRecentlyUsedResult) {
+    CountResultCache cache(2);
+    const auto uuid = UUID::gen();
+    const auto first = fromjson("{query: {a: 1}, hint: {}}");
+    const auto second = fromjson("{query: {a: 2}, hint: {}}");
+    const auto third = fromjson("{query: {a: 3}, hint: {}}");
+
+    cache.insert(uuid, first, 1, kNow);
+    cache.insert(uuid, second, 2, kNow);
+    // Using the first result makes the second one the least recently used.
+    ASSERT_EQ(cache.lookup(uuid, first, kNow).value_or(-1), 1);
+    cache.insert(uuid, third, 3, kNow);
+
+    ASSERT_EQ(cache.size(), 2U);
+    ASSERT_EQ(cache.lookup(uuid, first, kNow).value_or(-1), 1);
+    ASSERT_FALSE(cache.lookup(uuid, second, kNow));
+    ASSERT_EQ(cache.lookup(uuid, third, kNow).value_or(-1), 3);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -436,6 +436,12 @@ public:
          * Implements populating 'nextBatch' with up to 'batchSize' documents from the plan executor
          * 'exec'. Outputs the number of documents and relevant size statistics in 'numResults' and
          * 'docUnitsReturned'. Returns whether or not the cursor should be saved.
+         *
+         * Execution and serialization into the reply happen on this thread. Each document is
+         * copied into 'nextBatch' as it is produced, often from storage memory that stays valid
+         * only until the next call into the executor. The size limit is checked per document, and
+         * the resume token must match the last appended document. Handing documents to a second
+         * thread would add a copy per document and cross-thread coordination to every append.
          */
         bool batchedExecute(OperationContext* opCtx,
                             ClientCursor* cursor,
@@ -54,6 +54,11 @@ namespace mongo {
  * for re-checking privileges for getMore commands.
  *
  * On success, fills out 'result' with the command response.
+ *
+ * Every call plans and executes the pipeline from scratch; results are never cached. A cached
+ * result set would be valid only for one read snapshot and for one user's privileges. It would
+ * also have to be invalidated by every write to each referenced namespace, including secondary
+ * namespaces of $lookup and $unionWith, and on every shard that holds their data.
  */
 Status runAggregate(
     OperationContext* opCtx,
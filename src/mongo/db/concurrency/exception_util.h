@@ -145,7 +145,9 @@ template <ErrorCodes::Error ec>
  *
  * If we are already in a WriteUnitOfWork, we assume that we are being called within a
  * WriteConflictException retry loop up the call stack. Hence, this retry loop is reduced to an
- * invocation of the argument function f without any exception handling and retry logic.
+ * invocation of the argument function f without any exception handling and retry logic. This is
+ * always the case inside a multi-document transaction, where a WriteConflictException aborts the
+ * transaction and is surfaced to the client as a TransientTransactionError to retry.
  */
 template <typename F>
 auto writeConflictRetry(OperationContext* opCtx,
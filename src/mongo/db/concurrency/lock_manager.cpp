@@ -29,6 +29,7 @@
 
 #include "mongo/db/concurrency/lock_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <fmt/format.h>
@@ -37,6 +38,10 @@
 #include <utility>
 #include <vector>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include <absl/container/node_hash_map.h>
 #include <absl/meta/type_traits.h>
 
@@ -51,6 +56,7 @@
 #include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/processinfo.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
 
@@ -414,7 +420,8 @@ LockManager* LockManager::get(ServiceContext& service) {
     return &getLockManager(service);
 }
 
-LockManager::LockManager() {
+LockManager::LockManager()
+    : _numPartitions(std::max(_minPartitions, ProcessInfo::getNumLogicalCores())) {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
@@ -439,6 +446,7 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
 
     // For intent modes, try the PartitionedLockHead
     if (request->partitioned) {
+        _assignPartition(request);
         Partition* partition = _getPartition(request);
         stdx::lock_guard<SimpleMutex> scopedLock(partition->mutex);
         invariant(request->status == LockRequest::STATUS_NEW);
@@ -675,7 +683,18 @@ LockManager::LockBucket* LockManager::_getBucket(ResourceId resId) const {
 }
 
 LockManager::Partition* LockManager::_getPartition(LockRequest* request) const {
-    return &_partitions[request->locker->getId() % _numPartitions];
+    dassert(request->partitionId < _numPartitions);
+    return &_partitions[request->partitionId];
+}
+
+void LockManager::_assignPartition(LockRequest* request) const {
+#if defined(__linux__)
+    if (int cpu = sched_getcpu(); cpu >= 0) {
+        request->partitionId = cpu % _numPartitions;
+        return;
+    }
+#endif
+    request->partitionId = request->locker->getId() % _numPartitions;
 }
 
 bool LockManager::hasConflictingRequests(ResourceId resId, const LockRequest* request) const {
@@ -37,6 +37,7 @@
 #include "mongo/db/auth/cluster_auth_mode.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/service_context.h"
+#include "mongo/stdx/new.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/mutex.h"
 
@@ -154,7 +155,9 @@ private:
 
     // These types describe the locks hash table
 
-    struct LockBucket {
+    // Buckets and partitions are aligned so that threads working on neighbouring ones do not
+    // contend on the same cache line.
+    struct alignas(stdx::hardware_destructive_interference_size) LockBucket {
         LockHead* findOrInsert(ResourceId resId);
 
         SimpleMutex mutex;
@@ -162,10 +165,10 @@ private:
         Map data;
     };
 
-    // Each locker maps to a partition that is used for resources acquired in intent modes
-    // modes and potentially other modes that don't conflict with themselves. This avoids
-    // contention on the regular LockHead in the lock manager.
-    struct Partition {
+    // Each request in an intent mode maps to a partition, chosen by the CPU that the requesting
+    // thread runs on. This avoids contention on the regular LockHead in the lock manager, and keeps
+    // each partition's state in the caches of a single core, and so a single NUMA node.
+    struct alignas(stdx::hardware_destructive_interference_size) Partition {
         PartitionedLockHead* find(ResourceId resId);
         PartitionedLockHead* findOrInsert(ResourceId resId);
 
@@ -182,10 +185,17 @@ private:
 
 
     /**
-     * Retrieves the Partition that a particular LockRequest should use for intent locking.
+     * Retrieves the Partition that a particular LockRequest uses for intent locking. The request
+     * must have been assigned one with _assignPartition().
      */
     Partition* _getPartition(LockRequest* request) const;
 
+    /**
+     * Chooses the Partition that 'request' will use for intent locking, based on the CPU the
+     * calling thread runs on. Platforms which can't tell fall back to partitioning by locker.
+     */
+    void _assignPartition(LockRequest* request) const;
+
     /**
      * Should be invoked when the state of a lock changes in a way, which could potentially
      * allow other blocked requests to proceed.
@@ -209,9 +219,11 @@ private:
     static constexpr unsigned _numLockBuckets{128};
     LockBucket* _lockBuckets;
 
-    // Balance scalability of intent locks against potential added cost of conflicting locks. The
-    // exact value doesn't appear very important, but should be power of two.
-    static constexpr unsigned _numPartitions{32};
+    // One partition per logical core, so that intent locks taken on different cores never share
+    // a partition. Conflicting locks only visit the partitions that hold requests for their
+    // resource, so having more partitions does not make them more expensive.
+    static constexpr unsigned _minPartitions{32};
+    const unsigned _numPartitions;
     Partition* _partitions;
 };
 
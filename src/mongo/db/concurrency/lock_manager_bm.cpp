@@ -39,13 +39,14 @@
 #include "mongo/db/concurrency/lock_manager.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/concurrency/locker.h"
+#include "mongo/db/database_name.h"
 #include "mongo/db/service_context.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
 namespace {
 
-const int kMaxPerfThreads = 16;  // max number of threads to use for lock perf
+const int kMaxPerfThreads = 64;  // max number of threads to use for lock perf
 
 class LockManagerTest : public benchmark::Fixture {
 protected:
@@ -131,6 +132,20 @@ BENCHMARK_DEFINE_F(LockManagerTest, BM_LockUnlock_SharedLock_Locker)(benchmark::
     }
 }
 
+BENCHMARK_DEFINE_F(LockManagerTest, BM_LockUnlock_IntentLock_Locker)(benchmark::State& state) {
+    // Every thread takes an intent lock on the same database, as operations on a hot database do.
+    static const ResourceId resId(RESOURCE_DATABASE,
+                                  DatabaseName::createDatabaseName_forTest(boost::none, "hot"));
+
+    auto* opCtx = clients[state.thread_index].second.get();
+    Locker locker(getServiceContext());
+
+    for (auto keepRunning : state) {
+        locker.lock(opCtx, resId, MODE_IX);
+        locker.unlock(resId);
+    }
+}
+
 BENCHMARK_DEFINE_F(LockManagerTest, BM_LockUnlock_SharedLock)(benchmark::State& state) {
     static Lock::ResourceMutex resMutex("BM_LockUnlock_SharedLock");
 
@@ -153,6 +168,8 @@ BENCHMARK_REGISTER_F(LockManagerTest, BM_LockUnlock_SharedLock_Direct)
     ->ThreadRange(1, kMaxPerfThreads);
 BENCHMARK_REGISTER_F(LockManagerTest, BM_LockUnlock_SharedLock_Locker)
     ->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(LockManagerTest, BM_LockUnlock_IntentLock_Locker)
+    ->ThreadRange(1, kMaxPerfThreads);
 BENCHMARK_REGISTER_F(LockManagerTest, BM_LockUnlock_SharedLock)->ThreadRange(1, kMaxPerfThreads);
 
 BENCHMARK_REGISTER_F(LockManagerTest, BM_LockUnlock_ExclusiveLock)->ThreadRange(1, kMaxPerfThreads);
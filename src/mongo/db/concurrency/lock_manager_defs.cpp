@@ -75,6 +75,7 @@ void LockRequest::initNew(Locker* locker, LockGrantNotification* notify) {
 
     unlockPending = 0;
     recursiveCount = 1;
+    partitionId = 0;
 
     lock = nullptr;
     partitionedLock = nullptr;
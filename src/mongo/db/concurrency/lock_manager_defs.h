@@ -492,6 +492,15 @@ struct LockRequest {
     // No synchronization
     uint16_t recursiveCount;
 
+    // The LockManager partition used by this request, if it is partitioned. Chosen when the
+    // request is first locked, so that it is unlocked through the same partition even if the
+    // Locker has since moved to another CPU.
+    //
+    // Written by LockManager on Locker thread
+    // Read by LockManager on any thread
+    // No synchronization
+    uint16_t partitionId;
+
     // Pointer to the lock to which this request belongs, or null if this request has not yet been
     // assigned to a lock or if it belongs to the PartitionedLockHead for locker (in which case
     // partitionedLock must be set). The LockHead should be alive as long as there are LockRequests
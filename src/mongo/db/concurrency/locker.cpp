@@ -30,6 +30,7 @@
 #include "mongo/db/concurrency/locker.h"
 
 #include "mongo/bson/json.h"
+#include "mongo/db/admission/execution_control_parameters_gen.h"
 #include "mongo/db/admission/ticketholder_manager.h"
 #include "mongo/db/concurrency/lock_manager.h"
 #include "mongo/db/dump_lock_manager.h"
@@ -1002,6 +1003,16 @@ bool Locker::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t deadl
 
         _ticket = [&]() {
             ExecutionAdmissionContext* admCtx = &ExecutionAdmissionContext::get(opCtx);
+
+            // An operation that has already been admitted many times is long-running, so it waits
+            // behind normal-priority operations for the rest of its tickets.
+            boost::optional<ScopedAdmissionPriority<ExecutionAdmissionContext>> deprioritized;
+            if (auto threshold = gDeprioritizeAfterAdmissionsThreshold.load(); threshold > 0 &&
+                admCtx->getPriority() == AdmissionContext::Priority::kNormal &&
+                admCtx->getAdmissions() >= threshold) {
+                deprioritized.emplace(opCtx, AdmissionContext::Priority::kLow);
+            }
+
             if (opCtx->uninterruptibleLocksRequested_DO_NOT_USE()) {  // NOLINT
                 return holder->waitForTicketUntilNoInterrupt_DO_NOT_USE(opCtx, admCtx, deadline);
             }
@@ -573,9 +573,16 @@ std::tuple<Milliseconds, Milliseconds> CurOp::_getAndSumBlockedTimeTotal() {
         timeQueuedForFlowControl -= _lockerStatsBase->timeQueuedForFlowControl;
     }
 
+    // Time blocked on prepare conflicts is tracked per operation context rather than by the
+    // locker. Callers only use differences of this total, which discards any time accumulated
+    // before this CurOp started.
+    auto prepareConflictDuration =
+        PrepareConflictTracker::get(opCtx()).getPrepareConflictDuration();
+
     return std::make_pair(duration_cast<Milliseconds>(cumulativeLockWaitTime +
                                                       timeQueuedForTickets +
-                                                      timeQueuedForFlowControl),
+                                                      timeQueuedForFlowControl +
+                                                      prepareConflictDuration),
                           duration_cast<Milliseconds>(timeQueuedForTickets));
 }
 
@@ -1166,8 +1166,8 @@ private:
     static AdditiveLockerStats getAdditiveLockerStats(const Locker* locker);
 
     /**
-     * Returns the time operation spends blocked waiting for locks and tickets. Also returns the
-     * retrieved time waiting for locks.
+     * Returns the time operation spends blocked waiting for locks, tickets and prepare conflicts.
+     * Also returns the retrieved time waiting for tickets.
      */
     std::tuple<Milliseconds, Milliseconds> _getAndSumBlockedTimeTotal();
 
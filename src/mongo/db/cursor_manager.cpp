@@ -132,22 +132,29 @@ CursorManager::~CursorManager() {
     }
 }
 
-bool CursorManager::cursorShouldTimeout_inlock(const ClientCursor* cursor, Date_t now) {
+bool CursorManager::cursorShouldTimeout_inlock(const ClientCursor* cursor,
+                                               Date_t idleCutoff,
+                                               bool timeoutSessionCursors) {
     if (cursor->isNoTimeout() || cursor->_operationUsingCursor ||
-        (cursor->getSessionId() && !enableTimeoutOfInactiveSessionCursors.load())) {
+        (cursor->getSessionId() && !timeoutSessionCursors)) {
         return false;
     }
-    return (now - cursor->_lastUseDate) >= Milliseconds(getCursorTimeoutMillis());
+    return cursor->_lastUseDate <= idleCutoff;
 }
 
 std::size_t CursorManager::timeoutCursors(OperationContext* opCtx, Date_t now) {
     std::vector<std::unique_ptr<ClientCursor, ClientCursor::Deleter>> toDisposeWithoutMutex;
 
+    // Read the timeout parameters once per pass rather than once per cursor, since each partition
+    // lock is held while all of its cursors are checked.
+    const Date_t idleCutoff = now - Milliseconds(getCursorTimeoutMillis());
+    const bool timeoutSessionCursors = enableTimeoutOfInactiveSessionCursors.load();
+
     for (size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
         auto lockedPartition = _cursorMap->lockOnePartitionById(partitionId);
         for (auto it = lockedPartition->begin(); it != lockedPartition->end();) {
             auto* cursor = it->second;
-            if (cursorShouldTimeout_inlock(cursor, now)) {
+            if (cursorShouldTimeout_inlock(cursor, idleCutoff, timeoutSessionCursors)) {
                 toDisposeWithoutMutex.emplace_back(cursor);
                 // Advance the iterator first since erasing from the lockedPartition will
                 // invalidate any references to it.
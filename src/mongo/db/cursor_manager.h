@@ -244,7 +244,11 @@ private:
     void unpin(OperationContext* opCtx,
                std::unique_ptr<ClientCursor, ClientCursor::Deleter> cursor);
 
-    bool cursorShouldTimeout_inlock(const ClientCursor* cursor, Date_t now);
+    // Returns true if 'cursor' is eligible for timeout and was last used at or before
+    // 'idleCutoff'. Cursors with a session are only eligible if 'timeoutSessionCursors' is true.
+    bool cursorShouldTimeout_inlock(const ClientCursor* cursor,
+                                    Date_t idleCutoff,
+                                    bool timeoutSessionCursors);
 
     template <class T>
     void removeCursorFromMap(T& map, ClientCursor* cursor) {
@@ -196,7 +196,7 @@ write_ops::InsertCommandReply DBDirectClient::insert(
     const write_ops::InsertCommandRequest& insert) {
     auto request = insert.serialize();
     request.validatedTenancyScope = _createInnerRequestVTS(insert.getDbName().tenantId());
-    auto response = runCommand(request);
+    auto response = runCommand(std::move(request));
     return InsertOp::parseResponse(response->getCommandReply());
 }
 
@@ -205,7 +205,7 @@ write_ops::UpdateCommandReply DBDirectClient::update(
     auto request = update.serialize();
     request.validatedTenancyScope = _createInnerRequestVTS(update.getDbName().tenantId());
 
-    auto response = runCommand(request);
+    auto response = runCommand(std::move(request));
     return UpdateOp::parseResponse(response->getCommandReply());
 }
 
@@ -214,7 +214,7 @@ write_ops::DeleteCommandReply DBDirectClient::remove(
     auto request = remove.serialize();
     request.validatedTenancyScope = _createInnerRequestVTS(remove.getDbName().tenantId());
 
-    auto response = runCommand(request);
+    auto response = runCommand(std::move(request));
     return DeleteOp::parseResponse(response->getCommandReply());
 }
 
@@ -233,7 +233,7 @@ long long DBDirectClient::count(const NamespaceStringOrUUID nsOrUuid,
 
     // Calls runCommand instead of runCommandDirectly to ensure the tenant inforamtion of this
     // command gets validated and is used for parsing the command request.
-    auto response = runCommand(request);
+    auto response = runCommand(std::move(request));
     auto& result = response->getCommandReply();
 
     uassertStatusOK(getStatusFromCommandResult(result));
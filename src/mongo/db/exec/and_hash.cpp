@@ -210,7 +210,7 @@ PlanStage::StageState AndHashStage::doWork(WorkingSetID* out) {
     } else {
         // Child's output was in every previous child.  Merge any key data in
         // the child's output and free the child's just-outputted WSM.
-        WorkingSetID hashID = it->second;
+        WorkingSetID hashID = it->second.id;
         _dataMap.erase(it);
 
         AndCommon::mergeFrom(_ws, hashID, *member);
@@ -245,7 +245,7 @@ PlanStage::StageState AndHashStage::readFirstChild(WorkingSetID* out) {
         // with no record id.
         invariant(member->hasRecordId());
 
-        if (!_dataMap.insert(std::make_pair(member->recordId, id)).second) {
+        if (!_dataMap.insert(std::make_pair(member->recordId, DataMapEntry{id, 0})).second) {
             // Didn't insert because we already had this RecordId inside the map. This should only
             // happen if we're seeing a newer copy of the same doc in a more recent snapshot.
             // Throw out the newer copy of the doc.
@@ -296,12 +296,13 @@ PlanStage::StageState AndHashStage::hashOtherChildren(WorkingSetID* out) {
         // WSM with no record id.
         invariant(member->hasRecordId());
 
-        if (_dataMap.end() == _dataMap.find(member->recordId)) {
+        DataMap::iterator it = _dataMap.find(member->recordId);
+        if (_dataMap.end() == it) {
             // Ignore.  It's not in any previous child.
         } else {
             // We have a hit.  Copy data into the WSM we already have.
-            _seenMap.insert(member->recordId);
-            WorkingSetID olderMemberID = _dataMap[member->recordId];
+            it->second.lastSeenByChild = _currentChild;
+            WorkingSetID olderMemberID = it->second.id;
             WorkingSetMember* olderMember = _ws->get(olderMemberID);
             size_t memUsageBefore = olderMember->getMemUsage();
 
@@ -313,21 +314,18 @@ PlanStage::StageState AndHashStage::hashOtherChildren(WorkingSetID* out) {
         _ws->free(id);
         return PlanStage::NEED_TIME;
     } else if (PlanStage::IS_EOF == childStatus) {
-        // Finished with a child.
-        ++_currentChild;
-
-        // Keep elements of _dataMap that are in _seenMap.
+        // Keep elements of _dataMap that were seen by the child we just finished.
         DataMap::iterator it = _dataMap.begin();
         while (it != _dataMap.end()) {
-            if (_seenMap.end() == _seenMap.find(it->first)) {
+            if (it->second.lastSeenByChild != _currentChild) {
                 DataMap::iterator toErase = it;
                 ++it;
 
                 // Update memory stats.
-                WorkingSetMember* member = _ws->get(toErase->second);
+                WorkingSetMember* member = _ws->get(toErase->second.id);
                 _memUsage -= member->getMemUsage();
 
-                _ws->free(toErase->second);
+                _ws->free(toErase->second.id);
                 _dataMap.erase(toErase);
             } else {
                 ++it;
@@ -336,7 +334,8 @@ PlanStage::StageState AndHashStage::hashOtherChildren(WorkingSetID* out) {
 
         _specificStats.mapAfterChild.push_back(_dataMap.size());
 
-        _seenMap.clear();
+        // Finished with a child.
+        ++_currentChild;
 
         // _dataMap is now the intersection of the first _currentChild nodes.
 
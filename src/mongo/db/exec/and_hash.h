@@ -42,7 +42,6 @@
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/record_id.h"
 #include "mongo/stdx/unordered_map.h"
-#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 
@@ -97,16 +96,19 @@ private:
     // we place that result here.
     std::vector<WorkingSetID> _lookAheadResults;
 
+    // An entry of _dataMap. 'lastSeenByChild' is the index of the last child that produced the
+    // RecordId, which lets subsequent children mark a hit without hashing it a second time into a
+    // separate set.
+    struct DataMapEntry {
+        WorkingSetID id;
+        size_t lastSeenByChild;
+    };
+
     // _dataMap is filled out by the first child and probed by subsequent children.  This is the
     // hash table that we create by intersecting _children and probe with the last child.
-    typedef stdx::unordered_map<RecordId, WorkingSetID, RecordId::Hasher> DataMap;
+    typedef stdx::unordered_map<RecordId, DataMapEntry, RecordId::Hasher> DataMap;
     DataMap _dataMap;
 
-    // Keeps track of what elements from _dataMap subsequent children have seen.
-    // Only used while _hashingChildren.
-    typedef stdx::unordered_set<RecordId, RecordId::Hasher> SeenMap;
-    SeenMap _seenMap;
-
     // True if we're still intersecting _children[0..._children.size()-1].
     bool _hashingChildren;
 
@@ -58,6 +58,12 @@ class PlanYieldPolicy;
  * high, the plan cache entry is deactivated and we use multi-planning to select an entirely new
  * winning plan. This process is called "replanning".
  *
+ * The only feedback from execution is the number of works of this trial compared with the
+ * 'decisionWorks' stored in the cache entry. Cache entries are shared and immutable once created,
+ * so there is no per-entry history of past executions, and a shape keeps a single plan whatever
+ * the parameter values. Queries whose best plan depends on the parameters can therefore alternate
+ * between plans as entries are deactivated and replaced.
+ *
  * This stage requires all indices to stay intact during the trial period so that replanning can
  * occur with the set of indices in 'params'. As a future improvement, we could instead refresh the
  * list of indices in 'params' prior to replanning, and thus avoid inheriting from
@@ -278,6 +278,14 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
                     collPtr->getRecordStore()->waitForAllEarlierOplogWritesToBeVisible(opCtx());
                 }
 
+                if (_params.lowPriority && _lastSeenId.isNull() &&
+                    gPrefetchUnboundedUserCollectionScans.load() &&
+                    opCtx()->getClient()->isFromUserConnection()) {
+                    // An unbounded scan is likely to read much of the collection, so have the
+                    // storage engine read ahead of the cursor.
+                    shard_role_details::getRecoveryUnit(opCtx())->enablePrefetchingIfIdle();
+                }
+
                 try {
                     initCursor(opCtx(), collPtr, forward);
                 } catch (const ExceptionFor<ErrorCodes::CollectionIsEmpty>&) {
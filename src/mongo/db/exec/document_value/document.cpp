@@ -363,6 +363,22 @@ void DocumentStorage::reserveFields(size_t expectedFields) {
     _cacheEnd = _cache + newSize;
 }
 
+void DocumentStorage::reserveFields(size_t expectedFields, size_t expectedFieldNameBytes) {
+    fassert(9602800, !_cache);
+
+    unsigned buckets = HASH_TAB_INIT_SIZE;
+    while (buckets < expectedFields)
+        buckets *= 2;
+    _hashTabMask = buckets - 1;
+
+    const size_t newSize = maxBytesForFields(expectedFields, expectedFieldNameBytes);
+
+    uassert(9602801, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
+
+    _cache = static_cast<char*>(::operator new(newSize + hashTabBytes()));
+    _cacheEnd = _cache + newSize;
+}
+
 intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
     auto out = make_intrusive<DocumentStorage>(
         _bson, _bsonHasMetadata, _modified, _numBytesFromBSONInCache);
@@ -399,6 +415,58 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
     return out;
 }
 
+intrusive_ptr<DocumentStorage> DocumentStorage::cloneWithSpareCapacity(
+    size_t expectedNewFields, size_t expectedNewFieldNameBytes) const {
+    if (!_cache || expectedNewFields == 0) {
+        auto out = clone();
+        if (!out->_cache && expectedNewFields > 0) {
+            out->reserveFields(expectedNewFields, expectedNewFieldNameBytes);
+        }
+        return out;
+    }
+
+    auto out = make_intrusive<DocumentStorage>(
+        _bson, _bsonHasMetadata, _modified, _numBytesFromBSONInCache);
+
+    // Size the hash table for all the fields up front, the same way alloc() would when growing the
+    // buffer for them.
+    unsigned buckets = hashTabBuckets();
+    while ((_numFields + expectedNewFields) * 2 > buckets)
+        buckets *= 2;
+    out->_hashTabMask = buckets - 1;
+
+    const size_t newSize =
+        _usedBytes + maxBytesForFields(expectedNewFields, expectedNewFieldNameBytes);
+    uassert(9602900, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
+
+    // The positions of the fields must be the same as in this storage, so the fields are copied
+    // as is, and only the hash table is rebuilt if it has been resized.
+    out->_cache = static_cast<char*>(::operator new(newSize + out->hashTabBytes()));
+    out->_cacheEnd = out->_cache + newSize;
+    memcpy(out->_cache, _cache, _usedBytes);
+    out->_usedBytes = _usedBytes;
+    out->_numFields = _numFields;
+
+    // Tell values that they have been memcpyed (updates ref counts)
+    for (auto it = out->iteratorCacheOnly(); !it.atEnd(); it.advance()) {
+        it->val.memcpyed();
+    }
+
+    if (_numFields >= HASH_TAB_MIN) {
+        if (out->_hashTabMask == _hashTabMask) {
+            memcpy(out->_hashTab, _hashTab, hashTabBytes());
+        } else {
+            out->rehash();
+        }
+    }
+
+    out->_haveLazyLoadedMetadata = _haveLazyLoadedMetadata;
+    out->_metadataFields = _metadataFields;
+    out->_snapshottedSize = _snapshottedSize;
+
+    return out;
+}
+
 size_t DocumentStorage::getMetadataApproximateSize() const {
     return _metadataFields.getApproximateSize();
 }
@@ -657,6 +725,25 @@ MutableDocument::MutableDocument(size_t expectedFields)
     }
 }
 
+MutableDocument::MutableDocument(size_t expectedFields, size_t expectedFieldNameBytes)
+    : _storageHolder(nullptr), _storage(_storageHolder) {
+    if (expectedFields) {
+        storage().reserveFields(expectedFields, expectedFieldNameBytes);
+    }
+}
+
+void MutableDocument::reserveNewFields(size_t expectedNewFields,
+                                       size_t expectedNewFieldNameBytes) {
+    if (expectedNewFields == 0) {
+        return;
+    }
+    if (!_storage) {
+        newStorage().reserveFields(expectedNewFields, expectedNewFieldNameBytes);
+    } else if (_storage->isShared()) {
+        reset(storagePtr()->cloneWithSpareCapacity(expectedNewFields, expectedNewFieldNameBytes));
+    }
+}
+
 MutableValue MutableDocument::getNestedFieldHelper(const FieldPath& dottedField, size_t level) {
     if (level == dottedField.getPathLength() - 1) {
         return getField(dottedField.getFieldName(level));
@@ -553,11 +553,12 @@ public:
      *  @param expectedFields a hint at what the number of fields will be, if known.
      *         this can be used to increase memory allocation efficiency. There is
      *         no impact on correctness if this field over or under estimates.
-     *
-     *  TODO: find some way to convey field-name sizes to make even more efficient
+     *  @param expectedFieldNameBytes the total length of the names of the expected fields. If the
+     *         hint is an upper bound, adding the expected fields never grows the storage.
      */
     MutableDocument() : _storageHolder(nullptr), _storage(_storageHolder) {}
     explicit MutableDocument(size_t expectedFields);
+    MutableDocument(size_t expectedFields, size_t expectedFieldNameBytes);
 
     /// No copy of data yet. Copy-on-write. See storage()
     explicit MutableDocument(Document d) : _storageHolder(nullptr), _storage(_storageHolder) {
@@ -766,6 +767,15 @@ public:
         storage().makeOwned();
     }
 
+    /**
+     * A hint that up to 'expectedNewFields' fields, whose names add up to
+     * 'expectedNewFieldNameBytes', are about to be added. If the storage still has to be created
+     * or copied on write, it is done right away with enough space for the new fields, so that
+     * adding them doesn't grow the storage again. There is no impact on correctness if the hint is
+     * wrong.
+     */
+    void reserveNewFields(size_t expectedNewFields, size_t expectedNewFieldNameBytes);
+
 private:
     friend class MutableValue;  // for access to next constructor
     explicit MutableDocument(MutableValue mv) : _storageHolder(nullptr), _storage(mv.getDocPtr()) {}
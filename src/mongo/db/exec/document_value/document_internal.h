@@ -483,6 +483,11 @@ public:
      */
     void reserveFields(size_t expectedFields);
 
+    /** Same as above, but also given the total length of the names of the expected fields, so that
+     *  the preallocated space is enough to hold all of them.
+     */
+    void reserveFields(size_t expectedFields, size_t expectedFieldNameBytes);
+
     /// This returns values from the cache and underlying BSON.
     DocumentStorageIterator iterator() const {
         return DocumentStorageIterator(const_cast<DocumentStorage*>(this), BSONObjIterator(_bson));
@@ -496,6 +501,12 @@ public:
     /// Shallow copy of this. Caller owns memory.
     boost::intrusive_ptr<DocumentStorage> clone() const;
 
+    /// Same as clone(), but the copy has enough free space and hash table buckets to add
+    /// 'expectedNewFields' fields, whose names add up to 'expectedNewFieldNameBytes', without
+    /// growing its buffer. Caller owns memory.
+    boost::intrusive_ptr<DocumentStorage> cloneWithSpareCapacity(
+        size_t expectedNewFields, size_t expectedNewFieldNameBytes) const;
+
     size_t allocatedBytes() const {
         return !_cache ? 0 : (_cacheEnd - _cache + hashTabBytes());
     }
@@ -680,6 +691,13 @@ private:
         return hashKey(field) & _hashTabMask;
     }
 
+    /// Upper bound on the buffer space taken by 'numFields' fields whose names add up to
+    /// 'fieldNameBytes'. A field takes sizeof(ValueElement) + nameLen bytes rounded up to the
+    /// alignment, so padding adds at most 7 bytes to each of them.
+    static size_t maxBytesForFields(size_t numFields, size_t fieldNameBytes) {
+        return numFields * ValueElement::align(sizeof(ValueElement) + 7) + fieldNameBytes;
+    }
+
     /// Adds all fields to the hash table
     void rehash() {
         hashTabInit();
@@ -427,6 +427,48 @@ TEST(DocumentSize, ApproximateSizeDuringBuildIsUpdated) {
     ASSERT_EQ(beforeFreezeSize, frozenSize);
 }
 
+TEST(DocumentSize, ReservingFieldNamesAvoidsGrowingStorage) {
+    const std::vector<std::string> names{
+        "aRatherLongFieldName", "anotherLongFieldName", "b", "yetAnotherLongFieldName", "c"};
+    size_t nameBytes = 0;
+    for (auto&& name : names) {
+        nameBytes += name.size();
+    }
+
+    MutableDocument builder{names.size(), nameBytes};
+    const auto reservedSize = builder.peek().getCurrentApproximateSize();
+    for (size_t i = 0; i < names.size(); ++i) {
+        builder.addField(names[i], Value(static_cast<int>(i)));
+    }
+    ASSERT_EQ(reservedSize, builder.peek().getCurrentApproximateSize());
+}
+
+TEST(DocumentSize, ReservingNewFieldsAvoidsGrowingCopiedStorage) {
+    MutableDocument original;
+    for (int i = 0; i < 6; ++i) {
+        original.addField("existingField" + std::to_string(i), Value(i));
+    }
+    const Document input = original.freeze();
+
+    MutableDocument builder{input};
+    builder.reserveNewFields(10, 10 * std::string("newField0").size());
+    const auto reservedSize = builder.peek().getCurrentApproximateSize();
+    for (int i = 0; i < 10; ++i) {
+        builder.addField("newField" + std::to_string(i), Value(i));
+    }
+    ASSERT_EQ(reservedSize, builder.peek().getCurrentApproximateSize());
+
+    // The copy should find all fields, while the input is left unchanged.
+    const Document output = builder.freeze();
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_VALUE_EQ(output[StringData("existingField" + std::to_string(i))], Value(i));
+    }
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_VALUE_EQ(output[StringData("newField" + std::to_string(i))], Value(i));
+    }
+    ASSERT_EQ(6, input.computeSize());
+}
+
 TEST(ShredDocument, OutputHasNoBackingBSON) {
     BSONObj bson =
         BSON("a" << 1 << "subObj" << BSON("a" << 1) << "subArray" << BSON_ARRAY(BSON("a" << 1)));
@@ -154,7 +154,17 @@ protected:
         // allocate the number of projected fields.
         const auto maxPossibleResultingFields =
             _children.size() + _expressions.size() + _projectedFields.size();
-        return MutableDocument{maxPossibleResultingFields};
+
+        // Every output document shares the same field names, so reserve the space for all of them
+        // instead of growing the storage of each document as the fields are added.
+        size_t fieldNameBytes = 0;
+        for (auto&& field : _projectedFields) {
+            fieldNameBytes += field.size();
+        }
+        for (auto&& field : _orderToProcessAdditionsAndChildren) {
+            fieldNameBytes += field.size();
+        }
+        return MutableDocument{maxPossibleResultingFields, fieldNameBytes};
     }
     Value applyLeafProjectionToValue(const Value& value) const final {
         return value;
@@ -183,6 +183,10 @@ private:
      * Calls work on each child plan in a round-robin fashion. We stop when any plan hits EOF
      * or returns 'numResults' results.
      *
+     * The candidates can't be worked concurrently: they all read through the same
+     * OperationContext, whose locks, RecoveryUnit and storage snapshot are only usable from one
+     * thread at a time, and they yield together through the same yield policy.
+     *
      * Returns true if we need to keep working the plans and false otherwise.
      */
     bool workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy);
@@ -354,6 +354,12 @@ public:
     /**
      * Force this stage to collect timing info during its execution. Must not be called after
      * execution has started.
+     *
+     * Stages enable timing on construction for explain and for operations which may be profiled,
+     * since those are the only consumers of per-stage times of an executing plan. The summary
+     * reported to CurOp and $queryStats keeps totals for the whole plan only. MultiPlanStage also
+     * marks every candidate plan it is given, since the timings gathered during the trial period
+     * are stored in the plan cache and may be reported by explain.
      */
     void markShouldCollectTimingInfo() {
         invariant(durationCount<Microseconds>(_commonStats.executionTime.executionTimeEstimate) ==
@@ -213,6 +213,14 @@ void ProjectionNode::outputProjectedField(StringData field, Value val, MutableDo
 }
 
 void ProjectionNode::applyExpressions(const Document& root, MutableDocument* outputDoc) const {
+    // Setting the first field copies the output document's storage if it is shared with the input,
+    // so make room for the fields that may be added while copying it.
+    size_t fieldNameBytes = 0;
+    for (auto&& field : _orderToProcessAdditionsAndChildren) {
+        fieldNameBytes += field.size();
+    }
+    outputDoc->reserveNewFields(_orderToProcessAdditionsAndChildren.size(), fieldNameBytes);
+
     for (auto&& field : _orderToProcessAdditionsAndChildren) {
         auto childIt = _children.find(field);
         if (childIt != _children.end()) {
@@ -39,6 +39,7 @@
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/json.h"
+#include "mongo/db/exec/sbe/sbe_block_test_helpers.h"
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/sbe_unittest.h"
 #include "mongo/db/exec/sbe/stages/block_to_row.h"
@@ -915,4 +916,64 @@ TEST_F(BlockStagesTest, BlockToRowNoValuesFilteredObjects) {
 
     testBlockToBitmap(blocks, {std::vector<bool>{true, true, true, true, true, true}}, *expected);
 }
+
+// Tests that block_to_row only deblocks the input blocks whose output slots are actually read, and
+// doesn't deblock anything when no value passes the bitmap.
+TEST_F(BlockStagesTest, BlockToRowDeblocksLazily) {
+    auto makeChunk = [](std::vector<bool> bitset) {
+        auto [chunkTag, chunkVal] = value::makeNewArray();
+        auto chunk = value::getArrayView(chunkVal);
+
+        TestBlock readBlock;
+        UnextractableTestBlock unreadBlock;
+        value::HeterogeneousBlock bitsetBlock;
+        for (size_t i = 0; i < bitset.size(); ++i) {
+            readBlock.push_back(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(i));
+            unreadBlock.push_back(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(i));
+            bitsetBlock.push_back(value::TypeTags::Boolean, value::bitcastFrom<bool>(bitset[i]));
+        }
+        chunk->push_back(value::TypeTags::valueBlock,
+                         value::bitcastFrom<value::ValueBlock*>(readBlock.clone().release()));
+        chunk->push_back(value::TypeTags::valueBlock,
+                         value::bitcastFrom<value::ValueBlock*>(unreadBlock.clone().release()));
+        chunk->push_back(value::TypeTags::valueBlock,
+                         value::bitcastFrom<value::ValueBlock*>(bitsetBlock.clone().release()));
+        return std::pair{chunkTag, chunkVal};
+    };
+
+    auto [scanDataTag, scanDataVal] = value::makeNewArray();
+    auto scanData = value::getArrayView(scanDataVal);
+    auto [chunk1Tag, chunk1Val] = makeChunk({false, false, false});
+    scanData->push_back(chunk1Tag, chunk1Val);
+    auto [chunk2Tag, chunk2Val] = makeChunk({true, false, true});
+    scanData->push_back(chunk2Tag, chunk2Val);
+
+    auto [blockSlots, scan] = generateVirtualScanMulti(3, scanDataTag, scanDataVal);
+    // The bitmap block is only used as a bitmap and not as an input block here.
+    auto [blockToRow, outputSlots] =
+        makeBlockToRow(std::move(scan),
+                       value::SlotVector{blockSlots[0], blockSlots[1]},
+                       blockSlots[2] /* bitmap slot */);
+
+    auto ctx = makeCompileCtx();
+    prepareTree(ctx.get(), blockToRow.get());
+    auto accessor = blockToRow->getAccessor(*ctx, outputSlots[0]);
+
+    // Reading the first output slot doesn't require extracting the second block. The first
+    // chunk has no value passing the bitmap, so none of its blocks are extracted either.
+    std::vector<int32_t> results;
+    while (blockToRow->getNext() == PlanState::ADVANCED) {
+        auto [tag, val] = accessor->getViewOfValue();
+        ASSERT_EQ(tag, value::TypeTags::NumberInt32);
+        results.push_back(value::bitcastTo<int32_t>(val));
+    }
+    ASSERT(results == std::vector<int32_t>({0, 2}));
+
+    // Reading the second output slot does extract the second block.
+    blockToRow->open(true /* reOpen */);
+    ASSERT(blockToRow->getNext() == PlanState::ADVANCED);
+    ASSERT_THROWS_CODE(blockToRow->getAccessor(*ctx, outputSlots[1])->getViewOfValue(),
+                       DBException,
+                       8776400);
+}
 }  // namespace mongo::sbe
@@ -29,6 +29,8 @@
 
 #include "mongo/db/exec/sbe/stages/block_to_row.h"
 
+#include <algorithm>
+
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/values/bson.h"
@@ -38,6 +40,18 @@
 #include "mongo/util/str.h"
 
 namespace mongo::sbe {
+namespace {
+value::ValueBlock* getInputBlock(value::SlotAccessor* accessor) {
+    auto [tag, val] = accessor->getViewOfValue();
+    tassert(8625724,
+            "Expected a valueBlock or cellBlock",
+            tag == value::TypeTags::valueBlock || tag == value::TypeTags::cellBlock);
+
+    return tag == value::TypeTags::valueBlock ? value::getValueBlock(val)
+                                              : &value::getCellBlock(val)->getValueBlock();
+}
+}  // namespace
+
 BlockToRowStage::BlockToRowStage(std::unique_ptr<PlanStage> input,
                                  value::SlotVector blocks,
                                  value::SlotVector valsOut,
@@ -62,7 +76,13 @@ void BlockToRowStage::freeDeblockedValueRuns() {
         }
         _deblockedOwned = false;
     }
-    _deblockedValueRuns.clear();
+    for (auto& run : _deblockedValueRuns) {
+        run.clear();
+    }
+    std::fill(_runDeblocked.begin(), _runDeblocked.end(), false);
+    _selectivityVector.clear();
+    _numRows = 0;
+    _curIdx = 0;
 }
 
 BlockToRowStage::~BlockToRowStage() {
@@ -88,7 +108,13 @@ void BlockToRowStage::prepare(CompileCtx& ctx) {
 
     _bitmapAccessor = _children[0]->getAccessor(ctx, _bitmapSlotId);
 
-    _valsOutAccessors.resize(_blockSlotIds.size());
+    _valsOutAccessors.reserve(_blockSlotIds.size());
+    for (size_t i = 0; i < _blockSlotIds.size(); ++i) {
+        _valsOutAccessors.emplace_back(this, i);
+    }
+
+    _deblockedValueRuns.resize(_blockSlotIds.size());
+    _runDeblocked.resize(_blockSlotIds.size(), false);
 }
 
 value::SlotAccessor* BlockToRowStage::getAccessor(CompileCtx& ctx, value::SlotId slot) {
@@ -109,15 +135,11 @@ void BlockToRowStage::open(bool reOpen) {
 }
 
 PlanState BlockToRowStage::getNextFromDeblockedValues() {
-    if (_curIdx >= _deblockedValueRuns[0].size()) {
+    if (_curIdx >= _numRows) {
         return PlanState::IS_EOF;
     }
 
-    for (size_t i = 0; i < _deblockedValueRuns.size(); ++i) {
-        auto [t, v] = _deblockedValueRuns[i][_curIdx];
-        _valsOutAccessors[i].reset(t, v);
-    }
-
+    // The output accessors read the row at '_curIdx - 1', deblocking their input block on demand.
     ++_curIdx;
     return PlanState::ADVANCED;
 }
@@ -129,62 +151,54 @@ void BlockToRowStage::prepareDeblock() {
 
     // Extract the value in the bitmap slot into a selectivity vector, to determine which indexes
     // should get passed along and which should be filtered out.
-    std::vector<char> selectivityVector;
-    boost::optional<size_t> onesInBitset;
     if (_bitmapAccessor) {
         auto [bitmapTag, bitmapValue] = _bitmapAccessor->getViewOfValue();
         tassert(8044671, "Bitmap must be a block type", bitmapTag == value::TypeTags::valueBlock);
         auto bitmapBlock = value::getValueBlock(bitmapValue);
         auto extractedBitmap = bitmapBlock->extract();
 
-        selectivityVector.resize(extractedBitmap.count());
-        onesInBitset = 0;
+        _selectivityVector.resize(extractedBitmap.count());
         for (size_t i = 0; i < extractedBitmap.count(); ++i) {
             auto [t, v] = extractedBitmap[i];
             tassert(8044672, "Bitmap must contain only booleans", t == value::TypeTags::Boolean);
             auto idxPasses = value::bitcastTo<bool>(v);
-            *onesInBitset += idxPasses;
-            selectivityVector[i] = static_cast<char>(idxPasses);
+            _numRows += idxPasses;
+            _selectivityVector[i] = static_cast<char>(idxPasses);
         }
+    } else if (!_blockAccessors.empty()) {
+        _numRows = getInputBlock(_blockAccessors[0])->count();
     }
+}
 
-    for (auto acc : _blockAccessors) {
-        auto [tag, val] = acc->getViewOfValue();
-        tassert(8625724,
-                "Expected a valueBlock or cellBlock",
-                tag == value::TypeTags::valueBlock || tag == value::TypeTags::cellBlock);
-
-        auto* valueBlock = tag == value::TypeTags::valueBlock
-            ? value::getValueBlock(val)
-            : &value::getCellBlock(val)->getValueBlock();
-
-        auto deblocked = valueBlock->extract();
-        tassert(8044674,
-                "Bitmap must be same size as data blocks",
-                selectivityVector.empty() || deblocked.count() == selectivityVector.size());
-
-        // Apply the selectivity vector here, only taking the values which are included.
-        std::vector<std::pair<value::TypeTags, value::Value>> tvVec;
-        tvVec.resize(onesInBitset.get_value_or(deblocked.count()));
-
-        {
-            size_t idxInTvVec = 0;
-            for (size_t i = 0; i < deblocked.count(); ++i) {
-                if (selectivityVector.empty() || selectivityVector[i]) {
-                    tvVec[idxInTvVec++] = std::pair(deblocked[i].first, deblocked[i].second);
-                }
-            }
+void BlockToRowStage::deblockRun(size_t runIdx) {
+    tassert(9600300, "Cannot deblock values once they have been copied", !_deblockedOwned);
+
+    auto* valueBlock = getInputBlock(_blockAccessors[runIdx]);
+    auto deblocked = valueBlock->extract();
+    tassert(8044674,
+            "Bitmap must be same size as data blocks",
+            _selectivityVector.empty() || deblocked.count() == _selectivityVector.size());
+    tassert(7962151,
+            "Block's count must always be same as count of deblocked values",
+            valueBlock->count() == deblocked.count());
+
+    // Apply the selectivity vector here, only taking the values which are included.
+    auto& tvVec = _deblockedValueRuns[runIdx];
+    tvVec.resize(_numRows);
+
+    size_t idxInTvVec = 0;
+    for (size_t i = 0; i < deblocked.count(); ++i) {
+        if (_selectivityVector.empty() || _selectivityVector[i]) {
+            tassert(7962101,
+                    "All deblocked value runs for output must be same size",
+                    idxInTvVec < _numRows);
+            tvVec[idxInTvVec++] = std::pair(deblocked[i].first, deblocked[i].second);
         }
-
-        _deblockedValueRuns.emplace_back(std::move(tvVec));
-
-        tassert(7962151,
-                "Block's count must always be same as count of deblocked values",
-                valueBlock->count() == deblocked.count());
-        tassert(7962101,
-                "All deblocked value runs for output must be same size",
-                _deblockedValueRuns.back().size() == _deblockedValueRuns.front().size());
     }
+    tassert(
+        9600301, "All deblocked value runs for output must be same size", idxInTvVec == _numRows);
+
+    _runDeblocked[runIdx] = true;
 }
 
 PlanState BlockToRowStage::getNext() {
@@ -193,7 +207,7 @@ PlanState BlockToRowStage::getNext() {
     // interrupts so that we don't hold the lock on the underlying collection for too long.
     checkForInterrupt(_opCtx);
 
-    if (!_deblockedValueRuns.empty() && getNextFromDeblockedValues() == PlanState::ADVANCED) {
+    if (getNextFromDeblockedValues() == PlanState::ADVANCED) {
         return trackPlanState(PlanState::ADVANCED);
     }
 
@@ -201,8 +215,9 @@ PlanState BlockToRowStage::getNext() {
     // blocks from our child.
     while (true) {
         // We're about to call getNext() on our child and replace any state we hold in
-        // _deblockedValueRuns. If we happen to yield during this call, don't bother copying our
-        // current state since we're going to replace it in prepareDeblock() anyway.
+        // _deblockedValueRuns. Release it now so that if we happen to yield during this call, we
+        // don't bother copying (or deblocking) state we're going to replace anyway.
+        freeDeblockedValueRuns();
         disableSlotAccess();
         auto state = _children[0]->getNext();
         if (state == PlanState::IS_EOF) {
@@ -210,7 +225,6 @@ PlanState BlockToRowStage::getNext() {
         }
 
         // Got new blocks from our child, so we need to start from the beginning of the blocks.
-        _curIdx = 0;
         prepareDeblock();
 
         auto blockState = getNextFromDeblockedValues();
@@ -237,17 +251,27 @@ void BlockToRowStage::doSaveState(bool relinquishCursor) {
     // current one to be conservative. Note that copying the current value is not strictly necessary
     // when slotsAccessible() is false, but we do it anyway since it's a negligible fixed cost per
     // save/restore.
-    if (!_deblockedOwned) {
-        for (auto& run : _deblockedValueRuns) {
-            // Copy the values which have not yet been returned, starting at _curIdx.
-            for (size_t i = _curIdx; i < run.size(); ++i) {
+    //
+    // The input blocks may not survive the yield, so any block which hasn't been deblocked yet
+    // needs to be deblocked now.
+    if (!_deblockedOwned && _numRows > 0) {
+        const size_t start = _curIdx > 0 ? _curIdx - 1 : 0;
+        for (size_t runIdx = 0; runIdx < _deblockedValueRuns.size(); ++runIdx) {
+            if (!_runDeblocked[runIdx]) {
+                deblockRun(runIdx);
+            }
+
+            // Copy the values which have not yet been returned, starting at the current one.
+            auto& run = _deblockedValueRuns[runIdx];
+            for (size_t i = start; i < run.size(); ++i) {
                 auto [t, v] = run[i];
-                run[i - _curIdx] = value::copyValue(t, v);
+                run[i - start] = value::copyValue(t, v);
             }
-            run.resize(run.size() - _curIdx);
+            run.resize(run.size() - start);
         }
         _deblockedOwned = true;
-        _curIdx = 0;
+        _numRows -= start;
+        _curIdx -= start;
     }
 }
 
@@ -46,6 +46,11 @@ namespace mongo::sbe {
  * contain a block of all booleans, identical in size to the input blocks. Values that lie at an
  * index with a corresponding '0' in the bitmap will be omitted from the output.
  *
+ * Input blocks are deblocked lazily: a block is only extracted the first time its output slot is
+ * read for the current set of input blocks. Blocks whose values are never read, because no row
+ * passes the bitmap or because the consumer stops early or only reads some of the slots, are
+ * never decompressed.
+ *
  * Debug string representation:
  *
  *  block_to_row blocks[blocks[0], ..., blocks[N]] row[valsOut[0], ..., valsOut[N]] bitset
@@ -78,6 +83,28 @@ protected:
     void doSaveState(bool relinquishCursor) override;
 
 private:
+    /**
+     * Accessor for an output slot, which deblocks the corresponding input block on first access.
+     */
+    class DeblockedValueAccessor final : public value::SlotAccessor {
+    public:
+        DeblockedValueAccessor(BlockToRowStage* stage, size_t runIdx)
+            : _stage(stage), _runIdx(runIdx) {}
+
+        std::pair<value::TypeTags, value::Value> getViewOfValue() const override {
+            return _stage->getDeblockedValue(_runIdx);
+        }
+
+        std::pair<value::TypeTags, value::Value> copyOrMoveValue() override {
+            auto [tag, val] = getViewOfValue();
+            return value::copyValue(tag, val);
+        }
+
+    private:
+        BlockToRowStage* const _stage;
+        const size_t _runIdx;
+    };
+
     PlanState getNextFromDeblockedValues();
     void freeDeblockedValueRuns();
 
@@ -85,18 +112,40 @@ private:
 
     void prepareDeblock();
 
+    /**
+     * Extracts the values of the input block at 'runIdx' which pass the bitmap, if not done yet.
+     */
+    void deblockRun(size_t runIdx);
+
+    std::pair<value::TypeTags, value::Value> getDeblockedValue(size_t runIdx) {
+        if (_curIdx == 0) {
+            return {value::TypeTags::Nothing, value::Value{0u}};
+        }
+        if (!_runDeblocked[runIdx]) {
+            deblockRun(runIdx);
+        }
+        return _deblockedValueRuns[runIdx][_curIdx - 1];
+    }
+
     const value::SlotVector _blockSlotIds;
     const value::SlotVector _valsOutSlotIds;
     const value::SlotId _bitmapSlotId;
 
     // Values extracted from the blocks. The memory for these values are owned by the blocks in the
-    // '_blocks' member.
+    // '_blocks' member. A run is only populated once '_runDeblocked' is set for it.
     std::vector<std::vector<std::pair<value::TypeTags, value::Value>>> _deblockedValueRuns;
+    std::vector<char> _runDeblocked;
     bool _deblockedOwned = false;
 
+    // Selectivity vector extracted from the bitmap for the current blocks, empty if there is no
+    // bitmap.
+    std::vector<char> _selectivityVector;
+    // Number of rows to produce for the current blocks.
+    size_t _numRows = 0;
+
     std::vector<value::SlotAccessor*> _blockAccessors;
     value::SlotAccessor* _bitmapAccessor = nullptr;
-    std::vector<value::ViewOfValueAccessor> _valsOutAccessors;
+    std::vector<DeblockedValueAccessor> _valsOutAccessors;
 
     // Keeps track of the current reading index of the blocks.
     size_t _curIdx = 0;
@@ -30,6 +30,7 @@
 // IWYU pragma: no_include "cxxabi.h"
 // IWYU pragma: no_include "ext/alloc_traits.h"
 #include <absl/container/inlined_vector.h>
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/smart_ptr.hpp>
 #include <functional>
@@ -44,8 +45,13 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/sbe/stages/exchange.h"
+#include "mongo/db/s/operation_sharding_state.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/db/transaction_resources.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/future_impl.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 std::unique_ptr<ThreadPool> s_globalThreadPool;
@@ -55,9 +61,8 @@ MONGO_INITIALIZER(s_globalThreadPool)(InitializerContext* context) {
     options.threadNamePrefix = "ExchProd";
     options.minThreads = 0;
     options.maxThreads = 128;
-    options.onCreateThread = [](const std::string& name) {
-        Client::initThread(name, getGlobalServiceContext()->getService(ClusterRole::ShardServer));
-    };
+    // Every producer creates its own Client from the Service of the consumer's operation, so the
+    // pool threads themselves do not have one.
     s_globalThreadPool = std::make_unique<ThreadPool>(options);
     s_globalThreadPool->startup();
 }
@@ -83,10 +88,17 @@ void ExchangePipe::close() {
     _cond.notify_all();
 }
 
-std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer() {
+std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer(OperationContext* opCtx) {
     stdx::unique_lock lock(_mutex);
 
-    _cond.wait(lock, [this]() { return _closed || _emptyCount > 0; });
+    auto pred = [this]() {
+        return _closed || _emptyCount > 0;
+    };
+    if (opCtx) {
+        opCtx->waitForConditionOrInterrupt(_cond, lock, pred);
+    } else {
+        _cond.wait(lock, pred);
+    }
 
     if (_closed) {
         return nullptr;
@@ -97,10 +109,17 @@ std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer() {
     return std::move(_emptyBuffers[_emptyCount]);
 }
 
-std::unique_ptr<ExchangeBuffer> ExchangePipe::getFullBuffer() {
+std::unique_ptr<ExchangeBuffer> ExchangePipe::getFullBuffer(OperationContext* opCtx) {
     stdx::unique_lock lock(_mutex);
 
-    _cond.wait(lock, [this]() { return _closed || _fullCount != _fullPosition; });
+    auto pred = [this]() {
+        return _closed || _fullCount != _fullPosition;
+    };
+    if (opCtx) {
+        opCtx->waitForConditionOrInterrupt(_cond, lock, pred);
+    } else {
+        _cond.wait(lock, pred);
+    }
 
     if (_closed) {
         return nullptr;
@@ -143,6 +162,32 @@ ExchangeState::ExchangeState(size_t numOfProducers,
       _partition(std::move(partition)),
       _orderLess(std::move(orderLess)) {}
 
+void ExchangeState::registerProducerOpCtx(OperationContext* opCtx) {
+    stdx::lock_guard lk(_producerOpCtxsMutex);
+    _producerOpCtxs.push_back(opCtx);
+    if (_producerKillCode) {
+        ClientLock clientLock(opCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, opCtx, *_producerKillCode);
+    }
+}
+
+void ExchangeState::unregisterProducerOpCtx(OperationContext* opCtx) {
+    stdx::lock_guard lk(_producerOpCtxsMutex);
+    _producerOpCtxs.erase(std::find(_producerOpCtxs.begin(), _producerOpCtxs.end(), opCtx));
+}
+
+void ExchangeState::killProducers(ErrorCodes::Error killCode) {
+    stdx::lock_guard lk(_producerOpCtxsMutex);
+    if (_producerKillCode) {
+        return;
+    }
+    _producerKillCode = killCode;
+    for (auto opCtx : _producerOpCtxs) {
+        ClientLock clientLock(opCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, opCtx, killCode);
+    }
+}
+
 ExchangePipe* ExchangeState::pipe(size_t consumerTid, size_t producerTid) {
     return _consumers[consumerTid]->pipe(producerTid);
 }
@@ -162,7 +207,15 @@ ExchangeBuffer* ExchangeConsumer::getBuffer(size_t producerId) {
         return _fullBuffers[producerId].get();
     }
 
-    _fullBuffers[producerId] = _pipes[producerId]->getFullBuffer();
+    try {
+        _opCtx->checkForInterrupt();
+        _fullBuffers[producerId] = _pipes[producerId]->getFullBuffer(_opCtx);
+    } catch (const DBException& ex) {
+        // The consumer's operation was interrupted (killOp, maxTimeMS, shutdown). Pass the
+        // interruption on so that the producers stop as well.
+        _state->killProducers(ex.code());
+        throw;
+    }
 
     return _fullBuffers[producerId].get();
 }
@@ -265,6 +318,7 @@ void ExchangeConsumer::open(bool reOpen) {
             _bufferPos.emplace_back(0);
         }
         _eofs = 0;
+        _pipeClosedByProducer = false;
 
         if (_tid == 0) {
             // Consumer ID 0
@@ -292,22 +346,54 @@ void ExchangeConsumer::open(bool reOpen) {
                 }
             }
 
-            // Start n producers.
+            // The producers read like this operation does.
+            ExchangeState::ReadSettings readSettings;
+            readSettings.readConcern = repl::ReadConcernArgs::get(_opCtx);
+            auto ru = shard_role_details::getRecoveryUnit(_opCtx);
+            readSettings.readSource = ru->getTimestampReadSource();
+            if (readSettings.readSource == RecoveryUnit::ReadSource::kProvided) {
+                readSettings.readTimestamp = ru->getPointInTimeReadTimestamp(_opCtx);
+            }
+            if (const auto& coll = _state->producerCollection()) {
+                auto& oss = OperationShardingState::get(_opCtx);
+                readSettings.placementConcern = {oss.getDbVersion(coll->first.dbName()),
+                                                 oss.getShardVersion(coll->first)};
+            }
+            _state->setProducerReadSettings(std::move(readSettings));
+
+            // Start n producers. Each runs on a child operation of the consumer's operation which
+            // inherits its deadline; interrupting the consumer interrupts the producers as well.
             invariant(_state->producerCompileCtxs().size() == _state->numOfProducers());
+            auto service = _opCtx->getService();
+            auto deadline = _opCtx->getDeadline();
+            auto timeoutError = _opCtx->getTimeoutError();
             for (size_t idx = 0; idx < _state->numOfProducers(); ++idx) {
                 auto pf = makePromiseFuture<void>();
-                s_globalThreadPool->schedule(
-                    [this, idx, promise = std::move(pf.promise)](auto status) mutable {
-                        invariant(status);
+                s_globalThreadPool->schedule([state = _state,
+                                              idx,
+                                              service,
+                                              deadline,
+                                              timeoutError,
+                                              promise = std::move(pf.promise)](
+                                                 auto status) mutable {
+                    invariant(status);
+
+                    auto client = service->makeClient("ExchProd");
+                    AlternativeClientRegion acr(client);
+                    auto opCtx = cc().makeOperationContext();
+                    if (deadline != Date_t::max()) {
+                        opCtx->setDeadlineByDate(deadline, timeoutError);
+                    }
 
-                        auto opCtx = cc().makeOperationContext();
+                    state->registerProducerOpCtx(opCtx.get());
+                    ON_BLOCK_EXIT([&] { state->unregisterProducerOpCtx(opCtx.get()); });
 
-                        promise.setWith([&] {
-                            ExchangeProducer::start(opCtx.get(),
-                                                    _state->producerCompileCtxs()[idx],
-                                                    std::move(_state->producerPlans()[idx]));
-                        });
+                    promise.setWith([&] {
+                        ExchangeProducer::start(opCtx.get(),
+                                                state->producerCompileCtxs()[idx],
+                                                std::move(state->producerPlans()[idx]));
                     });
+                });
                 _state->addProducerFuture(std::move(pf.future));
             }
         } else {
@@ -344,6 +430,7 @@ PlanState ExchangeConsumer::getNext() {
             auto buffer = getBuffer(0);
             if (!buffer) {
                 // early out
+                _pipeClosedByProducer = true;
                 return trackPlanState(PlanState::IS_EOF);
             }
             if (_bufferPos[0] < buffer->count()) {
@@ -372,6 +459,15 @@ void ExchangeConsumer::close() {
 
     trackClose();
 
+    // If this consumer stops on its own before every producer reached EOF (a limit above the
+    // exchange or an error in the consumer), stop the producers rather than letting them run to
+    // the end of their input. Their results are not needed, so their errors are not reported. A
+    // pipe closed by a failed producer is not an early out: that producer's error is rethrown.
+    const bool earlyOut = _eofs < _state->numOfProducers() && !_pipeClosedByProducer;
+    if (earlyOut) {
+        _state->killProducers(ErrorCodes::QueryPlanKilled);
+    }
+
     {
         stdx::unique_lock lock(_state->consumerCloseMutex());
         ++_state->consumerClose();
@@ -403,7 +499,10 @@ void ExchangeConsumer::close() {
     if (_tid == 0) {
         // Consumer ID 0
         for (size_t idx = 0; idx < _state->numOfProducers(); ++idx) {
-            _state->producerResults()[idx].get();
+            auto status = _state->producerResults()[idx].getNoThrow();
+            if (!earlyOut) {
+                uassertStatusOK(status);
+            }
         }
     }
 }
@@ -481,7 +580,7 @@ ExchangeBuffer* ExchangeProducer::getBuffer(size_t consumerId) {
         return _emptyBuffers[consumerId].get();
     }
 
-    _emptyBuffers[consumerId] = _pipes[consumerId]->getEmptyBuffer();
+    _emptyBuffers[consumerId] = _pipes[consumerId]->getEmptyBuffer(_opCtx);
 
     if (!_emptyBuffers[consumerId]) {
         closePipes();
@@ -527,14 +626,41 @@ void ExchangeProducer::start(OperationContext* opCtx,
                              std::unique_ptr<PlanStage> producer) {
     ExchangeProducer* p = static_cast<ExchangeProducer*>(producer.get());
 
+    const auto& readSettings = p->_state->producerReadSettings();
+    repl::ReadConcernArgs::get(opCtx) = readSettings.readConcern;
+    if (readSettings.readSource != RecoveryUnit::ReadSource::kNoTimestamp) {
+        shard_role_details::getRecoveryUnit(opCtx)->setTimestampReadSource(
+            readSettings.readSource, readSettings.readTimestamp);
+    }
+
+    // A producer which reads a collection holds its own acquisition of it, at the consumer's
+    // placement, so the collection stays valid for the producer even while the consumer's
+    // operation yields. Otherwise just take the global lock.
     // TODO: SERVER-62925. Rationalize this lock.
-    // Also review if the threads should remain killable. Currently threads with IS mode global
-    // lock would not be made kill target but if this lock mode changes, the initialization of
-    // s_globalThreadPool should be reviewed.
-    Lock::GlobalLock lock(opCtx, MODE_IS);
+    boost::optional<CollectionAcquisition> acquisition;
+    boost::optional<Lock::GlobalLock> lock;
+    if (const auto& coll = p->_state->producerCollection()) {
+        acquisition.emplace(acquireCollectionMaybeLockFree(
+            opCtx,
+            CollectionAcquisitionRequest(coll->first,
+                                         coll->second,
+                                         readSettings.placementConcern,
+                                         readSettings.readConcern,
+                                         AcquisitionPrerequisites::kRead)));
+    } else {
+        lock.emplace(opCtx, MODE_IS);
+    }
 
     p->attachToOperationContext(opCtx);
 
+    // A producer which holds its acquisition yields it periodically through its own policy, like
+    // the consumer's operation would, rather than pinning its snapshot until it reaches EOF.
+    std::unique_ptr<PlanYieldPolicy> yieldPolicy;
+    if (acquisition && p->_state->producerYieldPolicyFactory()) {
+        yieldPolicy = p->_state->producerYieldPolicyFactory()(opCtx, p);
+        p->attachNewYieldPolicy(yieldPolicy.get());
+    }
+
     try {
         p->prepare(ctx);
         p->open(false);
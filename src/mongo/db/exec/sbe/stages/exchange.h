@@ -30,7 +30,9 @@
 #pragma once
 
 #include <boost/move/utility_core.hpp>
+#include <boost/optional/optional.hpp>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -44,14 +46,20 @@
 #include "mongo/db/exec/sbe/values/slot.h"
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/exec/sbe/vm/vm.h"
+#include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/query/plan_yield_policy.h"
 #include "mongo/db/query/stage_types.h"
+#include "mongo/db/repl/read_concern_args.h"
+#include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/transaction_resources.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/future.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/future.h"
+#include "mongo/util/uuid.h"
 
 namespace mongo::sbe {
 class ExchangeConsumer;
@@ -137,8 +145,10 @@ public:
     ExchangePipe(size_t size);
 
     void close();
-    std::unique_ptr<ExchangeBuffer> getEmptyBuffer();
-    std::unique_ptr<ExchangeBuffer> getFullBuffer();
+
+    // If 'opCtx' is provided, the wait for a buffer is interruptible.
+    std::unique_ptr<ExchangeBuffer> getEmptyBuffer(OperationContext* opCtx = nullptr);
+    std::unique_ptr<ExchangeBuffer> getFullBuffer(OperationContext* opCtx = nullptr);
     void putEmptyBuffer(std::unique_ptr<ExchangeBuffer>);
     void putFullBuffer(std::unique_ptr<ExchangeBuffer>);
 
@@ -188,6 +198,57 @@ public:
         _producerResults.emplace_back(std::move(f));
     }
 
+    /**
+     * Makes every producer acquire the collection 'nss' (which must have the given 'uuid') for
+     * reading while it runs, rather than relying on the locks held by the consumer's operation.
+     */
+    void setProducerCollection(NamespaceString nss, UUID uuid) {
+        _producerCollection.emplace(std::move(nss), uuid);
+    }
+    const auto& producerCollection() const {
+        return _producerCollection;
+    }
+
+    /**
+     * Builds the yield policy of a producer which acquires the collection, for the producer's
+     * operation and plan. Without it the producers hold their snapshot until they reach EOF.
+     */
+    using ProducerYieldPolicyFactory =
+        std::function<std::unique_ptr<PlanYieldPolicy>(OperationContext*, PlanStage*)>;
+    void setProducerYieldPolicyFactory(ProducerYieldPolicyFactory factory) {
+        _producerYieldPolicyFactory = std::move(factory);
+    }
+    const auto& producerYieldPolicyFactory() const {
+        return _producerYieldPolicyFactory;
+    }
+
+    /**
+     * How the consumer's operation reads. It is captured when the exchange is opened and copied
+     * to the operation of every producer, so that the producers read the same data at the same
+     * placement as the consumer would.
+     */
+    struct ReadSettings {
+        repl::ReadConcernArgs readConcern;
+        RecoveryUnit::ReadSource readSource{RecoveryUnit::ReadSource::kNoTimestamp};
+        boost::optional<Timestamp> readTimestamp;
+        PlacementConcern placementConcern;
+    };
+    void setProducerReadSettings(ReadSettings settings) {
+        _producerReadSettings = std::move(settings);
+    }
+    const auto& producerReadSettings() const {
+        return _producerReadSettings;
+    }
+
+    /**
+     * Producers run on their own operation contexts. They are registered here for the duration of
+     * their run so that an interrupted consumer can interrupt them as well. A producer which
+     * registers after 'killProducers()' has been called is interrupted immediately.
+     */
+    void registerProducerOpCtx(OperationContext* opCtx);
+    void unregisterProducerOpCtx(OperationContext* opCtx);
+    void killProducers(ErrorCodes::Error killCode);
+
     auto& consumerOpenMutex() {
         return _consumerOpenMutex;
     }
@@ -248,6 +309,15 @@ private:
     std::vector<CompileCtx> _producerCompileCtxs;
     std::vector<Future<void>> _producerResults;
 
+    boost::optional<std::pair<NamespaceString, UUID>> _producerCollection;
+    ProducerYieldPolicyFactory _producerYieldPolicyFactory;
+    ReadSettings _producerReadSettings;
+
+    mongo::Mutex _producerOpCtxsMutex =
+        MONGO_MAKE_LATCH("ExchangeState::_producerOpCtxsMutex");
+    std::vector<OperationContext*> _producerOpCtxs;
+    boost::optional<ErrorCodes::Error> _producerKillCode;
+
     // Variables (fields) that pass through the exchange.
     const value::SlotVector _fields;
 
@@ -298,6 +368,20 @@ public:
     ExchangePipe* pipe(size_t producerTid);
     size_t estimateCompileTimeSize() const final;
 
+    /**
+     * See ExchangeState::setProducerCollection().
+     */
+    void setProducerCollection(NamespaceString nss, UUID uuid) {
+        _state->setProducerCollection(std::move(nss), uuid);
+    }
+
+    /**
+     * See ExchangeState::setProducerYieldPolicyFactory().
+     */
+    void setProducerYieldPolicyFactory(ExchangeState::ProducerYieldPolicyFactory factory) {
+        _state->setProducerYieldPolicyFactory(std::move(factory));
+    }
+
 private:
     ExchangeBuffer* getBuffer(size_t producerId);
     void putBuffer(size_t producerId);
@@ -320,6 +404,9 @@ private:
     // Count how may EOFs we have seen so far.
     size_t _eofs{0};
 
+    // Set when a producer closed the pipe before sending its EOF, which means it failed.
+    bool _pipeClosedByProducer{false};
+
     bool _orderPreserving{false};
 
     size_t _rowProcessed{0};
@@ -322,8 +322,10 @@ void HashAggStage::open(bool reOpen) {
             dassert(_htIt == _ht->find(key));
             if (_htIt == _ht->end()) {
                 // The key is not present in the hash table yet, so we insert it and initialize the
-                // corresponding accumulator. Note that as a future optimization, we could avoid
-                // doing a lookup both in the 'find()' call and in 'emplace()'.
+                // corresponding accumulator. This looks the key up a second time in 'emplace()':
+                // 'key' only holds views of the child's values, and the table's copy must be owned,
+                // so a single try_emplace() of 'key' would store an unowned key. The second lookup
+                // is only paid once per distinct key.
                 newKey = true;
                 value::MaterializedRow keyCopy(key);
                 keyCopy.makeOwned();
@@ -65,6 +65,10 @@ namespace mongo::sbe {
  * This is _not_ the case for the 'outer' side, since it can stream data as it probes the hash
  * table. This stage preserves all slots and order of the 'outer' side.
  *
+ * The 'inner' side is always read in full, before the first 'outer' row is seen. Because the
+ * 'outer' keys are not known while the hash table is built, there is no filter on them that could
+ * be pushed down into the 'inner' scan.
+ *
  * The 'outerKeySlot' specifies the slot that contains match keys for the 'outer' row. If the
  * 'outerKeySlot' slot contains an array, the array items will be used as match keys, otherwise the
  * slot value itself will be used a single match key.
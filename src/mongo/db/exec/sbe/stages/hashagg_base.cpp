@@ -160,18 +160,47 @@ void HashAggBaseStage<Derived>::spillRowToDisk(const value::MaterializedRow& key
     kb.appendNumberLong(_ridSuffixCounter++);
     auto rid = RecordId(kb.getBuffer(), kb.getSize());
 
+    BufBuilder buf;
     if (collator) {
         // The keystring cannot always be deserialized back to the original keys when a collation is
         // in use, so we also store the unmodified key in the data part of the spilled record.
-        _recordStore->upsertToRecordStore(_opCtx, rid, key, val, false /*update*/);
+        key.serializeForSorter(buf);
+        val.serializeForSorter(buf);
     } else {
+        val.serializeForSorter(buf);
         auto typeBits = kb.getTypeBits();
-        _recordStore->upsertToRecordStore(_opCtx, rid, val, typeBits, false /*update*/);
+        buf.appendBuf(typeBits.getBuffer(), typeBits.getSize());
+    }
+
+    auto size = buf.len();
+    auto buffer = buf.release();
+    _spillBatch.push_back(Record{std::move(rid), RecordData(buffer.get(), size)});
+    _spillBatchBuffers.push_back(std::move(buffer));
+    _spillBatchBytes += size;
+    if (_spillBatch.size() >= kSpillBatchMaxRecords || _spillBatchBytes >= kSpillBatchMaxBytes) {
+        flushSpillBatch();
     }
 
     static_cast<Derived*>(this)->getHashAggStats()->spilledRecords++;
 }
 
+template <class Derived>
+void HashAggBaseStage<Derived>::flushSpillBatch() {
+    if (_spillBatch.empty()) {
+        return;
+    }
+
+    std::vector<Timestamp> timestamps(_spillBatch.size());
+    auto status = _recordStore->insertRecords(_opCtx, &_spillBatch, timestamps);
+    tassert(9609400,
+            str::stream() << "Failed to write to disk because " << status.reason(),
+            status.isOK());
+
+    _spillBatch.clear();
+    _spillBatchBuffers.clear();
+    _spillBatchBytes = 0;
+}
+
 template <class Derived>
 void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd) {
     uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
@@ -190,6 +219,7 @@ void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd) {
     for (auto&& it : *_ht) {
         spillRowToDisk(it.first, it.second);
     }
+    flushSpillBatch();
 
     _ht->clear();
 
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "mongo/db/exec/sbe/values/row.h"
 #include "mongo/db/exec/sbe/values/value.h"
@@ -128,14 +129,21 @@ protected:
     void makeTemporaryRecordStore();
 
     /**
-     * Inserts a key and value pair to the '_recordStore'. They key is serialized to a
-     * 'key_string::Value' which becomes the 'RecordId'.
+     * Serializes a key and value pair into a record for the '_recordStore' and appends it to
+     * '_spillBatch'. The key is serialized to a 'key_string::Value' which becomes the 'RecordId'.
+     * The batch is written out by flushSpillBatch() once it is large enough.
      *
      * Note that the 'typeBits' are needed to reconstruct the spilled 'key' to a 'MaterializedRow',
      * but are not necessary for comparison purposes. Therefore, we carry the type bits separately
      * from the record id, instead appending them to the end of the serialized 'val' buffer.
      */
     void spillRowToDisk(const value::MaterializedRow& key, const value::MaterializedRow& val);
+
+    /**
+     * Inserts all the records in '_spillBatch' into the '_recordStore' in a single storage
+     * transaction, rather than paying for one transaction per spilled row.
+     */
+    void flushSpillBatch();
     void spill(MemoryCheckData& mcd);
     void checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd);
 
@@ -165,6 +173,14 @@ protected:
     // key. We ensure uniqueness by appending a unique integer to the end of this key, which is
     // simply ignored during deserialization.
     int64_t _ridSuffixCounter = 0;
+
+    // Spilled records which have not been written to the '_recordStore' yet, along with the
+    // buffers which own their data. Always empty outside of spill().
+    static constexpr size_t kSpillBatchMaxRecords = 1000;
+    static constexpr size_t kSpillBatchMaxBytes = 16 * 1024 * 1024;
+    std::vector<Record> _spillBatch;
+    std::vector<SharedBuffer> _spillBatchBuffers;
+    size_t _spillBatchBytes = 0;
 };
 
 }  // namespace sbe
@@ -29,6 +29,8 @@
 
 #include "mongo/db/exec/sbe/stages/lookup_hash_table.h"
 
+#include <algorithm>
+
 #include "mongo/db/curop.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 
@@ -150,6 +152,9 @@ std::tuple<bool, value::TypeTags, value::Value> LookupHashTable::normalizeString
 
 boost::optional<std::vector<size_t>> LookupHashTable::readIndicesFromRecordStore(
     SpillingStore* rs, value::TypeTags tagKey, value::Value valKey) {
+    if (!mayHaveSpilledKey(tagKey, valKey)) {
+        return boost::none;
+    }
     _htProbeKey.reset(0, false, tagKey, valKey);
 
     auto [rid, _] = serializeKeyForRecordStore(_htProbeKey);
@@ -298,8 +303,9 @@ void LookupHashTable::spillIndicesToRecordStore(SpillingStore* rs,
                                                 const std::vector<size_t>& value) {
     CurOp::get(_opCtx)->debug().hashLookupSpillToDisk += 1;
 
+    // The normalized key must outlive the reads and writes below, which reuse '_htProbeKey'.
     auto [owned, tagKeyColl, valKeyColl] = normalizeStringIfCollator(tagKey, valKey);
-    _htProbeKey.reset(0, owned, tagKeyColl, valKeyColl);
+    value::ValueGuard keyGuard{owned, tagKeyColl, valKeyColl};
 
     auto valFromRs = readIndicesFromRecordStore(rs, tagKeyColl, valKeyColl);
 
@@ -315,6 +321,45 @@ void LookupHashTable::spillIndicesToRecordStore(SpillingStore* rs,
     }
 
     writeIndicesToRecordStore(rs, tagKeyColl, valKeyColl, *valFromRs, update);
+    if (!update) {
+        addToSpilledKeyFilter(tagKeyColl, valKeyColl);
+    }
+}
+
+namespace {
+// Number of bits set in '_spilledKeyFilter' for each spilled key.
+constexpr size_t kSpilledKeyFilterProbes = 3;
+
+// Returns the bit positions in a filter of 'numBits' bits for the key hashing to 'hash'. The
+// probes are derived from the single hash by double hashing.
+template <typename Callback>
+void forEachSpilledKeyFilterBit(size_t hash, size_t numBits, Callback&& callback) {
+    const uint64_t h1 = hash;
+    const uint64_t h2 = (h1 * 0x9E3779B97F4A7C15ULL) | 1;
+    for (size_t i = 0; i < kSpilledKeyFilterProbes; ++i) {
+        callback((h1 + i * h2) % numBits);
+    }
+}
+}  // namespace
+
+void LookupHashTable::addToSpilledKeyFilter(value::TypeTags tagKey, value::Value valKey) {
+    // The key is already normalized for the collator, so it is hashed without it.
+    const auto numBits = _spilledKeyFilter.size() * 64;
+    forEachSpilledKeyFilterBit(value::hashValue(tagKey, valKey), numBits, [&](size_t bit) {
+        _spilledKeyFilter[bit / 64] |= uint64_t{1} << (bit % 64);
+    });
+}
+
+bool LookupHashTable::mayHaveSpilledKey(value::TypeTags tagKey, value::Value valKey) const {
+    if (_spilledKeyFilter.empty()) {
+        return false;
+    }
+    const auto numBits = _spilledKeyFilter.size() * 64;
+    bool found = true;
+    forEachSpilledKeyFilterBit(value::hashValue(tagKey, valKey), numBits, [&](size_t bit) {
+        found = found && (_spilledKeyFilter[bit / 64] & (uint64_t{1} << (bit % 64)));
+    });
+    return found;
 }
 
 void LookupHashTable::makeTemporaryRecordStore() {
@@ -330,6 +375,11 @@ void LookupHashTable::makeTemporaryRecordStore() {
     _recordStoreBuf = std::make_unique<SpillingStore>(_opCtx, KeyFormat::Long);
     _recordStoreHt = std::make_unique<SpillingStore>(_opCtx, KeyFormat::String);
     _hashLookupStats.usedDisk = true;
+
+    // Size the filter at one bit per byte of the memory limit, with a floor for small limits. It
+    // is not counted against the limit, of which it is an eighth.
+    const size_t filterBits = std::max<long long>(_memoryUseInBytesBeforeSpill, 1024 * 1024);
+    _spilledKeyFilter.assign(filterBits / 64, 0);
 }
 
 std::pair<RecordId, key_string::TypeBits> LookupHashTable::serializeKeyForRecordStore(
@@ -371,6 +421,10 @@ void LookupHashTable::reset(bool fromClose) {
     if (_recordStoreBuf) {
         _recordStoreBuf.reset(nullptr);
     }
+    _spilledKeyFilter.clear();
+    if (fromClose) {
+        _spilledKeyFilter.shrink_to_fit();
+    }
 
     // Erase but don't change its reference, as 'HashLookupStage::_outInnerBufferProjectAccessor'
     // contain a reference to this buffer.
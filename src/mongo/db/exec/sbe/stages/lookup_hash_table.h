@@ -262,6 +262,18 @@ private:
 
     void makeTemporaryRecordStore();
 
+    /**
+     * Records the key (tagKey, valKey), which must already be normalized for the collator, in
+     * '_spilledKeyFilter'.
+     */
+    void addToSpilledKeyFilter(value::TypeTags tagKey, value::Value valKey);
+
+    /**
+     * Returns false if the key (tagKey, valKey), which must already be normalized for the
+     * collator, was never spilled to '_recordStoreHt'. May return true for keys that were not.
+     */
+    bool mayHaveSpilledKey(value::TypeTags tagKey, value::Value valKey) const;
+
     /**
      * Normalizes a string if '_collator' is populated and returns a third parameter to let the
      * caller know if it should own the tag and value.
@@ -320,6 +332,11 @@ private:
     // Documents of the inner collection that have spilled to disk.
     std::unique_ptr<SpillingStore> _recordStoreBuf;
 
+    // Bloom filter over the keys spilled to '_recordStoreHt'. Once the hash table has spilled,
+    // every probe for a key that is not in '_memoryHt' would otherwise be a random read from disk,
+    // including probes for keys the inner side never had.
+    std::vector<uint64_t> _spilledKeyFilter;
+
     // Next inner collection document index.
     size_t _valueId{0};
 
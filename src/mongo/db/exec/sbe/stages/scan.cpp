@@ -382,6 +382,12 @@ void ScanStage::scanResetState(bool reOpen) {
         if (!reOpen ||
             (!_seekRecordIdAccessor &&
              (_state->forward ? !_minRecordIdAccessor : !_maxRecordIdAccessor))) {
+            if (!reOpen && _lowPriority && gPrefetchUnboundedUserCollectionScans.load() &&
+                _opCtx->getClient()->isFromUserConnection()) {
+                // An unbounded scan is likely to read much of the collection, so have the storage
+                // engine read ahead of the cursor.
+                shard_role_details::getRecoveryUnit(_opCtx)->enablePrefetchingIfIdle();
+            }
             _cursor = _coll.getPtr()->getCursor(_opCtx, _state->forward);
         }
         if (_seekRecordIdAccessor) {
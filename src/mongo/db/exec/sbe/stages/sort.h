@@ -66,7 +66,10 @@ namespace mongo::sbe {
  * materialized rows to disk.
  *
  * If 'limit' is not std::numeric_limits<size_t>::max(), then this is a top-k sort that should only
- * return the number of rows given by the limit.
+ * return the number of rows given by the limit. The sorter compares the keys of each incoming row
+ * against its current top k and only materializes the values of rows that are kept. The current
+ * boundary is not pushed down, so the child still produces every row; the child subtree is
+ * compiled with fixed predicates and index bounds before the sort reads its first row.
  *
  * This stage is a binding reflector, meaning that only the 'obs' and 'vals' slots are visible to
  * nodes higher in the tree.
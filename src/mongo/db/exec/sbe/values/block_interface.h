@@ -186,6 +186,12 @@ struct DeblockedTagValStorage {
     bool owned{false};
 };
 
+/**
+ * Comparison operators which blocks may be able to evaluate against a scalar directly on their
+ * underlying format, see ValueBlock::tryCompareScalar().
+ */
+enum class ScalarCompareOp { kLt, kLte, kGt, kGte, kEq };
+
 /**
  * Interface for accessing a sequence of SBE Values independent of their backing storage.
  *
@@ -309,6 +315,18 @@ struct ValueBlock {
      */
     virtual std::unique_ptr<ValueBlock> exists();
 
+    /**
+     * Returns a block of booleans holding the result of comparing each value in this block against
+     * the scalar (rhsTag, rhsVal) using 'op', computed directly on the underlying format of the
+     * block without extracting it. Nothings are mapped to Nothing. Returns nullptr if the block
+     * can't evaluate this comparison natively, in which case the caller should fall back to map().
+     */
+    virtual std::unique_ptr<ValueBlock> tryCompareScalar(ScalarCompareOp op,
+                                                         TypeTags rhsTag,
+                                                         Value rhsVal) {
+        return nullptr;
+    }
+
     std::unique_ptr<ValueBlock> mapMonotonicFastPath(const ColumnOp& op);
 
     /**
@@ -29,12 +29,14 @@
 
 #include "mongo/db/exec/sbe/values/ts_block.h"
 
+#include <bit>
 #include <cstddef>
 #include <memory>
 #include <tuple>
 #include <utility>
 
 #include "mongo/bson/util/bsoncolumn.h"
+#include "mongo/bson/util/bsoncolumn_expressions.h"
 #include "mongo/db/exec/sbe/values/block_interface.h"
 #include "mongo/db/exec/sbe/values/bson_block.h"
 #include "mongo/db/exec/sbe/values/bsoncolumn_materializer.h"
@@ -704,6 +706,71 @@ std::unique_ptr<ValueBlock> TsBlock::fillEmpty(TypeTags fillTag, Value fillVal)
     return _decompressedBlock->fillEmpty(fillTag, fillVal);
 }
 
+std::unique_ptr<ValueBlock> TsBlock::tryCompareScalar(ScalarCompareOp op,
+                                                      TypeTags rhsTag,
+                                                      Value rhsVal) {
+    // Once decompressed, the comparison is handled natively by the decompressed block. Otherwise
+    // we can only evaluate it on a BSONColumn using block-based decoding, and only when the control
+    // values tell us the column holds numbers.
+    if (_decompressedBlock || _blockTag != TypeTags::bsonBinData ||
+        !_blockBasedDecompressionEnabled || !hasNoObjsOrArrays() || !isNumber(_controlMin.first)) {
+        return nullptr;
+    }
+
+    // Only provide a comparand where comparing against it is exact for the element type, matching
+    // the native comparisons done on decompressed blocks.
+    mongo::bsoncolumn::NumericComparand rhs;
+    if (rhsTag == TypeTags::NumberInt32 || rhsTag == TypeTags::NumberInt64) {
+        rhs.integer = numericCast<int64_t>(rhsTag, rhsVal);
+    }
+    if (rhsTag == TypeTags::NumberInt32 || rhsTag == TypeTags::NumberDouble) {
+        rhs.floating = numericCast<double>(rhsTag, rhsVal);
+    }
+    if (!rhs.integer && !rhs.floating) {
+        return nullptr;
+    }
+
+    const auto numericOp = [&] {
+        switch (op) {
+            case ScalarCompareOp::kLt:
+                return mongo::bsoncolumn::NumericCompareOp::kLt;
+            case ScalarCompareOp::kLte:
+                return mongo::bsoncolumn::NumericCompareOp::kLte;
+            case ScalarCompareOp::kGt:
+                return mongo::bsoncolumn::NumericCompareOp::kGt;
+            case ScalarCompareOp::kGte:
+                return mongo::bsoncolumn::NumericCompareOp::kGte;
+            case ScalarCompareOp::kEq:
+                return mongo::bsoncolumn::NumericCompareOp::kEq;
+        }
+        MONGO_UNREACHABLE;
+    }();
+
+    auto res = mongo::bsoncolumn::compareNumeric(getBinData(), numericOp, rhs);
+    if (!res) {
+        return nullptr;
+    }
+    tassert(9600201,
+            "Unexpected number of values in BSONColumn",
+            res->count == _count && res->present.size() == res->matches.size());
+
+    static_assert(sizeof(HomogeneousBlockBitset::block_type) == sizeof(uint64_t));
+    HomogeneousBlockBitset present(res->present.begin(), res->present.end());
+    present.resize(res->count);
+
+    // Only the present values are stored in the resulting block.
+    std::vector<Value> vals;
+    vals.reserve(present.count());
+    for (size_t word = 0; word < res->present.size(); ++word) {
+        for (uint64_t bits = res->present[word]; bits; bits &= bits - 1) {
+            const bool match = (res->matches[word] >> std::countr_zero(bits)) & 1;
+            vals.push_back(value::bitcastFrom<bool>(match));
+        }
+    }
+
+    return std::make_unique<BoolBlock>(std::move(vals), std::move(present));
+}
+
 std::unique_ptr<ValueBlock> TsBlock::fillType(uint32_t typeMask, TypeTags fillTag, Value fillVal) {
     if (static_cast<bool>(getBSONTypeMask(_controlMin.first) & kNumberMask) &&
         static_cast<bool>(getBSONTypeMask(_controlMax.first) & kNumberMask) &&
@@ -152,6 +152,10 @@ public:
                                          TypeTags fillTag,
                                          Value fillVal) override;
 
+    std::unique_ptr<ValueBlock> tryCompareScalar(ScalarCompareOp op,
+                                                 TypeTags rhsTag,
+                                                 Value rhsVal) override;
+
     // Returns true if none of the values in this block are arrays or objects. Returns false if
     // any _may_ be arrays or objects.
     bool hasNoObjsOrArrays() const {
@@ -748,4 +748,110 @@ TEST_F(SbeValueTest, VerifyDecompressedBlockType) {
         ASSERT(dynamic_cast<value::Int32Block*>(decompressedInternalBlock));
     }
 }
+
+const BSONObj kBucketWithDoublesAndMissing = fromjson(R"(
+{
+    "_id" : ObjectId("64a33d9cdf56a62781061048"),
+    "control" : {
+        "version" : 1,
+        "min": {
+            "_id": 0,
+            "time": {$date: "2023-06-30T21:29:00.000Z"},
+            "dbl": 1.5
+        },
+        "max": {
+            "_id": 3,
+            "time": {$date: "2023-06-30T21:29:19.088Z"},
+            "dbl": 9.5
+        }
+    },
+    "meta" : "A",
+    "data" : {
+        "_id" : {"0" : 0, "1": 1, "2" : 2, "3": 3},
+        "time" : {
+            "0" : {$date: "2023-06-30T21:29:00.568Z"},
+            "1" : {$date: "2023-06-30T21:29:09.968Z"},
+            "2" : {$date: "2023-06-30T21:29:15.088Z"},
+            "3" : {$date: "2023-06-30T21:29:19.088Z"}
+        },
+        dbl: {"0": 1.5, "2": 4.5, "3": 9.5}
+    }
+})");
+
+TEST_F(SbeValueTest, TsBlockCompareScalar) {
+    {
+        // The comparison can't be evaluated natively on an uncompressed bucket.
+        auto numBlock = makeTsBlockFromBucket(kBucketWithMixedNumbers, "num");
+        ASSERT_EQ(numBlock->tryCompareScalar(value::ScalarCompareOp::kGte,
+                                             value::TypeTags::NumberInt32,
+                                             value::bitcastFrom<int32_t>(456)),
+                  nullptr);
+    }
+
+    {
+        auto compressedBucketOpt =
+            timeseries::compressBucket(kBucketWithMixedNumbers, "time"_sd, {}, false)
+                .compressedBucket;
+        ASSERT(compressedBucketOpt) << "Should have been able to create compressed v2 bucket";
+        auto numBlock = makeTsBlockFromBucket(*compressedBucketOpt, "num");
+
+        // Mixed int32 and int64 values are compared against an integer without decompressing.
+        auto out = numBlock->tryCompareScalar(value::ScalarCompareOp::kGte,
+                                              value::TypeTags::NumberInt32,
+                                              value::bitcastFrom<int32_t>(456));
+        ASSERT(out);
+        ASSERT_FALSE(numBlock->decompressed());
+        assertBlockEq(value::TypeTags::valueBlock,
+                      value::bitcastFrom<value::ValueBlock*>(out.get()),
+                      TypedValues{makeBool(false), makeBool(true), makeBool(true)});
+
+        out = numBlock->tryCompareScalar(value::ScalarCompareOp::kEq,
+                                         value::TypeTags::NumberInt64,
+                                         value::bitcastFrom<int64_t>(789));
+        ASSERT(out);
+        assertBlockEq(value::TypeTags::valueBlock,
+                      value::bitcastFrom<value::ValueBlock*>(out.get()),
+                      TypedValues{makeBool(false), makeBool(false), makeBool(true)});
+
+        // Comparing integers against a double is not handled natively.
+        ASSERT_EQ(numBlock->tryCompareScalar(value::ScalarCompareOp::kLt,
+                                             value::TypeTags::NumberDouble,
+                                             value::bitcastFrom<double>(456.5)),
+                  nullptr);
+        ASSERT_FALSE(numBlock->decompressed());
+    }
+
+    {
+        auto compressedBucketOpt =
+            timeseries::compressBucket(kBucketWithDoublesAndMissing, "time"_sd, {}, false)
+                .compressedBucket;
+        ASSERT(compressedBucketOpt) << "Should have been able to create compressed v2 bucket";
+        auto dblBlock = makeTsBlockFromBucket(*compressedBucketOpt, "dbl");
+
+        // Missing values map to Nothing.
+        auto out = dblBlock->tryCompareScalar(value::ScalarCompareOp::kLt,
+                                              value::TypeTags::NumberInt32,
+                                              value::bitcastFrom<int32_t>(5));
+        ASSERT(out);
+        ASSERT_FALSE(dblBlock->decompressed());
+        assertBlockEq(value::TypeTags::valueBlock,
+                      value::bitcastFrom<value::ValueBlock*>(out.get()),
+                      TypedValues{makeBool(true), makeNothing(), makeBool(true), makeBool(false)});
+
+        out = dblBlock->tryCompareScalar(value::ScalarCompareOp::kGt,
+                                         value::TypeTags::NumberDouble,
+                                         value::bitcastFrom<double>(1.5));
+        ASSERT(out);
+        assertBlockEq(value::TypeTags::valueBlock,
+                      value::bitcastFrom<value::ValueBlock*>(out.get()),
+                      TypedValues{makeBool(false), makeNothing(), makeBool(true), makeBool(true)});
+
+        // Once decompressed, the comparison is left to the decompressed block.
+        [[maybe_unused]] auto unusedDeblockedVals = dblBlock->extract();
+        ASSERT_EQ(dblBlock->tryCompareScalar(value::ScalarCompareOp::kGt,
+                                             value::TypeTags::NumberDouble,
+                                             value::bitcastFrom<double>(1.5)),
+                  nullptr);
+    }
+}
 }  // namespace mongo::sbe
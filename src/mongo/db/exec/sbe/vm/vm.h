@@ -99,6 +99,11 @@ size_t writeToMemory(uint8_t* ptr, const T val) noexcept {
 /**
  * Enumeration of built-in VM instructions. These are implemented in vm.cpp ByteCode::runInternal.
  *
+ * The "Imm" variants (e.g. getFieldImm, traverseFImm) fold an immediate operand into the
+ * instruction instead of pushing it first, and instruction Parameters let an instruction read
+ * locals in place on the stack rather than copying them to the top; CodeFragment emits these forms
+ * when it can, so they serve as the VM's fused instructions and operand registers.
+ *
  * See also enum class Builtin for built-in functions, like 'addToArray', that are implemented as
  * C++ rather than VM instructions.
  */
@@ -1356,6 +1361,10 @@ public:
         MultiAccState;
 
 private:
+    /**
+     * The interpreter loop: decodes and dispatches one instruction at a time, starting at
+     * 'position' in 'code'. CodeFragments are always interpreted; there is no native code tier.
+     */
     void runInternal(const CodeFragment* code, int64_t position);
     void runLambdaInternal(const CodeFragment* code, int64_t position);
 
@@ -1910,6 +1910,23 @@ void compareNativeCppType(size_t count,
     }
 }
 
+template <class Cmp>
+boost::optional<value::ScalarCompareOp> toScalarCompareOp() {
+    if constexpr (std::is_same_v<Cmp, std::less<>>) {
+        return value::ScalarCompareOp::kLt;
+    } else if constexpr (std::is_same_v<Cmp, std::less_equal<>>) {
+        return value::ScalarCompareOp::kLte;
+    } else if constexpr (std::is_same_v<Cmp, std::greater<>>) {
+        return value::ScalarCompareOp::kGt;
+    } else if constexpr (std::is_same_v<Cmp, std::greater_equal<>>) {
+        return value::ScalarCompareOp::kGte;
+    } else if constexpr (std::is_same_v<Cmp, std::equal_to<>>) {
+        return value::ScalarCompareOp::kEq;
+    } else {
+        return boost::none;
+    }
+}
+
 template <class Cmp, ColumnOpType::Flags AddFlags = ColumnOpType::kNoFlags>
 FastTuple<bool, value::TypeTags, value::Value> blockCompareGeneric(value::ValueBlock* blockView,
                                                                    value::TypeTags rhsTag,
@@ -1981,7 +1998,26 @@ FastTuple<bool, value::TypeTags, value::Value> blockCompareGeneric(value::ValueB
             }
         });
 
-    auto res = blockView->map(cmpOp);
+    // Give the block a chance to evaluate the comparison on its underlying format (e.g. without
+    // decompressing a timeseries column), after the cheaper monotonic fast path had its chance.
+    std::unique_ptr<value::ValueBlock> res;
+    if (auto scalarOp = toScalarCompareOp<Cmp>()) {
+        res = blockView->mapMonotonicFastPath(cmpOp);
+        if (!res) {
+            res = blockView->tryCompareScalar(*scalarOp, rhsTag, rhsVal);
+        }
+        if (!res) {
+            // The monotonic fast path already failed above, so don't let map() try it again.
+            const value::ColumnOp nonMonotonicOp{
+                value::ColumnOpType{cmpOp.opType.flags & ~value::ColumnOpType::kMonotonic},
+                cmpOp.cofd,
+                cmpOp.methodTable};
+            res = blockView->map(nonMonotonicOp);
+        }
+    }
+    if (!res) {
+        res = blockView->map(cmpOp);
+    }
 
     return {
         true, value::TypeTags::valueBlock, value::bitcastFrom<value::ValueBlock*>(res.release())};
@@ -62,6 +62,21 @@ int SortKeyComparator::operator()(const Value& lhsKey, const Value& rhsKey) cons
     }
 
     // compound sort
+    // Compound sort keys are arrays with one element per sort pattern part. Compare the elements
+    // in place when possible, since Value::operator[] returns a copy of each one.
+    if (lhsKey.getType() == BSONType::Array && rhsKey.getType() == BSONType::Array &&
+        lhsKey.getArray().size() >= n && rhsKey.getArray().size() >= n) {
+        const auto& lhsArr = lhsKey.getArray();
+        const auto& rhsArr = rhsKey.getArray();
+        for (size_t i = 0; i < n; i++) {
+            int cmp = comparator.compare(lhsArr[i], rhsArr[i]);
+            if (cmp) {
+                return _pattern[i] == SortDirection::kDescending ? -cmp : cmp;
+            }
+        }
+        return 0;
+    }
+
     for (size_t i = 0; i < n; i++) {
         int cmp = comparator.compare(lhsKey[i], rhsKey[i]);
         if (cmp) {
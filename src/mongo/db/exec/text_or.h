@@ -56,6 +56,10 @@ class OperationContext;
  * the positive terms in the search query, as well as their scores.
  *
  * The WorkingSetMembers returned are fetched and in the LOC_AND_OBJ state.
+ *
+ * Every document matching any term is scored, even under a sort on the text score with a limit.
+ * The text index stores one key per (term, document) with that document's term weight, and holds
+ * no per-term or per-range upper bounds that would let a top-k evaluation skip documents.
  */
 class TextOrStage final : public RequiresCollectionStage {
 public:
@@ -165,6 +165,11 @@ private:
  * Otherwise, NEED_TIME is returned after updating a document if further updates are pending,
  * and IS_EOF is returned if no documents were found or all updates have been performed.
  *
+ * Each document is updated in its own WriteUnitOfWork, so a multi-update never holds a single
+ * storage transaction open for longer than one document's write and its index maintenance. Unlike
+ * deletes (see BatchedDeleteStage), updates are not batched: each update produces its own oplog
+ * entry and may move the document within the indexes this stage's child is scanning.
+ *
  * Callers of doWork() must be holding a write lock.
  */
 class UpdateStage : public RequiresWritableCollectionStage {
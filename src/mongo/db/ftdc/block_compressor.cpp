@@ -37,9 +37,9 @@
 
 namespace mongo {
 
-StatusWith<ConstDataRange> BlockCompressor::compress(ConstDataRange source) {
+StatusWith<ConstDataRange> BlockCompressor::compress(ConstDataRange source, Effort effort) {
     z_stream stream;
-    int level = Z_DEFAULT_COMPRESSION;
+    int level = effort == Effort::kFast ? Z_BEST_SPEED : Z_DEFAULT_COMPRESSION;
 
     stream.next_in = reinterpret_cast<unsigned char*>(const_cast<char*>(source.data()));
     stream.avail_in = source.length();
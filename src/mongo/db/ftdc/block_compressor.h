@@ -48,13 +48,25 @@ class BlockCompressor {
 public:
     BlockCompressor() = default;
 
+    /**
+     * How hard compress() works to shrink its output. Both produce the same zlib format, so the
+     * choice does not affect uncompress.
+     */
+    enum class Effort {
+        // zlib's default level.
+        kDefault,
+
+        // zlib's fastest level, for buffers that are rewritten soon after being compressed.
+        kFast,
+    };
+
     /**
      * Compress a buffer of data.
      *
      * Returns a pointer to a buffer that BlockCompressor owns.
      * The returned buffer is valid until the next call to compress or uncompress.
      */
-    StatusWith<ConstDataRange> compress(ConstDataRange source);
+    StatusWith<ConstDataRange> compress(ConstDataRange source, Effort effort = Effort::kDefault);
 
     /**
      * Uncompress a buffer of data.
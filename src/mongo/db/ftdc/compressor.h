@@ -129,8 +129,12 @@ public:
      *
      * The returned buffer is valid until next call to addSample() or getCompressedSamples() with
      * CompressBuffer::kGenerateNewCompressedBuffer.
+     *
+     * 'effort' is passed to the block compressor. Chunks which are superseded by a later call,
+     * such as interim chunks, can use BlockCompressor::Effort::kFast.
      */
-    StatusWith<std::tuple<ConstDataRange, Date_t>> getCompressedSamples();
+    StatusWith<std::tuple<ConstDataRange, Date_t>> getCompressedSamples(
+        BlockCompressor::Effort effort = BlockCompressor::Effort::kDefault);
 
     /**
      * Reset the state of the compressor.
@@ -126,6 +126,29 @@ TEST_F(FTDCCompressorTest, TestStrings) {
     ASSERT_TRUE(std::get<0>(swBuf.getValue()).data() != nullptr);
 }
 
+// Test that chunks compressed for speed decompress to the same samples
+TEST_F(FTDCCompressorTest, TestFastEffortRoundTrips) {
+    FTDCConfig config;
+    FTDCCompressor c(&config);
+    FTDCDecompressor d;
+
+    std::vector<BSONObj> docs;
+    for (int i = 0; i < 10; ++i) {
+        docs.emplace_back(BSON("name"
+                               << "joe"
+                               << "key1" << 33 + i << "key2" << 42 * i));
+        auto st = c.addSample(docs.back(), Date_t());
+        ASSERT_HAS_SPACE(st);
+    }
+
+    auto swBuf = c.getCompressedSamples(BlockCompressor::Effort::kFast);
+    ASSERT_TRUE(swBuf.isOK());
+
+    auto sw = d.uncompress(std::get<0>(swBuf.getValue()));
+    ASSERT_TRUE(sw.isOK());
+    ValidateDocumentList(sw.getValue(), docs, FTDCValidationMode::kStrict);
+}
+
 /**
  * Test class that records a series of samples and ensures that compress + decompress round trips
  * them correctly.
@@ -48,7 +48,8 @@ struct FTDCConfig {
           period(kPeriodMillisDefault),
           metadataCaptureFrequency(kMetadataCaptureFrequencyDefault),
           maxSamplesPerArchiveMetricChunk(kMaxSamplesPerArchiveMetricChunkDefault),
-          maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault) {}
+          maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault),
+          maxRecentSamples(kMaxRecentSamplesDefault) {}
 
     /**
      * True if FTDC is collecting data. False otherwise
@@ -94,6 +95,13 @@ struct FTDCConfig {
      */
     std::uint32_t maxSamplesPerInterimMetricChunk;
 
+    /**
+     * Maximum number of the most recent periodic samples to keep in memory so they can be
+     * retrieved on demand with getDiagnosticData. Zero keeps nothing in the ring. The reply to
+     * getDiagnosticData only includes the newest samples that fit in a BSON document.
+     */
+    std::uint32_t maxRecentSamples;
+
     static const bool kEnabledDefault = true;
 
     static const std::int64_t kPeriodMillisDefault;
@@ -105,6 +113,7 @@ struct FTDCConfig {
 
     static const std::uint32_t kMaxSamplesPerArchiveMetricChunkDefault = 300;
     static const std::uint32_t kMaxSamplesPerInterimMetricChunkDefault = 10;
+    static const std::uint32_t kMaxRecentSamplesDefault = 0;
 };
 
 }  // namespace mongo
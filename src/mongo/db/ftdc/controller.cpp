@@ -109,6 +109,12 @@ void FTDCController::setMaxSamplesPerInterimMetricChunk(size_t size) {
     _condvar.notify_one();
 }
 
+void FTDCController::setMaxRecentSamples(size_t size) {
+    stdx::lock_guard<Latch> lock(_mutex);
+    _configTemp.maxRecentSamples = size;
+    _condvar.notify_one();
+}
+
 Status FTDCController::setDirectory(const boost::filesystem::path& path) {
     stdx::lock_guard<Latch> lock(_mutex);
 
@@ -157,6 +163,11 @@ BSONObj FTDCController::getMostRecentPeriodicDocument() {
     }
 }
 
+std::vector<BSONObj> FTDCController::getRecentPeriodicDocuments() {
+    stdx::lock_guard<Latch> lock(_mutex);
+    return {_recentPeriodicDocuments.begin(), _recentPeriodicDocuments.end()};
+}
+
 void FTDCController::triggerRotate() {
     _shouldRotateBeforeNextSample.store(true);
 }
@@ -303,6 +314,14 @@ void FTDCController::doLoop(Service* service) {
         {
             stdx::lock_guard<Latch> lock(_mutex);
             _mostRecentPeriodicDocument = std::get<0>(collectSample);
+
+            // The samples are owned, so keeping them only shares their buffers.
+            if (_config.maxRecentSamples > 0) {
+                _recentPeriodicDocuments.push_back(_mostRecentPeriodicDocument);
+            }
+            while (_recentPeriodicDocuments.size() > _config.maxRecentSamples) {
+                _recentPeriodicDocuments.pop_front();
+            }
         }
 
         if (--metadataCaptureFrequencyCountdown == 0) {
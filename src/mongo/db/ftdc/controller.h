@@ -32,8 +32,10 @@
 #include <boost/filesystem/path.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/bson/bsonobj.h"
@@ -122,6 +124,13 @@ public:
      */
     void setMaxSamplesPerInterimMetricChunk(size_t size);
 
+    /**
+     * Set the maximum number of recent periodic samples to keep in memory for
+     * getRecentPeriodicDocuments(). Combined with a short period, this captures short stalls
+     * without having to inspect the archived files.
+     */
+    void setMaxRecentSamples(size_t size);
+
     /*
      * Set the path to store FTDC files if not already set.
      *
@@ -181,6 +190,12 @@ public:
      */
     BSONObj getMostRecentPeriodicDocument();
 
+    /**
+     * Get copies of the most recent documents from the periodic collectors, oldest first. At most
+     * the configured maximum number of recent samples are returned.
+     */
+    std::vector<BSONObj> getRecentPeriodicDocuments();
+
     /*
      * Forces a rotate before the next FTDC log is written.
      */
@@ -261,6 +276,10 @@ private:
     // Owned
     BSONObj _mostRecentPeriodicDocument;
 
+    // Ring buffer of the last _config.maxRecentSamples documents from periodic collectors
+    // Owned
+    std::deque<BSONObj> _recentPeriodicDocuments;
+
     // Set of file rotation collectors
     FTDCCollectorCollection _rotateCollectors;
 
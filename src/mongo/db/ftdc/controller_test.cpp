@@ -464,6 +464,41 @@ TEST_F(FTDCControllerTest, TestRotate20WithoutMultiversion) {
     testRotateCollector(UseMultiServiceSchema{false}, 20, std::make_unique<MockRotateCollector>());
 }
 
+// Test the controller keeps only the configured number of recent periodic samples in memory
+TEST_F(FTDCControllerTest, TestRecentPeriodicDocuments) {
+    unittest::TempDir tempdir("metrics_testpath");
+    boost::filesystem::path dir(tempdir.path());
+
+    createDirectoryClean(dir);
+
+    FTDCConfig config;
+    config.period = Milliseconds(1);
+    config.maxRecentSamples = 2;
+
+    auto env = std::make_unique<MockControllerEnv>();
+    Checkpoint& checkpoint = env->loopCheckpoint;
+
+    auto collector = std::make_unique<MockPeriodicCollector>();
+    auto collectorPtr = collector.get();
+
+    FTDCController c(dir, config, UseMultiServiceSchema{false}, std::move(env));
+    c.addPeriodicCollector(std::move(collector), ClusterRole::None);
+    c.start(getClient()->getService());
+    checkpoint.wait();
+
+    while (collectorPtr->getDocs().size() < 3) {
+        checkpoint.advance();
+        checkpoint.wait();
+    }
+
+    auto recent = c.getRecentPeriodicDocuments();
+    ASSERT_EQUALS(recent.size(), 2);
+    ASSERT_BSONOBJ_EQ(recent.back(), c.getMostRecentPeriodicDocument());
+
+    checkpoint.release();
+    c.stop();
+}
+
 // Test we can start and stop the controller in quick succession, make sure it succeeds without
 // assert or fault
 TEST_F(FTDCControllerTest, TestStartStop) {
@@ -166,8 +166,10 @@ Status FTDCFileWriter::writeSample(const BSONObj& sample, Date_t date) {
 
     if (_compressor.getSampleCount() != 0 &&
         (_compressor.getSampleCount() % _config->maxSamplesPerInterimMetricChunk) == 0) {
-        // Check if we want to do a partial write to the interim buffer
-        auto swBuf = _compressor.getCompressedSamples();
+        // Check if we want to do a partial write to the interim buffer. The interim file is
+        // rewritten with every partial write and only read after an unclean shutdown, so favor
+        // speed over size.
+        auto swBuf = _compressor.getCompressedSamples(BlockCompressor::Effort::kFast);
         if (!swBuf.isOK()) {
             return swBuf.getStatus();
         }
@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <iterator>
 #include <string>
 
 #include "mongo/base/error_codes.h"
@@ -36,6 +37,7 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/util/builder.h"
 #include "mongo/db/auth/action_type.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/resource_pattern.h"
@@ -57,6 +59,12 @@ namespace {
  */
 class GetDiagnosticDataCommand final : public BasicCommand {
 public:
+    // Room left in the reply for 'ok' and the other fields appended after run() returns.
+    static constexpr int kReplyReservedBytes = 16 * 1024;
+
+    // Upper bound of the type byte and the field name of an array element.
+    static constexpr int kArrayElementOverheadBytes = 8;
+
     GetDiagnosticDataCommand() : BasicCommand("getDiagnosticData") {}
 
     bool adminOnly() const override {
@@ -100,9 +108,34 @@ public:
              const BSONObj& cmdObj,
              BSONObjBuilder& result) override {
 
-        result.append(
-            "data",
-            FTDCController::get(opCtx->getServiceContext())->getMostRecentPeriodicDocument());
+        auto controller = FTDCController::get(opCtx->getServiceContext());
+        result.append("data", controller->getMostRecentPeriodicDocument());
+
+        if (cmdObj["recent"].trueValue()) {
+            // Return as many of the newest samples as fit in the reply, leaving room for the
+            // fields the command framework appends, and report how many older ones were left out.
+            const auto samples = controller->getRecentPeriodicDocuments();
+            int remainingBytes = BSONObjMaxUserSize - kReplyReservedBytes - result.len();
+            auto first = samples.end();
+            while (first != samples.begin()) {
+                const int sampleBytes = std::prev(first)->objsize() + kArrayElementOverheadBytes;
+                if (sampleBytes > remainingBytes) {
+                    break;
+                }
+                remainingBytes -= sampleBytes;
+                --first;
+            }
+
+            BSONArrayBuilder recent(result.subarrayStart("recent"));
+            for (auto it = first; it != samples.end(); ++it) {
+                recent.append(*it);
+            }
+            recent.done();
+            if (first != samples.begin()) {
+                result.append("recentSamplesOmitted",
+                              static_cast<long long>(std::distance(samples.begin(), first)));
+            }
+        }
 
         return true;
     }
@@ -189,6 +189,15 @@ Status onUpdateFTDCPerInterimUpdate(const std::int32_t potentialNewValue) {
     return Status::OK();
 }
 
+Status onUpdateFTDCRecentSamples(const std::int32_t potentialNewValue) {
+    if (FTDCController * controller;
+        hasGlobalServiceContext() && (controller = getFTDCController(getGlobalServiceContext()))) {
+        controller->setMaxRecentSamples(potentialNewValue);
+    }
+
+    return Status::OK();
+}
+
 FTDCSimpleInternalCommandCollector::FTDCSimpleInternalCommandCollector(StringData command,
                                                                        StringData name,
                                                                        const DatabaseName& db,
@@ -267,6 +276,7 @@ public:
             BSONObjBuilder subObjBuilder(commandBuilder.subobjStart("opLatencies"));
             subObjBuilder.append("histograms", true);
             subObjBuilder.append("slowBuckets", true);
+            subObjBuilder.append("percentiles", true);
         }
 
         if (gDiagnosticDataCollectionVerboseTCMalloc.load()) {
@@ -354,6 +364,7 @@ void startFTDC(ServiceContext* serviceContext,
         ftdcStartupParams.maxSamplesPerArchiveMetricChunk.load();
     config.maxSamplesPerInterimMetricChunk =
         ftdcStartupParams.maxSamplesPerInterimMetricChunk.load();
+    config.maxRecentSamples = ftdcStartupParams.maxRecentSamples.load();
 
     ftdcDirectoryPathParameter = path;
 
@@ -126,6 +126,7 @@ struct FTDCStartupParams {
     AtomicWord<int> maxFileSizeMB;
     AtomicWord<int> maxSamplesPerArchiveMetricChunk;
     AtomicWord<int> maxSamplesPerInterimMetricChunk;
+    AtomicWord<int> maxRecentSamples;
 
     FTDCStartupParams()
         : enabled(FTDCConfig::kEnabledDefault),
@@ -135,7 +136,8 @@ struct FTDCStartupParams {
           maxDirectorySizeMB(FTDCConfig::kMaxDirectorySizeBytesDefault / (1024 * 1024)),
           maxFileSizeMB(FTDCConfig::kMaxFileSizeBytesDefault / (1024 * 1024)),
           maxSamplesPerArchiveMetricChunk(FTDCConfig::kMaxSamplesPerArchiveMetricChunkDefault),
-          maxSamplesPerInterimMetricChunk(FTDCConfig::kMaxSamplesPerInterimMetricChunkDefault) {}
+          maxSamplesPerInterimMetricChunk(FTDCConfig::kMaxSamplesPerInterimMetricChunkDefault),
+          maxRecentSamples(FTDCConfig::kMaxRecentSamplesDefault) {}
 };
 
 extern FTDCStartupParams ftdcStartupParams;
@@ -150,6 +152,7 @@ Status onUpdateFTDCDirectorySize(std::int32_t value);
 Status onUpdateFTDCFileSize(std::int32_t value);
 Status onUpdateFTDCSamplesPerChunk(std::int32_t value);
 Status onUpdateFTDCPerInterimUpdate(std::int32_t value);
+Status onUpdateFTDCRecentSamples(std::int32_t value);
 
 /**
  * Server Parameter accessors
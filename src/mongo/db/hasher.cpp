@@ -34,6 +34,7 @@
 #include "mongo/db/hasher.h"
 
 #include <cstddef>
+#include <cstring>
 #include <memory>
 
 #include "mongo/base/data_type_endian.h"
@@ -80,8 +81,17 @@ private:
     template <typename T>
     void addIntegerData(T number);
 
+    // Feeds any buffered input to the MD5 state.
+    void flush();
+
     md5_state_t _md5State;
     HashSeed _seed;
+
+    // Hash input is mostly made of small pieces (canonical types, field names, numbers). These are
+    // collected here and passed to MD5 in larger chunks rather than one call per piece. This does
+    // not change the digest.
+    md5_byte_t _buffer[64];
+    size_t _bufferedBytes = 0;
 };
 
 Hasher::Hasher(HashSeed seed) : _seed(seed) {
@@ -90,7 +100,22 @@ Hasher::Hasher(HashSeed seed) : _seed(seed) {
 }
 
 void Hasher::addData(const void* keyData, size_t numBytes) {
-    md5_append(&_md5State, static_cast<const md5_byte_t*>(keyData), numBytes);
+    if (_bufferedBytes + numBytes > sizeof(_buffer)) {
+        flush();
+        if (numBytes > sizeof(_buffer)) {
+            md5_append(&_md5State, static_cast<const md5_byte_t*>(keyData), numBytes);
+            return;
+        }
+    }
+    std::memcpy(_buffer + _bufferedBytes, keyData, numBytes);
+    _bufferedBytes += numBytes;
+}
+
+void Hasher::flush() {
+    if (_bufferedBytes) {
+        md5_append(&_md5State, _buffer, _bufferedBytes);
+        _bufferedBytes = 0;
+    }
 }
 
 template <typename T>
@@ -100,6 +125,7 @@ void Hasher::addIntegerData(T number) {
 }
 
 void Hasher::finish(HashDigest out) {
+    flush();
     md5_finish(&_md5State, out);
 }
 
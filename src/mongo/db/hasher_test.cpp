@@ -31,6 +31,7 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
@@ -278,6 +279,15 @@ TEST(BSONElementHasher, HashString) {
     ASSERT_EQUALS(hashIt(o), 2049396243249673340LL);
 }
 
+TEST(BSONElementHasher, HashLongString) {
+    // Strings whose hash input does not fit in a single 64 byte block.
+    BSONObj o = BSON("check" << std::string(55, 'x'));
+    ASSERT_EQUALS(hashIt(o), -7987692452040115825LL);
+
+    o = BSON("check" << std::string(100, 'x'));
+    ASSERT_EQUALS(hashIt(o), 3870822758783210044LL);
+}
+
 TEST(BSONElementHasher, HashObject) {
     BSONObj o = BSON("check" << BSON("a"
                                      << "abc"
@@ -130,7 +130,8 @@ ColumnStoreSorter::ColumnStoreSorter(size_t maxMemoryUsageBytes,
                            {},
                            _dbName,
                            range.getChecksum(),
-                           range.getChecksumVersion().value_or(SorterChecksumVersion::v1));
+                           range.getChecksumVersion().value_or(SorterChecksumVersion::v1),
+                           range.getKeysPrefixCompressed().value_or(false));
                    });
     this->_stats.setSpilledRanges(_spilledFileIterators.size());
 }
@@ -290,11 +290,15 @@ void ColumnStoreAccessMethod::_visitCellsForIndexInsert(
     PooledFragmentBuilder& buf,
     const std::vector<BsonRecord>& bsonRecords,
     function_ref<void(StringData, const BsonRecord&)> cb) const {
+    // Every cell of a record shares the record's timestamp, and most inserts are of a single
+    // record, so only set the timestamp when it changes rather than once per cell.
+    Timestamp lastTimestamp;
     _keyGen.visitCellsForInsert(
         bsonRecords,
         [&](StringData path, const BsonRecord& rec, const column_keygen::UnencodedCellView& cell) {
-            if (!rec.ts.isNull()) {
+            if (!rec.ts.isNull() && rec.ts != lastTimestamp) {
                 uassertStatusOK(shard_role_details::getRecoveryUnit(opCtx)->setTimestamp(rec.ts));
+                lastTimestamp = rec.ts;
             }
             buf.reset();
             column_keygen::writeEncodedCell(cell, &buf);
@@ -235,7 +235,9 @@ SortOptions makeSortOptions(size_t maxMemoryUsageBytes,
         .UseMemoryPool(true)
         .FileStats(stats)
         .Tracker(&indexBulkBuilderSSS.sorterTracker)
-        .DBName(dbName);
+        .DBName(dbName)
+        .ReadAheadSpills(gIndexBuildSorterReadAheadSpills.load())
+        .SortThreads(gIndexBuildSorterThreads.load());
 }
 
 MultikeyPaths createMultikeyPaths(const std::vector<MultikeyPath>& multikeyPathsVec) {
@@ -270,6 +272,10 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
                                            const std::vector<BsonRecord>& bsonRecords,
                                            const InsertDeleteOptions& options,
                                            int64_t* numInserted) {
+    // Keys are inserted one record at a time, in the order of 'bsonRecords', rather than being
+    // sorted across the batch. Each record may carry its own commit timestamp, which must be set
+    // before that record's keys are written, and multikey state and duplicate key errors are
+    // tracked per record.
     for (const auto& bsonRecord : bsonRecords) {
         invariant(bsonRecord.id != RecordId());
 
@@ -905,6 +911,12 @@ public:
                   const OnSuppressedErrorFn& onSuppressedError = nullptr,
                   const ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr) final;
 
+    size_t insertConcurrently(OperationContext* opCtx,
+                              const CollectionPtr& collection,
+                              const IndexCatalogEntry* entry,
+                              const std::vector<BSONObj>& objs,
+                              const std::vector<RecordId>& locs) final;
+
     const MultikeyPaths& getMultikeyPaths() const final;
 
     bool isMultikey() const final;
@@ -932,6 +944,11 @@ public:
                         bool isDup);
 
 private:
+    /**
+     * Adds the keys generated for a document to the sorter and merges its multikey paths.
+     */
+    void _addKeys(const KeyStringSet& keys, const MultikeyPaths& multikeyPaths);
+
     void _insertMultikeyMetadataKeysIntoSorter();
 
     Sorter* _makeSorter(
@@ -1030,28 +1047,73 @@ Status SortedDataIndexAccessMethod::BulkBuilderImpl::insert(
         return exceptionToStatus();
     }
 
-    if (!multikeyPaths->empty()) {
+    _addKeys(*keys, *multikeyPaths);
+    return Status::OK();
+}
+
+size_t SortedDataIndexAccessMethod::BulkBuilderImpl::insertConcurrently(
+    OperationContext* opCtx,
+    const CollectionPtr& collection,
+    const IndexCatalogEntry* entry,
+    const std::vector<BSONObj>& objs,
+    const std::vector<RecordId>& locs) {
+    invariant(objs.size() == locs.size());
+
+    // The keys are generated into local containers, as the ones of the StorageExecutionContext
+    // belong to the thread of the calling operation.
+    KeyStringSet keys;
+    MultikeyPaths multikeyPaths;
+    for (size_t i = 0; i < objs.size(); ++i) {
+        // The index build may be aborted or killed while a batch is being processed.
+        opCtx->checkForInterrupt();
+
+        keys.clear();
+        multikeyPaths.clear();
+        try {
+            _iam->getKeys(opCtx,
+                          collection,
+                          entry,
+                          _sorter->memPool(),
+                          objs[i],
+                          InsertDeleteOptions::ConstraintEnforcementMode::kEnforceConstraints,
+                          GetKeysContext::kAddingKeys,
+                          &keys,
+                          &_multikeyMetadataKeys,
+                          &multikeyPaths,
+                          locs[i]);
+        } catch (const AssertionException&) {
+            // Let the caller insert() this document, which handles the error.
+            return i;
+        }
+
+        _addKeys(keys, multikeyPaths);
+    }
+
+    return objs.size();
+}
+
+void SortedDataIndexAccessMethod::BulkBuilderImpl::_addKeys(const KeyStringSet& keys,
+                                                            const MultikeyPaths& multikeyPaths) {
+    if (!multikeyPaths.empty()) {
         if (_indexMultikeyPaths.empty()) {
-            _indexMultikeyPaths = *multikeyPaths;
+            _indexMultikeyPaths = multikeyPaths;
         } else {
-            invariant(_indexMultikeyPaths.size() == multikeyPaths->size());
-            for (size_t i = 0; i < multikeyPaths->size(); ++i) {
+            invariant(_indexMultikeyPaths.size() == multikeyPaths.size());
+            for (size_t i = 0; i < multikeyPaths.size(); ++i) {
                 _indexMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
-                                              (*multikeyPaths)[i].begin(),
-                                              (*multikeyPaths)[i].end());
+                                              multikeyPaths[i].begin(),
+                                              multikeyPaths[i].end());
             }
         }
     }
 
-    for (const auto& keyString : *keys) {
+    for (const auto& keyString : keys) {
         _sorter->add(keyString, mongo::NullValue());
         ++_keysInserted;
     }
 
     _isMultiKey = _isMultiKey ||
-        _iam->shouldMarkIndexAsMultikey(keys->size(), _multikeyMetadataKeys, *multikeyPaths);
-
-    return Status::OK();
+        _iam->shouldMarkIndexAsMultikey(keys.size(), _multikeyMetadataKeys, multikeyPaths);
 }
 
 const MultikeyPaths& SortedDataIndexAccessMethod::BulkBuilderImpl::getMultikeyPaths() const {
@@ -244,6 +244,23 @@ public:
                               const OnSuppressedErrorFn& onSuppressedError = nullptr,
                               const ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr) = 0;
 
+        /**
+         * Inserts 'objs', whose RecordIds are 'locs', like insert() does, but stops at the first
+         * document whose keys cannot be generated instead of handling the error. This does not use
+         * 'opCtx' for anything but key generation and interrupt checks, so the BulkBuilders of
+         * different indexes may be inserted into concurrently, each from a thread with its own
+         * 'opCtx'. Throws if 'opCtx' is interrupted. Returns the
+         * number of leading documents of 'objs' that were inserted, the remaining ones must be
+         * passed to insert(). BulkBuilders that do not support concurrent insertion insert nothing.
+         */
+        virtual size_t insertConcurrently(OperationContext* opCtx,
+                                          const CollectionPtr& collection,
+                                          const IndexCatalogEntry* entry,
+                                          const std::vector<BSONObj>& objs,
+                                          const std::vector<RecordId>& locs) {
+            return 0;
+        }
+
         /**
          * Call this when you are ready to finish your bulk work.
          * @param dupsAllowed - If false and 'dupRecords' is not null, append with the RecordIds of
@@ -69,6 +69,14 @@ class BSONObj;
 class IndexAccessMethod;
 class OperationContext;
 
+/**
+ * Records the key changes made to an index while it is being built, in a temporary side writes
+ * table, so that they can be drained into the index before the build commits.
+ *
+ * The side writes table only exists for the duration of a build. A ready index is always kept
+ * fully up to date by the write that changes its collection, since queries that use it neither
+ * wait for a drain nor read the side writes table.
+ */
 class IndexBuildInterceptor {
 public:
     using RetrySkippedRecordMode = SkippedRecordTracker::RetrySkippedRecordMode;
@@ -439,6 +439,10 @@ public:
     //
     // Determine if a document satisfies the tree-predicate.
     //
+    // The classic engine evaluates the tree directly on every document. Filters that are eligible
+    // for SBE are instead compiled to SBE expressions by the stage builders (see
+    // sbe_stage_builder_filter.h); there is no separate compiled form for the classic engine.
+    //
 
     virtual bool matches(const MatchableDocument* doc, MatchDetails* details = nullptr) const = 0;
 
@@ -57,6 +57,7 @@ InListData::InListData(CloneCtorTag, const InListData& other)
       _oldBackingArr(other._oldBackingArr),
       _originalElements(other._originalElements),
       _sortedElements(boost::in_place_init, cloneSortedElements(other._sortedElements)),
+      _elementsHashSet(boost::in_place_init),
       _firstOfEachTypeElements(other._firstOfEachTypeElements) {}
 
 void InListData::appendElements(BSONArrayBuilder& bab, bool getSortedAndDeduped) {
@@ -264,10 +265,11 @@ Status InListData::setElementsImpl(boost::optional<BSONObj> arr,
         _arr = boost::none;
     }
 
-    // Save 'elements' into '_originalElements', reset '_sortedElements' back to the "uninitialized"
-    // state, and mark the elements as being initialized.
+    // Save 'elements' into '_originalElements', reset '_sortedElements' and '_elementsHashSet'
+    // back to the "uninitialized" state, and mark the elements as being initialized.
     _originalElements = std::move(elements);
     _sortedElements.emplace();
+    _elementsHashSet.emplace();
     _firstOfEachTypeElements = std::move(firstOfEachTypeElements);
     _elementsInitialized = true;
 
@@ -309,9 +311,10 @@ void InListData::updateSbeTagMasks() {
 void InListData::setCollator(const CollatorInterface* coll) {
     tassert(7690407, "Cannot call setCollator() after InListData has been shared", !isShared());
 
-    // Set '_collator'.
+    // Set '_collator'. The hash set refers to the old collator, so drop it.
     auto oldColl = _collator;
     _collator = coll;
+    _elementsHashSet.emplace();
 
     // If setElements() hasn't been called yet or if 'coll' matches the old collator, then there
     // is no more work to do and we can return early.
@@ -416,6 +419,9 @@ void InListData::makeArrOwned() {
 
     // Update each BSONElement in '_firstOfEachTypeElements' to refer to the new buffer.
     remapElements(_firstOfEachTypeElements, oldBuf, newBuf);
+
+    // The hash set holds elements that refer to the old buffer, so drop it.
+    _elementsHashSet.emplace();
 }
 
 std::size_t InListData::getNormalizedCanonicalType(BSONType type) {
@@ -31,6 +31,7 @@
 
 #include <absl/container/inlined_vector.h>
 #include <boost/optional.hpp>
+#include <memory>
 #include <vector>
 
 #include "mongo/base/status.h"
@@ -123,10 +124,10 @@ private:
  *
  * Const InListData methods (because they have to work with both models) must assume that there
  * might be other threads accessing the InListData object via const reference. Const methods
- * therefore cannot mutate the InListData object (with the exception of the '_shared' and
- * '_sortedElements' fields, for which we have appropriate synchronization in place to allow
- * for mutation). Furthermore, const methods cannot return non-const references or pointers to
- * the InListData object or any of its contents.
+ * therefore cannot mutate the InListData object (with the exception of the '_shared',
+ * '_sortedElements' and '_elementsHashSet' fields, for which we have appropriate synchronization
+ * in place to allow for mutation). Furthermore, const methods cannot return non-const references
+ * or pointers to the InListData object or any of its contents.
  *
  * (Note: The rules above regarding concurrency models and const / non-const methods are also
  * applicable to the InMatchExpression class and all the other subclasses of MatchExpression.)
@@ -134,9 +135,12 @@ private:
 class InListData {
 public:
     static constexpr size_t kLargeStringThreshold = 1000u;
+    // In-lists with at least this many unique elements are probed through a hash set rather than
+    // by binary search over the sorted elements.
+    static constexpr size_t kMinSizeForHashSet = 64u;
     static constexpr BSONObj::ComparisonRulesSet kIgnoreFieldName = 0;
 
-    InListData() : _sortedElements(boost::in_place_init) {}
+    InListData() : _sortedElements(boost::in_place_init), _elementsHashSet(boost::in_place_init) {}
 
     InListData(const InListData& other) = delete;
     InListData(InListData&& other) = delete;
@@ -199,9 +203,14 @@ public:
             return false;
         }
 
+        const auto& elems = getSortedElements();
+        if (elems.size() >= kMinSizeForHashSet) {
+            const auto& hashSet = getElementsHashSet().elements;
+            return hashSet.find(e) != hashSet.end();
+        }
+
         // Use binary search.
         auto elemLt = InListElemLessThan(_collator);
-        const auto& elems = getSortedElements();
         return std::binary_search(elems.begin(), elems.end(), e, elemLt);
     }
 
@@ -296,6 +305,24 @@ private:
     using SmallBSONElementVector = absl::InlinedVector<BSONElement, 1>;
     using CanonicalTypeMask = std::bitset<kCanonicalTypeCardinality>;
 
+    // A hash set over the sorted elements which uses the same equality as InListElemEqualTo. The
+    // set's hasher and equality functor point at 'comparator', so this is neither copyable nor
+    // movable.
+    struct ElementsHashSet {
+        ElementsHashSet(const CollatorInterface* collator, const std::vector<BSONElement>& elems)
+            : comparator(BSONElementComparator::FieldNamesMode::kIgnore, collator),
+              elements(comparator.makeBSONEltUnorderedSet()) {
+            elements.reserve(elems.size());
+            elements.insert(elems.begin(), elems.end());
+        }
+
+        ElementsHashSet(const ElementsHashSet&) = delete;
+        ElementsHashSet& operator=(const ElementsHashSet&) = delete;
+
+        const BSONElementComparator comparator;
+        BSONEltUnorderedSet elements;
+    };
+
     InListData(CloneCtorTag, const InListData& other);
 
     MONGO_COMPILER_ALWAYS_INLINE
@@ -355,6 +382,12 @@ private:
         });
     }
 
+    MONGO_COMPILER_ALWAYS_INLINE
+    const ElementsHashSet& getElementsHashSet() const {
+        return _elementsHashSet->get(
+            [&] { return std::make_unique<ElementsHashSet>(_collator, getSortedElements()); });
+    }
+
     void updateSbeTagMasks();
 
     void sortAndDedupElementsImpl();
@@ -436,6 +469,10 @@ private:
     // it will contain a sorted and deduped copy of the elements from '_originalElements'.
     boost::optional<LazilyInitialized<std::vector<BSONElement>>> _sortedElements;
 
+    // A lazily initialized hash set of the elements from '_sortedElements', only built for in-lists
+    // with at least 'kMinSizeForHashSet' unique elements.
+    boost::optional<LazilyInitialized<ElementsHashSet>> _elementsHashSet;
+
     // A vector of BSONElements of the first observed elements of each distinct canonical type in
     // '_originalElements'.
     SmallBSONElementVector _firstOfEachTypeElements;
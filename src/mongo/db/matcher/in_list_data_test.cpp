@@ -31,7 +31,9 @@
 #include <vector>
 
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/matcher/in_list_data.h"
+#include "mongo/db/query/collation/collator_interface_mock.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -161,5 +163,37 @@ TEST(InListData, GetFirstOfEachTypeSortedAndDeduped) {
     ASSERT_OK(inListElements.setElementsArray(objWithSortedElements["attr"].Obj()));
     assertFirstOfEachTypeReturnsReferredElements(inListElements, {0}, kGetSortedAndDeduped);
 }
+
+// Verifies that contains() gives the same answers whether it uses binary search or the hash set.
+TEST(InListData, ContainsSmallAndLargeLists) {
+    // The number of unique numbers in the list; the list also holds one string.
+    for (size_t size : {InListData::kMinSizeForHashSet - 2, InListData::kMinSizeForHashSet * 4}) {
+        BSONArrayBuilder bab;
+        for (size_t i = 0; i < size; ++i) {
+            bab.append(static_cast<int>(i * 2));
+        }
+        bab.append("str");
+        auto arr = bab.arr();
+
+        InListData inList;
+        ASSERT_OK(inList.setElementsArray(arr));
+
+        // Numbers of different types compare equal.
+        auto probes = BSON_ARRAY(4 << 4.0 << 4LL << Decimal128(4) << "str" << 3 << 4.5 << "STR"
+                                   << BSONNULL);
+        const bool expected[] = {true, true, true, true, true, false, false, false, false};
+        size_t i = 0;
+        for (auto&& probe : probes) {
+            ASSERT_EQ(inList.contains(probe), expected[i]) << size << " " << probe;
+            ++i;
+        }
+
+        // A collator change is honoured after the list has been probed.
+        CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+        inList.setCollator(&collator);
+        ASSERT_TRUE(inList.contains(BSON("" << "STR").firstElement())) << size;
+        ASSERT_TRUE(inList.contains(BSON("" << 4).firstElement())) << size;
+    }
+}
 }  // namespace
 }  // namespace mongo
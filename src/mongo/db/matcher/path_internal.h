@@ -46,6 +46,9 @@ bool isAllDigits(StringData str);
  * Finds the element at 'path' in 'doc', starting at 'startIndex' in 'path'. If none is found, an
  * EOO element is returned. If an array is encountered along 'path', the traversal stops early, and
  * the array is returned. 'idxPath' is set to the furthest index reached in 'path'.
+ *
+ * Each path component is found with a linear BSONObj::getField() scan, and nothing is cached
+ * between calls, so every predicate of a filter scans the document again.
  */
 BSONElement getFieldDottedOrArray(const BSONObj& doc,
                                   const FieldRef& path,
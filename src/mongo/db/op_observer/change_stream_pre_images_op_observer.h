@@ -47,6 +47,12 @@ public:
     ChangeStreamPreImagesOpObserver() = default;
     ~ChangeStreamPreImagesOpObserver() override = default;
 
+    NamespaceFilters getNamespaceFilters() const final {
+        return {.updateFilter = NamespaceFilter::kAll,
+                .deleteFilter = NamespaceFilter::kAll,
+                .insertFilter = NamespaceFilter::kNone};
+    }
+
     void onUpdate(OperationContext* opCtx,
                   const OplogUpdateEntryArgs& args,
                   OpStateAccumulator* opAccumulator = nullptr) final;
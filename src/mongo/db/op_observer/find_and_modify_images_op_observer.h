@@ -45,6 +45,12 @@ public:
     FindAndModifyImagesOpObserver() = default;
     ~FindAndModifyImagesOpObserver() override = default;
 
+    NamespaceFilters getNamespaceFilters() const final {
+        return {.updateFilter = NamespaceFilter::kAll,
+                .deleteFilter = NamespaceFilter::kAll,
+                .insertFilter = NamespaceFilter::kNone};
+    }
+
     void onUpdate(OperationContext* opCtx,
                   const OplogUpdateEntryArgs& args,
                   OpStateAccumulator* opAccumulator = nullptr) final;
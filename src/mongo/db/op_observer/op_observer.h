@@ -193,6 +193,9 @@ public:
     struct NamespaceFilters {
         NamespaceFilter updateFilter;  // onInserts, onUpdate
         NamespaceFilter deleteFilter;  // aboutToDelete, onDelete
+        // If set, overrides 'updateFilter' for onInserts. Observers that only act on updates and
+        // deletes set this to kNone so that they are not called for inserts.
+        boost::optional<NamespaceFilter> insertFilter = boost::none;
     };
 
     enum class CollectionDropType {
@@ -89,45 +89,21 @@ public:
         _observers.push_back(std::move(observer));
 
         OpObserver* observerPtr = _observers.back().get();
-        switch (nsFilters.updateFilter) {
-            case OpObserver::NamespaceFilter::kConfig:
-                _insertAndUpdateConfigObservers.push_back(observerPtr);
-                break;
-            case OpObserver::NamespaceFilter::kSystem:
-                _insertAndUpdateSystemObservers.push_back(observerPtr);
-                break;
-            case OpObserver::NamespaceFilter::kConfigAndSystem:
-                _insertAndUpdateConfigObservers.push_back(observerPtr);
-                _insertAndUpdateSystemObservers.push_back(observerPtr);
-                break;
-            case OpObserver::NamespaceFilter::kAll:
-                _insertAndUpdateConfigObservers.push_back(observerPtr);
-                _insertAndUpdateSystemObservers.push_back(observerPtr);
-                _insertAndUpdateUserObservers.push_back(observerPtr);
-                break;
-            default:
-                break;
-        }
-
-        switch (nsFilters.deleteFilter) {
-            case OpObserver::NamespaceFilter::kConfig:
-                _onDeleteConfigObservers.push_back(observerPtr);
-                break;
-            case OpObserver::NamespaceFilter::kSystem:
-                _onDeleteSystemObservers.push_back(observerPtr);
-                break;
-            case OpObserver::NamespaceFilter::kConfigAndSystem:
-                _onDeleteConfigObservers.push_back(observerPtr);
-                _onDeleteSystemObservers.push_back(observerPtr);
-                break;
-            case OpObserver::NamespaceFilter::kAll:
-                _onDeleteConfigObservers.push_back(observerPtr);
-                _onDeleteSystemObservers.push_back(observerPtr);
-                _onDeleteUserObservers.push_back(observerPtr);
-                break;
-            default:
-                break;
-        }
+        _addToQueues(nsFilters.insertFilter.value_or(nsFilters.updateFilter),
+                     observerPtr,
+                     _onInsertConfigObservers,
+                     _onInsertSystemObservers,
+                     _onInsertUserObservers);
+        _addToQueues(nsFilters.updateFilter,
+                     observerPtr,
+                     _onUpdateConfigObservers,
+                     _onUpdateSystemObservers,
+                     _onUpdateUserObservers);
+        _addToQueues(nsFilters.deleteFilter,
+                     observerPtr,
+                     _onDeleteConfigObservers,
+                     _onDeleteSystemObservers,
+                     _onDeleteUserObservers);
     }
 
     void onModifyCollectionShardingIndexCatalog(OperationContext* opCtx,
@@ -233,11 +209,11 @@ public:
         const auto& nss = coll->ns();
         std::vector<OpObserver*>* observerQueue;
         if (nss.isConfigDB()) {
-            observerQueue = &_insertAndUpdateConfigObservers;
+            observerQueue = &_onInsertConfigObservers;
         } else if (nss.isSystem()) {
-            observerQueue = &_insertAndUpdateSystemObservers;
+            observerQueue = &_onInsertSystemObservers;
         } else {
-            observerQueue = &_insertAndUpdateUserObservers;
+            observerQueue = &_onInsertUserObservers;
         }
 
         for (auto& o : *observerQueue)
@@ -281,11 +257,11 @@ public:
         const auto& nss = args.coll->ns();
         std::vector<OpObserver*>* observerQueue;
         if (nss.isConfigDB()) {
-            observerQueue = &_insertAndUpdateConfigObservers;
+            observerQueue = &_onUpdateConfigObservers;
         } else if (nss.isSystem()) {
-            observerQueue = &_insertAndUpdateSystemObservers;
+            observerQueue = &_onUpdateSystemObservers;
         } else {
-            observerQueue = &_insertAndUpdateUserObservers;
+            observerQueue = &_onUpdateUserObservers;
         }
 
         for (auto& o : *observerQueue)
@@ -640,6 +616,33 @@ private:
         return times.front();
     }
 
+    // Appends 'observer' to the queues of the namespace classes that 'filter' selects.
+    static void _addToQueues(OpObserver::NamespaceFilter filter,
+                             OpObserver* observer,
+                             std::vector<OpObserver*>& configObservers,
+                             std::vector<OpObserver*>& systemObservers,
+                             std::vector<OpObserver*>& userObservers) {
+        switch (filter) {
+            case OpObserver::NamespaceFilter::kConfig:
+                configObservers.push_back(observer);
+                break;
+            case OpObserver::NamespaceFilter::kSystem:
+                systemObservers.push_back(observer);
+                break;
+            case OpObserver::NamespaceFilter::kConfigAndSystem:
+                configObservers.push_back(observer);
+                systemObservers.push_back(observer);
+                break;
+            case OpObserver::NamespaceFilter::kAll:
+                configObservers.push_back(observer);
+                systemObservers.push_back(observer);
+                userObservers.push_back(observer);
+                break;
+            default:
+                break;
+        }
+    }
+
     // For use by the long tail of non-performance-critical operations: non-CRUD.
     // CRUD operations have the most observers and are worth optimizing. For non-CRUD operations,
     // there are few implemented observers and as little as one that implement the interface.
@@ -648,11 +651,17 @@ private:
     // For performance reasons, store separate but still ordered queues for CRUD ops.
     // Each CRUD operation will iterate through one of these queues based on the nss
     // of the target document of the operation.
-    std::vector<OpObserver*> _insertAndUpdateConfigObservers;  // config.*
-    std::vector<OpObserver*> _insertAndUpdateSystemObservers;  // *.system.*
+    std::vector<OpObserver*> _onInsertConfigObservers;  // config.*
+    std::vector<OpObserver*> _onInsertSystemObservers;  // *.system.*
+    std::vector<OpObserver*>
+        _onInsertUserObservers;  // not config nor system.
+                                 // Will impact writes to all user collections.
+
+    std::vector<OpObserver*> _onUpdateConfigObservers;  // config.*
+    std::vector<OpObserver*> _onUpdateSystemObservers;  // *.system.*
     std::vector<OpObserver*>
-        _insertAndUpdateUserObservers;  // not config nor system.
-                                        // Will impact writes to all user collections.
+        _onUpdateUserObservers;  // not config nor system.
+                                 // Will impact writes to all user collections.
 
     // Having separate queues for delete operations allows observers like
     // PrimaryOnlyServiceOpObserver to use the filtering differently between insert/update, and
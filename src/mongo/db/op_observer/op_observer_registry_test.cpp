@@ -35,6 +35,7 @@
 
 #include "mongo/base/error_codes.h"
 #include "mongo/base/string_data.h"
+#include "mongo/db/catalog/collection_mock.h"
 #include "mongo/db/op_observer/op_observer_noop.h"
 #include "mongo/db/op_observer/op_observer_registry.h"
 #include "mongo/db/repl/optime.h"
@@ -110,6 +111,28 @@ struct TestObserver : public OpObserverNoop {
                               bool stayTemp) override {}
 };
 
+struct InsertCountingObserver : public OpObserverNoop {
+    explicit InsertCountingObserver(NamespaceFilters filters) : filters(filters) {}
+
+    NamespaceFilters getNamespaceFilters() const override {
+        return filters;
+    }
+
+    void onInserts(OperationContext* opCtx,
+                   const CollectionPtr& coll,
+                   std::vector<InsertStatement>::const_iterator first,
+                   std::vector<InsertStatement>::const_iterator last,
+                   const std::vector<RecordId>& recordIds,
+                   std::vector<bool> fromMigrate,
+                   bool defaultFromMigrate,
+                   OpStateAccumulator* opAccumulator) override {
+        inserts++;
+    }
+
+    NamespaceFilters filters;
+    int inserts = 0;
+};
+
 struct ThrowingObserver : public TestObserver {
     void onDropDatabase(OperationContext* opCtx,
                         const DatabaseName& dbName,
@@ -256,5 +279,42 @@ DEATH_TEST_F(OpObserverRegistryTest, PreRenameCollectionReturnsInconsistentTime,
     checkInconsistentOpTime(op);
 }
 
+TEST_F(OpObserverRegistryTest, InsertFilterOverridesUpdateFilterForInserts) {
+    auto uniqueDefault = std::make_unique<InsertCountingObserver>(OpObserver::NamespaceFilters{
+        OpObserver::NamespaceFilter::kAll, OpObserver::NamespaceFilter::kAll});
+    auto uniqueNoInserts = std::make_unique<InsertCountingObserver>(
+        OpObserver::NamespaceFilters{.updateFilter = OpObserver::NamespaceFilter::kAll,
+                                     .deleteFilter = OpObserver::NamespaceFilter::kAll,
+                                     .insertFilter = OpObserver::NamespaceFilter::kNone});
+    auto uniqueConfigInserts = std::make_unique<InsertCountingObserver>(
+        OpObserver::NamespaceFilters{.updateFilter = OpObserver::NamespaceFilter::kNone,
+                                     .deleteFilter = OpObserver::NamespaceFilter::kNone,
+                                     .insertFilter = OpObserver::NamespaceFilter::kConfig});
+    auto defaultObserver = uniqueDefault.get();
+    auto noInsertsObserver = uniqueNoInserts.get();
+    auto configInsertsObserver = uniqueConfigInserts.get();
+    registry.addObserver(std::move(uniqueDefault));
+    registry.addObserver(std::move(uniqueNoInserts));
+    registry.addObserver(std::move(uniqueConfigInserts));
+
+    std::vector<InsertStatement> inserts{InsertStatement(BSON("_id" << 1))};
+    std::vector<RecordId> recordIds{RecordId(1)};
+    for (const auto& nss : {testNss, NamespaceString::kSessionTransactionsTableNamespace}) {
+        CollectionMock coll(nss);
+        CollectionPtr collPtr(&coll);
+        registry.onInserts(opCtx,
+                           collPtr,
+                           inserts.cbegin(),
+                           inserts.cend(),
+                           recordIds,
+                           {false},
+                           false /* defaultFromMigrate */);
+    }
+
+    ASSERT_EQUALS(defaultObserver->inserts, 2);
+    ASSERT_EQUALS(noInsertsObserver->inserts, 0);
+    ASSERT_EQUALS(configInsertsObserver->inserts, 1);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -42,6 +42,7 @@
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
+#include "mongo/bson/oid.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/catalog/document_validation.h"
 #include "mongo/db/logical_time.h"
@@ -59,6 +60,9 @@
 namespace mongo {
 namespace {
 
+// Type byte, "_id" field name and ObjectId value of a generated _id element.
+constexpr size_t kGeneratedIdElementSize = 1 + sizeof("_id") + OID::kOIDSize;
+
 /**
  * Validates the nesting depth of 'obj', returning a non-OK status if it exceeds the limit.
  */
@@ -169,12 +173,12 @@ StatusWith<BSONObj> fixDocumentForInsert(OperationContext* opCtx,
     if (validationDisabled || (firstElementIsId && !hasTimestampToFix))
         return StatusWith<BSONObj>(BSONObj());
 
+    // The rebuilt document has at most one more element than 'doc', a generated _id, so reserving
+    // that much up front means the builder never has to grow.
+    BSONObjBuilder b(doc.objsize() + kGeneratedIdElementSize);
     BSONObjIterator i(doc);
-
-    BSONObjBuilder b(doc.objsize() + 16);
     if (firstElementIsId) {
-        b.append(doc.firstElement());
-        i.next();
+        b.append(i.next());
     } else {
         BSONElement e = doc["_id"];
         if (e.type()) {
@@ -44,6 +44,7 @@
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -1218,7 +1219,7 @@ WriteResult performInserts(OperationContext* opCtx,
             batch.emplace_back(source == OperationSource::kTimeseriesInsert && wholeOp.getStmtIds()
                                    ? *wholeOp.getStmtIds()
                                    : std::vector<StmtId>{stmtId},
-                               toInsert);
+                               std::move(toInsert));
 
             bytesInBatch += batch.back().doc.objsize();
 
@@ -2898,7 +2899,8 @@ insertIntoBucketCatalog(OperationContext* opCtx,
                         size_t numDocs,
                         const std::vector<size_t>& indices,
                         std::vector<write_ops::WriteError>* errors,
-                        bool* containsRetry) {
+                        bool* containsRetry,
+                        timeseries::bucket_catalog::CombineWithInsertsFromOtherClients combine) {
     auto& bucketCatalog = timeseries::bucket_catalog::BucketCatalog::get(opCtx);
 
     auto bucketsNs = makeTimeseriesBucketsNamespace(ns(request));
@@ -2970,7 +2972,7 @@ insertIntoBucketCatalog(OperationContext* opCtx,
             timeSeriesOptions,
             measurementDoc,
             timeseries::BucketReopeningPermittance::kAllowed,
-            canCombineTimeseriesInsertWithOtherClients(opCtx, request),
+            combine,
             compressAndWriteBucketFunc);
 
         if (auto error = write_ops_exec::generateError(
@@ -3041,8 +3043,15 @@ bool performOrderedTimeseriesWritesAtomically(OperationContext* opCtx,
                                               boost::optional<repl::OpTime>* opTime,
                                               boost::optional<OID>* electionId,
                                               bool* containsRetry) {
-    auto [_, batches, stmtIds, numInserted] = insertIntoBucketCatalog(
-        opCtx, request, 0, request.getDocuments().size(), {}, errors, containsRetry);
+    auto [_, batches, stmtIds, numInserted] =
+        insertIntoBucketCatalog(opCtx,
+                                request,
+                                0,
+                                request.getDocuments().size(),
+                                {},
+                                errors,
+                                containsRetry,
+                                canCombineTimeseriesInsertWithOtherClients(opCtx, request));
 
     hangTimeseriesInsertBeforeCommit.pauseWhileSet();
 
@@ -3075,8 +3084,23 @@ std::vector<size_t> performUnorderedTimeseriesWrites(
     boost::optional<OID>* electionId,
     bool* containsRetry,
     absl::flat_hash_map<int, int>& retryAttemptsForDup) {
-    auto [uuid, batches, bucketStmtIds, _] =
-        insertIntoBucketCatalog(opCtx, request, start, numDocs, indices, errors, containsRetry);
+    // On the first attempt, try to commit all buckets in one storage transaction rather than one
+    // per bucket. The batches are then kept private to this operation, so that aborting them
+    // cannot drop measurements inserted by other clients.
+    const bool commitAtomically =
+        gTimeseriesCommitUnorderedInsertsAtomically.load() && indices.empty() && numDocs > 1;
+
+    const auto numErrors = errors->size();
+    auto [uuid, batches, bucketStmtIds, _] = insertIntoBucketCatalog(
+        opCtx,
+        request,
+        start,
+        numDocs,
+        indices,
+        errors,
+        containsRetry,
+        commitAtomically ? timeseries::bucket_catalog::CombineWithInsertsFromOtherClients::kDisallow
+                         : canCombineTimeseriesInsertWithOtherClients(opCtx, request));
     UUID collectionUUID = uuid;
 
     hangTimeseriesInsertBeforeCommit.pauseWhileSet();
@@ -3084,6 +3108,30 @@ std::vector<size_t> performUnorderedTimeseriesWrites(
     bool canContinue = true;
     std::vector<size_t> docsToRetry;
 
+    // The atomic commit is only attempted when every measurement made it into a batch, so that
+    // retrying all of them after a failed attempt cannot report an error twice.
+    if (commitAtomically && errors->size() == numErrors) {
+        if (commitTimeseriesBucketsAtomically(
+                opCtx, request, batches, std::move(bucketStmtIds), opTime, electionId)) {
+            getTimeseriesBatchResults(opCtx,
+                                      batches,
+                                      start,
+                                      batches.size(),
+                                      canContinue,
+                                      errors,
+                                      opTime,
+                                      electionId,
+                                      &docsToRetry);
+            return docsToRetry;
+        }
+
+        // The batches only held this operation's measurements and have all been aborted, so
+        // insert every measurement again and commit the resulting buckets individually.
+        docsToRetry.resize(numDocs);
+        std::iota(docsToRetry.begin(), docsToRetry.end(), 0);
+        return docsToRetry;
+    }
+
     stdx::unordered_set<timeseries::bucket_catalog::WriteBatch*> handledHere;
     int64_t handledElsewhere = 0;
     auto reportMeasurementsGuard =
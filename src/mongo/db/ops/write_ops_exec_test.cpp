@@ -50,7 +50,9 @@
 #include "mongo/db/catalog/collection_write_path.h"
 #include "mongo/db/catalog/create_collection.h"
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/client.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/dbdirectclient.h"
 #include "mongo/db/dbhelpers.h"
 #include "mongo/db/generic_argument_util.h"
 #include "mongo/db/op_observer/op_observer_noop.h"
@@ -70,8 +72,10 @@
 #include "mongo/idl/idl_parser.h"
 #include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/metadata/impersonated_user_metadata_gen.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
+#include "mongo/util/fail_point.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -412,6 +416,68 @@ TEST_F(WriteOpsExecTest, PerformAtomicTimeseriesWritesWithTransform) {
     }
 }
 
+TEST_F(WriteOpsExecTest, AtomicUnorderedTimeseriesInsertFailureRetriesOnlyItsOwnMeasurements) {
+    RAIIServerParameterControllerForTest commitAtomically{
+        "timeseriesCommitUnorderedInsertsAtomically", true};
+    NamespaceString ns =
+        NamespaceString::createNamespaceString_forTest("db_write_ops_exec_test", "ts");
+    ASSERT_OK(createCollection(operationContext(),
+                               ns.dbName(),
+                               BSON("create" << ns.coll() << "timeseries"
+                                             << BSON("timeField"
+                                                     << "time"
+                                                     << "metaField"
+                                                     << "meta"))));
+
+    // Two clients insert measurements with the same metadata, so that they would write to the
+    // same buckets. Measurement 'x' values are unique across both inserts.
+    constexpr int kNumPerWriter = 10;
+    auto runWriter = [&](const std::string& name, int firstX) {
+        ThreadClient tc(name, getServiceContext()->getService());
+        auto opCtx = tc->makeOperationContext();
+        std::vector<BSONObj> docs;
+        for (int x = firstX; x < firstX + kNumPerWriter; ++x) {
+            docs.push_back(BSON("time" << Date_t::now() << "meta" << 1 << "x" << x));
+        }
+        write_ops::InsertCommandRequest request(ns, std::move(docs));
+        request.getWriteCommandRequestBase().setOrdered(false);
+        auto reply = write_ops_exec::performTimeseriesWrites(opCtx.get(), request);
+        ASSERT_EQ(reply.getN(), kNumPerWriter);
+        ASSERT_FALSE(reply.getWriteErrors());
+    };
+
+    // Stage both inserts before either of them commits, then fail the first atomic commit.
+    auto hangBeforeCommit = globalFailPointRegistry().find("hangTimeseriesInsertBeforeCommit");
+    auto failAtomicWrites = globalFailPointRegistry().find("failAtomicTimeseriesWrites");
+    const auto timesEntered = hangBeforeCommit->setMode(FailPoint::alwaysOn);
+    stdx::thread writerA([&] { runWriter("writerA", 0); });
+    hangBeforeCommit->waitForTimesEntered(timesEntered + 1);
+    stdx::thread writerB([&] { runWriter("writerB", kNumPerWriter); });
+    hangBeforeCommit->waitForTimesEntered(timesEntered + 2);
+    failAtomicWrites->setMode(FailPoint::nTimes, 1);
+    hangBeforeCommit->setMode(FailPoint::off);
+    writerA.join();
+    writerB.join();
+    failAtomicWrites->setMode(FailPoint::off);
+
+    // Every measurement is stored exactly once: the failed commit must only have retried its own
+    // measurements, and must not have dropped those of the other client.
+    std::vector<int> seen(2 * kNumPerWriter, 0);
+    DBDirectClient client(operationContext());
+    auto cursor = client.find(FindCommandRequest(ns.makeTimeseriesBucketsNamespace()));
+    while (cursor->more()) {
+        auto bucket = cursor->next();
+        auto decompressed = timeseries::decompressBucket(bucket);
+        const auto& data = decompressed ? *decompressed : bucket;
+        for (auto&& x : data["data"]["x"].Obj()) {
+            ++seen.at(x.numberInt());
+        }
+    }
+    for (int x = 0; x < 2 * kNumPerWriter; ++x) {
+        ASSERT_EQ(seen[x], 1) << "x: " << x;
+    }
+}
+
 class OpObserverMock : public OpObserverNoop {
 public:
     ~OpObserverMock() override {
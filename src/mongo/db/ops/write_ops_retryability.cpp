@@ -129,6 +129,11 @@ void validateFindAndModifyRetryability(const write_ops::FindAndModifyCommandRequ
 /**
  * Extracts either the pre or post image (cannot be both) of the findAndModify operation from the
  * oplog.
+ *
+ * Images in the side collection are read on every retry. Each session has one image document,
+ * keyed by its lsid, so the read is a point lookup on _id. The document is checked against the
+ * oplog entry's txnNumber and timestamp, and it is replaced, invalidated or rolled back together
+ * with the oplog. Any in-memory copy would have to follow the same rules.
  */
 BSONObj extractPreOrPostImage(OperationContext* opCtx, const repl::OplogEntry& oplog) {
     invariant(oplog.getPreImageOpTime() || oplog.getPostImageOpTime() ||
@@ -193,6 +193,14 @@ std::set<std::string> ChangeStreamDefaultEventTransformation::getFieldNameDepend
     return accessedFields;
 }
 
+Value ChangeStreamDefaultEventTransformation::_getNsField(const NamespaceString& nss) const {
+    if (!_lastNss || *_lastNss != nss) {
+        _lastNss = nss;
+        _lastNsField = makeChangeStreamNsField(nss);
+    }
+    return _lastNsField;
+}
+
 Document ChangeStreamDefaultEventTransformation::applyTransformation(const Document& input) const {
     MutableDocument doc;
 
@@ -485,7 +493,7 @@ Document ChangeStreamDefaultEventTransformation::applyTransformation(const Docum
 
     // If needed, add the 'ns' field to the change stream document, based on the final value of nss.
     if (!kOpsWithoutNs.contains(operationType)) {
-        doc.addField(DocumentSourceChangeStream::kNamespaceField, makeChangeStreamNsField(nss));
+        doc.addField(DocumentSourceChangeStream::kNamespaceField, _getNsField(nss));
     }
 
     // The event may have a documentKey OR an operationDescription, but not both. We already
@@ -33,11 +33,13 @@
 #include <set>
 #include <string>
 
+#include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/document_source_change_stream_gen.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/resume_token.h"
@@ -94,6 +96,16 @@ public:
 
     Document applyTransformation(const Document& fromDoc) const override;
     std::set<std::string> getFieldNameDependencies() const override;
+
+private:
+    /**
+     * Returns the 'ns' field for 'nss'. Consecutive events usually share a namespace, so the field
+     * built for the previous event is reused rather than allocating a new one.
+     */
+    Value _getNsField(const NamespaceString& nss) const;
+
+    mutable boost::optional<NamespaceString> _lastNss;
+    mutable Value _lastNsField;
 };
 
 /**
@@ -109,6 +109,33 @@ TEST(ChangeStreamEventTransformTest, TestDefaultUpdateTransform) {
     ASSERT_DOCUMENT_EQ(applyTransformation(updateField), expectedUpdateField);
 }
 
+TEST(ChangeStreamEventTransformTest, TestNamespaceChangesAcrossEvents) {
+    const auto collA = NamespaceString::createNamespaceString_forTest(nss.dbName(), "a");
+    const auto collB = NamespaceString::createNamespaceString_forTest(nss.dbName(), "b");
+
+    DocumentSourceChangeStreamSpec spec;
+    spec.setStartAtOperationTime(kDefaultTs);
+    ChangeStreamEventTransformer transformer(
+        make_intrusive<ExpressionContextForTest>(
+            NamespaceString::makeCollectionlessAggregateNSS(nss.dbName())),
+        spec);
+
+    // The 'ns' field must follow the namespace of each event, including when it switches back.
+    for (const auto& eventNss : {collA, collB, collA}) {
+        auto insert = makeOplogEntry(repl::OpTypeEnum::kInsert,  // op type
+                                     eventNss,                   // namespace
+                                     BSON("_id" << 1),           // o
+                                     testUuid(),                 // uuid
+                                     boost::none,                // fromMigrate
+                                     BSON("_id" << 1));          // o2
+        auto changeStreamDoc =
+            transformer.applyTransformation(Document(insert.getEntry().toBSON()));
+        auto nsField = changeStreamDoc[DocumentSourceChangeStream::kNamespaceField];
+        ASSERT_DOCUMENT_EQ(nsField.getDocument(),
+                           (Document{{"db", eventNss.db_forTest()}, {"coll", eventNss.coll()}}));
+    }
+}
+
 TEST(ChangeStreamEventTransformTest, TestCreateViewTransform) {
     const NamespaceString systemViewNss = NamespaceString::makeSystemDotViewsNamespace(
         DatabaseName::createDatabaseName_forTest(boost::none, "viewDB"));
@@ -160,7 +160,9 @@ private:
     // stored in the oplog entry. Returns boost::none if no pre-image information is available.
     boost::optional<Document> generatePostImage(const Document& updateOp) const;
 
-    // Retrieves the current version of the document for the update event.
+    // Retrieves the current version of the document for the update event. Each event is looked up
+    // on its own: later stages may return the event to the client before the next one is read from
+    // the oplog, so events cannot be held back to batch their lookups.
     boost::optional<Document> lookupLatestPostImage(const Document& updateOp) const;
 
     /**
@@ -63,6 +63,10 @@ namespace mongo {
  * detect if a collection is being watched and a chunk for that collection migrates to a shard for
  * the first time. When this event is detected, this stage will establish a new cursor on that
  * shard and add it to the cursors being merged.
+ *
+ * The merge is a single stream totally ordered by resume token. An event can only be returned once
+ * every shard's high-water mark has passed it, because a shard added here may start reporting
+ * events from a point before the latest token returned so far.
  */
 class DocumentSourceChangeStreamHandleTopologyChange final : public DocumentSource {
 public:
@@ -84,7 +84,9 @@ std::unique_ptr<MatchExpression> buildOplogMatchFilter(
             "Expected changeStream spec to be present while building the oplog match filter",
             expCtx->changeStreamSpec);
 
-    // Start building the oplog filter by adding predicates that apply to every entry.
+    // Start building the oplog filter by adding predicates that apply to every entry. Only the
+    // 'ts' predicate bounds the scan, since the oplog is ordered by 'ts' and cannot have secondary
+    // indexes. The namespace predicates below are evaluated against every entry after that point.
     auto oplogFilter = std::make_unique<AndMatchExpression>();
     oplogFilter->add(buildTsFilter(expCtx, startFromInclusive, userMatch, backingBsonObjs));
 
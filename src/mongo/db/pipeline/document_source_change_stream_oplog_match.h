@@ -55,6 +55,10 @@ namespace mongo {
 /**
  * A custom subclass of DocumentSourceMatch which is used to generate a $match stage to be applied
  * on the oplog. The stage requires itself to be the first stage in the pipeline.
+ *
+ * The filter is pushed down into the oplog collection scan of this change stream's own tailable
+ * cursor, so every open change stream reads and filters the oplog independently. There is no
+ * shared oplog reader, and the cost of fanning out grows with the number of open streams.
  */
 class DocumentSourceChangeStreamOplogMatch final : public DocumentSourceMatch {
 public:
@@ -29,6 +29,7 @@
 
 // IWYU pragma: no_include "boost/container/detail/std_fwd.hpp"
 #include <algorithm>
+#include <exception>
 #include <list>
 #include <memory>
 #include <vector>
@@ -43,7 +44,9 @@
 #include "mongo/bson/bsontypes.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/document_metadata_fields.h"
+#include "mongo/db/client.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/document_source_facet.h"
 #include "mongo/db/pipeline/document_source_tee_consumer.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -52,8 +55,16 @@
 #include "mongo/db/pipeline/tee_buffer.h"
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/db/query/plan_summary_stats.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -62,6 +73,30 @@ using std::pair;
 using std::string;
 using std::vector;
 
+namespace {
+// Runs the sub-pipelines of every concurrent $facet on this ServiceContext. The pool is shared by
+// all queries and bounded by the largest allowed value of 'internalQueryFacetMaxThreads'.
+const auto facetWorkerPool = ServiceContext::declareDecoration<std::unique_ptr<ThreadPool>>();
+const ServiceContext::ConstructorActionRegisterer facetWorkerPoolRegisterer{
+    "FacetWorkerPool",
+    [](ServiceContext* service) {
+        ThreadPool::Options options;
+        options.poolName = "FacetWorker";
+        options.threadNamePrefix = "FacetWorker-";
+        options.minThreads = 0;
+        options.maxThreads = 64;
+        facetWorkerPool(service) = std::make_unique<ThreadPool>(std::move(options));
+        facetWorkerPool(service)->startup();
+    },
+    [](ServiceContext* service) {
+        if (auto& pool = facetWorkerPool(service)) {
+            pool->shutdown();
+            pool->join();
+            pool.reset();
+        }
+    }};
+}  // namespace
+
 DocumentSourceFacet::DocumentSourceFacet(std::vector<FacetPipeline> facetPipelines,
                                          const intrusive_ptr<ExpressionContext>& expCtx,
                                          size_t bufferSizeBytes,
@@ -72,8 +107,8 @@ DocumentSourceFacet::DocumentSourceFacet(std::vector<FacetPipeline> facetPipelin
       _maxOutputDocSizeBytes(maxOutputDocBytes) {
     for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
         auto& facet = _facets[facetId];
-        facet.pipeline->addInitialSource(
-            DocumentSourceTeeConsumer::create(pExpCtx, facetId, _teeBuffer, kTeeConsumerStageName));
+        facet.pipeline->addInitialSource(DocumentSourceTeeConsumer::create(
+            facet.pipeline->getContext(), facetId, _teeBuffer, kTeeConsumerStageName));
     }
 }
 
@@ -143,6 +178,60 @@ std::string getStageNameNotAllowedInFacet(const DocumentSource& source,
     MONGO_UNREACHABLE_TASSERT(8045600);
 }
 
+/**
+ * Folds the properties recorded on 'facetExpCtx' while parsing a sub-pipeline into 'expCtx', as if
+ * the sub-pipeline had been parsed with 'expCtx' itself.
+ */
+void mergeParsedProperties(ExpressionContext* expCtx, const ExpressionContext& facetExpCtx) {
+    expCtx->sbeCompatibility = std::min(expCtx->sbeCompatibility, facetExpCtx.sbeCompatibility);
+    expCtx->exprUnstableForApiV1 |= facetExpCtx.exprUnstableForApiV1;
+    expCtx->exprDeprectedForApiV1 |= facetExpCtx.exprDeprectedForApiV1;
+    expCtx->hasServerSideJs.accumulator |= facetExpCtx.hasServerSideJs.accumulator;
+    expCtx->hasServerSideJs.function |= facetExpCtx.hasServerSideJs.function;
+    expCtx->hasServerSideJs.where |= facetExpCtx.hasServerSideJs.where;
+}
+
+/**
+ * Returns true if 'pipeline' can run on a thread of its own while detached from the
+ * OperationContext. Its stages must only transform their input in memory, and must not share any
+ * state with the other sub-pipelines of the $facet.
+ */
+bool canRunConcurrently(const Pipeline& pipeline, const ExpressionContext& facetStageExpCtx) {
+    static const StringDataSet kConcurrentStages{DocumentSourceFacet::kTeeConsumerStageName,
+                                                 "$addFields"_sd,
+                                                 "$bucketAuto"_sd,
+                                                 "$group"_sd,
+                                                 "$limit"_sd,
+                                                 "$match"_sd,
+                                                 "$project"_sd,
+                                                 "$replaceRoot"_sd,
+                                                 "$replaceWith"_sd,
+                                                 "$set"_sd,
+                                                 "$skip"_sd,
+                                                 "$sort"_sd,
+                                                 "$unset"_sd,
+                                                 "$unwind"_sd};
+
+    // A sub-pipeline parsed with the $facet's own ExpressionContext shares its variables and its
+    // OperationContext. Collators and server-side JavaScript are not safe to use concurrently.
+    const auto& expCtx = pipeline.getContext();
+    if (expCtx.get() == &facetStageExpCtx || expCtx->getCollator() ||
+        expCtx->hasServerSideJs.accumulator || expCtx->hasServerSideJs.function ||
+        expCtx->hasServerSideJs.where) {
+        return false;
+    }
+
+    // Aggressive spilling consults the OperationContext for every group.
+    if (internalQueryEnableAggressiveSpillsInGroup.load()) {
+        return false;
+    }
+
+    const auto& sources = pipeline.getSources();
+    return std::all_of(sources.begin(), sources.end(), [](const auto& stage) {
+        return kConcurrentStages.contains(StringData(stage->getSourceName()));
+    });
+}
+
 }  // namespace
 
 std::unique_ptr<DocumentSourceFacet::LiteParsed> DocumentSourceFacet::LiteParsed::parse(
@@ -197,18 +286,22 @@ DocumentSource::GetNextResult DocumentSourceFacet::doGetNext() {
     };
 
     vector<vector<Value>> results(_facets.size());
-    bool allPipelinesEOF = false;
-    while (!allPipelinesEOF) {
-        allPipelinesEOF = true;  // Set this to false if any pipeline isn't EOF.
-        for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
-            const auto& pipeline = _facets[facetId].pipeline;
-            auto next = pipeline->getSources().back()->getNext();
-            for (; next.isAdvanced(); next = pipeline->getSources().back()->getNext()) {
-                ensureUnderMemoryLimit(next.getDocument().getApproximateSize());
-                results[facetId].emplace_back(next.releaseDocument());
+    if (auto concurrentFacets = getConcurrentFacets(); !concurrentFacets.empty()) {
+        drainFacetsConcurrently(concurrentFacets, results, ensureUnderMemoryLimit);
+    } else {
+        bool allPipelinesEOF = false;
+        while (!allPipelinesEOF) {
+            allPipelinesEOF = true;  // Set this to false if any pipeline isn't EOF.
+            for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
+                const auto& pipeline = _facets[facetId].pipeline;
+                auto next = pipeline->getSources().back()->getNext();
+                for (; next.isAdvanced(); next = pipeline->getSources().back()->getNext()) {
+                    ensureUnderMemoryLimit(next.getDocument().getApproximateSize());
+                    results[facetId].emplace_back(next.releaseDocument());
+                }
+                allPipelinesEOF = allPipelinesEOF && next.isEOF();
+                accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
             }
-            allPipelinesEOF = allPipelinesEOF && next.isEOF();
-            accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
         }
     }
 
@@ -221,6 +314,193 @@ DocumentSource::GetNextResult DocumentSourceFacet::doGetNext() {
     return resultDoc.freeze();
 }
 
+std::vector<size_t> DocumentSourceFacet::getConcurrentFacets() const {
+    // Collecting execution stats requires the OperationContext.
+    if (internalQueryFacetMaxThreads.load() <= 1 || pExpCtx->explain) {
+        return {};
+    }
+
+    std::vector<size_t> concurrentFacets;
+    for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
+        if (canRunConcurrently(*_facets[facetId].pipeline, *pExpCtx)) {
+            concurrentFacets.push_back(facetId);
+        }
+    }
+
+    // A lone sub-pipeline gains nothing from running on another thread.
+    if (_facets.size() < 2) {
+        return {};
+    }
+    return concurrentFacets;
+}
+
+void DocumentSourceFacet::drainFacetsConcurrently(
+    const std::vector<size_t>& concurrentFacets,
+    std::vector<std::vector<Value>>& results,
+    const std::function<void(long long)>& ensureUnderMemoryLimit) {
+    const size_t nThreads =
+        std::min<size_t>(internalQueryFacetMaxThreads.load(), concurrentFacets.size());
+
+    struct FacetProgress {
+        bool isConcurrent = false;
+        bool isEOF = false;
+        size_t nResultsCounted = 0;
+        long long resultBytes = 0;
+        std::exception_ptr error;
+    };
+    std::vector<FacetProgress> progress(_facets.size());
+    for (auto facetId : concurrentFacets) {
+        progress[facetId].isConcurrent = true;
+    }
+
+    // Consumes the current batch through the sub-pipeline of 'facetId'. A sub-pipeline whose
+    // output alone exceeds the size limit stops early, since this thread will fail the query.
+    auto drainFacet = [&](size_t facetId) {
+        auto& facetProgress = progress[facetId];
+        if (facetProgress.isEOF) {
+            return;
+        }
+        try {
+            const auto& pipeline = _facets[facetId].pipeline;
+            auto next = pipeline->getSources().back()->getNext();
+            for (; next.isAdvanced(); next = pipeline->getSources().back()->getNext()) {
+                facetProgress.resultBytes += next.getDocument().getApproximateSize();
+                results[facetId].emplace_back(next.releaseDocument());
+                if (facetProgress.resultBytes > static_cast<long long>(_maxOutputDocSizeBytes)) {
+                    return;
+                }
+            }
+            facetProgress.isEOF = next.isEOF();
+        } catch (...) {
+            facetProgress.error = std::current_exception();
+        }
+    };
+
+    _teeBuffer->setConcurrentConsumers(true);
+    ON_BLOCK_EXIT([&] { _teeBuffer->setConcurrentConsumers(false); });
+
+    // Each task drains its sub-pipelines on a child operation of this one, which inherits its
+    // deadline. Interrupting this operation while the tasks run kills the child operations with
+    // the same error, including those of tasks still queued in the shared pool.
+    auto opCtx = pExpCtx->opCtx;
+    auto service = opCtx->getService();
+    const auto deadline = opCtx->getDeadline();
+    const auto timeoutError = opCtx->getTimeoutError();
+
+    auto mutex = MONGO_MAKE_LATCH("DocumentSourceFacet::drainFacetsConcurrently");
+    stdx::condition_variable tasksDoneCond;
+    size_t nTasksScheduled = 0;
+    size_t nTasksDone = 0;
+    Status scheduleStatus = Status::OK();
+    std::vector<OperationContext*> childOpCtxs;
+    boost::optional<ErrorCodes::Error> killCode;
+    auto killChildOpCtx = [&](WithLock, OperationContext* childOpCtx) {
+        ClientLock clientLock(childOpCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, childOpCtx, *killCode);
+    };
+
+    auto runTask = [&](size_t taskId) {
+        auto client = service->makeClient("FacetWorker");
+        AlternativeClientRegion acr(client);
+        auto childOpCtx = cc().makeOperationContext();
+        if (deadline != Date_t::max()) {
+            childOpCtx->setDeadlineByDate(deadline, timeoutError);
+        }
+        {
+            stdx::lock_guard lk(mutex);
+            childOpCtxs.push_back(childOpCtx.get());
+            if (killCode) {
+                killChildOpCtx(lk, childOpCtx.get());
+            }
+        }
+        ON_BLOCK_EXIT([&] {
+            stdx::lock_guard lk(mutex);
+            childOpCtxs.erase(std::find(childOpCtxs.begin(), childOpCtxs.end(), childOpCtx.get()));
+        });
+
+        for (size_t i = taskId; i < concurrentFacets.size(); i += nThreads) {
+            const auto& pipeline = _facets[concurrentFacets[i]].pipeline;
+            pipeline->reattachToOperationContext(childOpCtx.get());
+            drainFacet(concurrentFacets[i]);
+            pipeline->detachFromOperationContext();
+        }
+    };
+
+    auto& pool = facetWorkerPool(opCtx->getServiceContext());
+    bool allPipelinesEOF = false;
+    while (!allPipelinesEOF) {
+        _teeBuffer->loadNextBatchForConcurrentConsumers();
+
+        for (auto facetId : concurrentFacets) {
+            _facets[facetId].pipeline->detachFromOperationContext();
+        }
+        ON_BLOCK_EXIT([&] {
+            for (auto facetId : concurrentFacets) {
+                _facets[facetId].pipeline->reattachToOperationContext(opCtx);
+            }
+        });
+        {
+            nTasksScheduled = 0;
+            nTasksDone = 0;
+            // The tasks refer to this frame, so wait for all of them even if this operation fails.
+            ON_BLOCK_EXIT([&] {
+                stdx::unique_lock lk(mutex);
+                tasksDoneCond.wait(lk, [&] { return nTasksDone == nTasksScheduled; });
+            });
+            for (size_t taskId = 0; taskId < nThreads; ++taskId) {
+                ++nTasksScheduled;
+                pool->schedule([&, taskId](Status status) {
+                    ON_BLOCK_EXIT([&] {
+                        stdx::lock_guard lk(mutex);
+                        if (!status.isOK()) {
+                            scheduleStatus = status;
+                        }
+                        ++nTasksDone;
+                        tasksDoneCond.notify_all();
+                    });
+                    if (status.isOK()) {
+                        runTask(taskId);
+                    }
+                });
+            }
+            for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
+                if (!progress[facetId].isConcurrent) {
+                    drainFacet(facetId);
+                }
+            }
+
+            stdx::unique_lock lk(mutex);
+            try {
+                opCtx->waitForConditionOrInterrupt(
+                    tasksDoneCond, lk, [&] { return nTasksDone == nTasksScheduled; });
+            } catch (const DBException& ex) {
+                killCode = ex.code();
+                for (auto childOpCtx : childOpCtxs) {
+                    killChildOpCtx(lk, childOpCtx);
+                }
+                throw;
+            }
+            uassertStatusOK(scheduleStatus);
+        }
+
+        allPipelinesEOF = true;
+        for (size_t facetId = 0; facetId < _facets.size(); ++facetId) {
+            auto& facetProgress = progress[facetId];
+            if (facetProgress.error) {
+                std::rethrow_exception(facetProgress.error);
+            }
+            auto& facetResults = results[facetId];
+            for (; facetProgress.nResultsCounted < facetResults.size();
+                 ++facetProgress.nResultsCounted) {
+                ensureUnderMemoryLimit(
+                    facetResults[facetProgress.nResultsCounted].getDocument().getApproximateSize());
+            }
+            allPipelinesEOF = allPipelinesEOF && facetProgress.isEOF;
+            accumulatePipelinePlanSummaryStats(*_facets[facetId].pipeline, _stats.planSummaryStats);
+        }
+    }
+}
+
 Value DocumentSourceFacet::serialize(const SerializationOptions& opts) const {
     MutableDocument serialized;
     for (auto&& facet : _facets) {
@@ -373,12 +653,20 @@ intrusive_ptr<DocumentSource> DocumentSourceFacet::createFromBson(
     boost::optional<std::string> needsMongoS;
     boost::optional<std::string> needsShard;
 
+    // To run concurrently, a sub-pipeline needs an ExpressionContext of its own, so that it can be
+    // detached from the OperationContext and evaluate variables independently. This is limited to
+    // top-level pipelines, since a sub-pipeline of $lookup sees its 'let' variables change with
+    // every input document.
+    const bool mayRunConcurrently = internalQueryFacetMaxThreads.load() > 1 &&
+        expCtx->subPipelineDepth == 0 && !expCtx->explain && !expCtx->inMongos;
+
     std::vector<FacetPipeline> facetPipelines;
     for (auto&& rawFacet : extractRawPipelines(elem)) {
         const auto facetName = rawFacet.first;
 
+        auto facetCtx = mayRunConcurrently ? expCtx->copyWith(expCtx->ns, expCtx->uuid) : expCtx;
         auto pipeline =
-            Pipeline::parseFacetPipeline(rawFacet.second, expCtx, [](const Pipeline& pipeline) {
+            Pipeline::parseFacetPipeline(rawFacet.second, facetCtx, [](const Pipeline& pipeline) {
                 auto sources = pipeline.getSources();
                 std::for_each(sources.begin(), sources.end(), [](auto& stage) {
                     auto stageConstraints = stage->constraints();
@@ -415,6 +703,9 @@ intrusive_ptr<DocumentSource> DocumentSourceFacet::createFromBson(
                     !(needsShard && needsMongoS));
         }
 
+        if (facetCtx != expCtx) {
+            mergeParsedProperties(expCtx.get(), *facetCtx);
+        }
         facetPipelines.emplace_back(facetName, std::move(pipeline));
     }
 
@@ -36,6 +36,7 @@
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -189,6 +190,23 @@ private:
 
     Value serialize(const SerializationOptions& opts = SerializationOptions{}) const final;
 
+    /**
+     * Returns the ids of the facets whose sub-pipelines can run on a thread of their own, detached
+     * from the OperationContext.
+     */
+    std::vector<size_t> getConcurrentFacets() const;
+
+    /**
+     * Runs the sub-pipelines of 'concurrentFacets' on up to 'internalQueryFacetMaxThreads'
+     * threads of a pool shared by all queries, and all the other sub-pipelines on this thread,
+     * appending the output of each facet to 'results'. Each batch of input is loaded by this
+     * thread while no sub-pipeline is running.
+     * 'ensureUnderMemoryLimit' is called on this thread with the size of every output document.
+     */
+    void drainFacetsConcurrently(const std::vector<size_t>& concurrentFacets,
+                                 std::vector<std::vector<Value>>& results,
+                                 const std::function<void(long long)>& ensureUnderMemoryLimit);
+
     boost::intrusive_ptr<TeeBuffer> _teeBuffer;
     std::vector<FacetPipeline> _facets;
 
@@ -41,6 +41,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
 #include "mongo/bson/json.h"
+#include "mongo/db/client.h"
 #include "mongo/db/database_name.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/document_metadata_fields.h"
@@ -52,11 +53,15 @@
 #include "mongo/db/pipeline/document_source_skip.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/pipeline/process_interface/stub_mongo_process_interface.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 using std::deque;
@@ -478,6 +483,111 @@ TEST_F(DocumentSourceFacetTest, ShouldBeAbleToEvaluateMultipleStagesWithinOneSub
     ASSERT_DOCUMENT_EQ(output.getDocument(), Document(fromjson("{subPipe: [{_id: 0}, {_id: 1}]}")));
 }
 
+TEST_F(DocumentSourceFacetTest, ShouldProduceSameResultsWhenRunningFacetsConcurrently) {
+    RAIIServerParameterControllerForTest maxThreads("internalQueryFacetMaxThreads", 2);
+    // A small buffer hands the input to the sub-pipelines over many batches.
+    RAIIServerParameterControllerForTest bufferSize("internalQueryFacetBufferSizeBytes", 200);
+    auto ctx = getExpCtx();
+
+    deque<DocumentSource::GetNextResult> inputs;
+    for (int i = 0; i < 100; ++i) {
+        inputs.emplace_back(Document{{"_id", i}, {"x", i}});
+    }
+    auto mock = DocumentSourceMock::createForTest(inputs, ctx);
+
+    auto spec = fromjson(
+        "{$facet: {total: [{$group: {_id: null, n: {$sum: '$x'}}}], "
+        "evens: [{$match: {x: {$mod: [2, 0]}}}, {$count: 'n'}], "
+        "firstTwo: [{$limit: 2}, {$project: {_id: 0, x: 1}}]}}");
+    auto facetStage = DocumentSourceFacet::createFromBson(spec.firstElement(), ctx);
+    facetStage->setSource(mock.get());
+
+    auto output = facetStage->getNext();
+    ASSERT(output.isAdvanced());
+    ASSERT_DOCUMENT_EQ(output.getDocument(),
+                       Document(fromjson("{total: [{_id: null, n: 4950}], evens: [{n: 50}], "
+                                         "firstTwo: [{x: 0}, {x: 1}]}")));
+    ASSERT(facetStage->getNext().isEOF());
+}
+
+TEST_F(DocumentSourceFacetTest, ShouldCheckForInterruptWhenRunningFacetsConcurrentlyOnLargeInput) {
+    RAIIServerParameterControllerForTest maxThreads("internalQueryFacetMaxThreads", 2);
+    auto ctx = getExpCtx();
+
+    // Enough documents for the sub-pipelines to check for interrupts many times.
+    const int kNumDocs = 10000;
+    deque<DocumentSource::GetNextResult> inputs;
+    for (int i = 0; i < kNumDocs; ++i) {
+        inputs.emplace_back(Document{{"_id", i}, {"x", i % 10}});
+    }
+    auto mock = DocumentSourceMock::createForTest(inputs, ctx);
+
+    auto spec = fromjson(
+        "{$facet: {total: [{$group: {_id: null, n: {$sum: '$x'}}}], "
+        "evens: [{$match: {x: {$mod: [2, 0]}}}, {$count: 'n'}], "
+        "doubled: [{$project: {_id: 0, y: {$multiply: ['$x', 2]}}}, "
+        "{$group: {_id: null, n: {$sum: '$y'}}}]}}");
+    auto facetStage = DocumentSourceFacet::createFromBson(spec.firstElement(), ctx);
+    facetStage->setSource(mock.get());
+
+    auto output = facetStage->getNext();
+    ASSERT(output.isAdvanced());
+    ASSERT_DOCUMENT_EQ(output.getDocument(),
+                       Document(fromjson("{total: [{_id: null, n: 45000}], evens: [{n: 5000}], "
+                                         "doubled: [{_id: null, n: 90000}]}")));
+    ASSERT(facetStage->getNext().isEOF());
+}
+
+TEST_F(DocumentSourceFacetTest, ShouldFailConcurrentFacetsWhenMaxTimeExpires) {
+    RAIIServerParameterControllerForTest maxThreads("internalQueryFacetMaxThreads", 2);
+    auto ctx = getExpCtx();
+
+    deque<DocumentSource::GetNextResult> inputs;
+    for (int i = 0; i < 10000; ++i) {
+        inputs.emplace_back(Document{{"_id", i}, {"x", i}});
+    }
+    auto mock = DocumentSourceMock::createForTest(inputs, ctx);
+
+    auto spec = fromjson(
+        "{$facet: {total: [{$group: {_id: null, n: {$sum: '$x'}}}], "
+        "evens: [{$match: {x: {$mod: [2, 0]}}}, {$count: 'n'}]}}");
+    auto facetStage = DocumentSourceFacet::createFromBson(spec.firstElement(), ctx);
+    facetStage->setSource(mock.get());
+
+    ctx->opCtx->setDeadlineByDate(Date_t::now() + Milliseconds(1), ErrorCodes::MaxTimeMSExpired);
+    sleepmillis(10);
+    ASSERT_THROWS_CODE(facetStage->getNext(), AssertionException, ErrorCodes::MaxTimeMSExpired);
+
+    // The sub-pipelines are attached to this operation again.
+    ASSERT(facetStage->validateOperationContext(ctx->opCtx));
+}
+
+TEST_F(DocumentSourceFacetTest, ShouldFailConcurrentFacetsWhenKilled) {
+    RAIIServerParameterControllerForTest maxThreads("internalQueryFacetMaxThreads", 2);
+    auto ctx = getExpCtx();
+
+    deque<DocumentSource::GetNextResult> inputs;
+    for (int i = 0; i < 10000; ++i) {
+        inputs.emplace_back(Document{{"_id", i}, {"x", i}});
+    }
+    auto mock = DocumentSourceMock::createForTest(inputs, ctx);
+
+    auto spec = fromjson(
+        "{$facet: {total: [{$group: {_id: null, n: {$sum: '$x'}}}], "
+        "evens: [{$match: {x: {$mod: [2, 0]}}}, {$count: 'n'}]}}");
+    auto facetStage = DocumentSourceFacet::createFromBson(spec.firstElement(), ctx);
+    facetStage->setSource(mock.get());
+
+    {
+        ClientLock lk(ctx->opCtx->getClient());
+        ctx->opCtx->getServiceContext()->killOperation(lk, ctx->opCtx, ErrorCodes::Interrupted);
+    }
+    ASSERT_THROWS_CODE(facetStage->getNext(), AssertionException, ErrorCodes::Interrupted);
+
+    // The sub-pipelines are attached to this operation again.
+    ASSERT(facetStage->validateOperationContext(ctx->opCtx));
+}
+
 TEST_F(DocumentSourceFacetTest, ShouldPropagateDisposeThroughToSource) {
     auto ctx = getExpCtx();
 
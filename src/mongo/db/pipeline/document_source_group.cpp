@@ -44,6 +44,7 @@
 #include "mongo/db/pipeline/accumulator_js_reduce.h"
 #include "mongo/db/pipeline/accumulator_multi.h"
 #include "mongo/db/pipeline/document_source_match.h"
+#include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_project.h"
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/expression.h"
@@ -102,6 +103,15 @@ Pipeline::SourceContainer::iterator DocumentSourceGroup::doOptimizeAt(
         return itr;
     }
 
+    // A {whenMatched: "accumulate"} $merge needs this stage's accumulators to know how to combine
+    // its results with the documents already in the target collection.
+    if (auto nextItr = std::next(itr); nextItr != container->end()) {
+        if (auto merge = dynamic_cast<DocumentSourceMerge*>(nextItr->get());
+            merge && merge->isAccumulateMode()) {
+            *nextItr = merge->resolveAccumulateMode(*this);
+        }
+    }
+
     return std::next(itr);
 }
 
@@ -253,6 +253,12 @@ public:
      * Helper method which checks if we can avoid unpacking if we have a group stage with
      * min/max/count aggregates. If the rewrite is possible, 'container' is modified, bool in the
      * return pair is set to 'true' and the iterator is set to point to the new group.
+     *
+     * The rewrite computes the accumulators from the bucket control fields, so it is only valid
+     * when every measurement of every scanned bucket contributes to the group. It is therefore not
+     * attempted when this stage has an '_eventFilter'. A $match on the time field that lines up
+     * with fixed bucket boundaries is rewritten into an exact bucket-level predicate and leaves no
+     * '_eventFilter', so such pipelines still take this path.
      */
     std::pair<bool, Pipeline::SourceContainer::iterator> rewriteGroupStage(
         Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container);
@@ -37,6 +37,7 @@
 // IWYU pragma: no_include "ext/alloc_traits.h"
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <list>
 #include <tuple>
 #include <type_traits>
@@ -242,7 +243,8 @@ DocumentSourceLookUp::DocumentSourceLookUp(NamespaceString fromNs,
       _fromNs(std::move(fromNs)),
       _as(std::move(as)),
       _variables(expCtx->variables),
-      _variablesParseState(expCtx->variablesParseState.copyWith(_variables.useIdGenerator())) {
+      _variablesParseState(expCtx->variablesParseState.copyWith(_variables.useIdGenerator())),
+      _batchMemoryTracker(internalLookupStageBatchMaxMemoryBytes.load()) {
     if (!_fromNs.isOnInternalDb()) {
         globalOpCounters.gotNestedAggregate();
     }
@@ -365,7 +367,8 @@ DocumentSourceLookUp::DocumentSourceLookUp(const DocumentSourceLookUp& original,
       _resolvedPipeline(original._resolvedPipeline),
       _userPipeline(original._userPipeline),
       _resolvedIntrospectionPipeline(original._resolvedIntrospectionPipeline->clone(_fromExpCtx)),
-      _letVariables(original._letVariables) {
+      _letVariables(original._letVariables),
+      _batchMemoryTracker(internalLookupStageBatchMaxMemoryBytes.load()) {
     if (!_localField && !_foreignField) {
         _cache.emplace(internalDocumentSourceCursorBatchSizeBytes.load());
     }
@@ -568,6 +571,10 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
         return unwindResult();
     }
 
+    if (!_batchedInputs.empty() || _batchEndResult || canBatchLookups()) {
+        return batchedResult();
+    }
+
     auto nextInput = pSource->getNext();
     if (!nextInput.isAdvanced()) {
         return nextInput;
@@ -579,9 +586,16 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
-    std::unique_ptr<Pipeline, PipelineDeleter> pipeline;
+    auto results = lookUpMatches(inputDoc);
+
+    MutableDocument output(std::move(inputDoc));
+    output.setNestedField(_as, Value(std::move(results)));
+    return output.freeze();
+}
+
+PipelinePtr DocumentSourceLookUp::buildPipelineForInput(const Document& inputDoc) {
     try {
-        pipeline = buildPipeline(_fromExpCtx, inputDoc);
+        return buildPipeline(_fromExpCtx, inputDoc);
     } catch (const ExceptionForCat<ErrorCategory::StaleShardVersionError>& ex) {
         // If lookup on a sharded collection is disallowed and the foreign collection is sharded,
         // throw a custom exception.
@@ -594,22 +608,43 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
         }
         throw;
     }
+}
 
-    std::vector<Value> results;
-    long long objsize = 0;
+namespace {
+/**
+ * Adds 'result' to 'results', enforcing the limit on the total size of the matches of a single
+ * local document.
+ */
+void appendLookupResult(const NamespaceString& fromNs,
+                        Value result,
+                        std::vector<Value>* results,
+                        long long* objsize) {
     const auto maxBytes = internalLookupStageIntermediateDocumentMaxSizeBytes.load();
+    long long safeSum = 0;
+    bool hasOverflowed = overflow::add(*objsize, result.getApproximateSize(), &safeSum);
+    uassert(4568,
+            str::stream() << "Total size of documents in " << fromNs.coll()
+                          << " matching pipeline's $lookup stage exceeds " << maxBytes << " bytes",
+
+            !hasOverflowed && safeSum <= maxBytes);
+    *objsize = safeSum;
+    results->emplace_back(std::move(result));
+}
 
-    while (auto result = pipeline->getNext()) {
-        long long safeSum = 0;
-        bool hasOverflowed = overflow::add(objsize, result->getApproximateSize(), &safeSum);
-        uassert(4568,
-                str::stream() << "Total size of documents in " << _fromNs.coll()
-                              << " matching pipeline's $lookup stage exceeds " << maxBytes
-                              << " bytes",
+/**
+ * Upper bound on the total size of the join values gathered into one batched query, keeping the
+ * $in well clear of the BSON size limit.
+ */
+constexpr long long kMaxBatchedJoinValuesBytes = 1024 * 1024;
+}  // namespace
+
+std::vector<Value> DocumentSourceLookUp::lookUpMatches(const Document& inputDoc) {
+    auto pipeline = buildPipelineForInput(inputDoc);
 
-                !hasOverflowed && objsize <= maxBytes);
-        objsize = safeSum;
-        results.emplace_back(std::move(*result));
+    std::vector<Value> results;
+    long long objsize = 0;
+    while (auto result = pipeline->getNext()) {
+        appendLookupResult(_fromNs, Value(std::move(*result)), &results, &objsize);
     }
 
     accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
@@ -617,7 +652,159 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // Check if pipeline uses disk.
     _stats.planSummaryStats.usedDisk = _stats.planSummaryStats.usedDisk || pipeline->usedDisk();
 
-    MutableDocument output(std::move(inputDoc));
+    return results;
+}
+
+bool DocumentSourceLookUp::canBatchLookups() const {
+    // With a user pipeline or 'let' variables the foreign pipeline may depend on the local
+    // document in ways other than the equality join, so its results cannot be redistributed.
+    return hasLocalFieldForeignFieldJoin() && !hasPipeline() && _letVariables.empty() &&
+        !_unwindSrc && internalLookupStageBatchSize.load() > 1 &&
+        !FieldRef(_localField->fullPath()).hasNumericPathComponents() &&
+        !FieldRef(_foreignField->fullPath()).hasNumericPathComponents();
+}
+
+void DocumentSourceLookUp::fillBatch() {
+    invariant(_batchedInputs.empty() && !_batchEndResult);
+    invariant(!_matchSrc);
+
+    // Every value a batched document joins on, together with the indexes into '_batchedInputs' of
+    // the documents joining on it.
+    auto joinValues =
+        _fromExpCtx->getValueComparator().makeUnorderedValueMap<std::vector<size_t>>();
+    std::vector<Value> joinValuesList;
+    long long joinValuesBytes = 0;
+
+    const size_t batchSize = internalLookupStageBatchSize.load();
+    while (_batchedInputs.size() < batchSize && joinValuesBytes < kMaxBatchedJoinValuesBytes &&
+           _batchMemoryTracker.withinMemoryLimit()) {
+        auto nextInput = pSource->getNext();
+        if (!nextInput.isAdvanced()) {
+            _batchEndResult = std::move(nextInput);
+            break;
+        }
+
+        BatchedInput input{nextInput.releaseDocument()};
+        input.docBytes = input.doc.getApproximateSize();
+        _batchMemoryTracker.add(input.docBytes);
+
+        // Only documents whose join values compare by plain equality can have their matches
+        // redistributed by value. Missing and null values also match missing fields, arrays match
+        // nested arrays and regexes are compared by pattern, so those documents are looked up on
+        // their own.
+        std::vector<Value> values;
+        input.batched = true;
+        document_path_support::visitAllValuesAtPath(
+            input.doc, *_localField, [&](const Value& nextValue) {
+                switch (nextValue.getType()) {
+                    case BSONType::jstNULL:
+                    case BSONType::Undefined:
+                    case BSONType::RegEx:
+                    case BSONType::Array:
+                    case BSONType::Object:
+                        input.batched = false;
+                        break;
+                    default:
+                        values.push_back(nextValue);
+                }
+            });
+        input.batched = input.batched && !values.empty();
+
+        if (input.batched) {
+            const size_t inputIdx = _batchedInputs.size();
+            for (auto&& value : values) {
+                auto& joiningInputs = joinValues[value];
+                if (joiningInputs.empty()) {
+                    joinValuesBytes += value.getApproximateSize();
+                    joinValuesList.push_back(value);
+                }
+                if (joiningInputs.empty() || joiningInputs.back() != inputIdx) {
+                    joiningInputs.push_back(inputIdx);
+                }
+            }
+        }
+        _batchedInputs.push_back(std::move(input));
+    }
+
+    if (joinValuesList.empty()) {
+        return;
+    }
+
+    // Query the foreign collection once for all the join values. A document shaped like a local
+    // document whose join field holds every value produces the same $in the per-document lookup
+    // would, so the resulting plan is a single multi-point index scan when 'foreignField' is
+    // indexed.
+    MutableDocument joinDoc;
+    joinDoc.setNestedField(*_localField, Value(std::move(joinValuesList)));
+    auto pipeline = buildPipelineForInput(joinDoc.freeze());
+
+    // Hand each foreign document to every local document joining on one of its values. The last
+    // document a local document received is tracked so that a foreign document matching several
+    // of its values is only added once.
+    std::vector<size_t> lastMatchIdx(_batchedInputs.size(), std::numeric_limits<size_t>::max());
+    size_t matchIdx = 0;
+    while (_batchMemoryTracker.withinMemoryLimit()) {
+        auto result = pipeline->getNext();
+        if (!result) {
+            break;
+        }
+        Value foreignDoc(std::move(*result));
+        document_path_support::visitAllValuesAtPath(
+            foreignDoc.getDocument(), *_foreignField, [&](const Value& foreignValue) {
+                auto it = joinValues.find(foreignValue);
+                if (it == joinValues.end()) {
+                    return;
+                }
+                for (auto inputIdx : it->second) {
+                    if (lastMatchIdx[inputIdx] == matchIdx) {
+                        continue;
+                    }
+                    lastMatchIdx[inputIdx] = matchIdx;
+                    auto& input = _batchedInputs[inputIdx];
+                    const auto matchesBytes = input.matchesBytes;
+                    appendLookupResult(_fromNs, foreignDoc, &input.matches, &input.matchesBytes);
+                    _batchMemoryTracker.add(input.matchesBytes - matchesBytes);
+                }
+            });
+        ++matchIdx;
+    }
+
+    accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
+    _stats.planSummaryStats.usedDisk = _stats.planSummaryStats.usedDisk || pipeline->usedDisk();
+
+    // The matches of the whole batch do not fit in memory at once. Drop them and look up each
+    // buffered document on its own as it is returned instead.
+    if (!_batchMemoryTracker.withinMemoryLimit()) {
+        for (auto&& input : _batchedInputs) {
+            _batchMemoryTracker.add(-input.matchesBytes);
+            input.matches.clear();
+            input.matchesBytes = 0;
+            input.batched = false;
+        }
+    }
+}
+
+DocumentSource::GetNextResult DocumentSourceLookUp::batchedResult() {
+    if (_batchedInputs.empty() && !_batchEndResult) {
+        fillBatch();
+    }
+
+    // Once the buffered documents have been returned, pass on the pause or EOF which ended the
+    // batch. The next call starts a new batch.
+    if (_batchedInputs.empty()) {
+        invariant(_batchEndResult);
+        auto result = std::move(*_batchEndResult);
+        _batchEndResult.reset();
+        return result;
+    }
+
+    auto input = std::move(_batchedInputs.front());
+    _batchedInputs.pop_front();
+    _batchMemoryTracker.add(-(input.docBytes + input.matchesBytes));
+
+    auto results = input.batched ? std::move(input.matches) : lookUpMatches(input.doc);
+
+    MutableDocument output(std::move(input.doc));
     output.setNestedField(_as, Value(std::move(results)));
     return output.freeze();
 }
@@ -1019,6 +1206,9 @@ bool DocumentSourceLookUp::usedDisk() {
 }
 
 void DocumentSourceLookUp::doDispose() {
+    _batchedInputs.clear();
+    _batchEndResult.reset();
+    _batchMemoryTracker.set(0);
     if (_pipeline) {
         accumulatePipelinePlanSummaryStats(*_pipeline, _stats.planSummaryStats);
         _pipeline->dispose(pExpCtx->opCtx);
@@ -37,6 +37,7 @@
 #include <boost/smart_ptr.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <set>
 #include <string>
@@ -77,6 +78,7 @@
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/intrusive_counter.h"
+#include "mongo/util/memory_usage_tracker.h"
 
 namespace mongo {
 
@@ -370,6 +372,36 @@ private:
      */
     GetNextResult unwindResult();
 
+    /**
+     * Delegate of doGetNext() when lookups of several local documents can be answered by a single
+     * query against the foreign collection. See canBatchLookups().
+     */
+    GetNextResult batchedResult();
+
+    /**
+     * Returns true if this $lookup only joins on localField/foreignField, so that the matches for
+     * several local documents can be fetched with one $in query and redistributed afterwards.
+     */
+    bool canBatchLookups() const;
+
+    /**
+     * Pulls up to 'internalLookupStageBatchSize' documents from the source stage into
+     * '_batchedInputs' and fills in their matches from a single query against the foreign
+     * collection.
+     */
+    void fillBatch();
+
+    /**
+     * Builds the pipeline for 'inputDoc', raising a custom error if the foreign collection turns
+     * out to be sharded when that is not allowed.
+     */
+    PipelinePtr buildPipelineForInput(const Document& inputDoc);
+
+    /**
+     * Runs the pipeline for a single local document and returns the matching foreign documents.
+     */
+    std::vector<Value> lookUpMatches(const Document& inputDoc);
+
     /**
      * Resolves let defined variables against 'localDoc' and stores the results in 'variables'.
      */
@@ -489,6 +521,25 @@ private:
     PipelinePtr _pipeline;
     boost::optional<Document> _input;
     boost::optional<Document> _nextValue;
+
+    // A local document buffered by fillBatch(). 'matches' has already been filled in when
+    // 'batched' is true; otherwise the document has join values which cannot be redistributed by
+    // value equality (null, arrays, regexes...) and is looked up on its own when it is returned.
+    struct BatchedInput {
+        Document doc;
+        long long docBytes = 0;
+        std::vector<Value> matches;
+        long long matchesBytes = 0;
+        bool batched = false;
+    };
+
+    // The following members are used to hold onto state across getNext() calls when lookups are
+    // batched. '_batchEndResult' holds the non-advanced result which ended the last batch, to be
+    // returned once the buffered documents have been drained. '_batchMemoryTracker' accounts for
+    // the buffered documents and their matches.
+    std::deque<BatchedInput> _batchedInputs;
+    boost::optional<GetNextResult> _batchEndResult;
+    SimpleMemoryUsageTracker _batchMemoryTracker;
 };  // class DocumentSourceLookUp
 
 }  // namespace mongo
@@ -1228,6 +1228,153 @@ TEST_F(DocumentSourceLookUpTest, ShouldPropagatePausesWhileUnwinding) {
     ASSERT_TRUE(lookup->getNext().isEOF());
 }
 
+TEST_F(DocumentSourceLookUpTest, ShouldRedistributeBatchedMatchesToEachLocalDocument) {
+    RAIIServerParameterControllerForTest batchSizeController("internalLookupStageBatchSize", 100);
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs =
+        NamespaceString::createNamespaceString_forTest(boost::none, "test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    // Mock out the foreign collection. The document with an array 'key' matches two values of the
+    // same local document, and the one without 'key' only matches a null join value.
+    std::deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document(fromjson("{_id: 0, key: 0}")),
+        Document(fromjson("{_id: 1, key: [1, 2]}")),
+        Document(fromjson("{_id: 2, key: 2}")),
+        Document(fromjson("{_id: 3}"))};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    // The null join value cannot be batched and is looked up on its own, in order.
+    auto mockLocalSource =
+        DocumentSourceMock::createForTest({Document(fromjson("{local: 0}")),
+                                           Document(fromjson("{local: [1, 2]}")),
+                                           Document(fromjson("{local: null}")),
+                                           Document(fromjson("{local: 4}")),
+                                           Document(fromjson("{local: 2}"))},
+                                          expCtx);
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "local"_sd},
+                                         {"foreignField", "key"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+    auto lookup = makeLookUpFromBson(lookupSpec.firstElement(), expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    auto expected = {
+        fromjson("{local: 0, matches: [{_id: 0, key: 0}]}"),
+        fromjson("{local: [1, 2], matches: [{_id: 1, key: [1, 2]}, {_id: 2, key: 2}]}"),
+        fromjson("{local: null, matches: [{_id: 3}]}"),
+        fromjson("{local: 4, matches: []}"),
+        fromjson("{local: 2, matches: [{_id: 1, key: [1, 2]}, {_id: 2, key: 2}]}")};
+    for (auto&& expectedDoc : expected) {
+        auto next = lookup->getNext();
+        ASSERT_TRUE(next.isAdvanced());
+        ASSERT_DOCUMENT_EQ(next.releaseDocument(), Document(expectedDoc));
+    }
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    ASSERT_TRUE(lookup->getNext().isEOF());
+}
+
+TEST_F(DocumentSourceLookUpTest, ShouldLookUpEachDocumentOnItsOwnByDefault) {
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs =
+        NamespaceString::createNamespaceString_forTest(boost::none, "test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    std::deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document(fromjson("{_id: 0, key: 0}")), Document(fromjson("{_id: 1, key: 1}"))};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto mockLocalSource = DocumentSourceMock::createForTest(
+        {Document(fromjson("{local: 0}")), Document(fromjson("{local: 1}"))}, expCtx);
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "local"_sd},
+                                         {"foreignField", "key"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+    auto lookup = makeLookUpFromBson(lookupSpec.firstElement(), expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    // Batching is off, so only the local document being returned has been consumed.
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       Document(fromjson("{local: 0, matches: [{_id: 0, key: 0}]}")));
+    ASSERT_EQ(mockLocalSource->size(), 1U);
+}
+
+TEST_F(DocumentSourceLookUpTest, ShouldBoundBatchedLookupsByMemory) {
+    RAIIServerParameterControllerForTest batchSizeController("internalLookupStageBatchSize", 100);
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs =
+        NamespaceString::createNamespaceString_forTest(boost::none, "test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    // Every local document matches the same large foreign documents.
+    const std::string padding(1024, 'x');
+    std::deque<DocumentSource::GetNextResult> mockForeignContents;
+    for (int i = 0; i < 4; ++i) {
+        mockForeignContents.push_back(Document{{"_id", i}, {"key", 0}, {"padding", padding}});
+    }
+    expCtx->mongoProcessInterface = std::make_shared<MockMongoInterface>(mockForeignContents);
+
+    const int kNumLocalDocs = 10;
+    std::deque<DocumentSource::GetNextResult> localDocs;
+    for (int i = 0; i < kNumLocalDocs; ++i) {
+        localDocs.push_back(Document{{"_id", i}, {"local", 0}});
+    }
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "local"_sd},
+                                         {"foreignField", "key"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+
+    // The local documents fit in the memory bound, but the batch's matches do not. The batch falls
+    // back to per-document lookups with the same results.
+    {
+        RAIIServerParameterControllerForTest maxMemoryController(
+            "internalLookupStageBatchMaxMemoryBytes", 16 * 1024);
+        auto mockLocalSource = DocumentSourceMock::createForTest(localDocs, expCtx);
+        auto lookup = makeLookUpFromBson(lookupSpec.firstElement(), expCtx);
+        lookup->setSource(mockLocalSource.get());
+
+        for (int i = 0; i < kNumLocalDocs; ++i) {
+            auto next = lookup->getNext();
+            ASSERT_TRUE(next.isAdvanced());
+            auto doc = next.releaseDocument();
+            ASSERT_VALUE_EQ(doc["_id"], Value(i));
+            ASSERT_EQ(doc["matches"].getArrayLength(), mockForeignContents.size());
+        }
+        ASSERT_TRUE(lookup->getNext().isEOF());
+    }
+
+    // A bound smaller than a single local document stops the batch after its first document.
+    {
+        RAIIServerParameterControllerForTest maxMemoryController(
+            "internalLookupStageBatchMaxMemoryBytes", 1);
+        auto mockLocalSource = DocumentSourceMock::createForTest(localDocs, expCtx);
+        auto lookup = makeLookUpFromBson(lookupSpec.firstElement(), expCtx);
+        lookup->setSource(mockLocalSource.get());
+
+        auto next = lookup->getNext();
+        ASSERT_TRUE(next.isAdvanced());
+        ASSERT_EQ(next.releaseDocument()["matches"].getArrayLength(), mockForeignContents.size());
+        ASSERT_EQ(mockLocalSource->size(), static_cast<size_t>(kNumLocalDocs - 1));
+    }
+}
+
 TEST_F(DocumentSourceLookUpTest, LookupReportsAsFieldIsModified) {
     auto expCtx = getExpCtx();
     NamespaceString fromNs =
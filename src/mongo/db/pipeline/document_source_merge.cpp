@@ -49,12 +49,16 @@
 #include "mongo/db/database_name.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/ops/write_ops_gen.h"
+#include "mongo/db/pipeline/accumulation_statement.h"
+#include "mongo/db/pipeline/accumulator.h"
+#include "mongo/db/pipeline/document_source_group_base.h"
 #include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_merge_gen.h"
 #include "mongo/db/pipeline/document_source_merge_spec.h"
 #include "mongo/db/pipeline/variable_validation.h"
 #include "mongo/db/query/allowed_contexts.h"
 #include "mongo/db/query/explain_options.h"
+#include "mongo/db/query/query_feature_flags_gen.h"
 #include "mongo/db/storage/duplicate_key_error_info.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/logv2/log.h"
@@ -74,7 +78,7 @@ MONGO_FAIL_POINT_DEFINE(hangWhileBuildingDocumentSourceMergeBatch);
 REGISTER_DOCUMENT_SOURCE(merge,
                          DocumentSourceMerge::LiteParsed::parse,
                          DocumentSourceMerge::createFromBson,
-                         AllowedWithApiStrict::kAlways);
+                         AllowedWithApiStrict::kConditionally);
 
 namespace {
 
@@ -158,6 +162,42 @@ boost::optional<std::set<FieldPath>> convertToFieldPaths(
     }
     return fieldPaths;
 }
+
+/**
+ * Returns the expression combining the value of the accumulated field 'fieldName' in an existing
+ * target document with its value in the new document, or boost::none if the results of
+ * 'accumulatorName' cannot be combined. Only accumulators whose result does not depend on the
+ * order of their input qualify.
+ */
+boost::optional<BSONObj> makeAccumulateCombiner(StringData accumulatorName,
+                                                const std::string& fieldName) {
+    StringData combiner;
+    bool combinesArrays = false;
+    if (accumulatorName == AccumulatorSum::kName) {
+        combiner = "$sum"_sd;
+    } else if (accumulatorName == AccumulatorMin::kName) {
+        combiner = "$min"_sd;
+    } else if (accumulatorName == AccumulatorMax::kName) {
+        combiner = "$max"_sd;
+    } else if (accumulatorName == AccumulatorAddToSet::kName) {
+        combiner = "$setUnion"_sd;
+        combinesArrays = true;
+    } else if (accumulatorName == AccumulatorPush::kName) {
+        combiner = "$concatArrays"_sd;
+        combinesArrays = true;
+    } else {
+        return boost::none;
+    }
+
+    // $setUnion and $concatArrays return null if any argument is missing, so an existing document
+    // without the field is treated as holding an empty array.
+    const auto existing = "$" + fieldName;
+    if (combinesArrays) {
+        return BSON(combiner << BSON_ARRAY(BSON("$ifNull" << BSON_ARRAY(existing << BSONArray()))
+                                           << "$$new." + fieldName));
+    }
+    return BSON(combiner << BSON_ARRAY(existing << "$$new." + fieldName));
+}
 }  // namespace
 
 std::unique_ptr<DocumentSourceMerge::LiteParsed> DocumentSourceMerge::LiteParsed::parse(
@@ -197,6 +237,17 @@ std::unique_ptr<DocumentSourceMerge::LiteParsed> DocumentSourceMerge::LiteParsed
                                                              std::move(liteParsedPipeline));
 }
 
+void DocumentSourceMerge::LiteParsed::assertPermittedInAPIVersion(
+    const APIParameters& apiParameters) const {
+    if (apiParameters.getAPIVersion() && *apiParameters.getAPIVersion() == "1" &&
+        apiParameters.getAPIStrict().value_or(false)) {
+        uassert(ErrorCodes::APIStrictError,
+                "{} with whenMatched: 'accumulate' is not supported in API Version 1"_format(
+                    kStageName),
+                _whenMatched != MergeWhenMatchedModeEnum::kAccumulate);
+    }
+}
+
 PrivilegeVector DocumentSourceMerge::LiteParsed::requiredPrivileges(
     bool isMongos, bool bypassDocumentValidation) const {
     invariant(_foreignNss);
@@ -305,6 +356,10 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceMerge::createFromBson(
     auto whenMatched =
         mergeSpec.getWhenMatched() ? mergeSpec.getWhenMatched()->mode : kDefaultWhenMatched;
     auto whenNotMatched = mergeSpec.getWhenNotMatched().value_or(kDefaultWhenNotMatched);
+    if (whenMatched == WhenMatched::kAccumulate) {
+        expCtx->throwIfFeatureFlagIsNotEnabledOnFCV("$merge with whenMatched: 'accumulate'",
+                                                    feature_flags::gFeatureFlagMergeAccumulate);
+    }
     auto pipeline = mergeSpec.getWhenMatched() ? mergeSpec.getWhenMatched()->pipeline : boost::none;
     auto fieldPaths = convertToFieldPaths(mergeSpec.getOn());
     auto [mergeOnFields, collectionPlacementVersion] =
@@ -321,6 +376,53 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceMerge::createFromBson(
                                        collectionPlacementVersion);
 }
 
+boost::intrusive_ptr<DocumentSource> DocumentSourceMerge::resolveAccumulateMode(
+    const DocumentSourceGroupBase& group) const {
+    invariant(isAccumulateMode());
+    uassert(9602401,
+            "$merge with whenMatched: 'accumulate' requires 'on' to include the _id field",
+            _mergeOnFieldsIncludesId);
+
+    BSONObjBuilder combiners;
+    for (auto&& statement : group.getAccumulationStatements()) {
+        for (auto&& path : _mergeOnFields) {
+            uassert(9602402,
+                    "$merge with whenMatched: 'accumulate' cannot use the accumulated field '{}' "
+                    "in 'on'"_format(statement.fieldName),
+                    path.front() != statement.fieldName);
+        }
+        auto combiner = makeAccumulateCombiner(statement.expr.name, statement.fieldName);
+        uassert(9602403,
+                "$merge with whenMatched: 'accumulate' cannot combine the results of {} for "
+                "field '{}'"_format(statement.expr.name, statement.fieldName),
+                combiner);
+        combiners.append(statement.fieldName, *combiner);
+    }
+
+    const auto whenNotMatched = _mergeProcessor->getMergeStrategyDescriptor().mode.second;
+    const auto& collectionPlacementVersion = _mergeProcessor->getCollectionPlacementVersion();
+    if (combiners.asTempObj().isEmpty()) {
+        // A $group without accumulators only produces group keys, so the existing documents are
+        // already up to date.
+        return DocumentSourceMerge::create(getOutputNs(),
+                                           pExpCtx,
+                                           WhenMatched::kKeepExisting,
+                                           whenNotMatched,
+                                           boost::none,
+                                           boost::none,
+                                           _mergeOnFields,
+                                           collectionPlacementVersion);
+    }
+    return DocumentSourceMerge::create(getOutputNs(),
+                                       pExpCtx,
+                                       WhenMatched::kPipeline,
+                                       whenNotMatched,
+                                       boost::none,
+                                       std::vector<BSONObj>{BSON("$set" << combiners.obj())},
+                                       _mergeOnFields,
+                                       collectionPlacementVersion);
+}
+
 StageConstraints DocumentSourceMerge::constraints(Pipeline::SplitState pipeState) const {
     StageConstraints result{StreamType::kStreaming,
                             PositionRequirement::kLast,
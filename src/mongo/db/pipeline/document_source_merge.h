@@ -83,6 +83,8 @@
 
 namespace mongo {
 
+class DocumentSourceGroupBase;
+
 /**
  * A class for the $merge aggregation stage to handle all supported merge modes. Each instance of
  * this class must be initialized (via a constructor) with a 'MergeDescriptor', which defines a
@@ -133,6 +135,11 @@ public:
         PrivilegeVector requiredPrivileges(bool isMongos,
                                            bool bypassDocumentValidation) const final;
 
+        /**
+         * The 'accumulate' whenMatched mode is not part of API Version 1.
+         */
+        void assertPermittedInAPIVersion(const APIParameters& apiParameters) const final;
+
         /**
          * We must know the aggregation's collation when parsing a $merge in order to correctly
          * verify that the target namespace guarantees the uniqueness of the 'mergeOnFields'.
@@ -189,7 +196,29 @@ public:
         return _mergeProcessor->getPipeline();
     }
 
+    /**
+     * Returns true if this is a {whenMatched: "accumulate"} $merge, which must be resolved against
+     * the $group stage preceding it before it can write anything.
+     */
+    bool isAccumulateMode() const {
+        return _mergeProcessor->getMergeStrategyDescriptor().mode.first ==
+            MergeStrategyDescriptor::WhenMatched::kAccumulate;
+    }
+
+    /**
+     * Returns a {whenMatched: [pipeline]} $merge equivalent to this {whenMatched: "accumulate"}
+     * $merge, whose pipeline combines each result of 'group' with the matching document in the
+     * target collection. This lets a rollup be refreshed by aggregating only the newly arrived
+     * source documents. Throws if 'group' has an accumulator whose results cannot be combined.
+     */
+    boost::intrusive_ptr<DocumentSource> resolveAccumulateMode(
+        const DocumentSourceGroupBase& group) const;
+
     void initialize() override {
+        uassert(9602400,
+                "$merge with whenMatched: 'accumulate' must directly follow a $group stage",
+                !isAccumulateMode());
+
         // This implies that the stage will soon start to write, so it's safe to verify the target
         // collection placement version. This is done here instead of parse time since it requires
         // that locks are not held.
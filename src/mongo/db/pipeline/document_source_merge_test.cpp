@@ -35,8 +35,10 @@
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include "mongo/base/error_codes.h"
 #include "mongo/bson/json.h"
 #include "mongo/bson/unordered_fields_bsonobj_comparator.h"
+#include "mongo/db/api_parameters.h"
 #include "mongo/db/database_name.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/document_value_test_util.h"
@@ -44,6 +46,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_merge_gen.h"
+#include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/pipeline/process_interface/stub_mongo_process_interface.h"
 #include "mongo/db/pipeline/serverless_aggregation_context_fixture.h"
@@ -758,6 +761,104 @@ TEST_F(DocumentSourceMergeTest, LetVariablesCanOnlyBeUsedWithPipelineMode) {
     ASSERT_THROWS_CODE(createMergeStage(spec), AssertionException, 51199);
 }
 
+TEST_F(DocumentSourceMergeTest, AccumulateModeIsResolvedAgainstPrecedingGroup) {
+    RAIIServerParameterControllerForTest featureFlag("featureFlagMergeAccumulate", true);
+    auto pipeline = Pipeline::parse(
+        {fromjson("{$group: {_id: '$k', total: {$sum: '$x'}, n: {$count: {}}, lo: {$min: '$x'}, "
+                  "hi: {$max: '$x'}, all: {$push: '$x'}, uniq: {$addToSet: '$x'}}}"),
+         fromjson("{$merge: {into: 'target_collection', whenMatched: 'accumulate'}}")},
+        getExpCtx());
+    auto merge = dynamic_cast<DocumentSourceMerge*>(pipeline->getSources().back().get());
+    ASSERT(merge);
+    ASSERT_TRUE(merge->isAccumulateMode());
+    ASSERT_THROWS_CODE(merge->initialize(), AssertionException, 9602400);
+
+    pipeline->optimizePipeline();
+    merge = dynamic_cast<DocumentSourceMerge*>(pipeline->getSources().back().get());
+    ASSERT(merge);
+    ASSERT_FALSE(merge->isAccumulateMode());
+    ASSERT(merge->getPipeline());
+    ASSERT_EQ(merge->getPipeline()->size(), 1U);
+    ASSERT_BSONOBJ_EQ(merge->getPipeline()->front(),
+                      fromjson("{$set: {total: {$sum: ['$total', '$$new.total']}, "
+                               "n: {$sum: ['$n', '$$new.n']}, "
+                               "lo: {$min: ['$lo', '$$new.lo']}, "
+                               "hi: {$max: ['$hi', '$$new.hi']}, "
+                               "all: {$concatArrays: [{$ifNull: ['$all', []]}, '$$new.all']}, "
+                               "uniq: {$setUnion: [{$ifNull: ['$uniq', []]}, '$$new.uniq']}}}"));
+}
+
+TEST_F(DocumentSourceMergeTest, AccumulateModeCombinesArraysIntoMissingTargetFields) {
+    RAIIServerParameterControllerForTest featureFlag("featureFlagMergeAccumulate", true);
+    auto pipeline = Pipeline::parse(
+        {fromjson("{$group: {_id: '$k', all: {$push: '$x'}, uniq: {$addToSet: '$x'}}}"),
+         fromjson("{$merge: {into: 'target_collection', whenMatched: 'accumulate'}}")},
+        getExpCtx());
+    pipeline->optimizePipeline();
+    auto merge = dynamic_cast<DocumentSourceMerge*>(pipeline->getSources().back().get());
+    ASSERT(merge);
+    ASSERT(merge->getPipeline());
+    auto set = merge->getPipeline()->front()["$set"].Obj();
+
+    // Evaluate the combiners against existing documents with and without the accumulated fields.
+    auto expCtx = getExpCtx();
+    auto newId = expCtx->variablesParseState.defineVariable("new");
+    expCtx->variables.setValue(newId, Value(fromjson("{_id: 1, all: [1, 1], uniq: [1]}")));
+    auto combine = [&](StringData field, const Document& existing) {
+        auto expr = Expression::parseOperand(expCtx.get(), set[field], expCtx->variablesParseState);
+        return expr->evaluate(existing, &expCtx->variables);
+    };
+
+    const Document missing{{"_id", 1}};
+    ASSERT_VALUE_EQ(combine("all", missing), Value(BSON_ARRAY(1 << 1)));
+    ASSERT_VALUE_EQ(combine("uniq", missing), Value(BSON_ARRAY(1)));
+
+    const Document existing(fromjson("{_id: 1, all: [2], uniq: [2]}"));
+    ASSERT_VALUE_EQ(combine("all", existing), Value(BSON_ARRAY(2 << 1 << 1)));
+    ASSERT_VALUE_EQ(combine("uniq", existing), Value(BSON_ARRAY(1 << 2)));
+}
+
+TEST_F(DocumentSourceMergeTest, AccumulateModeRejectsAccumulatorsThatCannotBeCombined) {
+    RAIIServerParameterControllerForTest featureFlag("featureFlagMergeAccumulate", true);
+    auto pipeline = Pipeline::parse(
+        {fromjson("{$group: {_id: '$k', mean: {$avg: '$x'}}}"),
+         fromjson("{$merge: {into: 'target_collection', whenMatched: 'accumulate'}}")},
+        getExpCtx());
+    ASSERT_THROWS_CODE(pipeline->optimizePipeline(), AssertionException, 9602403);
+
+    auto spec = BSON("$merge" << BSON("into"
+                                      << "target_collection"
+                                      << "whenMatched"
+                                      << "accumulate"
+                                      << "whenNotMatched"
+                                      << "discard"));
+    ASSERT_THROWS_CODE(createMergeStage(spec), AssertionException, 51189);
+}
+
+TEST_F(DocumentSourceMergeTest, AccumulateModeRequiresFeatureFlag) {
+    RAIIServerParameterControllerForTest featureFlag("featureFlagMergeAccumulate", false);
+    auto spec = fromjson("{$merge: {into: 'target_collection', whenMatched: 'accumulate'}}");
+    ASSERT_THROWS_CODE(
+        createMergeStage(spec), AssertionException, ErrorCodes::QueryFeatureNotAllowed);
+}
+
+TEST_F(DocumentSourceMergeTest, AccumulateModeIsNotAllowedWithApiStrict) {
+    APIParameters apiParameters;
+    apiParameters.setAPIVersion("1");
+    apiParameters.setAPIStrict(true);
+
+    auto nss = NamespaceString::createNamespaceString_forTest("test", "source_collection");
+    auto spec = fromjson("{$merge: {into: 'target_collection', whenMatched: 'accumulate'}}");
+    auto liteParsed = DocumentSourceMerge::LiteParsed::parse(nss, spec.firstElement());
+    ASSERT_THROWS_CODE(liteParsed->assertPermittedInAPIVersion(apiParameters),
+                       AssertionException,
+                       ErrorCodes::APIStrictError);
+
+    spec = fromjson("{$merge: {into: 'target_collection', whenMatched: 'merge'}}");
+    liteParsed = DocumentSourceMerge::LiteParsed::parse(nss, spec.firstElement());
+    liteParsed->assertPermittedInAPIVersion(apiParameters);
+}
+
 // We always serialize the default let variables as {new: "$$ROOT"} if omitted.
 TEST_F(DocumentSourceMergeTest, SerializeDefaultLetVariable) {
     for (auto&& whenNotMatched : {"insert", "fail", "discard"}) {
@@ -34,6 +34,8 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
+#include "mongo/db/exec/document_value/document_value_test_util.h"
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_mock.h"
@@ -84,5 +86,32 @@ TEST_F(DocumentSourceRedactTest, ShouldPropagatePauses) {
     ASSERT_TRUE(redact->getNext().isEOF());
     ASSERT_TRUE(redact->getNext().isEOF());
 }
+
+TEST_F(DocumentSourceRedactTest, ShouldDescendIntoSubdocumentsAndPruneThem) {
+    auto redactSpec = fromjson(
+        "{$redact: {$cond: {if: {$eq: ['$secret', true]}, then: '$$PRUNE', else: '$$DESCEND'}}}");
+    auto redact = DocumentSourceRedact::createFromBson(redactSpec.firstElement(), getExpCtx());
+    auto mock = DocumentSourceMock::createForTest(
+        {Document(fromjson("{_id: 0, a: {secret: true}, b: [{secret: true}, {c: 1}, 2], d: 3}")),
+         Document(fromjson("{_id: 1, secret: true}"))},
+        getExpCtx());
+    redact->setSource(mock.get());
+
+    auto next = redact->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       Document(fromjson("{_id: 0, b: [{c: 1}, 2], d: 3}")));
+    ASSERT_TRUE(redact->getNext().isEOF());
+}
+
+TEST_F(DocumentSourceRedactTest, ShouldRejectUnknownActions) {
+    auto redactSpec = BSON("$redact"
+                           << "keepIt");
+    auto redact = DocumentSourceRedact::createFromBson(redactSpec.firstElement(), getExpCtx());
+    auto mock = DocumentSourceMock::createForTest({Document{{"_id", 0}}}, getExpCtx());
+    redact->setSource(mock.get());
+
+    ASSERT_THROWS_CODE(redact->getNext(), AssertionException, 17053);
+}
 }  // namespace
 }  // namespace mongo
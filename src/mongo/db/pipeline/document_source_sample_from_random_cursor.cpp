@@ -28,13 +28,8 @@
  */
 
 
-#include <boost/exception/exception.hpp>
-#include <boost/math/distributions/beta.hpp>
-#include <boost/math/policies/policy.hpp>
-// IWYU pragma: no_include "boost/math/special_functions/detail/erf_inv.hpp"
-// IWYU pragma: no_include "boost/math/special_functions/detail/lanczos_sse2.hpp"
 #include <algorithm>
-#include <boost/math/tools/precision.hpp>
+#include <cmath>
 #include <cstddef>
 #include <stdexcept>
 #include <utility>
@@ -84,11 +79,14 @@ namespace {
  * distribution, so the return value represents the smallest value from such a sample. This is also
  * the expected distance between the values drawn from a uniform distribution, which is how it is
  * being used here.
+ *
+ * Beta(1, N) has the CDF 1 - (1 - x)^N, so its quantile function has the closed form
+ * 1 - (1 - p)^(1/N). This is evaluated as -expm1(log1p(-p) / N) to keep precision for large N,
+ * which avoids the iterative inversion a generic beta quantile needs for every sampled document.
  */
 double smallestFromSampleOfUniform(PseudoRandom* prng, size_t N) {
-    boost::math::beta_distribution<double> betaDist(1.0, static_cast<double>(N));
     double p = prng->nextCanonicalDouble();
-    return boost::math::quantile(betaDist, p);
+    return -std::expm1(std::log1p(-p) / static_cast<double>(N));
 }
 }  // namespace
 
@@ -256,7 +256,9 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
         }
         _executionState = ExecutionProgress::kStartingSubPipeline;
         // All documents from the base collection have been returned, switch to iterating the sub-
-        // pipeline by falling through below.
+        // pipeline by falling through below. The sub-pipeline is not prepared any earlier: both
+        // sides run on this operation's OperationContext and recovery unit, which may only be used
+        // by one thread at a time, so it cannot be read ahead while the outer side drains.
     }
 
     if (_executionState == ExecutionProgress::kStartingSubPipeline) {
@@ -161,7 +161,7 @@ Value ExpressionInternalJsEmit::evaluate(const Document& root, Variables* variab
     // Although inefficient to "create" a new function every time we evaluate, this will usually end
     // up being a simple cache lookup. This is needed because the JS Scope may have been recreated
     // on a new thread if the expression is evaluated across getMores.
-    auto func = makeJsFunc(expCtx, _funcSource.c_str());
+    auto func = makeJsFunc(expCtx, _funcSource);
 
     BSONObj thisBSON = thisVal.getDocument().toBson();
     BSONObj params;
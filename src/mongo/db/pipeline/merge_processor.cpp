@@ -167,6 +167,23 @@ MergeStrategy makeInsertStrategy() {
     };
 }
 
+/**
+ * Creates a merge strategy for a {whenMatched: "accumulate"} $merge. Such a $merge is replaced by a
+ * {whenMatched: [pipeline]} $merge during pipeline optimization, so this strategy is never
+ * expected to write anything.
+ */
+MergeStrategy makeUnresolvedAccumulateStrategy() {
+    return [](const auto& expCtx,
+              const auto& ns,
+              const auto& wc,
+              auto epoch,
+              auto&& batch,
+              auto&& bcr,
+              UpsertType upsertType) {
+        tasserted(9602404, "$merge with whenMatched: 'accumulate' was not resolved before writing");
+    };
+}
+
 /**
  * Creates a batched object transformation function which wraps 'obj' into the given 'updateOp'
  * operator.
@@ -298,6 +315,14 @@ const MergeStrategyDescriptorsMap& getMergeStrategyDescriptors() {
                                       {},
                                       UpsertType::kNone,
                                       makeUpdateCommandGenerator()}},
+                                    // whenMatched: accumulate, whenNotMatched: insert
+                                    {MergeStrategyDescriptor::kAccumulateInsertMode,
+                                     {MergeStrategyDescriptor::kAccumulateInsertMode,
+                                      {ActionType::insert, ActionType::update},
+                                      makeUnresolvedAccumulateStrategy(),
+                                      {},
+                                      UpsertType::kInsertSuppliedDoc,
+                                      makeUpdateCommandGenerator()}},
                                     // whenMatched: fail, whenNotMatched: insert
                                     {MergeStrategyDescriptor::kFailInsertMode,
                                      {MergeStrategyDescriptor::kFailInsertMode,
@@ -92,6 +92,8 @@ struct MergeStrategyDescriptor {
         MergeMode{WhenMatched::kPipeline, WhenNotMatched::kFail};
     static constexpr auto kPipelineDiscardMode =
         MergeMode{WhenMatched::kPipeline, WhenNotMatched::kDiscard};
+    static constexpr auto kAccumulateInsertMode =
+        MergeMode{WhenMatched::kAccumulate, WhenNotMatched::kInsert};
 
     MergeMode mode;
     ActionSet actions;
@@ -32,6 +32,7 @@
 #include <boost/none.hpp>
 #include <iostream>
 #include <memory>
+#include <utility>
 
 #include <boost/optional/optional.hpp>
 
@@ -74,8 +75,12 @@ TDigest::TDigest(int64_t negInfCount,
 }
 
 long TDigest::memUsageBytes() const {
+    long pendingBytes = _pendingDigests.capacity() * sizeof(TDigest);
+    for (const TDigest& digest : _pendingDigests) {
+        pendingBytes += digest._centroids.capacity() * sizeof(Centroid);
+    }
     return sizeof(TDigest) + _buffer.capacity() * sizeof(double) +
-        _centroids.capacity() * sizeof(Centroid);
+        _centroids.capacity() * sizeof(Centroid) + pendingBytes;
 }
 
 void TDigest::incorporate(double input) {
@@ -118,20 +123,43 @@ void TDigest::incorporate(const vector<double>& inputs) {
 }
 
 void TDigest::flushBuffer() {
-    if (_buffer.empty()) {
-        return;
+    if (!_buffer.empty()) {
+        // TODO SERVER-75565: 'boost::sort::spreadsort::spreadsort' shows an observable perf
+        // improvement over std::sort on large datasets. If switching to boost's spreadsort would
+        // need to re-tune the default delta setting and the size of the buffer.
+        std::sort(_buffer.begin(), _buffer.end());
+        merge(_buffer);
+        _buffer.clear();
     }
 
-    // TODO SERVER-75565: 'boost::sort::spreadsort::spreadsort' shows an observable perf improvement
-    // over std::sort on large datasets. If switching to boost's spreadsort would need to re-tune
-    // the default delta setting and the size of the buffer.
-    std::sort(_buffer.begin(), _buffer.end());
-    merge(_buffer);
-    _buffer.clear();
+    if (!_pendingDigests.empty()) {
+        vector<const TDigest*> others;
+        others.reserve(_pendingDigests.size());
+        for (const TDigest& digest : _pendingDigests) {
+            others.push_back(&digest);
+        }
+        merge(others);
+        _pendingDigests.clear();
+        _pendingCentroidsCount = 0;
+    }
+}
+
+void TDigest::deferMerge(TDigest other) {
+    tassert(9602600,
+            "Digests that use different scaling functions or delta parameters aren't mergeable",
+            _k_limit == other._k_limit && _delta == other._delta);
+
+    // The buffered inputs of 'other' aren't accounted for in its 'n' and would be lost otherwise.
+    other.flushBuffer();
+    _pendingCentroidsCount += other._centroids.size();
+    _pendingDigests.push_back(std::move(other));
+    if (_pendingCentroidsCount >= _maxBufferSize) {
+        flushBuffer();
+    }
 }
 
 boost::optional<double> TDigest::computePercentile(double p) {
-    if (!_buffer.empty()) {
+    if (!_buffer.empty() || !_pendingDigests.empty()) {
         flushBuffer();
     }
 
@@ -388,6 +416,86 @@ void TDigest::merge(const TDigest& other) {
     _centroids.swap(temp);
 }
 
+void TDigest::merge(const vector<const TDigest*>& others) {
+    vector<Centroid> all(_centroids);
+
+    // The centroids of each digest are sorted, so after concatenating them, 'all' consists of
+    // sorted runs delimited by 'runEnds'.
+    vector<size_t> runEnds{all.size()};
+    runEnds.reserve(others.size() + 1);
+    for (const TDigest* other : others) {
+        tassert(9602601,
+                "Digests that use different scaling functions or delta parameters aren't mergeable",
+                _k_limit == other->_k_limit && _delta == other->_delta);
+        tassert(9602602, "Cannot merge a digest with itself", other != this);
+
+        _n += other->_n;
+        _negInfCount += other->_negInfCount;
+        _posInfCount += other->_posInfCount;
+        _min = std::min(_min, other->_min);
+        _max = std::max(_max, other->_max);
+
+        if (!other->_centroids.empty()) {
+            all.insert(all.end(), other->_centroids.begin(), other->_centroids.end());
+            runEnds.push_back(all.size());
+        }
+    }
+
+    if (runEnds.size() < 2) {
+        return;  // none of the other digests have any centroids, nothing to compact
+    }
+
+    // Merge the adjacent runs pairwise until a single sorted run is left. This takes
+    // O(all.size() * log(others.size())) comparisons instead of re-sorting all centroids. The merge
+    // is stable, so centroids with equal means keep the order in which the digests were given.
+    const auto byMean = [](const Centroid& lhs, const Centroid& rhs) {
+        return lhs.mean < rhs.mean;
+    };
+    while (runEnds.size() > 1) {
+        vector<size_t> mergedRunEnds;
+        mergedRunEnds.reserve(runEnds.size() / 2 + 1);
+        size_t begin = 0;
+        for (size_t i = 0; i + 1 < runEnds.size(); i += 2) {
+            std::inplace_merge(all.begin() + begin,
+                               all.begin() + runEnds[i],
+                               all.begin() + runEnds[i + 1],
+                               byMean);
+            begin = runEnds[i + 1];
+            mergedRunEnds.push_back(begin);
+        }
+        if (runEnds.size() % 2 == 1) {
+            mergedRunEnds.push_back(runEnds.back());
+        }
+        runEnds.swap(mergedRunEnds);
+    }
+
+    vector<Centroid> temp;
+    temp.reserve(std::min<size_t>(2 * _delta, all.size()));
+
+    // Invariant: after the merge, the weights of all centroids should add up to the new _n.
+    int64_t tn = 0;
+    const double n = _n;  // to ensure floating point division below when it involves '_n'
+
+    int64_t w = 0;  // cumulative weights of centroids up to (not including) the current one
+    auto it = all.begin();
+    while (it != all.end()) {
+        Centroid cur = *(it++);
+        const double qLimit = n * _k_limit(w / n, _delta);
+
+        while (it != all.end() && w + cur.weight + it->weight <= qLimit) {
+            cur.add(*(it++));
+        }
+        temp.push_back(cur);
+        tn += cur.weight;
+        w += cur.weight;
+    }
+
+    tassert(9602603, "Merging digests either lost or duplicated some of the inputs", tn == _n);
+
+    temp.shrink_to_fit();
+    _centroids.swap(temp);
+}
+
 std::ostream& operator<<(std::ostream& os, const TDigest& digest) {
     os << "{n: " << digest.n() << ", min: " << digest.min() << ", max: " << digest.max();
     os << ", posInf: " << digest.posInfCount() << ", negInf: " << digest.negInfCount();
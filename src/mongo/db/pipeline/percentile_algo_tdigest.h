@@ -229,7 +229,19 @@ public:
     // the assumptions are checked.
     void merge(const std::vector<double>& sorted);
 
-    // Sorts data in the pending buffer and merges it with the prior centroids.
+    // Merges all 'others' into this digest at once. Unlike merging the digests one by one, the
+    // centroids are compacted only in a single pass over the combined data, which is cheaper when
+    // combining partial digests from many shards and doesn't accumulate the error of compacting
+    // the intermediate results.
+    void merge(const std::vector<const TDigest*>& others);
+
+    // Queues 'other' to be merged with the other queued digests by the next flushBuffer(). When
+    // the queued digests hold more than the max size of the buffer of centroids, they are flushed
+    // right away.
+    void deferMerge(TDigest other);
+
+    // Sorts data in the pending buffer and merges it with the prior centroids, then merges in the
+    // digests queued by deferMerge().
     void flushBuffer();
 
     const std::vector<Centroid>& centroids() const {
@@ -269,6 +281,10 @@ protected:
     const size_t _maxBufferSize;
     std::vector<double> _buffer;
 
+    // Digests queued by deferMerge() and the total number of centroids in them.
+    std::vector<TDigest> _pendingDigests;
+    size_t _pendingCentroidsCount = 0;
+
     // Centroids are ordered by their means. The ordering is maintained during merges.
     std::vector<Centroid> _centroids;
 
@@ -101,7 +101,11 @@ public:
             centroids.push_back({other[i].coerceToDouble(), other[i + 1].coerceToDouble()});
         }
 
-        merge(TDigest{negInfCount, posInfCount, min, max, centroids, _k_limit, _delta});
+        // When $group merges the results from many shards, combining the partial digests one at a
+        // time would re-compact the centroids for each of them. Instead, the partials are queued
+        // and compacted together when the percentile is computed or the queue grows too large.
+        deferMerge(
+            TDigest{negInfCount, posInfCount, min, max, std::move(centroids), _k_limit, _delta});
     }
 };
 
@@ -678,6 +678,43 @@ TEST(TDigestTest, Merge_DigestsMixed_k0) {
     assertSameCentroids({{4, 2.5}, {6, 6.5}, {4, 10.5}, {6, 14.5}, {5, 19}, {6, 24.5}}, d);
 }
 
+TEST(TDigestTest, Merge_MultipleDigests_k0) {
+    const int delta = 10;
+    const vector<Centroid> centroids{{4, 2.5}, {4, 6.5}, {4, 10.5}, {4, 14.5}, {4, 18.5}, {1, 21}};
+
+    TDigest d{0 /* negInfCount */, 0 /* posInfCount */, 1, 21, centroids, TDigest::k0_limit, delta};
+
+    const TDigest empty{TDigest::k0_limit, delta};
+    const TDigest other{0,    // negInfCount
+                        1,    // posInfCount
+                        4.5,  // min
+                        27,   // max
+                        {{2, 6.5}, {2, 14.5}, {1, 22}, {2, 23.5}, {2, 25.5}, {1, 27}},  // centroids
+                        TDigest::k0_limit,
+                        delta};
+
+    // Merging all digests at once compacts the centroids in the same way as merging two digests.
+    d.merge(vector<const TDigest*>{&empty, &other});
+
+    ASSERT_EQ(1, d.min()) << "min of digest: " << d;
+    ASSERT_EQ(std::numeric_limits<double>::infinity(), d.max()) << "max of digest: " << d;
+    ASSERT_EQ(31, d.n()) << "n of digest: " << d;
+    ASSERT_EQ(1, d.posInfCount()) << "posInfCount of digest: " << d;
+
+    assertSameCentroids({{4, 2.5}, {6, 6.5}, {4, 10.5}, {6, 14.5}, {5, 19}, {6, 24.5}}, d);
+
+    // The deferred merges should produce the same digest as merging the digests at once.
+    TDigest deferred{0, 0, 1, 21, centroids, TDigest::k0_limit, delta};
+    deferred.deferMerge(empty);
+    deferred.deferMerge(other);
+    ASSERT_EQ(21, deferred.n()) << "the deferred digests shouldn't be merged before the flush";
+
+    deferred.flushBuffer();
+    ASSERT_EQ(d.n(), deferred.n()) << "n of digest: " << deferred;
+    ASSERT_EQ(d.posInfCount(), deferred.posInfCount()) << "posInfCount of digest: " << deferred;
+    assertSameCentroids(d.centroids(), deferred);
+}
+
 /**
  * The following test doesn't add coverage but is meant to illustrate the difference between scaling
  * functions.
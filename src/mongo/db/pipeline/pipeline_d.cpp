@@ -51,6 +51,7 @@
 #include "mongo/base/exact_cast.h"
 #include "mongo/base/status.h"
 #include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
 #include "mongo/db/basic_types.h"
@@ -100,6 +101,7 @@
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/document_source_skip.h"
 #include "mongo/db/pipeline/document_source_sort.h"
+#include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/pipeline.h"
@@ -113,6 +115,7 @@
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/index_bounds.h"
+#include "mongo/db/query/interval.h"
 #include "mongo/db/query/plan_executor_factory.h"
 #include "mongo/db/query/plan_executor_impl.h"
 #include "mongo/db/query/plan_yield_policy.h"
@@ -1286,6 +1289,184 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> prepareExecutor
 
     return executor;
 }  // prepareExecutor
+
+/**
+ * Returns the index scan the chosen classic plan rooted at 'root' reads from, if it reads from a
+ * single one through stages which neither reorder documents nor change the values of the fields
+ * they keep. Returns nullptr otherwise.
+ */
+const IndexScan* getIndexScanOfChosenPlan(PlanStage* root) {
+    while (root) {
+        switch (root->stageType()) {
+            case STAGE_FETCH:
+            case STAGE_SHARDING_FILTER:
+                root = root->child().get();
+                break;
+            case STAGE_PROJECTION_DEFAULT:
+            case STAGE_PROJECTION_COVERED:
+            case STAGE_PROJECTION_SIMPLE: {
+                // Only inclusion and exclusion projections, like the one pushed down from the
+                // pipeline's dependencies, leave the values of the fields they keep untouched.
+                auto stats = static_cast<const ProjectionStats*>(root->getSpecificStats());
+                for (auto&& elem : stats->projObj) {
+                    if (!elem.isBoolean() && !elem.isNumber()) {
+                        return nullptr;
+                    }
+                }
+                root = root->child().get();
+                break;
+            }
+            case STAGE_MULTI_PLAN: {
+                auto mps = static_cast<MultiPlanStage*>(root);
+                if (!mps->bestPlanChosen() || !mps->bestPlanIdx()) {
+                    return nullptr;
+                }
+                root = mps->getChildren()[*mps->bestPlanIdx()].get();
+                break;
+            }
+            case STAGE_CACHED_PLAN: {
+                auto cp = static_cast<CachedPlanStage*>(root);
+                if (!cp->bestPlanChosen()) {
+                    return nullptr;
+                }
+                root = root->child().get();
+                break;
+            }
+            case STAGE_IXSCAN:
+                return static_cast<const IndexScan*>(root);
+            default:
+                return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Returns true if no interval of 'oil' contains the null or undefined key. Documents whose field is
+ * null, undefined or missing are indexed under those keys.
+ */
+bool excludesNullishKeys(const OrderedIntervalList& oil) {
+    static const Interval kNullInterval(BSON("" << BSONNULL << "" << BSONNULL), true, true);
+    static const Interval kUndefinedInterval(
+        BSON("" << BSONUndefined << "" << BSONUndefined), true, true);
+    return std::none_of(oil.intervals.begin(), oil.intervals.end(), [](const Interval& interval) {
+        auto ascending = interval.getDirection() == Interval::Direction::kDirectionDescending
+            ? interval.reverseClone()
+            : interval;
+        return ascending.intersects(kNullInterval) || ascending.intersects(kUndefinedInterval);
+    });
+}
+
+/**
+ * Returns true if 'expr' is exactly the path 'path' of the current document.
+ */
+bool isFieldPathExpression(const Expression* expr, const FieldPath& path) {
+    auto fieldPathExpr = dynamic_cast<const ExpressionFieldPath*>(expr);
+    return fieldPathExpr && !fieldPathExpr->isVariableReference() &&
+        fieldPathExpr->getFieldPath().getPathLength() > 1 &&
+        fieldPathExpr->getFieldPathWithoutCurrentPrefix() == path;
+}
+
+/**
+ * Replaces a $group at the front of 'pipeline' with a $_internalStreamingGroup when the index scan
+ * read by the chosen classic plan clusters its _id, that is all documents with the same _id are
+ * next to each other. For an index {k1: 1, ..., kn: 1}, this is the case when the _id has the
+ * fields "$k1", ..., "$k(j-1)" for some j, and a field which is monotonic in kj, such as a
+ * $dateTrunc of kj. Batches of groups then end whenever one of those fields changes.
+ */
+void enableStreamingGroupFromIndexOrder(const intrusive_ptr<ExpressionContext>& expCtx,
+                                        PlanExecutor* exec,
+                                        Pipeline* pipeline) {
+    auto execImpl = dynamic_cast<PlanExecutorImpl*>(exec);
+    if (!execImpl || !internalQueryEnableStreamingGroupFromIndexOrder.load()) {
+        return;
+    }
+
+    // Find the $group, making sure the stages before it keep the scan order.
+    auto& sources = pipeline->getSources();
+    auto groupIt = sources.begin();
+    std::vector<const DocumentSource*> stagesBeforeGroup;
+    for (; groupIt != sources.end() && !dynamic_cast<DocumentSourceGroup*>(groupIt->get());
+         ++groupIt) {
+        if (!(*groupIt)->constraints().preservesOrderAndMetadata) {
+            return;
+        }
+        stagesBeforeGroup.push_back(groupIt->get());
+    }
+    if (groupIt == sources.end()) {
+        return;
+    }
+    auto groupStage = static_cast<DocumentSourceGroup*>(groupIt->get());
+    if (groupStage->doingMerge()) {
+        return;
+    }
+
+    // Index keys equal document values only for plain ascending or descending fields without
+    // arrays, so wildcard, hashed and other special indexes are not used. Strings are also ordered
+    // by the index collation, which must group equal strings together as the query collation does;
+    // only the simple collation is handled.
+    auto ixscan = getIndexScanOfChosenPlan(execImpl->getRootStage());
+    if (!ixscan || !ixscan->indexDescriptor() ||
+        ixscan->indexDescriptor()->getAccessMethodName() != IndexNames::BTREE) {
+        return;
+    }
+    auto ixscanStats = static_cast<const IndexScanStats*>(ixscan->getSpecificStats());
+    const auto& bounds = ixscan->getBounds();
+    if (ixscanStats->isMultiKey || !ixscanStats->collation.isEmpty() || expCtx->getCollator() ||
+        bounds.isSimpleRange) {
+        return;
+    }
+
+    auto& idFields = groupStage->getMutableIdFields();
+    std::vector<size_t> monotonicIdFields;
+    size_t keyIdx = 0;
+    for (auto&& keyElem : ixscanStats->keyPattern) {
+        // The streaming group rejects null, undefined and missing monotonic values, which sort
+        // together but may belong to different groups. Only key fields whose bounds exclude them
+        // can order the _id.
+        if (!keyElem.isNumber() || keyIdx >= bounds.fields.size() ||
+            !excludesNullishKeys(bounds.fields[keyIdx++])) {
+            break;
+        }
+        const FieldPath keyField(keyElem.fieldName());
+        if (std::any_of(stagesBeforeGroup.begin(), stagesBeforeGroup.end(), [&](auto stage) {
+                return stage->getModifiedPaths().canModify(keyField);
+            })) {
+            break;
+        }
+
+        bool hasKeyField = false;
+        for (size_t i = 0; i < idFields.size(); ++i) {
+            idFields[i] = idFields[i]->optimize();
+            auto monotonicState = idFields[i]->getMonotonicState(keyField);
+            if ((monotonicState == monotonic::State::Increasing ||
+                 monotonicState == monotonic::State::Decreasing) &&
+                std::find(monotonicIdFields.begin(), monotonicIdFields.end(), i) ==
+                    monotonicIdFields.end()) {
+                monotonicIdFields.push_back(i);
+            }
+            hasKeyField = hasKeyField || isFieldPathExpression(idFields[i].get(), keyField);
+        }
+
+        // The index is only ordered on the next key among entries with the same value of this
+        // one, which the _id must then hold as-is.
+        if (!hasKeyField) {
+            break;
+        }
+    }
+    if (monotonicIdFields.empty()) {
+        return;
+    }
+    std::sort(monotonicIdFields.begin(), monotonicIdFields.end());
+
+    *groupIt = DocumentSourceStreamingGroup::create(
+        expCtx,
+        groupStage->getIdExpression(),
+        std::move(monotonicIdFields),
+        std::move(groupStage->getMutableAccumulationStatements()),
+        groupStage->getMaxMemoryUsageBytes());
+    Pipeline::stitch(&sources);
+}
 }  // namespace
 
 boost::optional<std::pair<PipelineD::IndexSortOrderAgree, PipelineD::IndexOrderedByMinTime>>
@@ -1881,6 +2062,8 @@ PipelineD::BuildQueryExecutorResult PipelineD::buildInnerQueryExecutorGeneric(
         }
     }
 
+    enableStreamingGroupFromIndexOrder(expCtx, exec.get(), pipeline);
+
     const auto cursorType = shouldProduceEmptyDocs
         ? DocumentSourceCursor::CursorType::kEmptyDocuments
         : DocumentSourceCursor::CursorType::kRegular;
@@ -927,13 +927,27 @@ std::unique_ptr<TemporaryRecordStore> CommonMongodProcessInterface::createTempor
         expCtx->opCtx, keyFormat);
 }
 
-Document CommonMongodProcessInterface::readRecordFromRecordStore(
-    const boost::intrusive_ptr<ExpressionContext>& expCtx, RecordStore* rs, RecordId rID) const {
-    RecordData possibleRecord;
+std::vector<Document> CommonMongodProcessInterface::readRecordsFromRecordStore(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    RecordStore* rs,
+    RecordId start,
+    size_t maxRecords,
+    size_t maxBytes) const {
+    std::vector<Document> docs;
     Lock::GlobalLock lk(expCtx->opCtx, MODE_IS);
-    auto foundDoc = rs->findRecord(expCtx->opCtx, RecordId(rID), &possibleRecord);
-    tassert(775101, str::stream() << "Could not find document id " << rID, foundDoc);
-    return Document(possibleRecord.toBson());
+    auto cursor = rs->getCursor(expCtx->opCtx);
+    auto record = cursor->seek(start, SeekableRecordCursor::BoundInclusion::kInclude);
+    tassert(9602700,
+            str::stream() << "Could not find document id " << start,
+            record && record->id == start);
+
+    size_t bytes = 0;
+    for (; record && docs.size() < maxRecords && (docs.empty() || bytes < maxBytes);
+         record = cursor->next()) {
+        bytes += record->data.size();
+        docs.emplace_back(record->data.toBson().getOwned());
+    }
+    return docs;
 }
 
 void CommonMongodProcessInterface::deleteRecordFromRecordStore(
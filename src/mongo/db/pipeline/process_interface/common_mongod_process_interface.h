@@ -161,9 +161,12 @@ public:
                                    std::vector<Record>* records,
                                    const std::vector<Timestamp>& ts) const final;
 
-    Document readRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
-                                       RecordStore* rs,
-                                       RecordId rID) const final;
+    std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId start,
+        size_t maxRecords,
+        size_t maxBytes) const final;
 
     void deleteRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                      RecordStore* rs,
@@ -632,13 +632,17 @@ public:
                                            const std::vector<Timestamp>& ts) const = 0;
 
     /**
-     * Search for the RecordId 'rID' in 'rs'. RecordStore must already exist and be populated.
-     * Asserts that a document was found.
+     * Reads the records of 'rs' in RecordId order, starting at 'start', in a single scan. Stops
+     * after 'maxRecords' records or once the records read add up to at least 'maxBytes'. The
+     * RecordStore must already exist and be populated. Asserts that the record with RecordId
+     * 'start' was found, so at least one document is always returned.
      */
-    virtual Document readRecordFromRecordStore(
+    virtual std::vector<Document> readRecordsFromRecordStore(
         const boost::intrusive_ptr<ExpressionContext>& expCtx,
         RecordStore* rs,
-        RecordId rID) const = 0;
+        RecordId start,
+        size_t maxRecords,
+        size_t maxBytes) const = 0;
 
     /**
      * Deletes the record with RecordId `rID` from `rs`. RecordStore must already exist.
@@ -353,9 +353,12 @@ public:
         MONGO_UNREACHABLE;
     }
 
-    Document readRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
-                                       RecordStore* rs,
-                                       RecordId rID) const final {
+    std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId start,
+        size_t maxRecords,
+        size_t maxBytes) const final {
         MONGO_UNREACHABLE;
     }
 
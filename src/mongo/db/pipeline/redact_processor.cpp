@@ -82,20 +82,55 @@ Value RedactProcessor::redactValue(const Value& in, const Document& root) const
     }
 }
 
+namespace {
+enum class RedactAction { kKeep, kPrune, kDescend };
+
+RedactAction getRedactAction(const Value& expressionResult) {
+    // The expression is evaluated for every (sub)document, and it almost always returns one of the
+    // $$KEEP, $$PRUNE or $$DESCEND strings, so compare the strings directly before falling back to
+    // the generic comparison, which also matches the equivalent symbols.
+    if (expressionResult.getType() == String) {
+        const StringData result = expressionResult.getStringData();
+        if (result == keepVal.getStringData()) {
+            return RedactAction::kKeep;
+        } else if (result == pruneVal.getStringData()) {
+            return RedactAction::kPrune;
+        } else if (result == descendVal.getStringData()) {
+            return RedactAction::kDescend;
+        }
+    } else {
+        ValueComparator simpleValueCmp;
+        if (simpleValueCmp.evaluate(expressionResult == keepVal)) {
+            return RedactAction::kKeep;
+        } else if (simpleValueCmp.evaluate(expressionResult == pruneVal)) {
+            return RedactAction::kPrune;
+        } else if (simpleValueCmp.evaluate(expressionResult == descendVal)) {
+            return RedactAction::kDescend;
+        }
+    }
+    uasserted(17053,
+              str::stream() << "$redact's expression should not return anything "
+                            << "aside from the variables $$KEEP, $$DESCEND, and "
+                            << "$$PRUNE, but returned " << expressionResult.toString());
+}
+}  // namespace
+
 boost::optional<Document> RedactProcessor::redactObject(const Document& root) const {
     auto& variables = _expCtx->variables;
     const Value expressionResult = _expression->evaluate(root, &variables);
 
-    ValueComparator simpleValueCmp;
-    if (simpleValueCmp.evaluate(expressionResult == keepVal)) {
+    const RedactAction action = getRedactAction(expressionResult);
+    if (action == RedactAction::kKeep) {
         return variables.getDocument(_currentId, root);
-    } else if (simpleValueCmp.evaluate(expressionResult == pruneVal)) {
+    } else if (action == RedactAction::kPrune) {
         return boost::optional<Document>();
-    } else if (simpleValueCmp.evaluate(expressionResult == descendVal)) {
+    } else {
         const Document in = variables.getDocument(_currentId, root);
         in.loadIntoCache();
 
-        MutableDocument out;
+        // All fields are in the cache now, so counting them is cheap and lets the output reserve
+        // its storage at once, since most of the fields are usually kept.
+        MutableDocument out{in.computeSize()};
         out.copyMetaDataFrom(in);
 
         FieldIterator fields(in);
@@ -109,11 +144,6 @@ boost::optional<Document> RedactProcessor::redactObject(const Document& root) co
             }
         }
         return out.freeze();
-    } else {
-        uasserted(17053,
-                  str::stream() << "$redact's expression should not return anything "
-                                << "aside from the variables $$KEEP, $$DESCEND, and "
-                                << "$$PRUNE, but returned " << expressionResult.toString());
     }
 }
 
@@ -40,6 +40,12 @@ namespace mongo {
  * Input documents will be ignored and skipped if they do not have a value at field "_id".
  * Input documents will be ignored and skipped if no document with key specified at "_id"
  * is locally-stored.
+ *
+ * Each input document is looked up with its own point query as it arrives, and the output keeps
+ * the order of the search results. Documents are not looked up in batches: the input arrives in
+ * score order, and reading ahead of 'limit' would ask mongot for batches that are never returned.
+ * Fetching the next mongot batch ahead of time is done by the mongot cursor's getMore strategy
+ * instead.
  */
 class DocumentSourceInternalSearchIdLookUp final : public DocumentSource {
 public:
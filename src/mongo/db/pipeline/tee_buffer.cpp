@@ -52,6 +52,19 @@ boost::intrusive_ptr<TeeBuffer> TeeBuffer::create(size_t nConsumers, int bufferS
 }
 
 DocumentSource::GetNextResult TeeBuffer::getNext(size_t consumerId) {
+    if (_concurrentConsumers) {
+        // The owner has already loaded the batch, and other consumers may be reading it right now.
+        if (_buffer.empty()) {
+            return DocumentSource::GetNextResult::makeEOF();
+        }
+        if (_consumers[consumerId].nLeftToReturn == 0) {
+            return DocumentSource::GetNextResult::makePauseExecution();
+        }
+        const size_t bufferIndex = _buffer.size() - _consumers[consumerId].nLeftToReturn;
+        --_consumers[consumerId].nLeftToReturn;
+        return _buffer[bufferIndex];
+    }
+
     size_t nConsumersStillProcessingThisBatch =
         std::count_if(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
             return info.nLeftToReturn > 0;
@@ -84,6 +97,12 @@ void TeeBuffer::loadNextBatch() {
 
     auto input = _source->getNext();
     for (; input.isAdvanced(); input = _source->getNext()) {
+        if (_concurrentConsumers) {
+            // Reading a document may lazily populate its cache from the backing BSON, which is not
+            // safe to do from several threads at once. Hand out fully materialized copies instead.
+            // Computing the size below also snapshots the sizes of all nested documents.
+            input = DocumentSource::GetNextResult(input.releaseDocument().shred());
+        }
         bytesInBuffer += input.getDocument().getApproximateSize();
         _buffer.push_back(std::move(input));
 
@@ -106,4 +125,25 @@ void TeeBuffer::loadNextBatch() {
     }
 }
 
+void TeeBuffer::loadNextBatchForConcurrentConsumers() {
+    invariant(_concurrentConsumers);
+    disposeSourceIfUnused();
+    if (std::any_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
+            return info.stillInUse;
+        })) {
+        loadNextBatch();
+    }
+}
+
+void TeeBuffer::disposeSourceIfUnused() {
+    if (std::none_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
+            return info.stillInUse;
+        })) {
+        _buffer.clear();
+        if (_source) {
+            _source->dispose();
+        }
+    }
+}
+
 }  // namespace mongo
@@ -40,6 +40,7 @@
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/intrusive_counter.h"
 
 namespace mongo {
@@ -70,13 +71,8 @@ public:
     void dispose(size_t consumerId) {
         _consumers[consumerId].stillInUse = false;
         _consumers[consumerId].nLeftToReturn = 0;
-        if (std::none_of(_consumers.begin(), _consumers.end(), [](const ConsumerInfo& info) {
-                return info.stillInUse;
-            })) {
-            _buffer.clear();
-            if (_source) {
-                _source->dispose();
-            }
+        if (!_concurrentConsumers) {
+            disposeSourceIfUnused();
         }
     }
 
@@ -87,6 +83,21 @@ public:
      */
     DocumentSource::GetNextResult getNext(size_t consumerId);
 
+    /**
+     * When 'concurrent' is true, each consumer may call getNext() and dispose() from its own
+     * thread. The buffer then never pulls from the source by itself; instead, the owner calls
+     * loadNextBatchForConcurrentConsumers() while no consumer is running.
+     */
+    void setConcurrentConsumers(bool concurrent) {
+        _concurrentConsumers = concurrent;
+    }
+
+    /**
+     * Loads the next batch for all consumers still in use. Once the source is exhausted, the batch
+     * is empty and getNext() returns EOF to every consumer. Only valid with concurrent consumers.
+     */
+    void loadNextBatchForConcurrentConsumers();
+
 private:
     TeeBuffer(size_t nConsumers, size_t bufferSizeBytes);
 
@@ -97,15 +108,23 @@ private:
      */
     void loadNextBatch();
 
+    /**
+     * Clears '_buffer' and disposes of '_source' once no consumer is still in use.
+     */
+    void disposeSourceIfUnused();
+
     DocumentSource* _source = nullptr;
 
     const size_t _bufferSizeBytes;
     std::vector<DocumentSource::GetNextResult> _buffer;
 
-    struct ConsumerInfo {
+    // Padded to a cache line so that concurrent consumers don't contend on each other's entries.
+    struct alignas(stdx::hardware_destructive_interference_size) ConsumerInfo {
         bool stillInUse = true;
         int nLeftToReturn = 0;
     };
     std::vector<ConsumerInfo> _consumers;
+
+    bool _concurrentConsumers = false;
 };
 }  // namespace mongo
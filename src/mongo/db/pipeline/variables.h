@@ -260,7 +260,9 @@ private:
     void setValue(Id id, const Value& value, bool isConstant);
 
     IdGenerator _idGenerator;
-    stdx::unordered_map<Id, ValueAndState> _definitions;
+    // A flat map, so that defining the handful of variables an expression typically uses does not
+    // allocate a node per variable.
+    absl::flat_hash_map<Id, ValueAndState> _definitions;
 };
 
 /**
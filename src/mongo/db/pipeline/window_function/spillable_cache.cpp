@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <utility>
 
 
@@ -93,12 +94,17 @@ void SpillableCache::freeUpTo(int id) {
         }
         ++_nextFreedIndex;
     }
+    while (!_diskReadCache.empty() && _diskReadCacheIndex < _nextFreedIndex) {
+        _diskReadCache.pop_front();
+        ++_diskReadCacheIndex;
+    }
 }
 void SpillableCache::clear() {
     if (_diskCache) {
         _expCtx->mongoProcessInterface->truncateRecordStore(_expCtx, _diskCache->rs());
     }
     _memCache.clear();
+    _diskReadCache.clear();
     _diskWrittenIndex = 0;
     _nextIndex = 0;
     _nextFreedIndex = 0;
@@ -156,6 +162,7 @@ void SpillableCache::spillToDisk() {
         ++_diskWrittenIndex;
     }
     _memCache.clear();
+    _diskReadCache.clear();
     if (records.size() == 0) {
         return;
     }
@@ -168,8 +175,37 @@ Document SpillableCache::readDocumentFromDiskById(int desired) {
             str::stream() << "Attempted to read id " << desired
                           << "from disk in SpillableCache before writing",
             _diskCache && desired < _diskWrittenIndex);
-    return _expCtx->mongoProcessInterface->readRecordFromRecordStore(
-        _expCtx, _diskCache->rs(), RecordId(desired + 1));
+    if (desired < _diskReadCacheIndex ||
+        desired >= _diskReadCacheIndex + static_cast<int>(_diskReadCache.size())) {
+        prefetchFromDisk(desired);
+    }
+    return _diskReadCache[desired - _diskReadCacheIndex].value();
+}
+
+void SpillableCache::prefetchFromDisk(int desired) {
+    _diskReadCache.clear();
+
+    const int64_t budget = std::max<int64_t>(
+        (_memTracker.maxAllowedMemoryUsageBytes() - _memTracker.currentMemoryBytes()) / 2, 0);
+    const size_t maxBytes = std::min(kMaxReadSize, static_cast<size_t>(budget));
+    const size_t maxRecords =
+        std::min(kMaxReadBatchCount, static_cast<size_t>(_diskWrittenIndex - desired));
+
+    auto docs = _expCtx->mongoProcessInterface->readRecordsFromRecordStore(
+        _expCtx, _diskCache->rs(), RecordId(desired + 1), maxRecords, maxBytes);
+    _diskReadCacheIndex = desired;
+
+    // The approximate size of a Document can be much larger than its BSON size, so keep only as
+    // many of the read documents as fit into the budget (but always the requested one).
+    int64_t readBytes = 0;
+    for (auto& doc : docs) {
+        const auto size = doc.getApproximateSize();
+        if (!_diskReadCache.empty() && readBytes + static_cast<int64_t>(size) > budget) {
+            break;
+        }
+        readBytes += size;
+        _diskReadCache.emplace_back(MemoryUsageToken{size, &_memTracker}, std::move(doc));
+    }
 }
 Document SpillableCache::readDocumentFromMemCacheById(int desired) {
     // If we have only freed documents from disk, the index into '_memCache' is off by the number of
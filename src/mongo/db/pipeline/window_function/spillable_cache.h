@@ -94,6 +94,7 @@ public:
             _diskCache = nullptr;
         }
         _memCache.clear();
+        _diskReadCache.clear();
     }
 
     size_t getApproximateSize() {
@@ -133,6 +134,7 @@ public:
 
 private:
     Document readDocumentFromDiskById(int desired);
+    void prefetchFromDisk(int desired);
     Document readDocumentFromMemCacheById(int desired);
     void verifyInCache(int desired);
     void writeBatchToDisk(std::vector<Record>& records);
@@ -142,6 +144,14 @@ private:
     ExpressionContext* _expCtx;
     std::deque<MemoryUsageTokenWith<Document>> _memCache;
 
+    // Documents read back from disk. Window bounds move forward through the partition, so when a
+    // spilled document is requested, the documents following it are read in the same scan of the
+    // record store instead of looking each of them up separately. '_diskReadCacheIndex' is the id
+    // of the first document in '_diskReadCache'. The documents are accounted for in '_memTracker'
+    // and are dropped when spilling.
+    std::deque<MemoryUsageTokenWith<Document>> _diskReadCache;
+    int _diskReadCacheIndex = 0;
+
     std::unique_ptr<TemporaryRecordStore> _diskCache = nullptr;
     // The number of documents we've written to disk, as well as the recordID of the last document
     // written. Zero is an invalid RecordID, so writing will start with RecordId(1).
@@ -155,6 +165,11 @@ private:
     // When spilling to disk, only write batches smaller than 16MB.
     static constexpr size_t kMaxWriteSize = 16 * 1024 * 1024;
 
+    // When reading from disk, read at most 1000 documents or 16MB at once, but no more than half of
+    // the memory that is still available.
+    static constexpr size_t kMaxReadBatchCount = 1000;
+    static constexpr size_t kMaxReadSize = 16 * 1024 * 1024;
+
     // Be able to report that disk was used after the cache has been finalized.
     bool _usedDisk = false;
 };
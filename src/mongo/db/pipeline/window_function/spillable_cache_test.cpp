@@ -92,14 +92,25 @@ public:
         });
     }
 
-    Document readRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
-                                       RecordStore* rs,
-                                       RecordId rID) const override {
-        RecordData possibleRecord;
+    std::vector<Document> readRecordsFromRecordStore(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        RecordStore* rs,
+        RecordId start,
+        size_t maxRecords,
+        size_t maxBytes) const override {
+        ++numBatchedReads;
+        std::vector<Document> docs;
         AutoGetCollection autoColl(expCtx->opCtx, expCtx->ns, MODE_IX);
-        auto foundDoc = rs->findRecord(expCtx->opCtx, RecordId(rID), &possibleRecord);
-        tassert(5643001, str::stream() << "Could not find document id " << rID, foundDoc);
-        return Document(possibleRecord.toBson());
+        auto cursor = rs->getCursor(expCtx->opCtx);
+        auto record = cursor->seek(start, SeekableRecordCursor::BoundInclusion::kInclude);
+        tassert(9602701, str::stream() << "Could not find document id " << start, record);
+        size_t bytes = 0;
+        for (; record && docs.size() < maxRecords && (docs.empty() || bytes < maxBytes);
+             record = cursor->next()) {
+            bytes += record->data.size();
+            docs.emplace_back(record->data.toBson().getOwned());
+        }
+        return docs;
     }
 
     void deleteRecordFromRecordStore(const boost::intrusive_ptr<ExpressionContext>& expCtx,
@@ -119,6 +130,8 @@ public:
         tassert(5643015, "Unable to clear record store", status.isOK());
         wuow.commit();
     }
+
+    mutable int numBatchedReads = 0;
 };
 
 class SpillableCacheTest : public AggregationMongoDContextFixture {
@@ -216,6 +229,28 @@ TEST_F(SpillableCacheTest, ReturnsCorrectDocumentsIfSomeHaveBeenRemovedMixed) {
     _expCtx->allowDiskUse = false;
 }
 
+TEST_F(SpillableCacheTest, ReadsSpilledDocumentsInBatches) {
+    _expCtx->allowDiskUse = true;
+    auto cache = createSpillableCache(5000);
+    buildAndLoadDocumentSet(10, cache.get());
+    cache->spillToDisk();
+    ASSERT_EQ(0, cache->getApproximateSize());
+
+    // The first read brings in the following documents as well, as much as half of the memory limit
+    // allows.
+    verifyDocsInCache(0, 10, cache.get());
+    auto* processInterface =
+        static_cast<MongoProcessInterfaceForTest*>(_expCtx->mongoProcessInterface.get());
+    ASSERT_LT(processInterface->numBatchedReads, 10);
+    ASSERT_LTE(cache->getApproximateSize(), 5000);
+
+    // Freeing documents releases the ones that have been read back, too.
+    cache->freeUpTo(9);
+    ASSERT_EQ(0, cache->getApproximateSize());
+    cache->finalize();
+    _expCtx->allowDiskUse = false;
+}
+
 TEST_F(SpillableCacheTest, CanInsertLargeDocuments) {
     _expCtx->allowDiskUse = true;
     // 19 MB
@@ -287,6 +287,14 @@ struct BudgetEstimator {
     }
 };
 
+/**
+ * The plan cache lives only in memory and starts out empty after a restart or step-up. Entries are
+ * not persisted or shipped between nodes: a cache key embeds index discriminators and a
+ * SolutionCacheData refers to indexes by their in-memory catalog identity, so neither is
+ * meaningful on another node or after the catalog is reloaded. Restoring an entry would also
+ * require its originating query, which is only kept as redactable debug info. Entries are instead
+ * rebuilt lazily by multiplanning the first occurrence of each shape.
+ */
 using PlanCache = PlanCacheBase<PlanCacheKey,
                                 SolutionCacheData,
                                 BudgetEstimator,
@@ -57,6 +57,11 @@ namespace mongo {
 
 /**
  * Builds the cursor field for a reply to a cursor-generating command in-place.
+ *
+ * Each document of the batch is copied once, straight into the reply builder's buffer, and that
+ * buffer becomes the body of the reply Message which the transport layer writes out as is. The
+ * reply is therefore kept contiguous rather than assembled from separate fragments, which lets
+ * the command reply be inspected, compressed or rewritten as a single buffer.
  */
 class CursorResponseBuilder {
     CursorResponseBuilder(const CursorResponseBuilder&) = delete;
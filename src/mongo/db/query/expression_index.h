@@ -80,6 +80,9 @@ public:
                                                 const S2IndexingParams& indexParams,
                                                 OrderedIntervalList* out);
 
+    // Computes the covering of 'region' each time it is called. Index bounds are never cached,
+    // not even for a query planned from the plan cache, so repeated queries on the same geometry
+    // each pay for their own covering.
     static void cover2dsphere(const S2Region& region,
                               const S2IndexingParams& indexParams,
                               OrderedIntervalList* oilOut);
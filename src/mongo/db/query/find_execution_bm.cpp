@@ -0,0 +1,305 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mongo/base/init.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/get_executor.h"
+#include "mongo/db/query/multiple_collection_accessor.h"
+#include "mongo/db/query/plan_executor.h"
+#include "mongo/db/query/query_request_helper.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/repl/storage_interface_impl.h"
+#include "mongo/db/service_context_d_test_fixture.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
+
+namespace mongo {
+namespace {
+
+using namespace fmt::literals;
+
+// Dummy initializer to fill in the initializer graph
+MONGO_INITIALIZER_GENERAL(CoreOptions_Store, (), ())(InitializerContext*) {}
+
+MONGO_INITIALIZER_GENERAL(DisableLogging, (), ())
+(InitializerContext*) {
+    auto& lv2Manager = logv2::LogManager::global();
+    logv2::LogDomainGlobal::ConfigurationOptions lv2Config;
+    lv2Config.makeDisabled();
+    uassertStatusOK(lv2Manager.getGlobalDomainInternal().configure(lv2Config));
+}
+
+static constexpr uint64_t kRandomSeed = 619449996;
+
+// YCSB-like 'usertable': string keys and ten 100-byte payload fields per record.
+const NamespaceString kUserTableNss =
+    NamespaceString::createNamespaceString_forTest("find_execution_bm.usertable");
+static constexpr int kUserTableRecords = 10000;
+static constexpr int kUserTableFields = 10;
+static constexpr int kUserTableFieldLength = 100;
+
+// TPC-H-like 'lineitem': a subset of the lineitem columns, with an index on the ship date.
+const NamespaceString kLineItemNss =
+    NamespaceString::createNamespaceString_forTest("find_execution_bm.lineitem");
+static constexpr int kLineItemRecords = 20000;
+static constexpr int kLineItemShipDays = 2500;
+
+enum class Engine { kClassic, kSbe };
+
+std::string userKey(int i) {
+    return "user{:010}"_format(i);
+}
+
+std::vector<InsertStatement> makeUserTableDocs() {
+    std::mt19937 rng(kRandomSeed);
+    std::uniform_int_distribution<int> charDist('a', 'z');
+
+    std::vector<InsertStatement> docs;
+    docs.reserve(kUserTableRecords);
+    for (int i = 0; i < kUserTableRecords; ++i) {
+        BSONObjBuilder bob;
+        bob.append("_id", userKey(i));
+        for (int f = 0; f < kUserTableFields; ++f) {
+            std::string value(kUserTableFieldLength, 'a');
+            for (auto& c : value) {
+                c = static_cast<char>(charDist(rng));
+            }
+            bob.append("field{}"_format(f), value);
+        }
+        docs.emplace_back(bob.obj());
+    }
+    return docs;
+}
+
+std::vector<InsertStatement> makeLineItemDocs() {
+    std::mt19937 rng(kRandomSeed);
+    std::uniform_int_distribution<int> quantityDist(1, 50);
+    std::uniform_int_distribution<int> discountDist(0, 10);
+    std::uniform_int_distribution<int> shipDayDist(0, kLineItemShipDays - 1);
+    std::uniform_real_distribution<double> priceDist(900.0, 105000.0);
+    static constexpr StringData kReturnFlags = "ANR"_sd;
+    static constexpr StringData kLineStatuses = "FO"_sd;
+
+    const auto kStartDate = dateFromISOString("1992-01-01T00:00:00Z").getValue();
+    std::vector<InsertStatement> docs;
+    docs.reserve(kLineItemRecords);
+    for (int i = 0; i < kLineItemRecords; ++i) {
+        docs.emplace_back(
+            BSON("_id" << i << "l_orderkey" << i / 4 << "l_linenumber" << i % 4 << "l_quantity"
+                       << quantityDist(rng) << "l_extendedprice" << priceDist(rng) << "l_discount"
+                       << discountDist(rng) / 100.0 << "l_returnflag"
+                       << kReturnFlags.substr(i % kReturnFlags.size(), 1) << "l_linestatus"
+                       << kLineStatuses.substr(i % kLineStatuses.size(), 1) << "l_shipdate"
+                       << kStartDate + Days(shipDayDist(rng))));
+    }
+    return docs;
+}
+
+/**
+ * Stands up a mongod ServiceContext on the ephemeral storage engine and loads the YCSB-like and
+ * TPC-H-like collections, so that each benchmark can drive find commands through parsing,
+ * planning and execution against real catalog and storage state.
+ */
+class FindExecutionBenchmarkFixture : public ServiceContextMongoDTest {
+public:
+    FindExecutionBenchmarkFixture() : ServiceContextMongoDTest() {
+        setUp();
+    }
+
+    ~FindExecutionBenchmarkFixture() override {
+        tearDown();
+    }
+
+    OperationContext* getOperationContext() {
+        return _opCtx.get();
+    }
+
+private:
+    void _doTest() override{};
+
+    void setUp() override {
+        ServiceContextMongoDTest::setUp();
+        _opCtx = cc().makeOperationContext();
+        auto replCoord = std::make_unique<repl::ReplicationCoordinatorMock>(getServiceContext());
+        repl::ReplicationCoordinator::set(getServiceContext(), std::move(replCoord));
+
+        repl::StorageInterfaceImpl storage;
+        uassertStatusOK(storage.createCollection(_opCtx.get(), kUserTableNss, {}));
+        uassertStatusOK(storage.insertDocuments(_opCtx.get(), kUserTableNss, makeUserTableDocs()));
+
+        uassertStatusOK(storage.createCollection(_opCtx.get(), kLineItemNss, {}));
+        uassertStatusOK(storage.createIndexesOnEmptyCollection(
+            _opCtx.get(),
+            kLineItemNss,
+            {BSON("v" << 2 << "key" << BSON("l_shipdate" << 1) << "name"
+                      << "l_shipdate_1")}));
+        uassertStatusOK(storage.insertDocuments(_opCtx.get(), kLineItemNss, makeLineItemDocs()));
+    }
+
+    void tearDown() override {
+        _opCtx.reset(nullptr);
+        ServiceContextMongoDTest::tearDown();
+    }
+
+    ServiceContext::UniqueOperationContext _opCtx;
+};
+
+/**
+ * Runs the find command produced by 'makeCmd' once per iteration and reports the average time
+ * spent in each phase: parsing and canonicalization, executor construction (including plan
+ * selection), and draining the executor.
+ */
+template <typename MakeCmd>
+void runFind(benchmark::State& state, const NamespaceString& nss, MakeCmd makeCmd) {
+    FindExecutionBenchmarkFixture fixture;
+    auto opCtx = fixture.getOperationContext();
+
+    const auto engine = static_cast<Engine>(state.range(0));
+    RAIIServerParameterControllerForTest engineController(
+        "internalQueryFrameworkControl",
+        engine == Engine::kClassic ? "forceClassicEngine" : "trySbeEngine");
+
+    std::mt19937 rng(kRandomSeed);
+    int64_t parseMicros = 0;
+    int64_t planMicros = 0;
+    int64_t executeMicros = 0;
+    int64_t docsReturned = 0;
+    for (auto _ : state) {
+        const BSONObj cmdObj = makeCmd(rng);
+
+        Timer timer;
+        auto findCommand = query_request_helper::makeFromFindCommandForTests(cmdObj, nss);
+        auto expCtx = makeExpressionContext(opCtx, *findCommand);
+        auto cq = std::make_unique<CanonicalQuery>(CanonicalQueryParams{
+            .expCtx = std::move(expCtx),
+            .parsedFind = ParsedFindCommandParams{
+                .findCommand = std::move(findCommand),
+                .allowedFeatures = MatchExpressionParser::kDefaultSpecialFeatures}});
+        parseMicros += timer.micros();
+
+        timer.reset();
+        const auto collection = acquireCollection(
+            opCtx,
+            CollectionAcquisitionRequest::fromOpCtx(opCtx, nss, AcquisitionPrerequisites::kRead),
+            MODE_IS);
+        auto exec = uassertStatusOK(getExecutorFind(opCtx,
+                                                    MultipleCollectionAccessor{collection},
+                                                    std::move(cq),
+                                                    PlanYieldPolicy::YieldPolicy::YIELD_AUTO));
+        planMicros += timer.micros();
+
+        timer.reset();
+        BSONObj obj;
+        while (exec->getNext(&obj, nullptr) == PlanExecutor::ADVANCED) {
+            benchmark::DoNotOptimize(obj);
+            ++docsReturned;
+        }
+        executeMicros += timer.micros();
+    }
+
+    state.counters["parse_us"] =
+        benchmark::Counter(parseMicros, benchmark::Counter::kAvgIterations);
+    state.counters["plan_us"] = benchmark::Counter(planMicros, benchmark::Counter::kAvgIterations);
+    state.counters["execute_us"] =
+        benchmark::Counter(executeMicros, benchmark::Counter::kAvgIterations);
+    state.counters["docs"] = benchmark::Counter(docsReturned, benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// YCSB workload C: a point read of a whole record by key.
+void BM_YcsbPointRead(benchmark::State& state) {
+    std::uniform_int_distribution<int> keyDist(0, kUserTableRecords - 1);
+    runFind(state, kUserTableNss, [&](std::mt19937& rng) {
+        return BSON("find" << kUserTableNss.coll() << "filter"
+                           << BSON("_id" << userKey(keyDist(rng))));
+    });
+}
+
+// YCSB workload E: a short range scan starting at a random key, returning one field.
+void BM_YcsbShortScan(benchmark::State& state) {
+    std::uniform_int_distribution<int> keyDist(0, kUserTableRecords - 1);
+    runFind(state, kUserTableNss, [&](std::mt19937& rng) {
+        return BSON("find" << kUserTableNss.coll() << "filter"
+                           << BSON("_id" << BSON("$gte" << userKey(keyDist(rng)))) << "projection"
+                           << BSON("field0" << 1) << "limit" << 50);
+    });
+}
+
+// TPC-H Q6 expressed as a find: an indexed ship date range with residual predicates on the
+// discount and quantity, projecting the columns needed to compute revenue.
+void BM_TpchQ6Filter(benchmark::State& state) {
+    const auto kStartDate = dateFromISOString("1992-01-01T00:00:00Z").getValue();
+    std::uniform_int_distribution<int> yearDist(0, kLineItemShipDays / 365 - 1);
+    runFind(state, kLineItemNss, [&](std::mt19937& rng) {
+        const auto from = kStartDate + Days(365 * yearDist(rng));
+        return BSON("find" << kLineItemNss.coll() << "filter"
+                           << BSON("l_shipdate" << BSON("$gte" << from << "$lt" << from + Days(365))
+                                                << "l_discount" << BSON("$gte" << 0.05 << "$lte"
+                                                                               << 0.07)
+                                                << "l_quantity" << BSON("$lt" << 24))
+                           << "projection"
+                           << BSON("_id" << 0 << "l_extendedprice" << 1 << "l_discount" << 1));
+    });
+}
+
+// A collection scan with a selective unindexed predicate and a sort, the shape of a TPC-H
+// reporting query that has no supporting index.
+void BM_TpchReturnedItemsSort(benchmark::State& state) {
+    std::uniform_int_distribution<int> quantityDist(1, 50);
+    runFind(state, kLineItemNss, [&](std::mt19937& rng) {
+        return BSON("find" << kLineItemNss.coll() << "filter"
+                           << BSON("l_returnflag"
+                                   << "R"
+                                   << "l_quantity" << quantityDist(rng))
+                           << "sort" << BSON("l_extendedprice" << -1) << "limit" << 100);
+    });
+}
+
+BENCHMARK(BM_YcsbPointRead)->ArgName("engine")->Arg(0)->Arg(1);
+BENCHMARK(BM_YcsbShortScan)->ArgName("engine")->Arg(0)->Arg(1);
+BENCHMARK(BM_TpchQ6Filter)->ArgName("engine")->Arg(0)->Arg(1);
+BENCHMARK(BM_TpchReturnedItemsSort)->ArgName("engine")->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace mongo
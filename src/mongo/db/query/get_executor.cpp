@@ -562,6 +562,22 @@ public:
             solutions[0]->indexFilterApplied = _plannerParams->indexFiltersApplied;
             return buildSingleSolutionPlan(std::move(solutions[0]));
         }
+
+        // A point lookup on a unique index returns at most one document, so trialing the other
+        // candidates against it cannot pick a cheaper plan.
+        if (!_cq->getExpCtxRaw()->forcePlanCache &&
+            internalQueryPlannerSkipMultiplanningForUniquePointLookups.load()) {
+            for (auto& solution : solutions) {
+                if (QueryPlannerCommon::isUniqueIndexPointLookup(solution->root())) {
+                    LOGV2_DEBUG(9603200,
+                                2,
+                                "Skipping multiplanning for unique index point lookup",
+                                "query"_attr = redact(_queryStringForDebugLog));
+                    solution->indexFilterApplied = _plannerParams->indexFiltersApplied;
+                    return buildSingleSolutionPlan(std::move(solution));
+                }
+            }
+        }
         return buildMultiPlan(std::move(solutions));
     }
 
@@ -226,10 +226,9 @@ public:
         KVListIt found = i->second;
 
         // Promote the kv-store entry to the front of the list. It is now the most recently used.
-        const auto& newEntry = _kvList.emplace_front(key, std::move(found->second));
-        _kvMap.erase(i);
-        _kvList.erase(found);
-        _kvMap[&newEntry.first] = _kvList.begin();
+        // Splicing relinks the existing node, so the key pointer and iterator stored in '_kvMap'
+        // stay valid and neither the key nor the value is copied.
+        _kvList.splice(_kvList.begin(), _kvList, found);
 
         return _kvList.begin();
     }
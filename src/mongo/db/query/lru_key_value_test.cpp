@@ -311,6 +311,31 @@ TEST(LRUKeyValueTest, PromotionTest) {
     }
 }
 
+/**
+ * Test that promoting an entry repeatedly, including the most recently used one, leaves it
+ * addressable by key.
+ */
+TEST(LRUKeyValueTest, RepeatedPromotionTest) {
+    TestSharedPtrValue cache{3};
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(0, cache.add(i, std::make_shared<int>(i)));
+    }
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 3; ++i) {
+            assertInKVStore(cache, i, std::make_shared<int>(i));
+            assertInKVStore(cache, i, std::make_shared<int>(i));
+        }
+    }
+
+    // Key 2 was promoted last, so key 0 is the least recently used.
+    ASSERT_EQ(1, cache.add(3, std::make_shared<int>(3)));
+    assertNotInKVStore(cache, 0);
+    ASSERT_TRUE(cache.erase(2));
+    assertNotInKVStore(cache, 2);
+    assertInKVStore(cache, 1, std::make_shared<int>(1));
+}
+
 /**
  * Test that calling add() with a key that already exists
  * in the kv-store deletes the existing entry.
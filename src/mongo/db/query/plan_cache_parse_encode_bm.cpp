@@ -82,6 +82,45 @@ public:
     }
 };
 
+/**
+ * Benchmarks only the encoding of an already parsed CanonicalQuery to SBE PlanCacheKey. The
+ * difference from CanonicalQueryParseAndEncodeSBE is the cost of parsing and normalization, which
+ * is an upper bound on what caching parsed queries by shape could save.
+ */
+class CanonicalQueryEncodeSBE : public BonsaiQueryBenchmarkFixture {
+public:
+    CanonicalQueryEncodeSBE() {}
+
+    void benchmarkPipeline(benchmark::State& state, const std::vector<BSONObj>& pipeline) final {
+        state.SkipWithError("CanonicalQuery encoding fixture cannot encode a pipeline.");
+        return;
+    }
+
+    void benchmarkQueryMatchProject(benchmark::State& state,
+                                    BSONObj matchSpec,
+                                    BSONObj projectSpec) final {
+        QueryTestServiceContext testServiceContext;
+        auto opCtx = testServiceContext.makeOperationContext();
+        auto nss = NamespaceString::createNamespaceString_forTest("test.bm");
+
+        auto findCommand = std::make_unique<FindCommandRequest>(nss);
+        findCommand->setFilter(matchSpec);
+        findCommand->setProjection(projectSpec);
+        auto cq = std::make_unique<CanonicalQuery>(CanonicalQueryParams{
+            .expCtx = makeExpressionContext(opCtx.get(), *findCommand),
+            .parsedFind = ParsedFindCommandParams{std::move(findCommand)}});
+        cq->setSbeCompatible(true);
+
+        // This is where recording starts.
+        for (auto keepRunning : state) {
+            benchmark::DoNotOptimize(canonical_query_encoder::encodeSBE(
+                *cq, canonical_query_encoder::Optimizer::kBonsai));
+            benchmark::ClobberMemory();
+        }
+    }
+};
+
 BENCHMARK_QUERY_ENCODING(CanonicalQueryParseAndEncodeSBE);
+BENCHMARK_QUERY_ENCODING(CanonicalQueryEncodeSBE);
 }  // namespace
 }  // namespace mongo::optimizer
@@ -488,7 +488,8 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutor(
     std::unique_ptr<CanonicalQuery> cq,
     typename IteratorChoice::CollectionTypeChoice coll,
     boost::optional<ScopedCollectionFilter> collectionFilter,
-    bool returnOwnedBson) {
+    bool returnOwnedBson,
+    FastPathQueryCounters::ExpressPath path) {
     using ShardFilterForRead = std::variant<express::NoShardFilter, ScopedCollectionFilter>;
 
     ShardFilterForRead shardFilter = express::NoShardFilter();
@@ -502,7 +503,7 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutor(
         projection = cq->getProj();
     }
 
-    fastPathQueryCounters.incrementExpressQueryCounter();
+    fastPathQueryCounters.incrementExpressQueryCounter(path);
 
     return std::visit(
         [&](auto& chosenShardFilter,
@@ -541,7 +542,8 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
                 std::move(cq),
                 collectionAlternative,
                 std::move(collectionFilter),
-                returnOwnedBson);
+                returnOwnedBson,
+                FastPathQueryCounters::ExpressPath::kIdLookup);
         },
         coll.get());
 }
@@ -563,7 +565,8 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
                 std::move(cq),
                 collectionAlternative,
                 std::move(collectionFilter),
-                returnOwnedBson);
+                returnOwnedBson,
+                FastPathQueryCounters::ExpressPath::kIdLookup);
         },
         coll.get());
 }
@@ -601,7 +604,8 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForFindB
                                        std::move(cq),
                                        collectionAlternative,
                                        std::move(collectionFilter),
-                                       returnOwnedBson);
+                                       returnOwnedBson,
+                                       FastPathQueryCounters::ExpressPath::kIndexedEquality);
         },
         coll.get());
 }
@@ -666,7 +670,7 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForUpdat
         }
     }();
 
-    fastPathQueryCounters.incrementExpressQueryCounter();
+    fastPathQueryCounters.incrementExpressQueryCounter(FastPathQueryCounters::ExpressPath::kUpdate);
     auto recoveryPolicy = getExpressRecoveryPolicy(opCtx, parsedUpdate->yieldPolicy());
 
     return std::visit(
@@ -728,7 +732,7 @@ std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> makeExpressExecutorForDelet
         }
     }();
 
-    fastPathQueryCounters.incrementExpressQueryCounter();
+    fastPathQueryCounters.incrementExpressQueryCounter(FastPathQueryCounters::ExpressPath::kDelete);
     auto recoveryPolicy = getExpressRecoveryPolicy(opCtx, parsedDelete->yieldPolicy());
 
     return std::visit(
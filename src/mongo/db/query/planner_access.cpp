@@ -310,6 +310,88 @@ bool affectedByCollator(const BSONElement& element) {
     }
 }
 
+// Builds the bounds of a whole index scan from the top-level equality predicates of the query,
+// using all values for the index fields without one. A point on a field after an unbounded one
+// makes the IndexBoundsChecker seek past each distinct prefix instead of examining every key, i.e.
+// a skip scan. The caller still applies the whole query as a filter, so the bounds only need to
+// contain every match. Returns false without touching 'isn' if no index field has an equality.
+bool buildSkipScanBounds(const IndexEntry& index, const CanonicalQuery& query, IndexScanNode* isn) {
+    if (INDEX_BTREE != index.type || index.multikey) {
+        return false;
+    }
+
+    // Bounds on strings are built with the index collation, so an equality on a string only
+    // bounds the scan when the query uses the same collation. Otherwise its field scans all values.
+    const bool collatorsMatch =
+        CollatorInterface::collatorsMatch(query.getCollator(), index.collator);
+    auto usableEquality = [collatorsMatch](const MatchExpression* expr) {
+        return MatchExpression::EQ == expr->matchType() &&
+            (collatorsMatch ||
+             !affectedByCollator(
+                 static_cast<const ComparisonMatchExpressionBase*>(expr)->getData()));
+    };
+
+    const MatchExpression* root = query.getPrimaryMatchExpression();
+    auto findEquality = [root, &usableEquality](StringData path) -> const MatchExpression* {
+        if (MatchExpression::EQ == root->matchType()) {
+            return root->path() == path && usableEquality(root) ? root : nullptr;
+        }
+        if (MatchExpression::AND != root->matchType()) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < root->numChildren(); ++i) {
+            const MatchExpression* child = root->getChild(i);
+            if (child->path() == path && usableEquality(child)) {
+                return child;
+            }
+        }
+        return nullptr;
+    };
+
+    const size_t nFields = index.keyPattern.nFields();
+    IndexBounds bounds;
+    bounds.fields.resize(nFields);
+    std::vector<interval_evaluation_tree::Builder> ietBuilders(query.isParameterized() ? nFields
+                                                                                       : 0);
+    bool hasEquality = false;
+    size_t pos = 0;
+    for (auto&& keyElt : index.keyPattern) {
+        auto& oil = bounds.fields[pos];
+        if (auto expr = findEquality(keyElt.fieldNameStringData())) {
+            IndexBoundsBuilder::BoundsTightness tightness;
+            IndexBoundsBuilder::translate(expr,
+                                          keyElt,
+                                          index,
+                                          &oil,
+                                          &tightness,
+                                          ietBuilders.empty() ? nullptr : &ietBuilders[pos]);
+            oil.name = keyElt.fieldName();
+            hasEquality = true;
+        } else {
+            IndexBoundsBuilder::allValuesForField(keyElt, &oil);
+        }
+        ++pos;
+    }
+    if (!hasEquality) {
+        return false;
+    }
+
+    // Like finishLeafNode(), build the IETs from the unaligned bounds so that a cached SBE plan
+    // can rebind the equality values.
+    for (size_t i = 0; i < ietBuilders.size(); ++i) {
+        if (auto iet = ietBuilders[i].done()) {
+            isn->iets.push_back(std::move(*iet));
+        } else {
+            isn->iets.push_back(
+                interval_evaluation_tree::IET::make<interval_evaluation_tree::ConstNode>(
+                    bounds.fields[i]));
+        }
+    }
+    IndexBoundsBuilder::alignBounds(&bounds, index.keyPattern, index.collator != nullptr);
+    isn->bounds = std::move(bounds);
+    return true;
+}
+
 // Set 'curr' to 'newMin' if 'newMin' < 'curr'
 void setLowestRecord(boost::optional<RecordIdBound>& curr, const RecordIdBound& newMin) {
     if (!curr || newMin.recordId() < curr->recordId()) {
@@ -2090,7 +2172,11 @@ std::unique_ptr<QuerySolutionNode> QueryPlannerAccess::scanWholeIndex(const Inde
     isn->addKeyMetadata = query.metadataDeps()[DocumentMetadataFields::kIndexKey];
     isn->queryCollator = query.getCollator();
 
-    IndexBoundsBuilder::allValuesBounds(index.keyPattern, &isn->bounds, index.collator != nullptr);
+    if (!internalQueryPlannerEnableIndexSkipScan.load() ||
+        !buildSkipScanBounds(index, query, isn.get())) {
+        IndexBoundsBuilder::allValuesBounds(
+            index.keyPattern, &isn->bounds, index.collator != nullptr);
+    }
 
     if (-1 == direction) {
         QueryPlannerCommon::reverseScans(isn.get());
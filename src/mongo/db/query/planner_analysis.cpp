@@ -70,6 +70,7 @@
 #include "mongo/db/query/optimizer/algebra/polyvalue.h"
 #include "mongo/db/query/projection.h"
 #include "mongo/db/query/query_knob_configuration.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/query/query_request_helper.h"
 #include "mongo/db/query/query_solution.h"
@@ -81,6 +82,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
 
@@ -882,6 +884,49 @@ void QueryPlannerAnalysis::removeUselessColumnScanRowStoreExpression(QuerySoluti
     }
 }
 
+// static
+void QueryPlannerAnalysis::markParallelizableCollScanBelowGroup(QuerySolutionNode& root) {
+    if (internalQuerySlotBasedExecutionParallelCollScanDOP.load() <= 1) {
+        return;
+    }
+
+    // Accumulators whose final result does not depend on the order in which the input documents
+    // are seen. Positional accumulators like $first, $last or $push are deliberately excluded, and
+    // so are $avg and $stdDev*, because floating point addition is not associative: summing the
+    // same doubles in a different order may give a different result. For the same reason $sum is
+    // only allowed over a constant (e.g. the {$sum: 1} of $count), whose partial sums are the same
+    // in any order.
+    static const StringDataSet kOrderInsensitiveAccumulators{"$min"_sd, "$max"_sd};
+    auto isOrderInsensitive = [](const AccumulationStatement& accStmt) {
+        if (accStmt.expr.name == "$sum"_sd) {
+            return dynamic_cast<ExpressionConstant*>(accStmt.expr.argument.get()) != nullptr;
+        }
+        return kOrderInsensitiveAccumulators.contains(accStmt.expr.name);
+    };
+
+    for (auto& child : root.children) {
+        if (root.getType() == STAGE_GROUP && child->getType() == STAGE_COLLSCAN) {
+            const auto& parentGroup = static_cast<const GroupNode&>(root);
+            auto childCollScan = static_cast<CollectionScanNode*>(child.get());
+
+            const bool orderInsensitive = std::all_of(parentGroup.accumulators.begin(),
+                                                      parentGroup.accumulators.end(),
+                                                      isOrderInsensitive);
+            const bool unbounded = !childCollScan->minRecord && !childCollScan->maxRecord &&
+                !childCollScan->resumeAfterRecordId;
+
+            if (orderInsensitive && unbounded && !childCollScan->isOplog &&
+                !childCollScan->tailable && !childCollScan->requestResumeToken &&
+                childCollScan->direction == CollectionScanParams::FORWARD) {
+                childCollScan->allowParallelScan = true;
+                childCollScan->markNotEligibleForPlanCache();
+            }
+        }
+        // Recur on child.
+        markParallelizableCollScanBelowGroup(*child);
+    }
+}
+
 // static
 void QueryPlannerAnalysis::removeImpreciseInternalExprFilters(const QueryPlannerParams& params,
                                                               QuerySolutionNode& root) {
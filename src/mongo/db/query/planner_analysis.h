@@ -146,6 +146,15 @@ public:
      */
     static void removeUselessColumnScanRowStoreExpression(QuerySolutionNode& root);
 
+    /**
+     * Walks the QuerySolutionNode tree rooted in 'root', and looks for an unbounded forward
+     * COLLSCAN that is a child of a Group whose accumulators do not depend on the order of their
+     * input. If 'internalQuerySlotBasedExecutionParallelCollScanDOP' is greater than 1, such scans
+     * are marked as eligible for a parallel scan in SBE. Because the resulting SBE plan cannot be
+     * safely cloned, the scan is also marked as ineligible for the plan cache.
+     */
+    static void markParallelizableCollScanBelowGroup(QuerySolutionNode& root);
+
     /**
      * Walk the solution tree, and trim out useless imprecise filters that are guaranteed to be
      * applied again by a later filter.
@@ -168,6 +177,12 @@ public:
      * - A hash join is chosen if disk use is allowed and if the foreign collection is sufficiently
      * small.
      * - A nested loop join is chosen in all other cases.
+     *
+     * The strategy is fixed when the plan is built and is not revisited during execution: the SBE
+     * plan is compiled around a single join stage, and switching from an indexed loop join to a
+     * hash join midway would require building the hash table from the whole foreign collection
+     * while keeping the local documents already joined. Collection sizes used by
+     * isEligibleForHashJoin() are read at planning time.
      */
     static Strategy determineLookupStrategy(
         const NamespaceString& foreignCollName,
@@ -2070,6 +2070,7 @@ std::unique_ptr<QuerySolution> QueryPlanner::extendWithAggPipeline(
     solution->extendWith(std::move(solnForAgg));
     solution = QueryPlannerAnalysis::removeInclusionProjectionBelowGroup(std::move(solution));
     QueryPlannerAnalysis::removeUselessColumnScanRowStoreExpression(*solution->root());
+    QueryPlannerAnalysis::markParallelizableCollScanBelowGroup(*solution->root());
 
     return std::move(solution);
 }  // QueryPlanner::extendWithAggPipeline
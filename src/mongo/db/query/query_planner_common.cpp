@@ -28,6 +28,7 @@
  */
 
 
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <boost/optional.hpp>
@@ -92,6 +93,25 @@ bool QueryPlannerCommon::scanDirectionsEqual(QuerySolutionNode* node, int direct
     return true;
 }
 
+bool QueryPlannerCommon::isUniqueIndexPointLookup(const QuerySolutionNode* root) {
+    const QuerySolutionNode* node = root;
+    while (node->children.size() == 1) {
+        node = node->children[0].get();
+    }
+    if (STAGE_IXSCAN != node->getType() || !node->children.empty()) {
+        return false;
+    }
+
+    const auto* isn = static_cast<const IndexScanNode*>(node);
+    if (!isn->index.unique || INDEX_BTREE != isn->index.type || isn->bounds.isSimpleRange ||
+        isn->bounds.fields.empty()) {
+        return false;
+    }
+    return std::all_of(isn->bounds.fields.begin(),
+                       isn->bounds.fields.end(),
+                       [](const OrderedIntervalList& oil) { return oil.isPoint(); });
+}
+
 void QueryPlannerCommon::reverseScans(QuerySolutionNode* node, bool reverseCollScans) {
     StageType type = node->getType();
 
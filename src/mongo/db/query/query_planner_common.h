@@ -117,6 +117,13 @@ public:
      */
     static void reverseScans(QuerySolutionNode* node, bool reverseCollScans = false);
 
+    /**
+     * Returns true if the tree rooted at 'root' is a chain of single-child nodes ending in an
+     * IXSCAN over a unique btree index whose bounds are a single point on every key field. Such a
+     * plan examines at most one index key, so no competing plan can do meaningfully better.
+     */
+    static bool isUniqueIndexPointLookup(const QuerySolutionNode* root);
+
     /**
      * Extracts all field names for the sortKey meta-projection and stores them in the returned
      * array. Returns an empty array if there were no sortKey meta-projection specified in the
@@ -50,6 +50,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/classic_plan_cache.h"
+#include "mongo/db/query/collation/collator_interface_mock.h"
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/index_entry.h"
 #include "mongo/db/query/index_tag.h"
@@ -59,6 +60,7 @@
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/service_context.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -406,6 +408,64 @@ TEST_F(QueryPlannerTest, HintInvalid) {
     runInvalidQueryHint(BSONObj(), fromjson("{b: 1}"));
 }
 
+TEST_F(QueryPlannerTest, HintedIndexWithTrailingEqualityScansAllValuesByDefault) {
+    addIndex(BSON("a" << 1 << "b" << 1));
+    runQueryHint(fromjson("{b: 5}"), fromjson("{a: 1, b: 1}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists(
+        "{fetch: {filter: {b: 5}, node: {ixscan: {pattern: {a: 1, b: 1}, bounds: "
+        "{a: [['MinKey','MaxKey',true,true]], b: [['MinKey','MaxKey',true,true]]}}}}}");
+}
+
+TEST_F(QueryPlannerTest, HintedIndexWithTrailingEqualityUsesSkipScanBounds) {
+    RAIIServerParameterControllerForTest controller("internalQueryPlannerEnableIndexSkipScan",
+                                                    true);
+    addIndex(BSON("a" << 1 << "b" << -1 << "c" << 1));
+    runQueryHint(fromjson("{b: 5, c: {$gt: 1}}"), fromjson("{a: 1, b: -1, c: 1}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists(
+        "{fetch: {filter: {b: 5, c: {$gt: 1}}, node: {ixscan: {pattern: {a: 1, b: -1, c: 1}, "
+        "bounds: {a: [['MinKey','MaxKey',true,true]], b: [[5,5,true,true]], "
+        "c: [['MinKey','MaxKey',true,true]]}}}}}");
+}
+
+TEST_F(QueryPlannerTest, HintedIndexSkipScanIgnoresStringEqualityWithOtherCollation) {
+    RAIIServerParameterControllerForTest controller("internalQueryPlannerEnableIndexSkipScan",
+                                                    true);
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+    addIndex(BSON("a" << 1 << "b" << 1 << "c" << 1), &collator);
+
+    // The index orders 'b' case-insensitively, so the point on 'FOO' would miss matching 'foo'
+    // keys of the simple collation. Only the numeric equality bounds the scan.
+    runQueryAsCommand(
+        fromjson("{find: 'testns', filter: {b: 'FOO', c: 5}, hint: {a: 1, b: 1, c: 1}}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists(
+        "{fetch: {filter: {b: 'FOO', c: 5}, node: {ixscan: {pattern: {a: 1, b: 1, c: 1}, "
+        "bounds: {a: [['MinKey','MaxKey',true,true]], b: [['MinKey','MaxKey',true,true]], "
+        "c: [[5,5,true,true]]}}}}}");
+}
+
+TEST_F(QueryPlannerTest, HintedIndexSkipScanUsesStringEqualityWithMatchingCollation) {
+    RAIIServerParameterControllerForTest controller("internalQueryPlannerEnableIndexSkipScan",
+                                                    true);
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
+    addIndex(BSON("a" << 1 << "b" << 1), &collator);
+
+    runQueryAsCommand(
+        fromjson("{find: 'testns', filter: {b: 'foo'}, hint: {a: 1, b: 1}, "
+                 "collation: {locale: 'reverse'}}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists(
+        "{fetch: {filter: {b: 'foo'}, collation: {locale: 'reverse'}, node: {ixscan: "
+        "{pattern: {a: 1, b: 1}, bounds: {a: [['MinKey','MaxKey',true,true]], "
+        "b: [['oof','oof',true,true]]}}}}}");
+}
+
 //
 // Test shard filter query planning
 //
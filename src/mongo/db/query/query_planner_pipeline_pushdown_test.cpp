@@ -48,6 +48,7 @@
 #include "mongo/db/query/query_planner_test_fixture.h"
 #include "mongo/db/query/query_planner_test_lib.h"
 #include "mongo/db/query/query_solution.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/stdx/type_traits.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
@@ -162,6 +163,81 @@ TEST_F(QueryPlannerPipelinePushdownTest, PushdownOfOneGroupWithMultipleAccumulat
         << solution->root()->toString();
 }
 
+TEST_F(QueryPlannerPipelinePushdownTest, CollScanBelowOrderInsensitiveGroupAllowsParallelScan) {
+    RAIIServerParameterControllerForTest controller(
+        "internalQuerySlotBasedExecutionParallelCollScanDOP", 4);
+    const std::vector<BSONObj> rawPipeline = {
+        fromjson("{$group: {_id: '$a', count: {$sum: 1}, m: {$max: '$y'}, n: {$min: '$y'}}}"),
+    };
+    auto pipeline = buildTestPipeline(rawPipeline);
+
+    runQueryWithPipeline(fromjson("{x: {$gt: 1}}"), makeInnerPipelineStages(*pipeline.get()));
+    ASSERT_EQUALS(getNumSolutions(), 1U);
+
+    auto solution =
+        QueryPlanner::extendWithAggPipeline(*cq, std::move(solns[0]), {} /* secondaryCollInfos */);
+    ASSERT_EQ(solution->root()->getType(), STAGE_GROUP);
+    auto collScan = static_cast<const CollectionScanNode*>(solution->root()->children[0].get());
+    ASSERT_EQ(collScan->getType(), STAGE_COLLSCAN);
+    ASSERT_TRUE(collScan->allowParallelScan);
+    ASSERT_FALSE(solution->isEligibleForPlanCache());
+}
+
+TEST_F(QueryPlannerPipelinePushdownTest, CollScanBelowOrderSensitiveGroupDisallowsParallelScan) {
+    RAIIServerParameterControllerForTest controller(
+        "internalQuerySlotBasedExecutionParallelCollScanDOP", 4);
+    const std::vector<BSONObj> rawPipeline = {
+        fromjson("{$group: {_id: '$a', total: {$sum: '$x'}, f: {$first: '$y'}}}"),
+    };
+    auto pipeline = buildTestPipeline(rawPipeline);
+
+    runQueryWithPipeline(fromjson("{x: {$gt: 1}}"), makeInnerPipelineStages(*pipeline.get()));
+    ASSERT_EQUALS(getNumSolutions(), 1U);
+
+    auto solution =
+        QueryPlanner::extendWithAggPipeline(*cq, std::move(solns[0]), {} /* secondaryCollInfos */);
+    auto collScan = static_cast<const CollectionScanNode*>(solution->root()->children[0].get());
+    ASSERT_EQ(collScan->getType(), STAGE_COLLSCAN);
+    ASSERT_FALSE(collScan->allowParallelScan);
+    ASSERT_TRUE(solution->isEligibleForPlanCache());
+}
+
+TEST_F(QueryPlannerPipelinePushdownTest, CollScanBelowFloatingPointSumDisallowsParallelScan) {
+    RAIIServerParameterControllerForTest controller(
+        "internalQuerySlotBasedExecutionParallelCollScanDOP", 4);
+    // The result of summing doubles depends on the order of the input, so only sums of a constant
+    // are computed over a parallel scan.
+    const std::vector<BSONObj> rawPipeline = {
+        fromjson("{$group: {_id: '$a', total: {$sum: '$x'}, m: {$max: '$y'}}}"),
+    };
+    auto pipeline = buildTestPipeline(rawPipeline);
+
+    runQueryWithPipeline(fromjson("{x: {$gt: 1}}"), makeInnerPipelineStages(*pipeline.get()));
+    ASSERT_EQUALS(getNumSolutions(), 1U);
+
+    auto solution =
+        QueryPlanner::extendWithAggPipeline(*cq, std::move(solns[0]), {} /* secondaryCollInfos */);
+    auto collScan = static_cast<const CollectionScanNode*>(solution->root()->children[0].get());
+    ASSERT_EQ(collScan->getType(), STAGE_COLLSCAN);
+    ASSERT_FALSE(collScan->allowParallelScan);
+}
+
+TEST_F(QueryPlannerPipelinePushdownTest, ParallelScanIsDisabledByDefault) {
+    const std::vector<BSONObj> rawPipeline = {
+        fromjson("{$group: {_id: '$a', total: {$sum: '$x'}}}"),
+    };
+    auto pipeline = buildTestPipeline(rawPipeline);
+
+    runQueryWithPipeline(fromjson("{x: {$gt: 1}}"), makeInnerPipelineStages(*pipeline.get()));
+    ASSERT_EQUALS(getNumSolutions(), 1U);
+
+    auto solution =
+        QueryPlanner::extendWithAggPipeline(*cq, std::move(solns[0]), {} /* secondaryCollInfos */);
+    auto collScan = static_cast<const CollectionScanNode*>(solution->root()->children[0].get());
+    ASSERT_EQ(collScan->getType(), STAGE_COLLSCAN);
+    ASSERT_FALSE(collScan->allowParallelScan);
+}
+
 TEST_F(QueryPlannerPipelinePushdownTest, PushdownOfASingleLookup) {
     const std::vector<BSONObj> rawPipeline = {
         fromjson("{$lookup: {from: '" + kSecondaryNamespace.coll().toString() +
@@ -444,6 +444,8 @@ std::unique_ptr<QuerySolutionNode> CollectionScanNode::clone() const {
     copy->clusteredIndex = this->clusteredIndex;
     copy->hasCompatibleCollation = this->hasCompatibleCollation;
     copy->lowPriority = this->lowPriority;
+    copy->allowParallelScan = this->allowParallelScan;
+    copy->eligibleForPlanCache = this->eligibleForPlanCache;
     return copy;
 }
 
@@ -785,6 +787,10 @@ FieldAvailability IndexScanNode::getFieldAvailability(const string& field) const
         }
     }
 
+    // Multikeyness is checked per key pattern component below, so the non-multikey fields of a
+    // multikey compound index can still be covered. An expanded $** index entry has a single
+    // concrete wildcard path, since each wildcard key holds only one path, so at most one
+    // wildcard-indexed field can be provided by a given scan.
     size_t keyPatternFieldIndex = 0;
     for (auto&& elt : index.keyPattern) {
         // For $** indexes, the keyPattern is prefixed by a virtual field, '$_path'. We therefore
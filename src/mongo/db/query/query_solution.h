@@ -641,6 +641,10 @@ struct CollectionScanNode : public QuerySolutionNodeWithSortSet {
 
     // Whether the collection scan should have low storage admission priority.
     bool lowPriority = false;
+
+    // Set when the consumer of this scan does not depend on the order of its input (for example an
+    // order-insensitive $group). SBE may then split the scan across parallel producers.
+    bool allowParallelScan = false;
 };
 
 struct ColumnIndexScanNode : public QuerySolutionNode {
@@ -55,6 +55,7 @@
 #include "mongo/db/query/planner_wildcard_helpers.h"
 #include "mongo/db/query/projection_parser.h"
 #include "mongo/db/query/projection_policies.h"
+#include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/query/query_test_service_context.h"
 #include "mongo/db/query/wildcard_test_utils.h"
@@ -1950,4 +1951,39 @@ TEST(QuerySolutionTest, ShouldCacheEofPlanTree) {
 
     ASSERT_TRUE(solution2->isEligibleForPlanCache());
 }
+
+std::unique_ptr<IndexScanNode> makeUniqueIndexScan(const BSONObj& kp, std::vector<BSONObj> points) {
+    auto entry = buildSimpleIndexEntry(kp);
+    entry.unique = true;
+    auto node = std::make_unique<IndexScanNode>(entry);
+    for (auto&& point : points) {
+        OrderedIntervalList oil{};
+        oil.intervals.push_back(IndexBoundsBuilder::makePointInterval(point));
+        node->bounds.fields.push_back(oil);
+    }
+    return node;
+}
+
+TEST(QuerySolutionTest, FetchOfPointOnUniqueIndexIsUniquePointLookup) {
+    auto ixscan =
+        makeUniqueIndexScan(BSON("a" << 1 << "b" << 1), {BSON("" << 1), BSON("" << "x")});
+    FetchNode fetch{std::move(ixscan)};
+    ASSERT_TRUE(QueryPlannerCommon::isUniqueIndexPointLookup(&fetch));
+}
+
+TEST(QuerySolutionTest, RangeOrNonUniqueIndexIsNotUniquePointLookup) {
+    auto nonUnique = makeUniqueIndexScan(BSON("a" << 1), {BSON("" << 1)});
+    nonUnique->index.unique = false;
+    ASSERT_FALSE(QueryPlannerCommon::isUniqueIndexPointLookup(nonUnique.get()));
+
+    auto range = makeUniqueIndexScan(BSON("a" << 1), {});
+    OrderedIntervalList oil{};
+    oil.intervals.push_back(IndexBoundsBuilder::makeRangeInterval(
+        BSON("" << 1 << "" << 2), BoundInclusion::kIncludeBothStartAndEndKeys));
+    range->bounds.fields.push_back(oil);
+    ASSERT_FALSE(QueryPlannerCommon::isUniqueIndexPointLookup(range.get()));
+
+    ASSERT_FALSE(QueryPlannerCommon::isUniqueIndexPointLookup(
+        std::make_unique<CollectionScanNode>().get()));
+}
 }  // namespace
@@ -89,6 +89,10 @@ struct PlanCacheKeyCollectionState {
         return hash;
     }
 
+    // Entries are deliberately not shared between collections, even ones with identical indexes.
+    // The compiled sbe::PlanStage tree binds the collection UUID into its scan stages at build
+    // time, and bind_input_params.cpp only rebinds query parameters, not the collection. The
+    // version below is also only meaningful relative to this UUID.
     UUID uuid;
 
     // There is a special collection versioning scheme associated with the SBE plan cache. Whenever
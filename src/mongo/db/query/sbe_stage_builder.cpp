@@ -966,7 +966,8 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
                                              csn,
                                              std::move(fields),
                                              _yieldPolicy,
-                                             reqs.getIsTailableCollScanResumeBranch());
+                                             reqs.getIsTailableCollScanResumeBranch(),
+                                             reqs.hasResultObj());
 
     if (reqs.has(kReturnKey)) {
         // Assign the 'returnKeySlot' to be the empty object.
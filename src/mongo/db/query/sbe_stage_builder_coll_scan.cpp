@@ -45,6 +45,7 @@
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/expressions/runtime_environment.h"
 #include "mongo/db/exec/sbe/stages/co_scan.h"
+#include "mongo/db/exec/sbe/stages/exchange.h"
 #include "mongo/db/exec/sbe/stages/filter.h"
 #include "mongo/db/exec/sbe/stages/limit_skip.h"
 #include "mongo/db/exec/sbe/stages/loop_join.h"
@@ -57,12 +58,16 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/dependencies.h"
+#include "mongo/db/query/plan_yield_policy_sbe.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/record_id_bound.h"
 #include "mongo/db/query/sbe_stage_builder.h"
 #include "mongo/db/query/sbe_stage_builder_coll_scan.h"
 #include "mongo/db/query/sbe_stage_builder_filter.h"
+#include "mongo/db/query/yield_policy_callbacks_impl.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/repl/optime.h"
+#include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/transaction_resources.h"
@@ -388,6 +393,157 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateClusteredColl
     return {std::move(stage), std::move(outputs)};
 }  // generateClusteredCollScan
 
+/**
+ * Returns the number of parallel producers to use for the collection scan described by 'csn', or 1
+ * if the scan must be executed serially. The planner has already established that the consumer of
+ * the scan does not depend on its order (see 'CollectionScanNode::allowParallelScan'). Here we
+ * additionally verify that the scan can be performed by producers which each read from their own
+ * storage snapshot, which is only acceptable for plain "local" reads outside of transactions.
+ */
+size_t getParallelCollScanDOP(StageBuilderState& state,
+                              const CollectionPtr& collection,
+                              const CollectionScanNode* csn,
+                              bool isResumingTailableScan) {
+    const auto dop = internalQuerySlotBasedExecutionParallelCollScanDOP.load();
+    if (dop <= 1 || !csn->allowParallelScan || isResumingTailableScan ||
+        csn->shouldTrackLatestOplogTimestamp || csn->shouldWaitForOplogVisibility ||
+        collection->ns().isOplog()) {
+        return 1;
+    }
+
+    if (state.opCtx->inMultiDocumentTransaction()) {
+        return 1;
+    }
+
+    const auto& readConcernArgs = repl::ReadConcernArgs::get(state.opCtx);
+    if (readConcernArgs.getLevel() != repl::ReadConcernLevel::kLocalReadConcern ||
+        readConcernArgs.getArgsAfterClusterTime() || readConcernArgs.getArgsAtClusterTime()) {
+        return 1;
+    }
+
+    return static_cast<size_t>(dop);
+}
+
+/**
+ * Generates a collection scan sub-tree which splits the collection into RecordId ranges that are
+ * read by 'dop' producer threads:
+ *
+ *     exchange [resultSlot?, recordIdSlot, fieldSlots...] dop round
+ *         filter {<csn->filter>}
+ *         pscan resultSlot recordIdSlot [fieldSlots...]
+ *
+ * The filter is evaluated by the producers so that only matching rows cross the exchange. The
+ * materialized document is only passed through the exchange if 'resultObjRequired' is true. Rows
+ * are returned in no particular order.
+ */
+std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateParallelCollScan(
+    StageBuilderState& state,
+    const CollectionPtr& collection,
+    const CollectionScanNode* csn,
+    std::vector<std::string> fields,
+    PlanYieldPolicy* yieldPolicy,
+    size_t dop,
+    bool resultObjRequired) {
+    invariant(csn->direction == CollectionScanParams::FORWARD);
+    invariant(!csn->resumeAfterRecordId && !csn->tailable);
+
+    if (csn->filter) {
+        DepsTracker deps;
+        match_expression::addDependencies(csn->filter.get(), &deps);
+        if (!deps.needWholeDocument) {
+            auto topLevelFields = getTopLevelFields(deps.fields);
+            fields = appendVectorUnique(std::move(fields), std::move(topLevelFields));
+        }
+    }
+
+    auto fieldSlots = state.slotIdGenerator->generateMultiple(fields.size());
+    auto resultSlot = state.slotId();
+    auto recordIdSlot = state.slotId();
+
+    // The producers run on their own threads and child operation contexts, so they do not
+    // participate in trial run tracking. The scan is given this operation's yield policy only to
+    // enable yielding; every producer replaces it with a policy for its own operation.
+    std::unique_ptr<sbe::PlanStage> stage =
+        sbe::makeS<sbe::ParallelScanStage>(collection->uuid(),
+                                           resultSlot,
+                                           recordIdSlot,
+                                           boost::none /* snapshotIdSlot */,
+                                           boost::none /* indexIdentSlot */,
+                                           boost::none /* indexKeySlot */,
+                                           boost::none /* keyPatternSlot */,
+                                           fields,
+                                           fieldSlots,
+                                           yieldPolicy,
+                                           csn->nodeId(),
+                                           sbe::ScanCallbacks{},
+                                           false /* participateInTrialRunTracking */);
+
+    PlanStageSlots outputs;
+    outputs.setResultObj(resultSlot);
+    outputs.set(PlanStageSlots::kRecordId, recordIdSlot);
+    for (size_t i = 0; i < fields.size(); ++i) {
+        outputs.set(std::make_pair(PlanStageSlots::kField, fields[i]), fieldSlots[i]);
+    }
+
+    if (csn->filter) {
+        auto filterExpr = generateFilter(
+            state, csn->filter.get(), SbSlot{resultSlot, TypeSignature::kAnyScalarType}, outputs);
+        if (!filterExpr.isNull()) {
+            stage = sbe::makeS<sbe::FilterStage<false>>(std::move(stage),
+                                                        filterExpr.extractExpr(state),
+                                                        csn->nodeId(),
+                                                        false /* participateInTrialRunTracking */);
+        }
+    }
+
+    sbe::value::SlotVector exchangeSlots;
+    if (resultObjRequired) {
+        exchangeSlots.push_back(resultSlot);
+    }
+    exchangeSlots.push_back(recordIdSlot);
+    exchangeSlots.insert(exchangeSlots.end(), fieldSlots.begin(), fieldSlots.end());
+
+    auto exchange = std::make_unique<sbe::ExchangeConsumer>(std::move(stage),
+                                                            dop,
+                                                            std::move(exchangeSlots),
+                                                            sbe::ExchangePolicy::roundrobin,
+                                                            nullptr /* partition */,
+                                                            nullptr /* orderLess */,
+                                                            csn->nodeId());
+    // The producers acquire the collection themselves, since the locks held by this operation are
+    // released whenever it yields.
+    exchange->setProducerCollection(collection->ns(), collection->uuid());
+    if (yieldPolicy) {
+        exchange->setProducerYieldPolicyFactory(
+            [policy = yieldPolicy->getPolicy(), nss = collection->ns()](OperationContext* opCtx,
+                                                                       sbe::PlanStage* plan) {
+                auto producerYieldPolicy =
+                    PlanYieldPolicySBE::make(opCtx,
+                                             policy,
+                                             opCtx->getServiceContext()->getFastClockSource(),
+                                             internalQueryExecYieldIterations.load(),
+                                             Milliseconds{internalQueryExecYieldPeriodMS.load()},
+                                             PlanYieldPolicy::YieldThroughAcquisitions{},
+                                             std::make_unique<YieldPolicyCallbacksImpl>(nss));
+                producerYieldPolicy->registerPlan(plan);
+                return std::unique_ptr<PlanYieldPolicy>(std::move(producerYieldPolicy));
+            });
+    }
+    stage = std::move(exchange);
+
+    // Only the slots which cross the exchange are visible to the parent stages.
+    PlanStageSlots exchangeOutputs;
+    if (resultObjRequired) {
+        exchangeOutputs.setResultObj(resultSlot);
+    }
+    exchangeOutputs.set(PlanStageSlots::kRecordId, recordIdSlot);
+    for (size_t i = 0; i < fields.size(); ++i) {
+        exchangeOutputs.set(std::make_pair(PlanStageSlots::kField, fields[i]), fieldSlots[i]);
+    }
+
+    return {std::move(stage), std::move(exchangeOutputs)};
+}  // generateParallelCollScan
+
 /**
  * Generates a generic collection scan sub-tree.
  *  - If a resume token has been provided, the scan will start from a RecordId contained within this
@@ -505,11 +661,16 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateCollScan(
     const CollectionScanNode* csn,
     std::vector<std::string> fields,
     PlanYieldPolicy* yieldPolicy,
-    bool isResumingTailableScan) {
+    bool isResumingTailableScan,
+    bool resultObjRequired) {
 
     if (csn->doClusteredCollectionScanSbe()) {
         return generateClusteredCollScan(
             state, collection, csn, std::move(fields), yieldPolicy, isResumingTailableScan);
+    } else if (auto dop = getParallelCollScanDOP(state, collection, csn, isResumingTailableScan);
+               dop > 1) {
+        return generateParallelCollScan(
+            state, collection, csn, std::move(fields), yieldPolicy, dop, resultObjRequired);
     } else {
         return generateGenericCollScan(
             state, collection, csn, std::move(fields), yieldPolicy, isResumingTailableScan);
@@ -60,6 +60,10 @@ class PlanStageSlots;
  *     requested to track this data or that are clustered scans ("ts" is the oplog clustering key).
  *   * A generated PlanStage sub-tree.
  *
+ * If 'csn' allows a parallel scan and 'internalQuerySlotBasedExecutionParallelCollScanDOP' is
+ * greater than 1, the scan may be split across parallel producers feeding an exchange. In that case
+ * the result slot is only provided when 'resultObjRequired' is true.
+ *
  * In cases of an error, throws.
  */
 std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateCollScan(
@@ -68,6 +72,7 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateCollScan(
     const CollectionScanNode* csn,
     std::vector<std::string> scanFieldNames,
     PlanYieldPolicy* yieldPolicy,
-    bool isResumingTailableScan);
+    bool isResumingTailableScan,
+    bool resultObjRequired);
 
 }  // namespace mongo::stage_builder
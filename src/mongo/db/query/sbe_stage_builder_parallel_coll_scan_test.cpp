@@ -0,0 +1,199 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * This file contains tests for executing parallel collection scans, which split a collection
+ * scan across producer threads connected to the consumer by an exchange.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/catalog/collection_write_path.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/exec/sbe/expressions/compile_ctx.h"
+#include "mongo/db/exec/sbe/stages/stages.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/query/multiple_collection_accessor.h"
+#include "mongo/db/query/query_solution.h"
+#include "mongo/db/query/sbe_stage_builder.h"
+#include "mongo/db/query/sbe_stage_builder_test_fixture.h"
+#include "mongo/db/repl/storage_interface.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo::sbe {
+namespace {
+
+// Enough documents for the parallel scan to split the collection into several ranges.
+constexpr int kNumDocs = 25000;
+
+class ParallelCollScanStageBuilderTest : public SbeStageBuilderTestFixture {
+public:
+    void setUp() override {
+        SbeStageBuilderTestFixture::setUp();
+
+        ASSERT_OK(
+            storageInterface()->createCollection(operationContext(), _nss, CollectionOptions()));
+
+        std::vector<InsertStatement> inserts;
+        inserts.reserve(kNumDocs);
+        for (int i = 0; i < kNumDocs; ++i) {
+            inserts.emplace_back(BSON("_id" << i << "a" << i % 7));
+        }
+
+        AutoGetCollection agc(operationContext(), _nss, LockMode::MODE_IX);
+        WriteUnitOfWork wuow{operationContext()};
+        ASSERT_OK(collection_internal::insertDocuments(
+            operationContext(), *agc, inserts.begin(), inserts.end(), nullptr /* opDebug */));
+        wuow.commit();
+    }
+
+    struct CompiledTree {
+        std::unique_ptr<PlanStage> stage;
+        stage_builder::PlanStageData data;
+        std::unique_ptr<CompileCtx> ctx;
+        value::SlotAccessor* resultSlotAccessor;
+    };
+
+    // Builds and opens a parallel scan of the test collection.
+    CompiledTree buildParallelScanTree(MultipleCollectionAccessor& colls) {
+        auto scanNode = std::make_unique<CollectionScanNode>();
+        scanNode->nss = _nss;
+        scanNode->allowParallelScan = true;
+
+        auto [resultSlots, stage, data, _] =
+            buildPlanStage(makeQuerySolution(std::move(scanNode)),
+                           colls,
+                           false /*hasRecordId*/,
+                           nullptr /*shard filterer*/,
+                           nullptr /*collator*/);
+
+        auto ctx = makeCompileCtx();
+        prepareTree(ctx.get(), stage.get());
+        auto accessor = stage->getAccessor(*ctx, *data.staticData->resultSlot);
+        return CompiledTree{std::move(stage), std::move(data), std::move(ctx), accessor};
+    }
+
+private:
+    RAIIServerParameterControllerForTest _dop{"internalQuerySlotBasedExecutionParallelCollScanDOP",
+                                              4};
+};
+
+TEST_F(ParallelCollScanStageBuilderTest, ReturnsEveryDocumentOnce) {
+    AutoGetCollection coll(operationContext(), _nss, LockMode::MODE_IS);
+    MultipleCollectionAccessor colls(operationContext(),
+                                     &coll.getCollection(),
+                                     _nss,
+                                     false /* isAnySecondaryNamespaceAViewOrNotFullyLocal */,
+                                     {});
+    auto tree = buildParallelScanTree(colls);
+    ASSERT(dynamic_cast<ExchangeConsumer*>(tree.stage.get()));
+
+    std::vector<int> seen(kNumDocs, 0);
+    size_t count = 0;
+    while (tree.stage->getNext() == PlanState::ADVANCED) {
+        auto [tag, val] = tree.resultSlotAccessor->getViewOfValue();
+        ASSERT_EQ(tag, value::TypeTags::bsonObject);
+        BSONObj doc(value::bitcastTo<const char*>(val));
+        auto id = doc["_id"].numberInt();
+        ASSERT_GTE(id, 0);
+        ASSERT_LT(id, kNumDocs);
+        ++seen[id];
+        ++count;
+    }
+    tree.stage->close();
+
+    ASSERT_EQ(count, static_cast<size_t>(kNumDocs));
+    for (int i = 0; i < kNumDocs; ++i) {
+        ASSERT_EQ(seen[i], 1) << "_id: " << i;
+    }
+}
+
+TEST_F(ParallelCollScanStageBuilderTest, StopsProducersWhenKilled) {
+    AutoGetCollection coll(operationContext(), _nss, LockMode::MODE_IS);
+    MultipleCollectionAccessor colls(operationContext(),
+                                     &coll.getCollection(),
+                                     _nss,
+                                     false /* isAnySecondaryNamespaceAViewOrNotFullyLocal */,
+                                     {});
+    auto tree = buildParallelScanTree(colls);
+    ASSERT_EQ(tree.stage->getNext(), PlanState::ADVANCED);
+
+    {
+        ClientLock lk(operationContext()->getClient());
+        getServiceContext()->killOperation(lk, operationContext(), ErrorCodes::Interrupted);
+    }
+    ASSERT_THROWS_CODE(
+        [&] {
+            while (tree.stage->getNext() == PlanState::ADVANCED) {
+            }
+        }(),
+        DBException,
+        ErrorCodes::Interrupted);
+
+    // Closing must wait for the producers, which observe the kill, and must not report their
+    // interruption errors.
+    tree.stage->close();
+}
+
+TEST_F(ParallelCollScanStageBuilderTest, ProducersInheritDeadline) {
+    AutoGetCollection coll(operationContext(), _nss, LockMode::MODE_IS);
+    MultipleCollectionAccessor colls(operationContext(),
+                                     &coll.getCollection(),
+                                     _nss,
+                                     false /* isAnySecondaryNamespaceAViewOrNotFullyLocal */,
+                                     {});
+    operationContext()->setDeadlineByDate(Date_t::now() + Milliseconds(1),
+                                          ErrorCodes::MaxTimeMSExpired);
+    auto tree = buildParallelScanTree(colls);
+    sleepmillis(10);
+
+    ASSERT_THROWS_CODE(
+        [&] {
+            while (tree.stage->getNext() == PlanState::ADVANCED) {
+            }
+        }(),
+        DBException,
+        ErrorCodes::MaxTimeMSExpired);
+    tree.stage->close();
+}
+
+}  // namespace
+}  // namespace mongo::sbe
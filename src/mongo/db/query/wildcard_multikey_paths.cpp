@@ -356,6 +356,14 @@ std::set<FieldRef> getWildcardMultikeyPathSet(OperationContext* opCtx,
                                               MultikeyMetadataAccessStats* stats) {
     tassert(7354610, "stats must be non-null", stats);
 
+    // With no fields to look up the bounds would be empty, so avoid opening a cursor at all. This
+    // is common for queries whose predicates are all on paths excluded from the wildcard index.
+    if (fieldSet.empty()) {
+        stats->numSeeks = 0;
+        stats->keysExamined = 0;
+        return {};
+    }
+
     const auto& indexBounds =
         buildMetadataKeysIndexBounds(entry->descriptor()->keyPattern(), fieldSet);
     return getWildcardMultikeyPathSetHelper(opCtx, entry, indexBounds, stats);
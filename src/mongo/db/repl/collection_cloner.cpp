@@ -496,9 +496,9 @@ void CollectionCloner::handleNextBatch(DBClientCursor& cursor) {
 
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
     uassertStatusOK(cbd.status);
+    std::vector<BSONObj> docs;
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        std::vector<BSONObj> docs;
         // Increment 'fetchedBatches' even if no documents were inserted to match the number of
         // 'receivedBatches'.
         ++_stats.fetchedBatches;
@@ -511,18 +511,19 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         _stats.documentsCopied += docs.size();
         _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
         _progressMeter.hit(int(docs.size()));
-        invariant(_collLoader);
-
-        CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
-            ? ([](const BSONObj& doc) {
-                  return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
-              })
-            : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
     }
 
+    // CollectionBulkLoader is not thread safe, but this callback only runs on the serial
+    // '_dbWorkTaskRunner', so the insert doesn't need '_mutex'. Not holding it lets
+    // handleNextBatch() buffer the next batch while this one is being inserted.
+    invariant(_collLoader);
+    CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
+        ? ([](const BSONObj& doc) {
+              return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
+          })
+        : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
+
     initialSyncHangDuringCollectionClone.executeIf(
         [&](const BSONObj&) {
             LOGV2(21138,
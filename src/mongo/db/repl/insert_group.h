@@ -49,6 +49,10 @@ namespace repl {
  * as a single oplog entry.
  * Advances the the std::vector<ApplierOperation> iterator if the grouped insert is applied
  * successfully.
+ *
+ * Only inserts are grouped. Updates and deletes are applied one at a time because each one looks
+ * up its target by _id, may be an upsert or a no-op on a secondary, and may need pre- or
+ * post-images; a failure in the middle of a group would also have to be retried op by op.
  */
 class InsertGroup {
     InsertGroup(const InsertGroup&) = delete;
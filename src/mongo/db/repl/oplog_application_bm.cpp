@@ -28,9 +28,13 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string>
@@ -40,6 +44,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 
+#include "mongo/base/init.h"  // IWYU pragma: keep
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
@@ -68,6 +73,7 @@
 #include "mongo/db/op_observer/op_observer_registry.h"
 #include "mongo/db/op_observer/operation_logger_impl.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/repl/apply_ops_command_info.h"
 #include "mongo/db/repl/drop_pending_collection_reaper.h"
 #include "mongo/db/repl/member_state.h"
 #include "mongo/db/repl/oplog.h"
@@ -103,6 +109,8 @@
 #include "mongo/logv2/log_manager.h"
 #include "mongo/logv2/log_severity.h"
 #include "mongo/s/sharding_state.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/util/assert_util.h"
@@ -113,7 +121,9 @@
 #include "mongo/util/fail_point.h"
 #include "mongo/util/periodic_runner.h"
 #include "mongo/util/periodic_runner_factory.h"
+#include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 #include "mongo/util/uuid.h"
 #include "mongo/util/version/releases.h"
 
@@ -123,9 +133,17 @@ namespace {
 constexpr std::size_t kOplogBufferSize = 256 * 1024 * 1024;
 constexpr std::size_t kOplogBufferCount = std::numeric_limits<std::size_t>::max();
 
+// Path to a BSON dump of oplog entries, e.g. the output of mongodump on local.oplog.rs, replayed by
+// BM_TestRecordedOplog.
+constexpr auto kRecordedOplogEnvVar = "OPLOG_APPLICATION_BM_RECORDED_OPLOG";
+
 class TestServiceContext {
 public:
-    TestServiceContext() {
+    /**
+     * 'writerThreadCount' sizes the oplog applier's writer pool. Zero uses the
+     * replWriterThreadCount server parameter, as a secondary would.
+     */
+    explicit TestServiceContext(int writerThreadCount = 0) {
         // Disable server info logging so that the benchmark output is cleaner.
         logv2::LogManager::global().getGlobalSettings().setMinimumLoggedSeverity(
             mongo::logv2::LogComponent::kDefault, mongo::logv2::LogSeverity::Error());
@@ -217,7 +235,9 @@ public:
 
         _oplogBuffer =
             std::make_unique<repl::OplogBufferBlockingQueue>(kOplogBufferSize, kOplogBufferCount);
-        _oplogApplierThreadPool = repl::makeReplWorkerPool();
+        _oplogApplierThreadPool = writerThreadCount > 0
+            ? repl::makeReplWorkerPool(writerThreadCount)
+            : repl::makeReplWorkerPool();
 
         // Act as a secondary to get optimizations due to parallizing 'prepare' oplog entries. But
         // do not include in the benchmark the time to write to the oplog.
@@ -495,6 +515,49 @@ public:
         }
     }
 
+    /**
+     * Loads the oplog entries stored as concatenated BSON documents in the file at 'path'. The
+     * collections they write to are created on each reset(), except those the segment creates
+     * itself.
+     */
+    void loadRecordedOplog(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        uassert(
+            8700001, str::stream() << "Could not open recorded oplog file " << path, file.good());
+        const std::string data{std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+
+        stdx::unordered_set<UUID, UUID::Hash> createdInSegment;
+        std::size_t offset = 0;
+        while (offset < data.size()) {
+            uassert(8700002,
+                    str::stream() << "Truncated BSON document in recorded oplog file " << path,
+                    data.size() - offset >= 4);
+            BSONObj obj(data.data() + offset);
+            uassert(8700003,
+                    str::stream() << "Truncated BSON document in recorded oplog file " << path,
+                    obj.objsize() > 0 && std::size_t(obj.objsize()) <= data.size() - offset);
+            offset += obj.objsize();
+
+            obj = obj.getOwned();
+            _recordCollection(repl::OplogEntry(obj), createdInSegment);
+            _oplogEntries.push_back(std::move(obj));
+        }
+    }
+
+    void setBatchLimits(std::size_t ops, std::size_t bytes) {
+        _batchLimits.ops = ops;
+        _batchLimits.bytes = bytes;
+    }
+
+    const std::vector<Microseconds>& batchDurations() const {
+        return _batchDurations;
+    }
+
+    std::size_t numOplogEntries() const {
+        return _oplogEntries.size();
+    }
+
     void reset() {
         // Restart with an empty storage.
         _testSvcCtx->resetStorageEngine();
@@ -523,6 +586,13 @@ public:
                           << "value_1"
                           << "key" << BSON("value" << 1))}));
 
+            // Create the collections a recorded oplog segment writes to, with their original UUIDs.
+            // Only the _id index is built, so secondary index maintenance is not replayed.
+            for (const auto& [uuid, nss] : _recordedCollections) {
+                uassertStatusOK(createCollectionForApplyOps(
+                    opCtx, nss.dbName(), uuid, BSON("create" << nss.coll()), allowRename));
+            }
+
             // Create 'config.transactions' for transactions.
             uassertStatusOK(storageInterface->createCollection(
                 opCtx, NamespaceString::kSessionTransactionsTableNamespace, CollectionOptions()));
@@ -548,8 +618,10 @@ public:
             const auto lastOpTimeInBatch = lastOpInBatch.getOpTime();
             const auto lastWallTimeInBatch = lastOpInBatch.getWallClockTime();
 
+            Timer batchTimer;
             invariantStatusOK(
                 _testSvcCtx->getOplogApplier()->applyOplogBatch(opCtx, std::move(oplogBatch)));
+            _batchDurations.push_back(Microseconds(batchTimer.micros()));
 
             // Advance timestamps.
             _testSvcCtx->getReplCoordMock()->setMyLastAppliedOpTimeAndWallTimeForward(
@@ -562,9 +634,34 @@ public:
     }
 
 private:
+    /**
+     * Records the collection a recorded oplog entry writes to, unless the segment created it
+     * earlier. The operations nested in applyOps entries, which also hold the operations of
+     * transactions, are recorded the same way.
+     */
+    void _recordCollection(const repl::OplogEntry& entry,
+                           stdx::unordered_set<UUID, UUID::Hash>& createdInSegment) {
+        if (entry.getOpType() == repl::OpTypeEnum::kCommand &&
+            entry.getCommandType() == repl::OplogEntry::CommandType::kApplyOps) {
+            for (const auto& op : repl::ApplyOps::extractOperations(entry)) {
+                _recordCollection(op, createdInSegment);
+            }
+        } else if (entry.getOpType() == repl::OpTypeEnum::kCommand &&
+                   entry.getCommandType() == repl::OplogEntry::CommandType::kCreate &&
+                   entry.getUuid()) {
+            createdInSegment.insert(*entry.getUuid());
+        } else if (entry.isCrudOpType() && entry.getUuid() &&
+                   !createdInSegment.contains(*entry.getUuid()) &&
+                   entry.getNss() != NamespaceString::kSessionTransactionsTableNamespace) {
+            _recordedCollections.emplace(*entry.getUuid(), entry.getNss());
+        }
+    }
+
     TestServiceContext* _testSvcCtx;
 
     std::vector<BSONObj> _oplogEntries;
+    stdx::unordered_map<UUID, NamespaceString, UUID::Hash> _recordedCollections;
+    std::vector<Microseconds> _batchDurations;
     UUID _foobarUUID;
     NamespaceString _foobarNs = NamespaceString::createNamespaceString_forTest("foo.bar"_sd);
     repl::OplogApplierBatcher::BatchLimits _batchLimits{std::numeric_limits<std::size_t>::max(),
@@ -622,6 +719,37 @@ void BM_TestPrepares(benchmark::State& state) {
     runBMTest(testSvcCtx, fixture, state);
 }
 
+/**
+ * Replays the oplog segment named by the OPLOG_APPLICATION_BM_RECORDED_OPLOG environment variable.
+ *
+ * Arguments: the number of writer threads and the maximum number of operations per batch. Reports
+ * applied operations per second along with the mean and maximum time to apply one batch.
+ */
+void BM_TestRecordedOplog(benchmark::State& state) {
+    const char* path = std::getenv(kRecordedOplogEnvVar);
+    invariant(path);
+
+    TestServiceContext testSvcCtx(state.range(0));
+    Fixture fixture(&testSvcCtx);
+    fixture.loadRecordedOplog(path);
+    fixture.setBatchLimits(state.range(1), std::numeric_limits<std::size_t>::max());
+    runBMTest(testSvcCtx, fixture, state);
+
+    const auto& batchDurations = fixture.batchDurations();
+    Microseconds total{0};
+    Microseconds longest{0};
+    for (auto duration : batchDurations) {
+        total += duration;
+        longest = std::max(longest, duration);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture.numOplogEntries());
+    state.counters["batches"] =
+        benchmark::Counter(batchDurations.size(), benchmark::Counter::kAvgIterations);
+    state.counters["batch_mean_us"] =
+        batchDurations.empty() ? 0 : durationCount<Microseconds>(total) / batchDurations.size();
+    state.counters["batch_max_us"] = durationCount<Microseconds>(longest);
+}
+
 BENCHMARK(BM_TestInserts)->Arg(100 * 1000)->UseManualTime()->Unit(benchmark::kMillisecond);
 
 BENCHMARK(BM_TestApplyOps)
@@ -664,5 +792,18 @@ BENCHMARK(BM_TestPrepares)
     ->UseManualTime()
     ->Unit(benchmark::kMillisecond);
 
+// Only registered when a recorded oplog segment is given, since there is nothing to replay
+// otherwise.
+MONGO_INITIALIZER(RegisterRecordedOplogBenchmark)(InitializerContext* context) {
+    if (!std::getenv(kRecordedOplogEnvVar)) {
+        return;
+    }
+    benchmark::RegisterBenchmark("BM_TestRecordedOplog", BM_TestRecordedOplog)
+        ->ArgNames({"writers", "batchOps"})
+        ->ArgsProduct({{4, 16, 32}, {500, 5000}})
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+}
+
 }  // namespace
 }  // namespace mongo
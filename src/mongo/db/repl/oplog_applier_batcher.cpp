@@ -145,6 +145,9 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
         batchDeadline =
             opCtx->getServiceContext()->getPreciseClockSource()->now() + waitToFillBatch;
     }
+    // Evaluate the feature flag once per batch rather than taking an FCV snapshot for every entry.
+    const bool checkOplogVersion = !feature_flags::gReduceMajorityWriteLatency.isEnabled(
+        serverGlobalParams.featureCompatibility.acquireFCVSnapshot());
     while (_oplogBuffer->peek(opCtx, &op)) {
         oplogBatcherPauseAfterSuccessfulPeek.pauseWhileSet();
         auto entry = OplogEntry(op);
@@ -155,8 +158,7 @@ StatusWith<OplogApplierBatch> OplogApplierBatcher::getNextApplierBatch(
                   "oplogEntry"_attr = entry.toBSONForLogging());
         }
 
-        if (!feature_flags::gReduceMajorityWriteLatency.isEnabled(
-                serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+        if (checkOplogVersion) {
             // Check for oplog version change.
             if (entry.getVersion() != OplogEntry::kOplogVersion) {
                 static constexpr char message[] = "Unexpected oplog version";
@@ -32,6 +32,7 @@
 // IWYU pragma: no_include "cxxabi.h"
 #include <absl/container/node_hash_map.h>
 #include <absl/meta/type_traits.h>
+#include <algorithm>
 #include <boost/cstdint.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
@@ -68,6 +69,7 @@
 #include "mongo/db/repl/oplog_applier_utils.h"
 #include "mongo/db/repl/oplog_entry_gen.h"
 #include "mongo/db/repl/oplog_writer_impl.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_metrics.h"
 #include "mongo/db/repl/split_prepare_session_manager.h"
 #include "mongo/db/repl/transaction_oplog_application.h"
@@ -104,6 +106,7 @@
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplication
 
@@ -124,6 +127,9 @@ auto& oplogApplicationBatchSize = *MetricBuilder<Counter64>{"repl.apply.batchSiz
 // Number and time of each ApplyOps worker pool round
 auto& applyBatchStats = *MetricBuilder<TimerStats>("repl.apply.batches");
 
+// Time the applier spent waiting for the next batch to be ready
+auto& waitForBatchMillis = *MetricBuilder<Counter64>{"repl.apply.waitForBatchMillis"};
+
 /**
  * Used for logging a report of ops that take longer than "slowMS" to apply. This is called
  * right before returning from applyOplogEntryOrGroupedInserts, and it returns the same status.
@@ -538,7 +544,9 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
 
         // Blocks up to a second waiting for a batch to be ready to apply. If one doesn't become
         // ready in time, we'll loop again so we can do the above checks periodically.
+        Timer waitForBatchTimer;
         OplogApplierBatch ops = _oplogBatcher->getNextBatch(Seconds(1));
+        waitForBatchMillis.increment(durationCount<Milliseconds>(waitForBatchTimer.elapsed()));
         if (ops.empty()) {
             if (ops.mustShutdown()) {
                 // Shut down and exit oplog application loop.
@@ -798,7 +806,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
     std::vector<OplogEntry>* ops,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps,
-    SessionUpdateTracker* sessionUpdateTracker) noexcept {
+    SessionUpdateTracker* sessionUpdateTracker,
+    BalancedWriterAssignment* assignment) noexcept {
 
     // Caches partial transaction operations. Each map entry contains a cumulative list
     // of operations seen in this batch so far.
@@ -954,10 +963,12 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
             continue;
         }
 
-        OplogApplierUtils::addToWriterVector(opCtx, &op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(
+            opCtx, &op, writerVectors, &collPropertiesCache, boost::none, assignment);
     }
     retryImageRectifier.handleLatestDeletes([&](OplogEntry* op) {
-        OplogApplierUtils::addToWriterVector(opCtx, op, writerVectors, &collPropertiesCache);
+        OplogApplierUtils::addToWriterVector(
+            opCtx, op, writerVectors, &collPropertiesCache, boost::none, assignment);
     });
 }
 
@@ -966,14 +977,40 @@ void OplogApplierImpl::_fillWriterVectors(
     std::vector<OplogEntry>* ops,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     std::vector<std::vector<OplogEntry>>* derivedOps) noexcept {
+    // Batches of plain CRUD ops are spread by load instead of by hash, over as many writers as the
+    // size of the batch calls for. Other batches need the hash to keep the ops of a transaction or
+    // prepare consistent with the writers they were split across.
+    boost::optional<BalancedWriterAssignment> assignment;
+    if (replWriterBalancedAssignment.load() &&
+        std::all_of(ops->begin(), ops->end(), [](const OplogEntry& op) {
+            return op.isCrudOpType() || op.getOpType() == OpTypeEnum::kNoop;
+        })) {
+        auto numWriters = static_cast<uint32_t>(writerVectors->size());
+        if (auto minOpsPerWriter = replWriterMinOpsPerWriter.load(); minOpsPerWriter > 0) {
+            auto numWritersForBatch = (ops->size() + minOpsPerWriter - 1) / minOpsPerWriter;
+            numWriters = std::clamp<uint32_t>(numWritersForBatch, 1, numWriters);
+        }
+
+        CachedCollectionProperties collPropertiesCache;
+        std::vector<uint32_t> hashes;
+        hashes.reserve(ops->size());
+        for (auto& op : *ops) {
+            hashes.push_back(
+                OplogApplierUtils::getOplogEntryHash(opCtx, &op, &collPropertiesCache));
+        }
+        assignment.emplace(numWriters);
+        assignment->plan(*ops, std::move(hashes));
+    }
+
     SessionUpdateTracker sessionUpdateTracker;
-    _deriveOpsAndFillWriterVectors(opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker);
+    _deriveOpsAndFillWriterVectors(
+        opCtx, ops, writerVectors, derivedOps, &sessionUpdateTracker, assignment.get_ptr());
 
     auto newOplogWrites = sessionUpdateTracker.flushAll();
     if (!newOplogWrites.empty()) {
         derivedOps->emplace_back(std::move(newOplogWrites));
         _deriveOpsAndFillWriterVectors(
-            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr);
+            opCtx, &derivedOps->back(), writerVectors, derivedOps, nullptr, assignment.get_ptr());
     }
 }
 
@@ -122,6 +122,7 @@
 #include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/idl/idl_parser.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/unittest/assert.h"
@@ -1265,6 +1266,94 @@ TEST_F(OplogApplierImplTest,
                   secondDerivedOp.getObject()["lastWriteOpTime"]["ts"].timestamp());
 }
 
+TEST_F(OplogApplierImplTest, BalancedWriterAssignmentKeepsHotDocumentOnOneWriter) {
+    RAIIServerParameterControllerForTest balanced("replWriterBalancedAssignment", true);
+    const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test", "foo");
+    const auto uuid = UUID::gen();
+    const size_t kNumWriters = 8;
+    const int kNumHotOps = 100;
+    const int kNumColdDocs = 70;
+
+    std::vector<OplogEntry> ops;
+    for (int i = 0; i < kNumHotOps; ++i) {
+        ops.push_back(makeOplogEntry(
+            OpTypeEnum::kUpdate, nss, uuid, BSON("$set" << BSON("a" << i)), BSON("_id" << 0)));
+    }
+    for (int i = 1; i <= kNumColdDocs; ++i) {
+        ops.push_back(makeOplogEntry(OpTypeEnum::kInsert, nss, uuid, BSON("_id" << i)));
+    }
+
+    NoopOplogApplierObserver observer;
+    auto workerPool = makeReplWorkerPool();
+    OplogApplierImpl oplogApplier(
+        nullptr,  // executor
+        nullptr,  // oplogBuffer
+        &observer,
+        ReplicationCoordinator::get(_opCtx.get()),
+        getConsistencyMarkers(),
+        getStorageInterface(),
+        repl::OplogApplier::Options(repl::OplogApplication::Mode::kSecondary, false),
+        workerPool.get());
+
+    std::vector<std::vector<ApplierOperation>> writerVectors(kNumWriters);
+    std::vector<std::vector<OplogEntry>> derivedOps;
+    oplogApplier.fillWriterVectors_forTest(_opCtx.get(), &ops, &writerVectors, &derivedOps);
+
+    // The updates of the hot document all go to one writer, which gets nothing else, and the
+    // inserts are spread evenly across the remaining writers.
+    size_t numHotWriters = 0;
+    for (const auto& writer : writerVectors) {
+        ASSERT_FALSE(writer.empty());
+        if (writer.front()->getOpType() == OpTypeEnum::kUpdate) {
+            ++numHotWriters;
+            ASSERT_EQUALS(static_cast<size_t>(kNumHotOps), writer.size());
+            for (const auto& op : writer) {
+                ASSERT_EQUALS(OpTypeEnum::kUpdate, op->getOpType());
+            }
+        } else {
+            ASSERT_EQUALS(static_cast<size_t>(kNumColdDocs) / (kNumWriters - 1), writer.size());
+        }
+    }
+    ASSERT_EQUALS(1U, numHotWriters);
+}
+
+TEST_F(OplogApplierImplTest, SmallBatchesUseFewerWritersWithMinOpsPerWriter) {
+    RAIIServerParameterControllerForTest balanced("replWriterBalancedAssignment", true);
+    RAIIServerParameterControllerForTest minOps("replWriterMinOpsPerWriter", 50);
+    const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test", "foo");
+    const auto uuid = UUID::gen();
+    const size_t kNumWriters = 8;
+
+    std::vector<OplogEntry> ops;
+    for (int i = 0; i < 120; ++i) {
+        ops.push_back(makeOplogEntry(OpTypeEnum::kInsert, nss, uuid, BSON("_id" << i)));
+    }
+
+    NoopOplogApplierObserver observer;
+    auto workerPool = makeReplWorkerPool();
+    OplogApplierImpl oplogApplier(
+        nullptr,  // executor
+        nullptr,  // oplogBuffer
+        &observer,
+        ReplicationCoordinator::get(_opCtx.get()),
+        getConsistencyMarkers(),
+        getStorageInterface(),
+        repl::OplogApplier::Options(repl::OplogApplication::Mode::kSecondary, false),
+        workerPool.get());
+
+    std::vector<std::vector<ApplierOperation>> writerVectors(kNumWriters);
+    std::vector<std::vector<OplogEntry>> derivedOps;
+    oplogApplier.fillWriterVectors_forTest(_opCtx.get(), &ops, &writerVectors, &derivedOps);
+
+    // 120 ops at 50 ops per writer need three writers.
+    ASSERT_EQUALS(40U, writerVectors[0].size());
+    ASSERT_EQUALS(40U, writerVectors[1].size());
+    ASSERT_EQUALS(40U, writerVectors[2].size());
+    for (size_t i = 3; i < kNumWriters; ++i) {
+        ASSERT_TRUE(writerVectors[i].empty());
+    }
+}
+
 TEST_F(OplogApplierImplTest, applyOplogEntryOrGroupedInsertsInsertDocumentIncludesTenantId) {
     setServerParameter("multitenancySupport", true);
     setServerParameter("featureFlagRequireTenantID", true);
@@ -37,6 +37,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <set>
 #include <string>
@@ -115,6 +116,58 @@ CachedCollectionProperties::getCollectionProperties(OperationContext* opCtx,
     return collProperties;
 }
 
+BalancedWriterAssignment::BalancedWriterAssignment(uint32_t numWriters) : _load(numWriters, 0) {
+    invariant(numWriters > 0);
+}
+
+void BalancedWriterAssignment::plan(const std::vector<OplogEntry>& ops,
+                                    std::vector<uint32_t> hashes) {
+    invariant(_writerIds.empty());
+    invariant(ops.size() == hashes.size());
+    _plannedOps = ops.data();
+    _plannedHashes = std::move(hashes);
+
+    stdx::unordered_map<uint32_t, size_t> numOpsByHash;
+    for (auto hash : _plannedHashes) {
+        ++numOpsByHash[hash];
+    }
+
+    // Placing the heaviest hashes first keeps the most loaded writer close to the optimum.
+    std::vector<std::pair<size_t, uint32_t>> hashesByNumOps;
+    hashesByNumOps.reserve(numOpsByHash.size());
+    for (const auto& [hash, numOps] : numOpsByHash) {
+        hashesByNumOps.emplace_back(numOps, hash);
+    }
+    std::sort(hashesByNumOps.begin(), hashesByNumOps.end(), std::greater<>());
+
+    for (const auto& [numOps, hash] : hashesByNumOps) {
+        auto writerId = _leastLoadedWriter();
+        _load[writerId] += numOps;
+        _writerIds.emplace(hash, writerId);
+    }
+}
+
+boost::optional<uint32_t> BalancedWriterAssignment::getPlannedHash(const OplogEntry* op) const {
+    std::less<const OplogEntry*> before;
+    if (before(op, _plannedOps) || !before(op, _plannedOps + _plannedHashes.size())) {
+        return boost::none;
+    }
+    return _plannedHashes[op - _plannedOps];
+}
+
+uint32_t BalancedWriterAssignment::getWriterId(uint32_t hash) {
+    auto [it, inserted] = _writerIds.try_emplace(hash, 0);
+    if (inserted) {
+        it->second = _leastLoadedWriter();
+        ++_load[it->second];
+    }
+    return it->second;
+}
+
+uint32_t BalancedWriterAssignment::_leastLoadedWriter() const {
+    return std::distance(_load.begin(), std::min_element(_load.begin(), _load.end()));
+}
+
 namespace {
 /**
  * Populates a CRUD op's idHash and updates the isForCappedCollection field if necessary.
@@ -245,9 +298,17 @@ uint32_t OplogApplierUtils::addToWriterVector(
     OplogEntry* op,
     std::vector<std::vector<ApplierOperation>>* writerVectors,
     CachedCollectionProperties* collPropertiesCache,
-    boost::optional<uint32_t> forceWriterId) {
-    auto writerId =
-        getWriterId(opCtx, op, collPropertiesCache, writerVectors->size(), forceWriterId);
+    boost::optional<uint32_t> forceWriterId,
+    BalancedWriterAssignment* assignment) {
+    uint32_t writerId;
+    if (assignment && !forceWriterId) {
+        auto hash = assignment->getPlannedHash(op);
+        writerId = assignment->getWriterId(
+            hash ? *hash : getOplogEntryHash(opCtx, op, collPropertiesCache));
+    } else {
+        writerId =
+            getWriterId(opCtx, op, collPropertiesCache, writerVectors->size(), forceWriterId);
+    }
     return addToWriterVectorImpl(writerId, writerVectors, op);
 }
 
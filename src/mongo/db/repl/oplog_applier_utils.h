@@ -70,6 +70,47 @@ private:
     stdx::unordered_map<NamespaceString, CollectionProperties> _cache;
 };
 
+/**
+ * Assigns the hashes returned by OplogApplierUtils::getOplogEntryHash to writers for a single
+ * batch. Hashing modulo the number of writers can give one writer several hot documents while
+ * others sit idle; instead, hashes are given to the least loaded writer, heaviest first. Ops with
+ * the same hash may conflict and are therefore always assigned to the same writer.
+ */
+class BalancedWriterAssignment {
+public:
+    explicit BalancedWriterAssignment(uint32_t numWriters);
+
+    /**
+     * Assigns a writer to each distinct value in 'hashes', which holds the hash of each op in
+     * 'ops'. The hashes are kept so that getPlannedHash() can return them without hashing the ops
+     * again. Must be called at most once, before any call to getWriterId().
+     */
+    void plan(const std::vector<OplogEntry>& ops, std::vector<uint32_t> hashes);
+
+    /**
+     * Returns the hash computed for 'op' by plan(), or boost::none if 'op' was not part of the
+     * planned ops (e.g. an op derived from the batch).
+     */
+    boost::optional<uint32_t> getPlannedHash(const OplogEntry* op) const;
+
+    /**
+     * Returns the writer assigned to 'hash'. Hashes that were not planned are assigned to the
+     * least loaded writer the first time they are seen.
+     */
+    uint32_t getWriterId(uint32_t hash);
+
+private:
+    uint32_t _leastLoadedWriter() const;
+
+    // Number of ops assigned to each writer.
+    std::vector<size_t> _load;
+    stdx::unordered_map<uint32_t, uint32_t> _writerIds;
+
+    // The planned ops and their hashes, by position.
+    const OplogEntry* _plannedOps = nullptr;
+    std::vector<uint32_t> _plannedHashes;
+};
+
 /**
  * This class contains some static methods common to ordinary oplog application and oplog
  * application as part of tenant migration.
@@ -110,13 +151,15 @@ public:
 
     /**
      * Adds a single oplog entry to the appropriate writer vector. Returns the index of the
-     * writer vector the entry was written to.
+     * writer vector the entry was written to. If 'assignment' is given, it picks the writer
+     * instead of the hash of the entry modulo the number of writers.
      */
     static uint32_t addToWriterVector(OperationContext* opCtx,
                                       OplogEntry* op,
                                       std::vector<std::vector<ApplierOperation>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      boost::optional<uint32_t> forceWriterId = boost::none);
+                                      boost::optional<uint32_t> forceWriterId = boost::none,
+                                      BalancedWriterAssignment* assignment = nullptr);
 
     /**
      * Adds a set of derivedOps to writerVectors. For ops derived from prepared transactions, the
@@ -34,11 +34,19 @@
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/change_stream_change_collection_manager.h"
 #include "mongo/db/change_stream_serverless_helpers.h"
+#include "mongo/db/client.h"
+#include "mongo/db/cluster_role.h"
 #include "mongo/db/commands/fsync.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/repl/initial_syncer.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/control/journal_flusher.h"
 #include "mongo/db/storage/storage_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/future.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplication
 
@@ -147,10 +155,20 @@ TimerStats& OplogWriterStats::getBatches() {
     return _batches;
 }
 
+void OplogWriterStats::incrementWaitForBatchMillis(uint64_t n) {
+    _waitForBatchMillis.increment(n);
+}
+
+void OplogWriterStats::incrementWaitForApplyBufferMillis(uint64_t n) {
+    _waitForApplyBufferMillis.increment(n);
+}
+
 BSONObj OplogWriterStats::getReport() const {
     BSONObjBuilder b;
     b.append("batchSize", _batchSize.get());
     b.append("batches", _batches.getReport());
+    b.append("waitForBatchMillis", _waitForBatchMillis.get());
+    b.append("waitForApplyBufferMillis", _waitForApplyBufferMillis.get());
     return b.obj();
 }
 
@@ -185,6 +203,49 @@ void OplogWriterImpl::_run() {
     ScopedAdmissionPriority<ExecutionAdmissionContext> priority(
         opCtx, AdmissionContext::Priority::kExempt);
 
+    // Written batches are pushed to the applier's buffer by a separate thread, so that the next
+    // batch is written while the previous one waits for the applier to make room for it. At most
+    // one batch is handed off at a time, which bounds the memory held by the writer.
+    boost::optional<ThreadPool> handoffPool;
+    if (oplogWriterOverlapApplyBufferPush) {
+        ThreadPool::Options options;
+        options.poolName = "OplogWriterHandoff";
+        options.threadNamePrefix = "OplogWriterHandoff-";
+        options.minThreads = 1;
+        options.maxThreads = 1;
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName,
+                               getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+            stdx::lock_guard<Client> lk(cc());
+            cc().setSystemOperationUnkillableByStepdown(lk);
+        };
+        handoffPool.emplace(std::move(options));
+        handoffPool->startup();
+    }
+    boost::optional<Future<void>> pendingHandoff;
+    ON_BLOCK_EXIT([&] {
+        if (handoffPool) {
+            // Let a batch that is still being handed off reach the applier's buffer, as it would
+            // have if the writer had pushed it itself, before stopping the handoff thread.
+            if (pendingHandoff) {
+                pendingHandoff->getNoThrow().ignore();
+            }
+            handoffPool->shutdown();
+            handoffPool->join();
+        }
+    });
+
+    auto waitForPendingHandoff = [&] {
+        if (pendingHandoff) {
+            Timer timer;
+            auto future = std::move(*pendingHandoff);
+            pendingHandoff.reset();
+            future.get();
+            oplogWriterMetric.incrementWaitForApplyBufferMillis(
+                durationCount<Milliseconds>(timer.elapsed()));
+        }
+    };
+
     while (true) {
         // For pausing replication in tests.
         if (MONGO_unlikely(rsSyncApplyStop.shouldFail())) {
@@ -194,8 +255,15 @@ void OplogWriterImpl::_run() {
             rsSyncApplyStop.pauseWhileSet(opCtx);
         }
 
+        Timer waitForBatchTimer;
         auto batch = _batcher.getNextBatch(opCtx, Seconds(1));
+        oplogWriterMetric.incrementWaitForBatchMillis(
+            durationCount<Milliseconds>(waitForBatchTimer.elapsed()));
         if (batch.empty()) {
+            // There is nothing left to write, so make sure that everything written has reached
+            // the applier's buffer before going idle. This is what shutdown, drain mode and the
+            // wait for all fetched ops to be applied before a rollback rely on.
+            waitForPendingHandoff();
             if (inShutdown()) {
                 return;
             }
@@ -228,20 +296,43 @@ void OplogWriterImpl::_run() {
         // Update various things that care about our last written optime.
         finalizeOplogBatch(opCtx, lastOpTimeAndWallTime, flushJournal);
 
-        // Push the entries to the applier's buffer, may be blocked if no enough space.
-        // The number of entries in the batch could be larger than the buffer's limit,
-        // so we need to break the batch into smaller ones.
-        auto capacity = _applyBuffer->getMaxCount() / 2;
-        auto remain = ops.size();
-        auto begin = ops.begin();
-
-        while (remain > capacity) {
-            _applyBuffer->push(opCtx, begin, begin + capacity);
-            remain -= capacity;
-            begin += capacity;
+        waitForPendingHandoff();
+        if (!handoffPool) {
+            Timer timer;
+            _pushToApplyBuffer(opCtx, ops);
+            oplogWriterMetric.incrementWaitForApplyBufferMillis(
+                durationCount<Milliseconds>(timer.elapsed()));
+            continue;
         }
-        _applyBuffer->push(opCtx, begin, ops.end());
+
+        auto [promise, future] = makePromiseFuture<void>();
+        pendingHandoff.emplace(std::move(future));
+        handoffPool->schedule([this, ops = std::move(ops), promise = std::move(promise)](
+                                  Status status) mutable {
+            promise.setWith([&] {
+                uassertStatusOK(status);
+                auto handoffOpCtx = cc().makeOperationContext();
+                _pushToApplyBuffer(handoffOpCtx.get(), ops);
+            });
+        });
+    }
+}
+
+void OplogWriterImpl::_pushToApplyBuffer(OperationContext* opCtx,
+                                         const std::vector<BSONObj>& ops) {
+    // Push the entries to the applier's buffer, may be blocked if no enough space.
+    // The number of entries in the batch could be larger than the buffer's limit,
+    // so we need to break the batch into smaller ones.
+    auto capacity = _applyBuffer->getMaxCount() / 2;
+    auto remain = ops.size();
+    auto begin = ops.begin();
+
+    while (remain > capacity) {
+        _applyBuffer->push(opCtx, begin, begin + capacity);
+        remain -= capacity;
+        begin += capacity;
     }
+    _applyBuffer->push(opCtx, begin, ops.end());
 }
 
 bool OplogWriterImpl::writeOplogBatch(OperationContext* opCtx, const std::vector<BSONObj>& ops) {
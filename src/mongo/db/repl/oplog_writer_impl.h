@@ -41,6 +41,14 @@ class OplogWriterStats {
 public:
     void incrementBatchSize(uint64_t n);
     TimerStats& getBatches();
+
+    /**
+     * Time the writer spent waiting for the fetcher to fill its buffer, and waiting for the
+     * applier to make room in its buffer, respectively.
+     */
+    void incrementWaitForBatchMillis(uint64_t n);
+    void incrementWaitForApplyBufferMillis(uint64_t n);
+
     BSONObj getReport() const;
     operator BSONObj() const {
         return getReport();
@@ -49,6 +57,8 @@ public:
 private:
     TimerStats _batches;
     Counter64 _batchSize;
+    Counter64 _waitForBatchMillis;
+    Counter64 _waitForApplyBufferMillis;
 };
 
 /**
@@ -143,6 +153,11 @@ private:
 
     std::pair<bool, bool> _checkWriteOptions();
 
+    /**
+     * Pushes a written batch to the applyBuffer, blocking while the applyBuffer is full.
+     */
+    void _pushToApplyBuffer(OperationContext* opCtx, const std::vector<BSONObj>& ops);
+
     // Not owned by us.
     OplogBuffer* const _applyBuffer;
 
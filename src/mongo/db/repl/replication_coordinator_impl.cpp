@@ -46,6 +46,7 @@
 #include <ostream>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/bson/bsonelement.h"
@@ -5540,11 +5541,30 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
+    // Waiters are visited in increasing OpTime order, and a write concern that is not satisfied at
+    // some OpTime cannot be satisfied at a later one. Remember the write concerns found
+    // unsatisfied during this pass so that the remaining waiters using them, typically nearly all
+    // of the w:majority waiters beyond the commit point, are skipped without re-evaluating them.
+    std::vector<const WriteConcernOptions*> unsatisfied;
+    auto sameRequirement = [](const WriteConcernOptions& a, const WriteConcernOptions& b) {
+        return a.w == b.w && a.syncMode == b.syncMode && a.checkCondition == b.checkCondition;
+    };
+
     _replicationWaiterList.setValueIf(
         lk,
-        [this](WithLock lk, const OpTime& opTime, const SharedWaiterHandle& waiter) {
+        [&](WithLock lk, const OpTime& opTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
-            return _doneWaitingForReplication(lk, opTime, waiter->writeConcern.value());
+            const auto& writeConcern = waiter->writeConcern.value();
+            if (std::any_of(unsatisfied.begin(), unsatisfied.end(), [&](const auto* other) {
+                    return sameRequirement(*other, writeConcern);
+                })) {
+                return false;
+            }
+            if (_doneWaitingForReplication(lk, opTime, writeConcern)) {
+                return true;
+            }
+            unsatisfied.push_back(&writeConcern);
+            return false;
         },
         opTime);
 }
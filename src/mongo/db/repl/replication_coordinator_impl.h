@@ -900,7 +900,7 @@ private:
         // Returns whether waiter is found and removed.
         bool remove(WithLock lk, SharedWaiterHandle waiter);
         // Signals all waiters whose opTime is <= the given opTime (if any) that satisfy the
-        // condition in func.
+        // condition in func. Waiters are passed to func in increasing opTime order.
         template <typename Func>
         void setValueIf(WithLock lk, Func&& func, boost::optional<OpTime> opTime = boost::none);
         // Signals all waiters from the list and fulfills promises with OK status.
@@ -1055,6 +1055,119 @@ TEST_F(
     ASSERT_EQUALS(ErrorCodes::WriteConcernFailed, statusAndDur.status);
 }
 
+TEST_F(ReplCoordTest, ReplicationWaitersWithDifferentWriteConcernsAreWokenExactlyWhenSatisfied) {
+    assertStartSuccess(
+        BSON("_id"
+             << "mySet"
+             << "version" << 2 << "members"
+             << BSON_ARRAY(BSON("_id" << 0 << "host"
+                                      << "node0"
+                                      << "tags"
+                                      << BSON("dc"
+                                              << "NA"))
+                           << BSON("_id" << 1 << "host"
+                                         << "node1"
+                                         << "tags"
+                                         << BSON("dc"
+                                                 << "NA"))
+                           << BSON("_id" << 2 << "host"
+                                         << "node2"
+                                         << "tags"
+                                         << BSON("dc"
+                                                 << "NA"))
+                           << BSON("_id" << 3 << "host"
+                                         << "node3"
+                                         << "tags"
+                                         << BSON("dc"
+                                                 << "EU"))
+                           << BSON("_id" << 4 << "host"
+                                         << "node4"
+                                         << "tags"
+                                         << BSON("dc"
+                                                 << "EU")))
+             << "settings" << BSON("getLastErrorModes" << BSON("multiDC" << BSON("dc" << 2)))),
+        HostAndPort("node0"));
+    ASSERT_OK(getReplCoord()->setFollowerMode(MemberState::RS_SECONDARY));
+    replCoordSetMyLastWrittenAndAppliedAndDurableOpTime(OpTime(Timestamp(100, 1), 0),
+                                                        Date_t() + Seconds(100));
+    simulateSuccessfulV1Election();
+
+    OpTime time1(Timestamp(100, 2), 1);
+    OpTime time2(Timestamp(100, 3), 1);
+    OpTime time3(Timestamp(100, 4), 1);
+    getStorageInterface()->allDurableTimestamp = time3.getTimestamp();
+    replCoordSetMyLastWrittenAndAppliedAndDurableOpTime(time3, Date_t() + Seconds(100));
+
+    auto makeWriteConcern = [](WriteConcernW w) {
+        WriteConcernOptions writeConcern;
+        writeConcern.wTimeout = WriteConcernOptions::kNoTimeout;
+        writeConcern.w = w;
+        return writeConcern;
+    };
+    const auto majority = makeWriteConcern(WriteConcernOptions::kMajority);
+    const auto w2 = makeWriteConcern(int64_t{2});
+    const auto w3 = makeWriteConcern(int64_t{3});
+    const auto multiDC = makeWriteConcern(std::string{"multiDC"});
+    auto await = [&](const OpTime& opTime, const WriteConcernOptions& writeConcern) {
+        return getReplCoord()->awaitReplicationAsyncNoWTimeout(opTime, writeConcern);
+    };
+
+    // Interleave the write concerns across increasing OpTimes.
+    auto majorityAt1 = await(time1, majority);
+    auto w2At1 = await(time1, w2);
+    auto multiDCAt1 = await(time1, multiDC);
+    auto w3At2 = await(time2, w3);
+    auto majorityAt2 = await(time2, majority);
+    auto multiDCAt2 = await(time2, multiDC);
+    auto w2At3 = await(time3, w2);
+
+    auto advance = [&](int memberId, const OpTime& opTime) {
+        ASSERT_OK(getReplCoord()->setLastAppliedOptime_forTest(2, memberId, opTime));
+        ASSERT_OK(getReplCoord()->setLastDurableOptime_forTest(2, memberId, opTime));
+    };
+    auto assertReady = [](const SharedSemiFuture<void>& future, bool ready) {
+        ASSERT_EQ(future.isReady(), ready);
+        if (ready) {
+            ASSERT_OK(future.getNoThrow());
+        }
+    };
+
+    // Only this node has any of the writes.
+    assertReady(majorityAt1, false);
+    assertReady(w2At1, false);
+    assertReady(multiDCAt1, false);
+    assertReady(w3At2, false);
+    assertReady(majorityAt2, false);
+    assertReady(multiDCAt2, false);
+    assertReady(w2At3, false);
+
+    // Two nodes in different data centers have time1.
+    advance(3, time1);
+    assertReady(majorityAt1, false);
+    assertReady(w2At1, true);
+    assertReady(multiDCAt1, true);
+    assertReady(w3At2, false);
+    assertReady(majorityAt2, false);
+    assertReady(multiDCAt2, false);
+    assertReady(w2At3, false);
+
+    // A majority has time1, but only two nodes in the same data center have time2. The
+    // unsatisfied w:3 and w:majority waiters at time2 must not prevent evaluating w:2 at time3.
+    advance(1, time2);
+    assertReady(majorityAt1, true);
+    assertReady(w3At2, false);
+    assertReady(majorityAt2, false);
+    assertReady(multiDCAt2, false);
+    assertReady(w2At3, false);
+
+    // A majority spanning both data centers has time2, and two nodes have time3.
+    advance(4, time3);
+    assertReady(w3At2, true);
+    assertReady(majorityAt2, true);
+    assertReady(multiDCAt2, true);
+    assertReady(w2At3, true);
+}
+
 /**
  * Used to wait for replication in a separate thread without blocking execution of the test.
  * To use, set the optime and write concern to be passed to awaitReplication and then call
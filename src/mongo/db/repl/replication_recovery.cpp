@@ -134,6 +134,14 @@ public:
                            "numOpsApplied"_attr = _numOpsApplied);
 
         _numOpsApplied += batch.size();
+        if (_sinceLastProgressLog.elapsed() >= kProgressLogInterval) {
+            _sinceLastProgressLog.reset();
+            LOGV2(9611300,
+                  "Oplog application for recovery in progress",
+                  "numOpsApplied"_attr = _numOpsApplied,
+                  "numBatches"_attr = _numBatches,
+                  "lastOpTime"_attr = batch.back().getOpTime());
+        }
         if (shouldLog(::mongo::logv2::LogComponent::kStorageRecovery, kRecoveryOperationLogLevel)) {
             std::size_t i = 0;
             for (const auto& entry : batch) {
@@ -160,8 +168,13 @@ public:
     }
 
 private:
+    // Recovery can replay a long stretch of the oplog, so report progress at the default log level
+    // this often.
+    static constexpr Seconds kProgressLogInterval{10};
+
     std::size_t _numBatches = 0;
     std::size_t _numOpsApplied = 0;
+    Timer _sinceLastProgressLog;
 };
 
 /**
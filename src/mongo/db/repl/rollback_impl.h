@@ -421,6 +421,10 @@ private:
     /**
      * Iterates through the _countDiff map and retrieves the count of the record store pointed to
      * by each UUID. It then saves the post-rollback counts to the _newCounts map.
+     *
+     * The counts are read from each collection's fast count metadata rather than by scanning it,
+     * so this is cheap compared to writing the rollback files. Only collections whose count cannot
+     * be derived from the oplog are marked for a collection scan, which happens after recovery.
      */
     Status _findRecordStoreCounts(OperationContext* opCtx);
 
@@ -468,6 +472,10 @@ private:
      * This function causes the server to terminate if an error occurs while fetching documents from
      * disk or while writing documents to the rollback file. It must be called before marking the
      * oplog truncate point, and before the storage engine recovers to the stable timestamp.
+     *
+     * Namespaces are written one at a time on this thread: every document is read from this
+     * operation's snapshot, which must not move until all rollback files are written. Writing the
+     * files can be skipped altogether with the 'createRollbackDataFiles' server parameter.
      */
     Status _writeRollbackFiles(OperationContext* opCtx);
 
@@ -56,7 +56,11 @@ public:
     SyncSourceFeedback() = default;
 
     /// Notifies the SyncSourceFeedbackThread to wake up and send an update upstream of secondary
-    /// replication progress.
+    /// replication progress. Updates are pushed as soon as they are triggered; if a report is
+    /// already in flight they are coalesced into the next one, unless 'prioritized' is set, in
+    /// which case one more report may go out on the Reporter's backup channel without waiting.
+    /// The replication coordinator prioritizes whichever of lastWritten or lastDurable the
+    /// majority commit point is computed from.
     void forwardSecondaryProgress(bool prioritized = false);
 
     /**
@@ -31,6 +31,7 @@
 #include <absl/container/node_hash_map.h>
 #include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <ctime>
 #include <fmt/format.h>
 #include <limits>
@@ -137,6 +138,57 @@ std::vector<ZoneRange> normalizeZones(const ChunkManager& cm, const ZoneInfo& zo
     return normalizedRanges;
 }
 
+/**
+ * Candidate shards are only compared by load when their data sizes are within one chunk of the
+ * shard chosen by data size, and only switched to when their load differs from it by more than
+ * this fraction. Both margins keep load noise from causing back and forth migrations.
+ */
+constexpr double kShardLoadHysteresis = 0.1;
+
+/**
+ * Given the shard 'best' chosen by data size and every candidate shard with its data size, returns
+ * the candidate within one chunk of 'best's data size with the lowest recent operation rate, or
+ * the highest if 'preferBusiest' is set. Returns 'best' unchanged if it, or any other shard in
+ * that band, has no operation rate sample.
+ */
+std::tuple<ShardId, int64_t> breakDataSizeTieByLoad(
+    const std::vector<std::pair<const ClusterStatistics::ShardStatistics*, int64_t>>& candidates,
+    const ShardId& best,
+    int64_t bestSize,
+    int64_t maxChunkSizeBytes,
+    bool preferBusiest) {
+    const ClusterStatistics::ShardStatistics* chosen = nullptr;
+    int64_t chosenSize = bestSize;
+    for (const auto& [stat, size] : candidates) {
+        if (stat->shardId == best) {
+            chosen = stat;
+        }
+    }
+    if (!chosen || !chosen->opsPerSecond) {
+        return {best, bestSize};
+    }
+
+    for (const auto& [stat, size] : candidates) {
+        if (std::abs(size - bestSize) > maxChunkSizeBytes) {
+            continue;
+        }
+        if (!stat->opsPerSecond) {
+            return {best, bestSize};
+        }
+
+        const double chosenLoad = *chosen->opsPerSecond;
+        const bool isBetter = preferBusiest
+            ? *stat->opsPerSecond > chosenLoad * (1 + kShardLoadHysteresis)
+            : *stat->opsPerSecond < chosenLoad * (1 - kShardLoadHysteresis);
+        if (isBetter) {
+            chosen = stat;
+            chosenSize = size;
+        }
+    }
+
+    return {chosen->shardId, chosenSize};
+}
+
 }  // namespace
 
 DistributionStatus::DistributionStatus(NamespaceString nss,
@@ -306,6 +358,7 @@ std::tuple<ShardId, int64_t> BalancerPolicy::_getLeastLoadedReceiverShard(
     const stdx::unordered_set<ShardId>& availableShards) {
     ShardId best;
     int64_t currentMin = numeric_limits<int64_t>::max();
+    std::vector<std::pair<const ClusterStatistics::ShardStatistics*, int64_t>> candidates;
 
     for (const auto& stat : shardStats) {
         if (!availableShards.count(stat.shardId))
@@ -323,13 +376,18 @@ std::tuple<ShardId, int64_t> BalancerPolicy::_getLeastLoadedReceiverShard(
         }
 
         const auto shardSize = shardSizeIt->second;
+        candidates.emplace_back(&stat, shardSize);
         if (shardSize < currentMin) {
             best = stat.shardId;
             currentMin = shardSize;
         }
     }
 
-    return {best, currentMin};
+    return breakDataSizeTieByLoad(candidates,
+                                  best,
+                                  currentMin,
+                                  collDataSizeInfo.maxChunkSizeBytes,
+                                  false /* preferBusiest */);
 }
 
 std::tuple<ShardId, int64_t> BalancerPolicy::_getMostOverloadedShard(
@@ -339,6 +397,7 @@ std::tuple<ShardId, int64_t> BalancerPolicy::_getMostOverloadedShard(
     const stdx::unordered_set<ShardId>& availableShards) {
     ShardId worst;
     long long currentMax = numeric_limits<long long>::min();
+    std::vector<std::pair<const ClusterStatistics::ShardStatistics*, int64_t>> candidates;
 
     for (const auto& stat : shardStats) {
         if (!availableShards.count(stat.shardId))
@@ -351,13 +410,18 @@ std::tuple<ShardId, int64_t> BalancerPolicy::_getMostOverloadedShard(
         }
 
         const auto shardSize = shardSizeIt->second;
+        candidates.emplace_back(&stat, shardSize);
         if (shardSize > currentMax) {
             worst = stat.shardId;
             currentMax = shardSize;
         }
     }
 
-    return {worst, currentMax};
+    return breakDataSizeTieByLoad(candidates,
+                                  worst,
+                                  currentMax,
+                                  collDataSizeInfo.maxChunkSizeBytes,
+                                  true /* preferBusiest */);
 }
 
 // Returns a random integer in [0, max) using a uniform random distribution.
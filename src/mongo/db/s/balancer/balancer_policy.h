@@ -481,7 +481,9 @@ public:
 private:
     /*
      * Only considers shards with the specified zone, all shards in case the zone is empty.
-     * Returns a tuple <ShardID, amount of data in bytes> referring the shard with less data.
+     * Returns a tuple <ShardID, amount of data in bytes> referring the shard with less data. When
+     * shard load samples are available, a shard within one chunk of that data size with clearly
+     * lower load is returned instead.
      */
     static std::tuple<ShardId, int64_t> _getLeastLoadedReceiverShard(
         const ShardStatisticsVector& shardStats,
@@ -491,7 +493,9 @@ private:
 
     /**
      * Only considers shards with the specified zone, all shards in case the zone is empty.
-     * Returns a tuple <ShardID, amount of data in bytes> referring the shard with more data.
+     * Returns a tuple <ShardID, amount of data in bytes> referring the shard with more data. When
+     * shard load samples are available, a shard within one chunk of that data size with clearly
+     * higher load is returned instead.
      */
     static std::tuple<ShardId, int64_t> _getMostOverloadedShard(
         const ShardStatisticsVector& shardStats,
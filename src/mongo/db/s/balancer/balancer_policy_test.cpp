@@ -280,6 +280,49 @@ TEST(BalancerPolicy, BasicWithManyChunks) {
     ASSERT_EQ(MigrationReason::chunksImbalance, reason);
 }
 
+TEST(BalancerPolicy, ShardLoadBreaksDataSizeNearTies) {
+    auto [cluster, cm] = generateCluster({{6, 6 * kDefaultMaxChunkSizeBytes},
+                                          {6, 6 * kDefaultMaxChunkSizeBytes - 100},
+                                          {0, 0},
+                                          {1, 100}});
+
+    // Without load samples the shards are chosen purely by data size.
+    {
+        const auto [migrations, reason] =
+            balanceChunks(cluster.first, makeDistStatus(cm), false, false);
+        ASSERT_EQ(2U, migrations.size());
+        ASSERT_EQ(getShardId(0), migrations[0].from);
+        ASSERT_EQ(getShardId(2), migrations[0].to);
+    }
+
+    // Shards 1 and 3 are within a chunk of the largest and smallest shards but are clearly the
+    // busiest and the least busy, so the first migration moves data from 1 to 3.
+    cluster.first.shardStats[0].opsPerSecond = 100;
+    cluster.first.shardStats[1].opsPerSecond = 1000;
+    cluster.first.shardStats[2].opsPerSecond = 500;
+    cluster.first.shardStats[3].opsPerSecond = 10;
+    {
+        const auto [migrations, reason] =
+            balanceChunks(cluster.first, makeDistStatus(cm), false, false);
+        ASSERT_EQ(2U, migrations.size());
+        ASSERT_EQ(getShardId(1), migrations[0].from);
+        ASSERT_EQ(getShardId(3), migrations[0].to);
+        ASSERT_EQ(getShardId(0), migrations[1].from);
+        ASSERT_EQ(getShardId(2), migrations[1].to);
+    }
+
+    // Differences in load within the hysteresis margin do not change the choice.
+    cluster.first.shardStats[1].opsPerSecond = 105;
+    cluster.first.shardStats[3].opsPerSecond = 475;
+    {
+        const auto [migrations, reason] =
+            balanceChunks(cluster.first, makeDistStatus(cm), false, false);
+        ASSERT_EQ(2U, migrations.size());
+        ASSERT_EQ(getShardId(0), migrations[0].from);
+        ASSERT_EQ(getShardId(2), migrations[0].to);
+    }
+}
+
 TEST(BalancerPolicy, SmallSingleChunkShouldNotMove) {
     auto [cluster, cm] =
         generateCluster({{1, 1 * kDefaultMaxChunkSizeBytes}, {0, 0 * kDefaultMaxChunkSizeBytes}});
@@ -34,6 +34,8 @@
 #include <string>
 #include <vector>
 
+#include <boost/optional/optional.hpp>
+
 #include "mongo/base/status_with.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/shard_id.h"
@@ -69,6 +71,10 @@ public:
 
         // Set of zones for the shard
         std::set<std::string> shardZones;
+
+        // Operations per second served by the shard's primary since the previous statistics
+        // snapshot. Only collected when 'balancerConsiderShardLoad' is enabled.
+        boost::optional<double> opsPerSecond;
     };
     virtual ~ClusterStatistics();
 
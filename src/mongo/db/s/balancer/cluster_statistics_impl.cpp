@@ -52,6 +52,7 @@
 #include "mongo/db/repl/read_concern_level.h"
 #include "mongo/db/s/balancer/cluster_statistics_impl.h"
 #include "mongo/db/s/config/sharding_catalog_manager.h"
+#include "mongo/db/s/sharding_config_server_parameters_gen.h"
 #include "mongo/db/shard_id.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
@@ -71,6 +72,53 @@ namespace mongo {
 
 using ShardStatistics = ClusterStatistics::ShardStatistics;
 
+namespace {
+
+// Only the opcounters section is needed, so skip the costlier default sections.
+const BSONObj kOpCountersServerStatusCmd = BSON("serverStatus" << 1 << "metrics" << 0 << "locks"
+                                                               << 0 << "wiredTiger" << 0 << "repl"
+                                                               << 0 << "tcmalloc" << 0);
+
+// The balancer reads the statistics more than once per round, so shards are sampled at most once
+// per default balancer round and the load derived from the previous sample is reused in between.
+const Milliseconds kMinShardLoadSampleInterval = Seconds(10);
+
+/**
+ * Returns the sum of the operation counters reported by the shard's primary, or boost::none if they
+ * could not be read.
+ */
+boost::optional<long long> fetchTotalOpCount(OperationContext* opCtx, const ShardId& shardId) {
+    auto shardStatus = Grid::get(opCtx)->shardRegistry()->getShard(opCtx, shardId);
+    if (!shardStatus.isOK()) {
+        return boost::none;
+    }
+
+    auto swResponse = shardStatus.getValue()->runCommandWithFixedRetryAttempts(
+        opCtx,
+        ReadPreferenceSetting{ReadPreference::PrimaryOnly},
+        DatabaseName::kAdmin,
+        kOpCountersServerStatusCmd,
+        Shard::RetryPolicy::kIdempotent);
+    if (!swResponse.isOK() || !swResponse.getValue().commandStatus.isOK()) {
+        return boost::none;
+    }
+
+    const auto opCounters = swResponse.getValue().response["opcounters"];
+    if (opCounters.type() != BSONType::Object) {
+        return boost::none;
+    }
+
+    long long totalOps = 0;
+    for (const auto& counter : opCounters.Obj()) {
+        if (counter.isNumber()) {
+            totalOps += counter.safeNumberLong();
+        }
+    }
+    return totalOps;
+}
+
+}  // namespace
+
 ClusterStatisticsImpl::~ClusterStatisticsImpl() = default;
 
 StatusWith<std::vector<ShardStatistics>> ClusterStatisticsImpl::getStats(OperationContext* opCtx) {
@@ -102,6 +150,48 @@ StatusWith<std::vector<ShardStatistics>> ClusterStatisticsImpl::getStats(Operati
         stats.emplace_back(shard.getName(), shard.getDraining(), std::move(shardZones));
     }
 
+    if (balancerConsiderShardLoad.load()) {
+        _sampleShardLoad(opCtx, &stats);
+    } else {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _lastOpCounters.clear();
+    }
+
     return stats;
 }
+
+void ClusterStatisticsImpl::_sampleShardLoad(OperationContext* opCtx,
+                                             std::vector<ShardStatistics>* stats) {
+    for (auto& stat : *stats) {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            auto it = _lastOpCounters.find(stat.shardId);
+            if (it != _lastOpCounters.end() &&
+                Date_t::now() - it->second.sampledAt < kMinShardLoadSampleInterval) {
+                stat.opsPerSecond = it->second.opsPerSecond;
+                continue;
+            }
+        }
+
+        const auto totalOps = fetchTotalOpCount(opCtx, stat.shardId);
+        const auto now = Date_t::now();
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (!totalOps) {
+            _lastOpCounters.erase(stat.shardId);
+            continue;
+        }
+
+        auto it = _lastOpCounters.find(stat.shardId);
+        if (it != _lastOpCounters.end()) {
+            const auto elapsed = now - it->second.sampledAt;
+            // The counters restart from zero when the shard's primary changes or restarts.
+            if (elapsed > Milliseconds(0) && *totalOps >= it->second.totalOps) {
+                stat.opsPerSecond = static_cast<double>(*totalOps - it->second.totalOps) /
+                    durationCount<Milliseconds>(elapsed) * 1000;
+            }
+        }
+        _lastOpCounters[stat.shardId] = {*totalOps, now, stat.opsPerSecond};
+    }
+}
 }  // namespace mongo
@@ -36,19 +36,45 @@
 #include "mongo/base/status_with.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/s/balancer/cluster_statistics.h"
+#include "mongo/db/shard_id.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
 /**
  * Default implementation for the cluster statistics gathering utility. Uses a blocking method to
- * fetch the statistics and does not perform any caching. If any of the shards fails to report
- * statistics fails the entire refresh.
+ * fetch the statistics and does not perform any caching, other than remembering each shard's
+ * previous operation counters in order to derive its load, and the load itself between samples.
+ * If any of the shards fails to report statistics fails the entire refresh.
  */
 class ClusterStatisticsImpl final : public ClusterStatistics {
 public:
     ~ClusterStatisticsImpl() override;
 
     StatusWith<std::vector<ShardStatistics>> getStats(OperationContext* opCtx) override;
+
+private:
+    /**
+     * Sets opsPerSecond on each of the 'stats' for which the shard's operation counters could be
+     * read on the last two samples. A shard is only sampled again once kMinShardLoadSampleInterval
+     * has passed since its previous sample.
+     */
+    void _sampleShardLoad(OperationContext* opCtx, std::vector<ShardStatistics>* stats);
+
+    struct OpCountersSample {
+        long long totalOps;
+        Date_t sampledAt;
+        // The load derived from this sample and the one before it.
+        boost::optional<double> opsPerSecond;
+    };
+
+    // Protects _lastOpCounters.
+    Mutex _mutex = MONGO_MAKE_LATCH("ClusterStatisticsImpl::_mutex");
+
+    // Most recent operation counter totals read from each shard.
+    stdx::unordered_map<ShardId, OpCountersSample> _lastOpCounters;
 };
 
 }  // namespace mongo
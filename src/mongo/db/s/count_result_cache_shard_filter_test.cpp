@@ -0,0 +1,154 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <vector>
+
+#include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
+#include "mongo/bson/timestamp.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/keypattern.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/s/collection_metadata.h"
+#include "mongo/db/s/collection_sharding_runtime.h"
+#include "mongo/db/s/operation_sharding_state.h"
+#include "mongo/db/s/shard_server_test_fixture.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/s/chunk_version.h"
+#include "mongo/s/database_version.h"
+#include "mongo/s/shard_version_factory.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("TestDB", "TestColl");
+
+/**
+ * Runs the count command through the full command path to check that counts which tolerate
+ * staleness ('maxStalenessMS') never share cached results across different shard filtering.
+ */
+class CountResultCacheShardFilterTest : public ShardServerTestFixture {
+protected:
+    /**
+     * Shards 'kNss' on _id, with [MinKey, 0) owned by this shard and [0, MaxKey) by another one.
+     */
+    CollectionMetadata shardCollection() {
+        const auto uuid = [&] {
+            AutoGetCollection autoColl(operationContext(), kNss, MODE_IS);
+            return autoColl->uuid();
+        }();
+        const OID epoch = OID::gen();
+        const Timestamp timestamp(1, 1);
+        const KeyPattern shardKeyPattern(BSON("_id" << 1));
+
+        ChunkVersion version({epoch, timestamp}, {1, 0});
+        ChunkType ownedChunk(
+            uuid, {shardKeyPattern.globalMin(), BSON("_id" << 0)}, version, kMyShardName);
+        version.incMinor();
+        ChunkType otherChunk(
+            uuid, {BSON("_id" << 0), shardKeyPattern.globalMax()}, version, ShardId("other"));
+
+        ChunkManager cm(kMyShardName,
+                        DatabaseVersion(UUID::gen(), timestamp),
+                        makeStandaloneRoutingTableHistory(
+                            RoutingTableHistory::makeNew(kNss,
+                                                         uuid,
+                                                         shardKeyPattern,
+                                                         false, /* unsplittable */
+                                                         nullptr,
+                                                         false,
+                                                         epoch,
+                                                         timestamp,
+                                                         boost::none /* timeseriesFields */,
+                                                         boost::none /* reshardingFields */,
+                                                         true,
+                                                         {ownedChunk, otherChunk})),
+                        boost::none);
+        CollectionMetadata metadata(std::move(cm), kMyShardName);
+
+        AutoGetCollection autoColl(operationContext(), kNss, MODE_X);
+        CollectionShardingRuntime::assertCollectionLockedAndAcquireExclusive(operationContext(),
+                                                                             kNss)
+            ->setFilteringMetadata(operationContext(), metadata);
+        return metadata;
+    }
+
+    long long runCount(DBDirectClient& client) {
+        BSONObj result;
+        ASSERT(client.runCommand(kNss.dbName(),
+                                 BSON("count" << kNss.coll() << "query" << BSONObj()
+                                              << "maxStalenessMS" << 60 * 1000),
+                                 result))
+            << result;
+        return result["n"].safeNumberLong();
+    }
+};
+
+TEST_F(CountResultCacheShardFilterTest, CountsWithAndWithoutShardFilterDoNotShareResults) {
+    DBDirectClient client(operationContext());
+    ASSERT(client.createCollection(kNss));
+    client.insert(kNss,
+                  std::vector<BSONObj>{BSON("_id" << -2),
+                                       BSON("_id" << -1),
+                                       BSON("_id" << 1),
+                                       BSON("_id" << 2)});
+    const auto metadata = shardCollection();
+
+    // A count which is not sent by a router doesn't filter out the documents of other shards.
+    ASSERT_EQ(runCount(client), 4);
+
+    {
+        ScopedSetShardRole scopedSetShardRole{
+            operationContext(),
+            kNss,
+            ShardVersionFactory::make(metadata, boost::optional<CollectionIndexes>(boost::none)),
+            boost::none /* databaseVersion */};
+        ASSERT(OperationShardingState::isComingFromRouter(operationContext()));
+
+        // The same count from a router only counts the documents this shard owns, so it must not
+        // be answered with the unfiltered result cached above.
+        ASSERT_EQ(runCount(client), 2);
+    }
+
+    // Nor is the filtered result served to counts which are not sent by a router.
+    ASSERT_EQ(runCount(client), 4);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -736,14 +736,23 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
-    while (true) {
-        int recordsNoLongerExist = 0;
-        auto docInFlight = _cloneList.getNextDoc(opCtx, collection, &recordsNoLongerExist);
-
-        if (recordsNoLongerExist) {
+    // Concurrent _migrateClone requests and the writes to the collection all take '_mutex', so the
+    // progress counters are accumulated locally and published once per batch.
+    int numRecordsCloned = 0;
+    int numRecordsPassedOver = 0;
+    long long numBytesCloned = 0;
+    ScopeGuard publishCounters([&] {
+        {
             stdx::lock_guard lk(_mutex);
-            _numRecordsPassedOver += recordsNoLongerExist;
+            _numRecordsCloned += numRecordsCloned;
+            _numRecordsPassedOver += numRecordsPassedOver;
         }
+        ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(numRecordsCloned);
+        ShardingStatistics::get(opCtx).countBytesClonedOnDonor.addAndFetch(numBytesCloned);
+    });
+
+    while (true) {
+        auto docInFlight = _cloneList.getNextDoc(opCtx, collection, &numRecordsPassedOver);
 
         const auto& doc = docInFlight->getDoc();
         if (!doc) {
@@ -764,10 +773,7 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
         // the range of the chunk being migrated.
         if (!isDocInRange(
                 doc->value(), _args.getMin().value(), _args.getMax().value(), _shardKeyPattern)) {
-            {
-                stdx::lock_guard lk(_mutex);
-                _numRecordsPassedOver++;
-            }
+            numRecordsPassedOver++;
             continue;
         }
 
@@ -779,14 +785,10 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
             break;
         }
 
-        {
-            stdx::lock_guard lk(_mutex);
-            _numRecordsCloned++;
-        }
+        numRecordsCloned++;
+        numBytesCloned += doc->value().objsize();
 
         arrBuilder->append(doc->value());
-        ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
-        ShardingStatistics::get(opCtx).countBytesClonedOnDonor.addAndFetch(doc->value().objsize());
     }
 }
 
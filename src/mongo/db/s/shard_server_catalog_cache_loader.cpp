@@ -444,6 +444,22 @@ void performNoopMajorityWriteLocally(OperationContext* opCtx, StringData msg) {
                             &writeConcernResult));
 }
 
+/**
+ * Schedules tasks on a ThreadPool ahead of the tasks it was given through ThreadPool::schedule().
+ */
+class HighPriorityThreadPoolExecutor final : public OutOfLineExecutor {
+public:
+    explicit HighPriorityThreadPoolExecutor(std::shared_ptr<ThreadPool> pool)
+        : _pool(std::move(pool)) {}
+
+    void schedule(Task task) override {
+        _pool->scheduleHighPriority(std::move(task));
+    }
+
+private:
+    std::shared_ptr<ThreadPool> _pool;
+};
+
 }  // namespace
 
 ShardServerCatalogCacheLoader::ShardServerCatalogCacheLoader(
@@ -455,7 +471,8 @@ ShardServerCatalogCacheLoader::ShardServerCatalogCacheLoader(
           options.minThreads = 0;
           options.maxThreads = 6;
           return options;
-      }())) {
+      }())),
+      _refreshExecutor(std::make_shared<HighPriorityThreadPoolExecutor>(_executor)) {
     _executor->startup();
 }
 
@@ -544,7 +561,7 @@ SemiFuture<CollectionAndChangedChunks> ShardServerCatalogCacheLoader::getChunksS
         return std::make_tuple(_role == ReplicaSetRole::Primary, _term);
     }();
 
-    return ExecutorFuture<void>(_executor)
+    return ExecutorFuture<void>(_refreshExecutor)
         .then([=, this]() {
             ThreadClient tc("ShardServerCatalogCacheLoader::getChunksSince",
                             getGlobalServiceContext()->getService(ClusterRole::ShardServer));
@@ -586,7 +603,7 @@ SemiFuture<DatabaseType> ShardServerCatalogCacheLoader::getDatabase(const Databa
         return std::make_tuple(_role == ReplicaSetRole::Primary, _term);
     }();
 
-    return ExecutorFuture<void>(_executor)
+    return ExecutorFuture<void>(_refreshExecutor)
         .then([this, dbName, isPrimary = isPrimary, term = term]() {
             ThreadClient tc("ShardServerCatalogCacheLoader::getDatabase",
                             getGlobalServiceContext()->getService(ClusterRole::ShardServer));
@@ -56,6 +56,7 @@
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/future.h"
+#include "mongo/util/out_of_line_executor.h"
 
 namespace mongo {
 
@@ -501,6 +502,10 @@ private:
     // Thread pool used to run blocking tasks which perform disk reads and writes
     std::shared_ptr<ThreadPool> _executor;
 
+    // Schedules routing table and database refreshes on '_executor' ahead of the tasks which
+    // persist refreshed metadata, since operations wait for the refreshes to complete
+    std::shared_ptr<OutOfLineExecutor> _refreshExecutor;
+
     // Registry of notifications for changes happening to the shard's on-disk routing information
     NamespaceMetadataChangeNotifications _namespaceNotifications;
 
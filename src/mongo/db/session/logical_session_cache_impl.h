@@ -67,6 +67,12 @@ namespace mongo {
  *    every 5 minutes (300,000). If the caller is setting the sessionTimeout by hand, it is
  *    suggested that they consider also setting the refresh interval accordingly.
  *      --setParameter logicalSessionRefreshMillis=X.
+ *
+ * A single mutex guards the cache, but it is only held for map operations. A refresh swaps out
+ * the active and ending sessions under the lock and then writes them to the sessions collection
+ * without holding it, in batches of at most 1000 records (see SessionsCollection). Those batches
+ * are sent back to back, so each refresh interval produces one burst of writes whose size depends
+ * on the number of sessions used since the previous refresh.
  */
 class LogicalSessionCacheImpl final : public LogicalSessionCache {
 public:
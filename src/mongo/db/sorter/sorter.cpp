@@ -85,16 +85,22 @@
 #include "mongo/db/sorter/sorter_checksum_calculator.h"
 #include "mongo/db/sorter/sorter_gen.h"
 #include "mongo/db/sorter/sorter_stats.h"
+#include "mongo/db/sorter/sorter_thread_pool.h"
 #include "mongo/db/storage/encryption_hooks.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/destructor_guard.h"
 #include "mongo/util/file.h"
+#include "mongo/util/future.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/shared_buffer_fragment.h"
 #include "mongo/util/str.h"
 
@@ -167,6 +173,88 @@ void dassertCompIsSane(const Comparator& comp, const Key& lhs, const Key& rhs) {
 #endif
 }
 
+// The smallest number of elements each thread is given by parallelSort().
+constexpr std::size_t kMinParallelSortChunkSize = 16 * 1024;
+
+/**
+ * Returns the number of threads parallelSort() uses to sort 'size' elements with up to
+ * 'numThreads' threads.
+ */
+inline std::size_t parallelSortThreads(std::size_t size, std::size_t numThreads) {
+    return std::max<std::size_t>(1, std::min(numThreads, size / kMinParallelSortChunkSize));
+}
+
+/**
+ * Returns an upper bound of the bytes parallelSort() allocates to merge 'size' elements of type
+ * 'T' sorted with up to 'numThreads' threads. std::inplace_merge() buffers at most the shorter of
+ * the two ranges it merges, which is never more than half of all the elements.
+ */
+template <typename T>
+std::size_t parallelSortMergeBufferBytes(std::size_t size, std::size_t numThreads) {
+    return parallelSortThreads(size, numThreads) > 1 ? sizeof(T) * (size / 2 + 1) : 0;
+}
+
+/**
+ * Sorts [begin, end) with 'less' using up to 'numThreads' threads, including the calling one. The
+ * range is split into one chunk per thread, the chunks other than the first are sorted on the
+ * shared parallel sort pool while the calling thread sorts the first one, and they are then merged
+ * pairwise. Ranges too small to benefit from more threads are sorted on the calling thread.
+ */
+template <typename It, typename Less>
+void parallelSort(It begin, It end, const Less& less, std::size_t numThreads) {
+    const std::size_t size = std::distance(begin, end);
+    numThreads = parallelSortThreads(size, numThreads);
+    if (numThreads <= 1) {
+        std::sort(begin, end, less);
+        return;
+    }
+
+    std::vector<It> bounds;
+    for (std::size_t i = 0; i <= numThreads; ++i) {
+        bounds.push_back(begin + size * i / numThreads);
+    }
+
+    std::vector<std::exception_ptr> errors(numThreads);
+    auto sortChunk = [&](std::size_t i) {
+        try {
+            std::sort(bounds[i], bounds[i + 1], less);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    auto mutex = MONGO_MAKE_LATCH("parallelSort");
+    stdx::condition_variable chunkSortedCond;
+    std::size_t numChunksSorted = 0;
+    for (std::size_t i = 1; i < numThreads; ++i) {
+        // If the pool is shut down, the task runs on this thread instead.
+        getParallelSortThreadPool().schedule([&, i](Status) {
+            sortChunk(i);
+            stdx::lock_guard lk(mutex);
+            ++numChunksSorted;
+            chunkSortedCond.notify_all();
+        });
+    }
+    sortChunk(0);
+    {
+        stdx::unique_lock lk(mutex);
+        chunkSortedCond.wait(lk, [&] { return numChunksSorted == numThreads - 1; });
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (std::size_t width = 1; width < numThreads; width *= 2) {
+        for (std::size_t i = 0; i + width < numThreads; i += 2 * width) {
+            std::inplace_merge(
+                bounds[i], bounds[i + width], bounds[std::min(i + 2 * width, numThreads)], less);
+        }
+    }
+}
+
 /**
  * Returns results from sorted in-memory storage.
  */
@@ -282,15 +370,21 @@ public:
                  const Settings& settings,
                  const boost::optional<DatabaseName>& dbName,
                  const size_t checksum,
-                 const SorterChecksumVersion checksumVersion)
+                 const SorterChecksumVersion checksumVersion,
+                 const bool keysPrefixCompressed = false)
         : _settings(settings),
           _file(std::move(file)),
           _fileStartOffset(fileStartOffset),
           _fileCurrentOffset(fileStartOffset),
           _fileEndOffset(fileEndOffset),
           _dbName(dbName),
+          _keysPrefixCompressed(keysPrefixCompressed),
           _afterReadChecksumCalculator(checksumVersion),
-          _originalChecksum(checksum) {}
+          _originalChecksum(checksum) {
+        uassert(9601500,
+                "Spilled keys are stored relative to one another, which this type does not support",
+                !_keysPrefixCompressed || SorterKeyIsPrefixCompressible<Key>::value);
+    }
 
     void openSource() override {}
 
@@ -334,6 +428,11 @@ public:
         // buffer. Since Key comes before Value in the _bufferReader, and C++ makes no function
         // parameter evaluation order guarantees, we cannot deserialize Key and Value straight into
         // the Data constructor
+        if constexpr (SorterKeyIsPrefixCompressible<Key>::value) {
+            if (_keysPrefixCompressed) {
+                return Key::deserializeForSorter(*_bufferReader, _settings.first, &_previousKey);
+            }
+        }
         return Key::deserializeForSorter(*_bufferReader, _settings.first);
     }
 
@@ -363,10 +462,88 @@ public:
         if (_afterReadChecksumCalculator.version() != SorterChecksumVersion::v1) {
             range.setChecksumVersion(_afterReadChecksumCalculator.version());
         }
+        if (_keysPrefixCompressed) {
+            range.setKeysPrefixCompressed(true);
+        }
         return range;
     }
 
+    void readAheadOn(std::shared_ptr<ThreadPool> executor) override {
+        _readAheadExecutor = std::move(executor);
+    }
+
 private:
+    /**
+     * A block of the sorted data range as it is stored on disk, that is before being decrypted and
+     * decompressed.
+     */
+    struct RawBlock {
+        int32_t rawSize;  // Negative if the block is compressed.
+        std::unique_ptr<char[]> data;
+        std::streamoff endOffset;  // File offset right after the block.
+    };
+
+    /**
+     * Reads the block starting at 'offset' from 'file', or returns boost::none if 'offset' is the
+     * end of the range. This may run on a read-ahead thread, so it must not touch the iterator.
+     */
+    static boost::optional<RawBlock> _readBlock(typename Sorter<Key, Value>::File& file,
+                                                std::streamoff offset,
+                                                std::streamoff endOffset) {
+        if (offset == endOffset) {
+            return boost::none;
+        }
+
+        invariant(offset < endOffset,
+                  str::stream() << "Current file offset (" << offset
+                                << ") greater than end offset (" << endOffset << ")");
+
+        RawBlock block;
+        file.read(offset, sizeof(block.rawSize), &block.rawSize);
+        offset += sizeof(block.rawSize);
+        uassert(16816, "file too short?", offset != endOffset);
+
+        const int32_t blockSize = std::abs(block.rawSize);
+        block.data.reset(new char[blockSize]);
+        file.read(offset, blockSize, block.data.get());
+        block.endOffset = offset + blockSize;
+        return block;
+    }
+
+    /**
+     * Returns the block at _fileCurrentOffset, either from the pending read-ahead or by reading it
+     * now.
+     */
+    boost::optional<RawBlock> _nextBlock() {
+        if (!_readAhead) {
+            return _readBlock(*_file, _fileCurrentOffset, _fileEndOffset);
+        }
+
+        auto block = std::move(*_readAhead).get();
+        _readAhead.reset();
+        return block;
+    }
+
+    /**
+     * Starts reading the block at _fileCurrentOffset on the read-ahead executor, if there is one.
+     */
+    void _scheduleReadAhead() {
+        if (!_readAheadExecutor || _fileCurrentOffset == _fileEndOffset) {
+            return;
+        }
+
+        auto [promise, future] = makePromiseFuture<boost::optional<RawBlock>>();
+        _readAheadExecutor->schedule([promise = std::move(promise),
+                                      file = _file,
+                                      offset = _fileCurrentOffset,
+                                      endOffset = _fileEndOffset](Status) mutable {
+            // A shut down executor runs the task inline with an error status, in which case the
+            // block is simply read synchronously.
+            promise.setWith([&] { return _readBlock(*file, offset, endOffset); });
+        });
+        _readAhead.emplace(std::move(future));
+    }
+
     /**
      * Attempts to refill the _bufferReader if it is empty. Expects _done to be false.
      */
@@ -388,18 +565,22 @@ private:
      * read, then _done is set to true and the function returns immediately.
      */
     void _fillBufferFromDisk() {
-        int32_t rawSize;
-        _read(&rawSize, sizeof(rawSize));
-        if (_done)
+        auto block = _nextBlock();
+        if (!block) {
+            _done = true;
             return;
+        }
+        _fileCurrentOffset = block->endOffset;
+        _scheduleReadAhead();
+
+        // The first key of each block is stored in full.
+        _previousKey.clear();
 
         // negative size means compressed
-        const bool compressed = rawSize < 0;
-        int32_t blockSize = std::abs(rawSize);
+        const bool compressed = block->rawSize < 0;
+        int32_t blockSize = std::abs(block->rawSize);
 
-        _buffer.reset(new char[blockSize]);
-        _read(_buffer.get(), blockSize);
-        uassert(16816, "file too short?", !_done);
+        _buffer = std::move(block->data);
 
         if (auto encryptionHooks = getEncryptionHooksIfEnabled()) {
             std::unique_ptr<char[]> out(new char[blockSize]);
@@ -440,23 +621,6 @@ private:
         _bufferReader.reset(new BufReader(_buffer.get(), uncompressedSize));
     }
 
-    /**
-     * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
-     */
-    void _read(void* out, size_t size) {
-        if (_fileCurrentOffset == _fileEndOffset) {
-            _done = true;
-            return;
-        }
-
-        invariant(_fileCurrentOffset < _fileEndOffset,
-                  str::stream() << "Current file offset (" << _fileCurrentOffset
-                                << ") greater than end offset (" << _fileEndOffset << ")");
-
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
-    }
-
     const Settings _settings;
     bool _done = false;
 
@@ -469,6 +633,16 @@ private:
     std::streamoff _fileEndOffset;      // File offset at which the sorted data range ends.
     boost::optional<DatabaseName> _dbName;
 
+    // Whether each key is stored relative to the previous key of its block, which '_previousKey'
+    // describes.
+    const bool _keysPrefixCompressed;
+    std::string _previousKey;
+
+    // If set, the block following the one in _buffer is read ahead on this executor into
+    // _readAhead.
+    std::shared_ptr<ThreadPool> _readAheadExecutor;
+    boost::optional<Future<boost::optional<RawBlock>>> _readAhead;
+
     // Points to the beginning of a serialized key in the key-value pair currently being read, and
     // used for computing the checksum value. This is set to nullptr after reading each key-value
     // pair.
@@ -489,6 +663,14 @@ private:
  * ranges within the same file. The input iterators must implement nextWithDeferredValue() and
  * getDeferredValue(). This class is given the data source file name upon construction and is
  * responsible for deleting the data source file upon destruction.
+ *
+ * The inputs are merged with a tournament tree of losers: every internal node remembers the input
+ * that lost the match played there, so advancing the winning input only replays the matches on
+ * the path from its leaf to the root, which takes exactly log(k) comparisons for k inputs. Ties
+ * are broken on the input number to keep the merge stable.
+ *
+ * If SortOptions::readAheadSpills is set, the inputs read their next block ahead on a background
+ * thread owned by this iterator.
  */
 template <typename Key, typename Value, typename Comparator>
 class MergeIterator : public SortIteratorInterface<Key, Value> {
@@ -503,10 +685,23 @@ public:
           _remaining(opts.limit ? opts.limit : std::numeric_limits<unsigned long long>::max()),
           _positioned(false),
           _greater(comp) {
+        if (_opts.readAheadSpills && iters.size() > 1) {
+            ThreadPool::Options options;
+            options.poolName = "SorterReadAhead";
+            options.threadNamePrefix = "SorterReadAhead-";
+            options.minThreads = 0;
+            options.maxThreads = 1;
+            _readAheadExecutor = std::make_shared<ThreadPool>(std::move(options));
+            _readAheadExecutor->startup();
+        }
+
         for (size_t i = 0; i < iters.size(); i++) {
+            if (_readAheadExecutor) {
+                iters[i]->readAheadOn(_readAheadExecutor);
+            }
             iters[i]->openSource();
             if (iters[i]->more()) {
-                _heap.push_back(
+                _streams.push_back(
                     std::make_shared<Stream>(i, iters[i]->nextWithDeferredValue(), iters[i]));
                 if (i > _maxFile) {
                     _maxFile = i;
@@ -516,46 +711,45 @@ public:
             }
         }
 
-        if (_heap.empty()) {
+        if (_streams.empty()) {
             _remaining = 0;
             return;
         }
 
-        std::make_heap(_heap.begin(), _heap.end(), _greater);
-        std::pop_heap(_heap.begin(), _heap.end(), _greater);
-        _current = _heap.back();
-        _heap.pop_back();
-
+        _numLiveStreams = _streams.size();
+        _buildTree();
         _positioned = true;
     }
 
     ~MergeIterator() override {
         _current.reset();
-        _heap.clear();
+        _streams.clear();
+        if (_readAheadExecutor) {
+            _readAheadExecutor->shutdown();
+            _readAheadExecutor->join();
+        }
     }
 
     void openSource() override {}
     void closeSource() override {}
 
     void addSource(std::shared_ptr<Input> iter) {
+        if (_readAheadExecutor) {
+            iter->readAheadOn(_readAheadExecutor);
+        }
         iter->openSource();
         if (iter->more()) {
-            _heap.push_back(
+            _streams.push_back(
                 std::make_shared<Stream>(++_maxFile, iter->nextWithDeferredValue(), iter));
-            std::push_heap(_heap.begin(), _heap.end(), _greater);
-
-            if (_greater(_current, _heap.front())) {
-                std::pop_heap(_heap.begin(), _heap.end(), _greater);
-                std::swap(_current, _heap.back());
-                std::push_heap(_heap.begin(), _heap.end(), _greater);
-            }
+            ++_numLiveStreams;
+            _buildTree();
         } else {
             iter->closeSource();
         }
     }
 
     bool more() override {
-        if (_remaining > 0 && (_positioned || !_heap.empty() || _current->more()))
+        if (_remaining > 0 && (_positioned || _numLiveStreams > 1 || _current->more()))
             return true;
 
         _remaining = 0;
@@ -597,16 +791,14 @@ public:
     }
 
     void advance() {
+        const size_t winner = _tree[0];
         if (!_current->advance()) {
-            invariant(!_heap.empty());
-            std::pop_heap(_heap.begin(), _heap.end(), _greater);
-            _current = _heap.back();
-            _heap.pop_back();
-        } else if (!_heap.empty() && _greater(_current, _heap.front())) {
-            std::pop_heap(_heap.begin(), _heap.end(), _greater);
-            std::swap(_current, _heap.back());
-            std::push_heap(_heap.begin(), _heap.end(), _greater);
+            invariant(_numLiveStreams > 1);
+            _streams[winner].reset();
+            --_numLiveStreams;
         }
+
+        _replay(winner);
     }
 
 private:
@@ -670,13 +862,81 @@ private:
         const Comparator _comp;
     };
 
+    /**
+     * Returns whether the stream at index 'lhs' of _streams wins a match against the one at index
+     * 'rhs'. Exhausted streams lose against everything.
+     */
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (!_streams[lhs]) {
+            return false;
+        }
+        if (!_streams[rhs]) {
+            return true;
+        }
+        return _greater(_streams[rhs], _streams[lhs]);
+    }
+
+    /**
+     * Plays all the matches of the subtree rooted at 'node' and returns its winner. The leaves are
+     * the nodes [k, 2k) for k streams, so that the leaf of stream i is the node k + i.
+     */
+    size_t _playSubtree(size_t node) {
+        const size_t numStreams = _streams.size();
+        if (node >= numStreams) {
+            return node - numStreams;
+        }
+
+        size_t left = _playSubtree(2 * node);
+        size_t right = _playSubtree(2 * node + 1);
+        if (_beats(right, left)) {
+            std::swap(left, right);
+        }
+        _tree[node] = right;
+        return left;
+    }
+
+    /**
+     * (Re)builds the whole tree from the current keys of the streams.
+     */
+    void _buildTree() {
+        _tree.resize(_streams.size());
+        _tree[0] = _playSubtree(1);
+        _current = _streams[_tree[0]];
+    }
+
+    /**
+     * Replays the matches on the path from the leaf of the stream at index 'idx' to the root,
+     * after its key has changed.
+     */
+    void _replay(size_t idx) {
+        size_t winner = idx;
+        for (size_t node = (idx + _streams.size()) / 2; node > 0; node /= 2) {
+            if (_beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+        _current = _streams[winner];
+    }
+
     SortOptions _opts;
     unsigned long long _remaining;
     bool _positioned;
     std::shared_ptr<Stream> _current;
-    std::vector<std::shared_ptr<Stream>> _heap;  // MinHeap
-    STLComparator _greater;                      // named so calls make sense
-    size_t _maxFile = 0;                         // The maximum file identifier used thus far
+
+    // The streams in the order they were added. Exhausted streams are reset but keep their leaf.
+    std::vector<std::shared_ptr<Stream>> _streams;
+    size_t _numLiveStreams = 0;
+
+    // The tournament tree over _streams. _tree[0] is the index of the overall winner, and
+    // _tree[n] for n in [1, k) is the index of the stream that lost the match at internal node n.
+    std::vector<size_t> _tree;
+
+    STLComparator _greater;  // named so calls make sense
+    size_t _maxFile = 0;     // The maximum file identifier used thus far
+
+    // Executor the inputs read ahead on, if SortOptions::readAheadSpills is set.
+    std::shared_ptr<ThreadPool> _readAheadExecutor;
 };
 
 template <typename Key, typename Value, typename Comparator>
@@ -865,7 +1125,8 @@ public:
                                this->_settings,
                                this->_opts.dbName,
                                range.getChecksum(),
-                               range.getChecksumVersion().value_or(SorterChecksumVersion::v1));
+                               range.getChecksumVersion().value_or(SorterChecksumVersion::v1),
+                               range.getKeysPrefixCompressed().value_or(false));
                        });
         this->_stats.setSpilledRanges(this->_iters.size());
     }
@@ -886,7 +1147,10 @@ public:
             this->_stats.incrementMemUsage(memUsage);
         }
 
-        if (this->_stats.memUsage() > this->_opts.maxMemoryUsageBytes) {
+        // Sorting the data in parallel allocates a buffer to merge the sorted chunks.
+        const auto mergeBufferBytes =
+            sorter::parallelSortMergeBufferBytes<Data>(_data.size(), this->_opts.sortThreads);
+        if (this->_stats.memUsage() + mergeBufferBytes > this->_opts.maxMemoryUsageBytes) {
             spill();
         }
     }
@@ -952,7 +1216,7 @@ private:
 
     void sort() {
         STLComparator less(this->_comp);
-        std::sort(_data.begin(), _data.end(), less);
+        parallelSort(_data.begin(), _data.end(), less, this->_opts.sortThreads);
         this->_stats.incrementNumSorted(_data.size());
         auto& memPool = this->_memPool;
         if (memPool) {
@@ -1472,6 +1736,7 @@ Sorter<Key, Value>::File::~File() {
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size, void* out) {
+    stdx::lock_guard<Latch> lk(_mutex);
     if (!_file.is_open()) {
         _open();
     }
@@ -1508,6 +1773,7 @@ void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size,
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
+    stdx::lock_guard<Latch> lk(_mutex);
     _ensureOpenForWriting();
 
     try {
@@ -1533,6 +1799,7 @@ void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
 
 template <typename Key, typename Value>
 std::streamoff Sorter<Key, Value>::File::currentOffset() {
+    stdx::lock_guard<Latch> lk(_mutex);
     _ensureOpenForWriting();
     invariant(_offset >= 0);
     return _offset;
@@ -1586,7 +1853,8 @@ SortedFileWriter<Key, Value>::SortedFileWriter(
       _file(std::move(file)),
       _checksumCalculator(_getSorterChecksumVersion()),
       _fileStartOffset(_file->currentOffset()),
-      _opts(opts) {
+      _opts(opts),
+      _keysPrefixCompressed(_shouldPrefixCompressKeys()) {
     // This should be checked by consumers, but if we get here don't allow writes.
     uassert(16946,
             "Attempting to use external sort from mongos. This is not allowed.",
@@ -1604,7 +1872,15 @@ void SortedFileWriter<Key, Value>::addAlreadySorted(const Key& key, const Value&
     int _nextObjPos = _buffer.len();
 
     // Add serialized key and value to the buffer.
-    key.serializeForSorter(_buffer);
+    if constexpr (SorterKeyIsPrefixCompressible<Key>::value) {
+        if (_keysPrefixCompressed) {
+            key.serializeForSorter(_buffer, &_previousKey);
+        } else {
+            key.serializeForSorter(_buffer);
+        }
+    } else {
+        key.serializeForSorter(_buffer);
+    }
     val.serializeForSorter(_buffer);
 
     // Serializing the key and value grows the buffer, but _buffer.buf() still points to the
@@ -1667,6 +1943,9 @@ void SortedFileWriter<Key, Value>::writeChunk() {
     _file->write(outBuffer, std::abs(size));
 
     _buffer.reset();
+
+    // Blocks can be decoded independently of one another, so the next key is stored in full.
+    _previousKey.clear();
 }
 
 template <typename Key, typename Value>
@@ -1679,7 +1958,8 @@ SortIteratorInterface<Key, Value>* SortedFileWriter<Key, Value>::done() {
                                                 _settings,
                                                 _opts.dbName,
                                                 _checksumCalculator.checksum(),
-                                                _checksumCalculator.version());
+                                                _checksumCalculator.version(),
+                                                _keysPrefixCompressed);
 }
 
 template <typename Key, typename Value>
@@ -1691,10 +1971,18 @@ SortedFileWriter<Key, Value>::createFileIteratorForResume(
     const Settings& settings,
     const boost::optional<DatabaseName>& dbName,
     const size_t checksum,
-    const SorterChecksumVersion checksumVersion) {
-
-    return std::shared_ptr<SortIteratorInterface<Key, Value>>(new sorter::FileIterator<Key, Value>(
-        file, fileStartOffset, fileEndOffset, settings, dbName, checksum, checksumVersion));
+    const SorterChecksumVersion checksumVersion,
+    const bool keysPrefixCompressed) {
+
+    return std::shared_ptr<SortIteratorInterface<Key, Value>>(
+        new sorter::FileIterator<Key, Value>(file,
+                                             fileStartOffset,
+                                             fileEndOffset,
+                                             settings,
+                                             dbName,
+                                             checksum,
+                                             checksumVersion,
+                                             keysPrefixCompressed));
 }
 
 template <typename Key, typename Value>
@@ -1709,6 +1997,15 @@ SorterChecksumVersion SortedFileWriter<Key, Value>::_getSorterChecksumVersion()
     return SorterChecksumVersion::v1;
 }
 
+template <typename Key, typename Value>
+bool SortedFileWriter<Key, Value>::_shouldPrefixCompressKeys() const {
+    // Spilled ranges outlive the process for resumable index builds, so only write keys that older
+    // versions cannot read once the FCV rules out downgrading to them.
+    return SorterKeyIsPrefixCompressible<Key>::value &&
+        gFeatureFlagSorterPrefixCompressedKeys.isEnabledUseLatestFCVWhenUninitialized(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot());
+}
+
 template <typename Key, typename Value, typename Comparator, typename BoundMaker>
 BoundedSorter<Key, Value, Comparator, BoundMaker>::BoundedSorter(const SortOptions& opts,
                                                                  Comparator comp,
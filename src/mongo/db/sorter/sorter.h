@@ -32,6 +32,7 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -55,6 +56,7 @@
 #include "mongo/db/sorter/sorter_stats.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 #include "mongo/util/shared_buffer_fragment.h"
@@ -84,6 +86,15 @@
  * // Return *this if your type doesn't have an unowned state.
  * Type getOwned() const;
  *
+ * Key types may also provide the following members, in which case keys spilled to disk only store
+ * what follows their common prefix with the key before them in the same block. 'previous' holds
+ * whatever the type needs to recover that prefix, and is empty for the first key of each block.
+ *
+ * void serializeForSorter(BufBuilder& buf, std::string* previous) const;
+ * static Type deserializeForSorter(BufReader& buf,
+ *                                  const Type::SorterDeserializeSettings&,
+ *                                  std::string* previous);
+ *
  * Comparators are functors that that compare std::pair<Key, Value> and return an
  * int less than, equal to, or greater than 0 depending on how the two pairs
  * compare with the same semantics as memcmp.
@@ -107,6 +118,8 @@
 
 namespace mongo {
 
+class ThreadPool;
+
 /**
  * Runtime options that control the Sorter's behavior
  */
@@ -147,6 +160,14 @@ struct SortOptions {
     // instead of copying.
     bool moveSortedDataIntoIterator;
 
+    // If set to true, merges of spilled ranges read the next block of every range ahead on a
+    // background thread, so that disk reads overlap with the comparisons done by the merge.
+    bool readAheadSpills;
+
+    // The number of threads used to sort the in-memory data before it is spilled or returned. A
+    // value of 1 sorts on the calling thread. Only honored by sorters without a limit.
+    size_t sortThreads;
+
     SortOptions()
         : limit(0),
           maxMemoryUsageBytes(DefaultMaxMemoryUsageBytes),
@@ -154,7 +175,9 @@ struct SortOptions {
           sorterFileStats(nullptr),
           sorterTracker(nullptr),
           useMemPool(false),
-          moveSortedDataIntoIterator(false) {}
+          moveSortedDataIntoIterator(false),
+          readAheadSpills(false),
+          sortThreads(1) {}
 
     // Fluent API to support expressions like SortOptions().Limit(1000).ExtSortAllowed(true)
 
@@ -202,6 +225,16 @@ struct SortOptions {
         useMemPool = usePool;
         return *this;
     }
+
+    SortOptions& ReadAheadSpills(bool newReadAheadSpills = true) {
+        readAheadSpills = newReadAheadSpills;
+        return *this;
+    }
+
+    SortOptions& SortThreads(size_t newSortThreads) {
+        sortThreads = std::max(newSortThreads, static_cast<size_t>(1));
+        return *this;
+    }
 };
 
 /**
@@ -277,6 +310,12 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    /**
+     * Allows the iterator to schedule reads of its upcoming data on 'executor' ahead of the
+     * consumer asking for it. Only FileIterator reads ahead, all other iterators ignore this.
+     */
+    virtual void readAheadOn(std::shared_ptr<ThreadPool> executor) {}
+
 protected:
     SortIteratorInterface() {}  // can only be constructed as a base
 };
@@ -383,6 +422,10 @@ public:
 
         // If set, this points to an external metrics holder for tracking file open/close activity.
         SorterFileStats* _stats;
+
+        // Serializes accesses to '_file', which may be read from a read-ahead thread while the
+        // owning Sorter is still using it.
+        Mutex _mutex = MONGO_MAKE_LATCH("Sorter::File::_mutex");
     };
 
     explicit Sorter(const SortOptions& opts);
@@ -607,6 +650,19 @@ private:
     bool _done = false;
 };
 
+/**
+ * True if Key can be serialized relative to the key before it, as documented at the top of this
+ * file.
+ */
+template <typename Key, typename = void>
+struct SorterKeyIsPrefixCompressible : std::false_type {};
+
+template <typename Key>
+struct SorterKeyIsPrefixCompressible<
+    Key,
+    std::void_t<decltype(std::declval<const Key&>().serializeForSorter(
+        std::declval<BufBuilder&>(), std::declval<std::string*>()))>> : std::true_type {};
+
 /**
  * Appends a pre-sorted range of data to a given file and hands back an Iterator over that file
  * range.
@@ -652,10 +708,12 @@ public:
         const Settings& settings,
         const boost::optional<DatabaseName>& dbName,
         size_t checksum,
-        SorterChecksumVersion checksumVersion);
+        SorterChecksumVersion checksumVersion,
+        bool keysPrefixCompressed = false);
 
 private:
     SorterChecksumVersion _getSorterChecksumVersion() const;
+    bool _shouldPrefixCompressKeys() const;
 
     const Settings _settings;
     std::shared_ptr<typename Sorter<Key, Value>::File> _file;
@@ -670,6 +728,11 @@ private:
     std::streamoff _fileStartOffset;
 
     SortOptions _opts;
+
+    // Whether keys are stored relative to the previous key of their block, which '_previousKey'
+    // describes. Recorded in the SorterRange so that readers know how to deserialize the keys.
+    const bool _keysPrefixCompressed;
+    std::string _previousKey;
 };
 }  // namespace mongo
 
@@ -34,7 +34,9 @@
 #include <ctime>
 #include <fmt/format.h>
 #include <fstream>  // IWYU pragma: keep
+#include <functional>
 #include <memory>
+#include <numeric>
 
 #include <boost/filesystem/path.hpp>
 
@@ -484,6 +486,17 @@ public:
             ASSERT_ITERATORS_EQUIVALENT(mergeIterators(iterators, tempDir, DESC),
                                         std::make_shared<IntIterator>(30, 0, -1));
         }
+        {  // test ASC with a number of sources that is not a power of two
+            std::shared_ptr<IWIterator> iterators[] = {
+                std::make_shared<IntIterator>(4, 50, 5),   // 4, 9, ... 49
+                std::make_shared<IntIterator>(0, 50, 5),   // 0, 5, ... 45
+                std::make_shared<IntIterator>(3, 50, 5),   // 3, 8, ... 48
+                std::make_shared<IntIterator>(1, 50, 5),   // 1, 6, ... 46
+                std::make_shared<IntIterator>(2, 50, 5)};  // 2, 7, ... 47
+
+            ASSERT_ITERATORS_EQUIVALENT(mergeIterators(iterators, tempDir, ASC),
+                                        std::make_shared<IntIterator>(0, 50, 1));
+        }
         {  // test Limit
             std::shared_ptr<IWIterator> iterators[] = {
                 std::make_shared<IntIterator>(1, 20, 2),   // 1, 3, ... 19
@@ -517,6 +530,30 @@ public:
     }
 };
 
+class ParallelSortTests {
+public:
+    void run() {
+        const int numItems = 100 * 1000 + 7;
+        std::vector<int> expected(numItems);
+        std::iota(expected.begin(), expected.end(), 0);
+
+        std::vector<int> shuffled = expected;
+        PseudoRandom random(int64_t(time(nullptr)));
+        std::shuffle(shuffled.begin(), shuffled.end(), random.urbg());
+
+        for (std::size_t numThreads : {1, 2, 3, 7}) {
+            std::vector<int> data = shuffled;
+            parallelSort(data.begin(), data.end(), std::less<int>(), numThreads);
+            ASSERT(data == expected);
+        }
+
+        // Only sorts that use more than one thread allocate a buffer to merge the sorted chunks.
+        ASSERT_EQ(parallelSortMergeBufferBytes<int>(numItems, 1), 0U);
+        ASSERT_EQ(parallelSortMergeBufferBytes<int>(kMinParallelSortChunkSize, 7), 0U);
+        ASSERT_EQ(parallelSortMergeBufferBytes<int>(numItems, 7), sizeof(int) * (numItems / 2 + 1));
+    }
+};
+
 namespace SorterTests {
 class Basic {
 public:
@@ -964,6 +1001,14 @@ public:
 };
 
 
+template <bool Random = true>
+class LotsOfDataLittleMemoryReadAhead : public LotsOfDataLittleMemory<Random> {
+    typedef LotsOfDataLittleMemory<Random> Parent;
+    SortOptions adjustSortOptions(SortOptions opts) override {
+        return Parent::adjustSortOptions(opts).ReadAheadSpills().SortThreads(4);
+    }
+};
+
 template <long long Limit, bool Random = true>
 class LotsOfDataWithLimit : public LotsOfDataLittleMemory<Random> {
     typedef LotsOfDataLittleMemory<Random> Parent;
@@ -1067,11 +1112,13 @@ public:
         add<InMemIterTests>();
         add<SortedFileWriterAndFileIteratorTests>();
         add<MergeIteratorTests>();
+        add<ParallelSortTests>();
         add<SorterTests::Basic>();
         add<SorterTests::Limit>();
         add<SorterTests::Dupes>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/false>>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/true>>();
+        add<SorterTests::LotsOfDataLittleMemoryReadAhead</*random=*/true>>();
         add<SorterTests::LotsOfSpillsLittleMemory</*random=*/false>>();
         add<SorterTests::LotsOfSpillsLittleMemory</*random=*/true>>();
         add<SorterTests::LotsOfDataWithLimit<1, /*random=*/false>>();     // limit=1 is special case
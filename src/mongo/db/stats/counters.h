@@ -428,14 +428,40 @@ public:
         idHackQueryCounter.increment();
     }
 
-    void incrementExpressQueryCounter() {
+    // The kinds of operations which can be executed by the express executor.
+    enum class ExpressPath { kIdLookup, kIndexedEquality, kUpdate, kDelete };
+
+    void incrementExpressQueryCounter(ExpressPath path) {
         expressQueryCounter.increment();
+        switch (path) {
+            case ExpressPath::kIdLookup:
+                expressIdLookupCounter.increment();
+                break;
+            case ExpressPath::kIndexedEquality:
+                expressIndexedEqualityCounter.increment();
+                break;
+            case ExpressPath::kUpdate:
+                expressUpdateCounter.increment();
+                break;
+            case ExpressPath::kDelete:
+                expressDeleteCounter.increment();
+                break;
+        }
     }
 
     // Counter for the number of queries planned using idHack fast planning.
     Counter64& idHackQueryCounter = *MetricBuilder<Counter64>{"query.planning.fastPath.idHack"};
     // Counter for the number of queries planned using express fast planning.
     Counter64& expressQueryCounter = *MetricBuilder<Counter64>{"query.planning.fastPath.express"};
+    // Breakdown of 'expressQueryCounter' by the kind of operation.
+    Counter64& expressIdLookupCounter =
+        *MetricBuilder<Counter64>{"query.planning.fastPath.expressPaths.idLookup"};
+    Counter64& expressIndexedEqualityCounter =
+        *MetricBuilder<Counter64>{"query.planning.fastPath.expressPaths.indexedEquality"};
+    Counter64& expressUpdateCounter =
+        *MetricBuilder<Counter64>{"query.planning.fastPath.expressPaths.update"};
+    Counter64& expressDeleteCounter =
+        *MetricBuilder<Counter64>{"query.planning.fastPath.expressPaths.delete"};
 };
 extern FastPathQueryCounters fastPathQueryCounters;
 
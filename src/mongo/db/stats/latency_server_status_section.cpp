@@ -54,12 +54,15 @@ public:
         BSONObjBuilder latencyBuilder;
         bool includeHistograms = false;
         bool slowBuckets = false;
+        bool includePercentiles = false;
         if (configElem.type() == BSONType::Object) {
             includeHistograms = configElem.Obj()["histograms"].trueValue();
             slowBuckets = configElem.Obj()["slowBuckets"].trueValue();
+            includePercentiles = configElem.Obj()["percentiles"].trueValue();
         }
         Top::get(opCtx->getServiceContext())
-            .appendGlobalLatencyStats(includeHistograms, slowBuckets, &latencyBuilder);
+            .appendGlobalLatencyStats(
+                includeHistograms, slowBuckets, &latencyBuilder, includePercentiles);
         return latencyBuilder.obj();
     }
 };
@@ -75,12 +78,15 @@ class WorkingTimeHistogramServerStatusSection final : public ServerStatusSection
         BSONObjBuilder latencyBuilder;
         bool includeHistograms = false;
         bool slowBuckets = false;
+        bool includePercentiles = false;
         if (configElem.type() == BSONType::Object) {
             includeHistograms = configElem.Obj()["histograms"].trueValue();
             slowBuckets = configElem.Obj()["slowBuckets"].trueValue();
+            includePercentiles = configElem.Obj()["percentiles"].trueValue();
         }
         Top::get(opCtx->getServiceContext())
-            .appendWorkingTimeStats(includeHistograms, slowBuckets, &latencyBuilder);
+            .appendWorkingTimeStats(
+                includeHistograms, slowBuckets, &latencyBuilder, includePercentiles);
         return latencyBuilder.obj();
     }
 };
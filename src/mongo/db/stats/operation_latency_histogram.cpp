@@ -28,8 +28,10 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <utility>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/server_options.h"
@@ -158,11 +160,58 @@ void increment(HistogramsType& histograms,
     updateHistogram(histograms[index], bucket, latency, isQueryableEncryptionOperation);
 }
 
+template <typename HistogramDataType>
+uint64_t loadBucket(const HistogramDataType& data, size_t i) {
+    if constexpr (std::is_same_v<HistogramDataType,
+                                 AtomicOperationLatencyHistogram::HistogramType>) {
+        return data.buckets[i].loadRelaxed();
+    } else {
+        return data.buckets[i];
+    }
+}
+
+// Appends the estimated percentiles of the latencies recorded in 'data'. Each estimate is the upper
+// bound of the bucket holding the percentile, or the lower bound of the last bucket which has no
+// upper bound. Concurrent increments may be partially observed, which only skews the estimates.
+template <typename HistogramDataType>
+void appendPercentiles(const HistogramDataType& data, BSONObjBuilder& builder) {
+    static constexpr std::array<std::pair<StringData, double>, 4> kPercentiles = {
+        std::pair{"p50"_sd, 0.5},
+        std::pair{"p90"_sd, 0.9},
+        std::pair{"p99"_sd, 0.99},
+        std::pair{"p999"_sd, 0.999}};
+
+    std::array<uint64_t, operation_latency_histogram_details::kMaxBuckets> buckets;
+    uint64_t total = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        buckets[i] = loadBucket(data, i);
+        total += buckets[i];
+    }
+
+    BSONObjBuilder percentilesBuilder(builder.subobjStart("percentiles"));
+    size_t bucket = 0;
+    uint64_t cumulative = 0;
+    for (const auto& [name, percentile] : kPercentiles) {
+        uint64_t estimate = 0;
+        if (total > 0) {
+            const auto rank = static_cast<uint64_t>(std::ceil(percentile * total));
+            while (bucket < buckets.size() - 1 && cumulative + buckets[bucket] < rank) {
+                cumulative += buckets[bucket++];
+            }
+            estimate =
+                bucket < buckets.size() - 1 ? kLowerBounds[bucket + 1] : kLowerBounds[bucket];
+        }
+        percentilesBuilder.append(name, static_cast<long long>(estimate));
+    }
+    percentilesBuilder.doneFast();
+}
+
 template <typename HistogramDataType, typename StringType>
 void appendHistogram(const HistogramDataType& data,
                      StringType key,
                      bool includeHistograms,
                      bool slowMSBucketsOnly,
+                     bool includePercentiles,
                      BSONObjBuilder& builder) {
     BSONObjBuilder histogramBuilder(builder.subobjStart(key));
     const uint64_t slowMicros = static_cast<uint64_t>(serverGlobalParams.slowMS.load()) * 1000;
@@ -174,14 +223,7 @@ void appendHistogram(const HistogramDataType& data,
     if (includeHistograms) {
         BSONArrayBuilder arrayBuilder(histogramBuilder.subarrayStart("histogram"));
         for (size_t i = 0; i < operation_latency_histogram_details::kMaxBuckets; i++) {
-            const auto bucketValue = [&] {
-                if constexpr (std::is_same_v<HistogramDataType,
-                                             AtomicOperationLatencyHistogram::HistogramType>) {
-                    return data.buckets[i].loadRelaxed();
-                } else {
-                    return data.buckets[i];
-                }
-            }();
+            const auto bucketValue = loadBucket(data, i);
 
             if (bucketValue == 0) {
                 continue;
@@ -215,6 +257,10 @@ void appendHistogram(const HistogramDataType& data,
         arrayBuilder.doneFast();
     }
 
+    if (includePercentiles) {
+        appendPercentiles(data, histogramBuilder);
+    }
+
     uint64_t latency, ops, queryableEncryptionLatencyMicros;
     if constexpr (std::is_same_v<HistogramDataType,
                                  AtomicOperationLatencyHistogram::HistogramType>) {
@@ -239,6 +285,7 @@ template <typename HistogramsType>
 void appendHistograms(HistogramsType& histograms,
                       bool includeHistograms,
                       bool slowMSBucketsOnly,
+                      bool includePercentiles,
                       BSONObjBuilder& builder) {
     static_assert(static_cast<int>(Command::ReadWriteType::kCommand) == 0);
     static_assert(static_cast<int>(Command::ReadWriteType::kRead) == 1);
@@ -248,7 +295,12 @@ void appendHistograms(HistogramsType& histograms,
         kNames = {"commands"_sd, "reads"_sd, "writes"_sd, "transactions"_sd};
 
     for (size_t i = 0; i < kNames.size(); ++i) {
-        appendHistogram(histograms[i], kNames[i], includeHistograms, slowMSBucketsOnly, builder);
+        appendHistogram(histograms[i],
+                        kNames[i],
+                        includeHistograms,
+                        slowMSBucketsOnly,
+                        includePercentiles,
+                        builder);
     }
 }
 }  // namespace
@@ -267,8 +319,10 @@ void OperationLatencyHistogram::increment(uint64_t latency,
 
 void OperationLatencyHistogram::append(bool includeHistograms,
                                        bool slowMSBucketsOnly,
-                                       BSONObjBuilder* builder) const {
-    appendHistograms(_histograms, includeHistograms, slowMSBucketsOnly, *builder);
+                                       BSONObjBuilder* builder,
+                                       bool includePercentiles) const {
+    appendHistograms(
+        _histograms, includeHistograms, slowMSBucketsOnly, includePercentiles, *builder);
 }
 
 void AtomicOperationLatencyHistogram::increment(uint64_t latency,
@@ -279,8 +333,10 @@ void AtomicOperationLatencyHistogram::increment(uint64_t latency,
 
 void AtomicOperationLatencyHistogram::append(bool includeHistograms,
                                              bool slowMSBucketsOnly,
-                                             BSONObjBuilder* builder) const {
-    appendHistograms(_histograms, includeHistograms, slowMSBucketsOnly, *builder);
+                                             BSONObjBuilder* builder,
+                                             bool includePercentiles) const {
+    appendHistograms(
+        _histograms, includeHistograms, slowMSBucketsOnly, includePercentiles, *builder);
 }
 
 }  // namespace mongo
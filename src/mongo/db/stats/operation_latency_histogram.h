@@ -74,9 +74,15 @@ public:
     void increment(uint64_t latency, Command::ReadWriteType type, bool isQueryableEncryptionOp);
 
     /**
-     * Appends the four histograms with latency totals and operation counts.
+     * Appends the four histograms with latency totals and operation counts. If
+     * 'includePercentiles' is true, each histogram also reports estimated p50, p90, p99 and p999
+     * latencies. An estimate is the upper bound of the bucket holding that percentile, so it
+     * overstates the latency by at most the width of the bucket.
      */
-    void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
+    void append(bool includeHistograms,
+                bool slowMSBucketsOnly,
+                BSONObjBuilder* builder,
+                bool includePercentiles = false) const;
 
 private:
     std::array<HistogramType, operation_latency_histogram_details::kHistogramsCount> _histograms;
@@ -87,7 +93,10 @@ public:
     using HistogramType = operation_latency_histogram_details::HistogramData<Atomic<uint64_t>>;
 
     void increment(uint64_t latency, Command::ReadWriteType type, bool isQueryableEncryptionOp);
-    void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
+    void append(bool includeHistograms,
+                bool slowMSBucketsOnly,
+                BSONObjBuilder* builder,
+                bool includePercentiles = false) const;
 
 private:
     std::array<HistogramType, operation_latency_histogram_details::kHistogramsCount> _histograms;
@@ -145,6 +145,40 @@ TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatencySlowBuckets) {
     }
 }
 
+TEST(OperationLatencyHistogram, CheckPercentiles) {
+    OperationLatencyHistogram hist;
+    for (int i = 0; i < 900; i++) {
+        hist.increment(100, Command::ReadWriteType::kRead, false);
+    }
+    for (int i = 0; i < 90; i++) {
+        hist.increment(1000, Command::ReadWriteType::kRead, false);
+    }
+    for (int i = 0; i < 9; i++) {
+        hist.increment(10000, Command::ReadWriteType::kRead, false);
+    }
+    hist.increment(100000, Command::ReadWriteType::kRead, false);
+
+    BSONObjBuilder outBuilder;
+    hist.append(false, false, &outBuilder, true);
+    BSONObj out = outBuilder.done();
+    ASSERT_FALSE(out["reads"].Obj().hasField("histogram"));
+
+    // Each estimate is the upper bound of the bucket holding the percentile.
+    BSONObj readPercentiles = out["reads"]["percentiles"].Obj();
+    ASSERT_EQUALS(readPercentiles["p50"].Long(), 128);
+    ASSERT_EQUALS(readPercentiles["p90"].Long(), 128);
+    ASSERT_EQUALS(readPercentiles["p99"].Long(), 1024);
+    ASSERT_EQUALS(readPercentiles["p999"].Long(), 12288);
+
+    BSONObj writePercentiles = out["writes"]["percentiles"].Obj();
+    ASSERT_EQUALS(writePercentiles["p50"].Long(), 0);
+    ASSERT_EQUALS(writePercentiles["p999"].Long(), 0);
+
+    BSONObjBuilder noPercentilesBuilder;
+    hist.append(false, false, &noPercentilesBuilder);
+    ASSERT_FALSE(noPercentilesBuilder.done()["reads"].Obj().hasField("percentiles"));
+}
+
 // QE
 // Verify we count QE correctly.
 TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatencyQueryableEncryption) {
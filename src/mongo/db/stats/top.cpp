@@ -246,14 +246,17 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
-                                   BSONObjBuilder* builder) {
-    _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
+                                   BSONObjBuilder* builder,
+                                   bool includePercentiles) {
+    _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder, includePercentiles);
 }
 
 void Top::appendWorkingTimeStats(bool includeHistograms,
                                  bool slowMSBucketsOnly,
-                                 BSONObjBuilder* builder) {
-    _workingTimeHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
+                                 BSONObjBuilder* builder,
+                                 bool includePercentiles) {
+    _workingTimeHistogramStats.append(
+        includeHistograms, slowMSBucketsOnly, builder, includePercentiles);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(OperationContext* opCtx, uint64_t latency) {
@@ -148,14 +148,16 @@ public:
      */
     void appendGlobalLatencyStats(bool includeHistograms,
                                   bool slowMSBucketsOnly,
-                                  BSONObjBuilder* builder);
+                                  BSONObjBuilder* builder,
+                                  bool includePercentiles = false);
 
     /**
      * Appends the global working time statistics.
      */
     void appendWorkingTimeStats(bool includeHistograms,
                                 bool slowMSBucketsOnly,
-                                BSONObjBuilder* builder);
+                                BSONObjBuilder* builder,
+                                bool includePercentiles = false);
 
 private:
     AtomicOperationLatencyHistogram _globalHistogramStats;
@@ -63,6 +63,10 @@ public:
 
     /**
      * Starts the checkpoint thread that runs every storageGlobalParams.syncdelay seconds.
+     *
+     * The interval is fixed and does not adapt to load. The amount of dirty data a checkpoint has
+     * to write is bounded by the storage engine's own eviction of dirty pages between checkpoints,
+     * and the storage engine reports checkpoint durations in its serverStatus section.
      */
     void run() override;
 
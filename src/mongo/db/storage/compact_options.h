@@ -36,7 +36,10 @@
 namespace mongo {
 
 /**
- * Represents the options for auto compaction.
+ * Represents the options for auto compaction, set through the 'autoCompact' command. When enabled,
+ * the storage engine compacts files in the background on its own thread, skipping files which
+ * would release less than 'freeSpaceTargetMB', so no foreground compact command is needed to
+ * reclaim space after large deletes.
  */
 struct AutoCompactOptions {
     // Toggle to enable/disable the service.
@@ -50,6 +50,8 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/storage/flow_control.h"
 #include "mongo/db/storage/flow_control_parameters_gen.h"
+#include "mongo/db/storage/kv/kv_engine.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -165,7 +167,7 @@ FlowControl::FlowControl(repl::ReplicationCoordinator* replCoord)
     : _replCoord(replCoord), _lastTimeSustainerAdvanced(Date_t::now()) {}
 
 FlowControl::FlowControl(ServiceContext* service, repl::ReplicationCoordinator* replCoord)
-    : _replCoord(replCoord), _lastTimeSustainerAdvanced(Date_t::now()) {
+    : _service(service), _replCoord(replCoord), _lastTimeSustainerAdvanced(Date_t::now()) {
     // Initialize _lastTargetTicketsPermitted to maximum tickets to make sure flow control doesn't
     // cause a slow start on start up.
     FlowControlTicketholder::set(service, std::make_unique<FlowControlTicketholder>(kMaxTickets));
@@ -442,6 +444,12 @@ int FlowControl::getNumTickets(Date_t now) {
         // variables here.
     }
 
+    // Independently of the commit point lag, admit only a fraction of the operations performed
+    // in the last period while the storage engine cache keeps filling up with dirty data.
+    if (_isCacheDirtyAboveThreshold()) {
+        ret = _capTicketsForDirtyCache(ret, locksUsedLastPeriod);
+    }
+
     ret = std::max(ret, gFlowControlMinTicketsPerSecond.load());
 
     LOGV2_DEBUG(22220,
@@ -467,6 +475,26 @@ int FlowControl::getNumTickets(Date_t now) {
     return ret;
 }
 
+int FlowControl::_capTicketsForDirtyCache(int tickets, std::int64_t locksUsedLastPeriod) const {
+    // Tickets are global IX lock acquisitions, so the cap is expressed in the same unit.
+    const double cap = std::min(locksUsedLastPeriod * gFlowControlDecayConstant.load(),
+                                static_cast<double>(kMaxTickets));
+    return std::min(tickets, static_cast<int>(cap));
+}
+
+bool FlowControl::_isCacheDirtyAboveThreshold() const {
+    const double threshold = gFlowControlDirtyCacheThreshold.load();
+    if (threshold <= 0.0 || !_service) {
+        return false;
+    }
+
+    auto storageEngine = _service->getStorageEngine();
+    if (!storageEngine) {
+        return false;
+    }
+    return storageEngine->getEngine()->getCacheDirtyFraction() > threshold;
+}
+
 std::int64_t FlowControl::_approximateOpsBetween(Timestamp prevTs, Timestamp currTs) {
     std::int64_t prevApplied = -1;
     std::int64_t currApplied = -1;
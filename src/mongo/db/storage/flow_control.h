@@ -130,6 +130,7 @@ public:
                                    double locksPerOp,
                                    std::uint64_t lagMillis,
                                    std::uint64_t thresholdLagMillis);
+    int _capTicketsForDirtyCache(int tickets, std::int64_t locksUsedLastPeriod) const;
     void _trimSamples(Timestamp trimSamplesTo);
 
     // Sample of (timestamp, ops, lock acquisitions) where ops and lock acquisitions are
@@ -140,6 +141,15 @@ public:
     }
 
 private:
+    /**
+     * Returns true if the storage engine reports more dirty data in its cache than allowed by
+     * 'flowControlDirtyCacheThreshold'.
+     */
+    bool _isCacheDirtyAboveThreshold() const;
+
+    // Not set when constructed for testing without a ServiceContext.
+    ServiceContext* _service = nullptr;
+
     repl::ReplicationCoordinator* _replCoord;
 
     // These values are updated with each flow control computation and are also surfaced in server
@@ -28,6 +28,7 @@
  */
 
 
+#include <limits>
 #include <ostream>
 #include <utility>
 
@@ -262,6 +263,31 @@ TEST_F(FlowControlTest, CalculatingTickets) {
                                                       thresholdLag));
 }
 
+TEST_F(FlowControlTest, DirtyCacheCapIsInLockAcquisitions) {
+    gFlowControlDecayConstant.store(0.5);
+
+    // Take the global IX lock three times per applied operation so that 'locksPerOp' is 3.0.
+    for (int numSamples = 1; numSamples <= 10; ++numSamples) {
+        for (int globalLock = 0; globalLock < 3; ++globalLock) {
+            Lock::GlobalLock lk(opCtx.get(), LockMode::MODE_IX);
+        }
+        flowControl->sample(Timestamp(numSamples), 1);
+    }
+    ASSERT_EQ(3.0, flowControl->_getLocksPerOp());
+
+    // 1,000 lock acquisitions in the last period admit 1,000 * 0.5 = 500 acquisitions, regardless
+    // of how many acquisitions each operation takes.
+    const std::int64_t locksUsedLastPeriod = 1000;
+    ASSERT_EQ(500,
+              flowControl->_capTicketsForDirtyCache(FlowControl::kMaxTickets, locksUsedLastPeriod));
+    // A lower ticket count is left untouched.
+    ASSERT_EQ(200, flowControl->_capTicketsForDirtyCache(200, locksUsedLastPeriod));
+    // The cap never exceeds the maximum number of tickets.
+    ASSERT_EQ(FlowControl::kMaxTickets,
+              flowControl->_capTicketsForDirtyCache(FlowControl::kMaxTickets,
+                                                    std::numeric_limits<std::int64_t>::max()));
+}
+
 TEST_F(FlowControlTest, DisableUntil) {
     const int ticketOverride = 52319;
 
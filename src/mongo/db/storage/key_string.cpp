@@ -34,6 +34,7 @@
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <fmt/format.h>
 #include <limits>
 #include <memory>
@@ -347,10 +348,24 @@ const uint8_t kGreater = 254;
 // some utility functions
 namespace {
 
+/**
+ * Copies 'bytes' bytes from 'src' to 'dst', inverting every bit. The buffers must either not
+ * overlap or be the same.
+ *
+ * Works a word at a time, since every string, OID and BinData appended to a descending key, or
+ * decoded from one, goes through here.
+ */
 void memcpy_flipBits(void* dst, const void* src, size_t bytes) {
     const char* input = static_cast<const char*>(src);
     char* output = static_cast<char*>(dst);
     const char* const end = input + bytes;
+    for (; end - input >= static_cast<ptrdiff_t>(sizeof(uint64_t));
+         input += sizeof(uint64_t), output += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, input, sizeof(word));
+        word = ~word;
+        std::memcpy(output, &word, sizeof(word));
+    }
     while (input != end) {
         *output++ = ~(*input++);
     }
@@ -402,10 +417,8 @@ string readInvertedCString(BufReader* reader) {
     const char* end = static_cast<const char*>(memchr(start, 0xFF, reader->remaining()));
     keyStringAssert(50817, "Failed to find '0xFF' in inverted string.", end);
     size_t actualBytes = end - start;
-    string s(start, actualBytes);
-    for (size_t i = 0; i < s.size(); i++) {
-        s[i] = ~s[i];
-    }
+    string s(actualBytes, '\0');
+    memcpy_flipBits(s.data(), start, actualBytes);
     reader->skip(1 + actualBytes);
     return s;
 }
@@ -432,9 +445,7 @@ string readInvertedCStringWithNuls(BufReader* reader) {
         reader->skip(1 + actualBytes);
     } while (reader->peek<unsigned char>() == 0x00);
 
-    for (size_t i = 0; i < out.size(); i++) {
-        out[i] = ~out[i];
-    }
+    memcpy_flipBits(out.data(), out.data(), out.size());
 
     return out;
 }
@@ -3048,8 +3059,44 @@ Value Value::deserialize(BufReader& buf,
                          key_string::Version version,
                          boost::optional<KeyFormat> ridFormat) {
     const int32_t sizeOfKeystring = buf.read<LittleEndian<int32_t>>();
-    const void* keystringPtr = buf.skip(sizeOfKeystring);
+    const char* keystringPtr = static_cast<const char*>(buf.skip(sizeOfKeystring));
+    return _deserialize(keystringPtr, sizeOfKeystring, buf, version, ridFormat);
+}
+
+void Value::serializeForSorter(BufBuilder& buf, std::string* previous) const {
+    const char* const keystring = _buffer.get();
+    const size_t maxPrefixSize = std::min(previous->size(), static_cast<size_t>(_ksSize));
+    const int32_t prefixSize =
+        std::mismatch(keystring, keystring + maxPrefixSize, previous->data()).first - keystring;
 
+    buf.appendNum(_ksSize);     // Serialize size of KeyString
+    buf.appendNum(prefixSize);  // Serialize size of the prefix shared with 'previous'
+    buf.appendBuf(keystring + prefixSize, _buffer.size() - prefixSize);  // Suffix + TypeBits
+    previous->assign(keystring, _ksSize);
+}
+
+Value Value::deserializeForSorter(BufReader& buf,
+                                  const SorterDeserializeSettings& settings,
+                                  std::string* previous) {
+    const int32_t sizeOfKeystring = buf.read<LittleEndian<int32_t>>();
+    const int32_t prefixSize = buf.read<LittleEndian<int32_t>>();
+    keyStringAssert(9601501,
+                    "Invalid prefix size for a KeyString stored relative to the previous one",
+                    prefixSize >= 0 && prefixSize <= sizeOfKeystring &&
+                        static_cast<size_t>(prefixSize) <= previous->size());
+
+    const int32_t suffixSize = sizeOfKeystring - prefixSize;
+    previous->resize(prefixSize);
+    previous->append(static_cast<const char*>(buf.skip(suffixSize)), suffixSize);
+    return _deserialize(
+        previous->data(), sizeOfKeystring, buf, settings.keyStringVersion, settings.ridFormat);
+}
+
+Value Value::_deserialize(const char* keystringPtr,
+                          int32_t sizeOfKeystring,
+                          BufReader& buf,
+                          key_string::Version version,
+                          boost::optional<KeyFormat> ridFormat) {
     BufBuilder newBuf;
     newBuf.appendBuf(keystringPtr, sizeOfKeystring);
 
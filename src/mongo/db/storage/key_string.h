@@ -549,6 +549,18 @@ public:
         return deserialize(buf, settings.keyStringVersion, settings.ridFormat);
     }
 
+    /**
+     * Variants for spilling sorted runs, which store only the part of the KeyString that follows
+     * its common prefix with 'previous', the KeyString serialized just before it, and then make
+     * 'previous' this KeyString. Compound keys on a low cardinality leading field share most of
+     * their bytes with their neighbours. The serialized format takes the following form:
+     *   [keystring size][common prefix size][keystring suffix][typebits encoding]
+     */
+    void serializeForSorter(BufBuilder& buf, std::string* previous) const;
+    static Value deserializeForSorter(BufReader& buf,
+                                      const SorterDeserializeSettings& settings,
+                                      std::string* previous);
+
     // It is illegal to call this function on a value that is backed by a buffer that is shared
     // elsewhere. The SharedBufferFragment cannot accurately report memory usage per individual
     // Value, so we require the sorter to look at the SharedBufferFragmentBuilder's memory usage in
@@ -573,6 +585,16 @@ public:
     int computeElementCount(Ordering ord) const;
 
 private:
+    /**
+     * Makes a Value of the 'size' bytes of KeyString at 'keystring', and of the TypeBits that 'buf'
+     * is positioned at.
+     */
+    static Value _deserialize(const char* keystring,
+                              int32_t size,
+                              BufReader& buf,
+                              key_string::Version version,
+                              boost::optional<KeyFormat> ridFormat);
+
     static_assert(Version::kLatestVersion == Version::V1);
     uint32_t _encodeVersionAndRidSize(Version version, int32_t ridSize) {
         uint32_t versionBit = (version == Version::V1) ? 1 << 31 : 0;
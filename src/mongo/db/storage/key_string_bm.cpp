@@ -38,6 +38,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
 #include "mongo/bson/ordering.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/key_string.h"
@@ -58,6 +59,7 @@ const int kStrLenMultiplier = 100;
 const int kArrLenMultiplier = 40;
 
 const Ordering ALL_ASCENDING = Ordering::make(BSONObj());
+const Ordering ALL_DESCENDING = Ordering::make(BSON("a" << -1 << "b" << -1 << "c" << -1));
 
 struct BsonsAndKeyStrings {
     int bsonSize = 0;
@@ -75,6 +77,7 @@ enum BsonValueType {
     STRING,
     ARRAY,
     DECIMAL,
+    COMPOUND,
 };
 
 BSONObj generateBson(BsonValueType bsonValueType) {
@@ -102,18 +105,24 @@ BSONObj generateBson(BsonValueType bsonValueType) {
                                          Decimal128::kRoundTo34Digits,
                                          Decimal128::kRoundTiesToAway)
                                   .quantize(Decimal128("0.01", Decimal128::kRoundTiesToAway)));
+        case COMPOUND:
+            // Like an index on {tenant: 1, name: 1, _id: 1}.
+            return BSON("" << static_cast<int>(expReal(gen)) << ""
+                           << std::string(expDist(gen) * kStrLenMultiplier, 'x') << ""
+                           << OID::gen());
     }
     MONGO_UNREACHABLE;
 }
 
 static BsonsAndKeyStrings generateBsonsAndKeyStrings(BsonValueType bsonValueType,
-                                                     key_string::Version version) {
+                                                     key_string::Version version,
+                                                     Ordering ordering = ALL_ASCENDING) {
     BsonsAndKeyStrings result;
     result.bsonSize = 0;
     result.keystringSize = 0;
     for (int i = 0; i < kSampleSize; i++) {
         BSONObj bson = generateBson(bsonValueType);
-        key_string::Builder ks(version, bson, ALL_ASCENDING);
+        key_string::Builder ks(version, bson, ordering);
         result.bsonSize += bson.objsize();
         result.keystringSize += ks.getSize();
         result.bsons[i] = bson;
@@ -131,12 +140,14 @@ static BsonsAndKeyStrings generateBsonsAndKeyStrings(BsonValueType bsonValueType
 
 void BM_BSONToKeyString(benchmark::State& state,
                         const key_string::Version version,
-                        BsonValueType bsonType) {
-    const BsonsAndKeyStrings bsonsAndKeyStrings = generateBsonsAndKeyStrings(bsonType, version);
+                        BsonValueType bsonType,
+                        Ordering ordering = ALL_ASCENDING) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings =
+        generateBsonsAndKeyStrings(bsonType, version, ordering);
     for (auto _ : state) {
         benchmark::ClobberMemory();
         for (const auto& bson : bsonsAndKeyStrings.bsons) {
-            benchmark::DoNotOptimize(key_string::Builder(version, bson, ALL_ASCENDING));
+            benchmark::DoNotOptimize(key_string::Builder(version, bson, ordering));
         }
     }
     state.SetBytesProcessed(state.iterations() * bsonsAndKeyStrings.bsonSize);
@@ -145,8 +156,10 @@ void BM_BSONToKeyString(benchmark::State& state,
 
 void BM_KeyStringToBSON(benchmark::State& state,
                         const key_string::Version version,
-                        BsonValueType bsonType) {
-    const BsonsAndKeyStrings bsonsAndKeyStrings = generateBsonsAndKeyStrings(bsonType, version);
+                        BsonValueType bsonType,
+                        Ordering ordering = ALL_ASCENDING) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings =
+        generateBsonsAndKeyStrings(bsonType, version, ordering);
     for (auto _ : state) {
         benchmark::ClobberMemory();
         for (size_t i = 0; i < kSampleSize; i++) {
@@ -154,7 +167,7 @@ void BM_KeyStringToBSON(benchmark::State& state,
             benchmark::DoNotOptimize(
                 key_string::toBson(bsonsAndKeyStrings.keystrings[i].get(),
                                    bsonsAndKeyStrings.keystringLens[i],
-                                   ALL_ASCENDING,
+                                   ordering,
                                    key_string::TypeBits::fromBuffer(version, &buf)));
         }
     }
@@ -264,6 +277,11 @@ BENCHMARK_CAPTURE(BM_BSONToKeyString, V0_String, key_string::Version::V0, STRING
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_String, key_string::Version::V1, STRING);
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V0_Array, key_string::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_Array, key_string::Version::V1, ARRAY);
+BENCHMARK_CAPTURE(BM_BSONToKeyString, V1_Compound, key_string::Version::V1, COMPOUND);
+BENCHMARK_CAPTURE(
+    BM_BSONToKeyString, V1_String_Descending, key_string::Version::V1, STRING, ALL_DESCENDING);
+BENCHMARK_CAPTURE(
+    BM_BSONToKeyString, V1_Compound_Descending, key_string::Version::V1, COMPOUND, ALL_DESCENDING);
 
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Int, key_string::Version::V0, INT);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Int, key_string::Version::V1, INT);
@@ -274,6 +292,11 @@ BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_String, key_string::Version::V0, STRING
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_String, key_string::Version::V1, STRING);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Array, key_string::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Array, key_string::Version::V1, ARRAY);
+BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Compound, key_string::Version::V1, COMPOUND);
+BENCHMARK_CAPTURE(
+    BM_KeyStringToBSON, V1_String_Descending, key_string::Version::V1, STRING, ALL_DESCENDING);
+BENCHMARK_CAPTURE(
+    BM_KeyStringToBSON, V1_Compound_Descending, key_string::Version::V1, COMPOUND, ALL_DESCENDING);
 
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 16B, 16);
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 512B, 512);
@@ -1098,6 +1098,46 @@ TEST_F(KeyStringBuilderTest, SerializeDeserialize) {
     }
 }
 
+TEST_F(KeyStringBuilderTest, SerializeDeserializeForSorterWithPrefix) {
+    // Keys sharing a leading field, as they would be spilled by an index build, including one
+    // whose type bits differ and one that is a prefix of the key before it.
+    std::vector<key_string::Value> keys;
+    keys.push_back(key_string::Builder(
+                       version, BSON("" << "tenant" << "" << 1), ALL_ASCENDING, RecordId(1))
+                       .getValueCopy());
+    keys.push_back(key_string::Builder(
+                       version, BSON("" << "tenant" << "" << 2.0), ALL_ASCENDING, RecordId(2))
+                       .getValueCopy());
+    keys.push_back(key_string::Builder(
+                       version, BSON("" << "tenant" << "" << 3LL), ALL_ASCENDING, RecordId(300))
+                       .getValueCopy());
+    keys.push_back(
+        key_string::Builder(version, BSON("" << "tenant"), ALL_ASCENDING, RecordId(4))
+            .getValueCopy());
+
+    BufBuilder buf;
+    std::string previous;
+    for (const auto& key : keys) {
+        key.serializeForSorter(buf, &previous);
+    }
+
+    BufBuilder uncompressed;
+    for (const auto& key : keys) {
+        key.serializeForSorter(uncompressed);
+    }
+    ASSERT_LT(buf.len(), uncompressed.len());
+
+    BufReader reader(buf.buf(), buf.len());
+    previous.clear();
+    for (const auto& key : keys) {
+        auto value = key_string::Value::deserializeForSorter(
+            reader, {version, KeyFormat::Long}, &previous);
+        ASSERT_EQ(key.compareWithTypeBits(value), 0);
+        ASSERT_EQ(key.getRecordIdSize(), value.getRecordIdSize());
+    }
+    ASSERT(reader.atEof());
+}
+
 const std::vector<BSONObj>& getInterestingElements(key_string::Version version) {
     static std::vector<BSONObj> elements;
     elements.clear();
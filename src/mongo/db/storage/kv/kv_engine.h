@@ -495,6 +495,13 @@ public:
         return 0;
     }
 
+    /**
+     * Returns the fraction of the cache holding dirty data, or 0 if the engine does not track it.
+     */
+    virtual double getCacheDirtyFraction() const {
+        return 0.0;
+    }
+
     /**
      * Returns the input storage engine options, sanitized to remove options that may not apply to
      * this node, such as encryption. Might be called for both collection and index options. See
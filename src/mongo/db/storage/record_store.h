@@ -311,6 +311,11 @@ private:
  *
  * This class must be thread-safe. In addition, for storage engines implementing the KVEngine some
  * methods must be thread safe, see DurableCatalog.
+ *
+ * All record stores of a storage engine share its transactions, snapshots and cache: a
+ * RecordStore cannot be backed by a separate read-only format, since its cursors must honor the
+ * RecoveryUnit's snapshot and be saved and restored alongside the cursors of other record stores
+ * in the same transaction.
  */
 class RecordStore {
     RecordStore(const RecordStore&) = delete;
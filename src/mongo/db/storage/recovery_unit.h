@@ -213,6 +213,15 @@ public:
      */
     virtual void setPrefetching(bool enable) {}
 
+    /**
+     * Enables pre-fetching as setPrefetching(true) does, but only if this recovery unit has no
+     * active transaction and no open cursors, so that a query stage can opt in to it before it
+     * opens its cursor. Returns whether pre-fetching was enabled.
+     */
+    virtual bool enablePrefetchingIfIdle() {
+        return false;
+    }
+
     /**
      * Transitions the active unit of work to the "prepared" state. Must be called after
      * beginUnitOfWork and before calling either abortUnitOfWork or commitUnitOfWork. Must be
@@ -244,13 +244,20 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx,
         // a repair context, if we can't find an ident in the catalog, we generate a catalog entry
         // 'local.orphan.xxxxx' for it. However, in a nonrepair context, the orphaned idents
         // will be dropped in reconcileCatalogAndIdents().
+        //
+        // Sort the catalog's idents up front so that checking every ident known to the storage
+        // engine doesn't scan the whole catalog each time.
+        std::vector<std::string> identsKnownToCatalog;
+        identsKnownToCatalog.reserve(catalogEntries.size());
+        for (const auto& entry : catalogEntries) {
+            identsKnownToCatalog.push_back(entry.ident);
+        }
+        std::sort(identsKnownToCatalog.begin(), identsKnownToCatalog.end());
+
         for (const auto& ident : identsKnownToStorageEngine) {
             if (DurableCatalog::isCollectionIdent(ident)) {
-                bool isOrphan = !std::any_of(catalogEntries.begin(),
-                                             catalogEntries.end(),
-                                             [this, &ident](DurableCatalog::EntryIdentifier entry) {
-                                                 return entry.ident == ident;
-                                             });
+                bool isOrphan = !std::binary_search(
+                    identsKnownToCatalog.begin(), identsKnownToCatalog.end(), ident);
                 if (isOrphan) {
                     // If the catalog does not have information about this
                     // collection, we create an new entry for it.
@@ -403,6 +403,13 @@ public:
 private:
     using CollIter = std::list<std::string>::iterator;
 
+    /**
+     * Instantiates the Collection for the catalog entry 'catalogId', including its record store
+     * and the IndexCatalogEntry of each of its indexes, and registers it in the CollectionCatalog.
+     * Every collection is initialized eagerly at startup: the CollectionCatalog, and the lock-free
+     * readers which use it, expect every registered Collection to be fully formed. WiredTiger
+     * cursors and data handles are opened on first use and closed when idle by WiredTiger itself.
+     */
     void _initCollection(OperationContext* opCtx,
                          RecordId catalogId,
                          const NamespaceString& nss,
@@ -138,6 +138,36 @@ void BM_setTimestamp(benchmark::State& state) {
     }
 }
 
+// Many readers beginning transactions at the same read timestamp, as majority reads do. Each thread
+// uses its own session on a shared connection and forces a snapshot with a cursor search, so this
+// includes the cost of WiredTiger scanning the global transaction table.
+void BM_setTimestampConcurrent(benchmark::State& state) {
+    static unittest::TempDir dbpath{"wt_test_concurrent"};
+    static WiredTigerConnection connection{dbpath.path(), ""};
+    static const bool tableCreated = [] {
+        WiredTigerSession session(connection.getConnection());
+        auto wt_session = session.getSession();
+        invariant(wtRCToStatus(wt_session->create(wt_session,
+                                                  "table:mytable",
+                                                  "key_format=S,value_format=S"),
+                               wt_session)
+                      .isOK());
+        return true;
+    }();
+    invariant(tableCreated);
+
+    WiredTigerSession session(connection.getConnection());
+    WT_CURSOR* cursor = session.getNewCursor("table:mytable");
+    for (auto _ : state) {
+        WiredTigerBeginTxnBlock beginTxn(&session, nullptr);
+        ASSERT_OK(beginTxn.setReadSnapshot(Timestamp(1)));
+        cursor->set_key(cursor, "key");
+        benchmark::DoNotOptimize(cursor->search(cursor));
+        invariantWTOK(cursor->reset(cursor), cursor->session);
+    }
+    session.closeCursor(cursor);
+}
+
 BENCHMARK(BM_WiredTigerBeginTxnBlock);
 BENCHMARK_TEMPLATE(BM_WiredTigerBeginTxnBlockWithArgs,
                    PrepareConflictBehavior::kEnforce,
@@ -158,6 +188,7 @@ BENCHMARK_TEMPLATE(BM_WiredTigerBeginTxnBlockWithArgs,
                    PrepareConflictBehavior::kIgnoreConflictsAllowWrites,
                    RoundUpPreparedTimestamps::kRound);
 BENCHMARK(BM_setTimestamp);
+BENCHMARK(BM_setTimestampConcurrent)->ThreadRange(1, 16);
 
 }  // namespace
 }  // namespace mongo
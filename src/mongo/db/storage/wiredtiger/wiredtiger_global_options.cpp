@@ -27,12 +27,14 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/util/database_name_util.h"
 #include "mongo/util/options_parser/value.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -50,6 +52,12 @@ Status WiredTigerGlobalOptions::store(const moe::Environment& params) {
         LOGV2(22293, "Engine custom option", "option"_attr = wiredTigerGlobalOptions.engineConfig);
     }
 
+    if (!wiredTigerGlobalOptions.cacheResidentDatabases.empty()) {
+        LOGV2(9601800,
+              "Cache resident databases",
+              "databases"_attr = wiredTigerGlobalOptions.cacheResidentDatabases);
+    }
+
     if (!wiredTigerGlobalOptions.collectionConfig.empty()) {
         LOGV2(22294,
               "Collection custom option",
@@ -63,6 +71,15 @@ Status WiredTigerGlobalOptions::store(const moe::Environment& params) {
     return Status::OK();
 }
 
+bool WiredTigerGlobalOptions::isCacheResident(const DatabaseName& dbName) const {
+    if (cacheResidentDatabases.empty()) {
+        return false;
+    }
+    return std::find(cacheResidentDatabases.begin(),
+                     cacheResidentDatabases.end(),
+                     DatabaseNameUtil::serializeForStorage(dbName)) != cacheResidentDatabases.end();
+}
+
 Status WiredTigerGlobalOptions::validateWiredTigerCompressor(const std::string& value) {
     constexpr auto kNone = "none"_sd;
     constexpr auto kSnappy = "snappy"_sd;
@@ -31,9 +31,11 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
+#include "mongo/db/database_name.h"
 #include "mongo/util/options_parser/environment.h"
 
 namespace mongo {
@@ -49,6 +51,7 @@ public:
           zstdCompressorLevel(0),
           directoryForIndexes(false),
           maxCacheOverflowFileSizeGBDeprecated(0),
+          cacheResidentMaxCachePct(50),
           useCollectionPrefixCompression(false),
           useIndexPrefixCompression(false){};
 
@@ -61,6 +64,8 @@ public:
     bool directoryForIndexes;
     double maxCacheOverflowFileSizeGBDeprecated;
     std::string engineConfig;
+    std::vector<std::string> cacheResidentDatabases;
+    double cacheResidentMaxCachePct;
 
     std::string collectionBlockCompressor;
     bool useCollectionPrefixCompression;
@@ -70,6 +75,12 @@ public:
 
     static Status validateWiredTigerCompressor(const std::string&);
 
+    /**
+     * Returns true if tables for collections and indexes in 'dbName' should be created with
+     * 'cache_resident=true', as configured by 'cacheResidentDatabases'.
+     */
+    bool isCacheResident(const DatabaseName& dbName) const;
+
     /**
      * Returns current history file size limit in MB.
      * Always returns 0 for unbounded.
@@ -221,6 +221,14 @@ StatusWith<std::string> WiredTigerIndex::generateCreateString(
 
     ss << WiredTigerCustomizationHooks::get(getGlobalServiceContext())
               ->getTableCreateConfig(NamespaceStringUtil::serializeForCatalog(collectionNamespace));
+    if (wiredTigerGlobalOptions.isCacheResident(collectionNamespace.dbName())) {
+        // This is permanent for the table, whatever the option is set to on later restarts.
+        LOGV2(9601102,
+              "Creating cache resident index table",
+              logAttrs(collectionNamespace),
+              "index"_attr = desc.indexName());
+        ss << "cache_resident=true,";
+    }
     ss << sysIndexConfig << ",";
     ss << collIndexConfig << ",";
 
@@ -624,6 +632,10 @@ StatusWith<bool> WiredTigerIndex::_checkDups(OperationContext* opCtx,
     // The second phase looks for the key to avoid insertion of a duplicate key. The range bounded
     // cursor API restricts the key range we search within. This makes the search significantly
     // faster.
+    //
+    // This cannot be folded into the insert of the full key that follows: the prefix and the full
+    // key sort to different positions, and WiredTiger insert/remove leave the cursor without a
+    // position, so each phase needs its own search.
     auto rid = _keyExists(opCtx, c, session, keyString, sizeWithoutRecordId);
     if (!rid) {
         return false;
@@ -1482,6 +1482,12 @@ Status WiredTigerKVEngine::createRecordStore(OperationContext* opCtx,
     _ensureIdentPath(ident);
     WiredTigerSession session(_conn);
 
+    if (!nss.isOplog() && wiredTigerGlobalOptions.isCacheResident(nss.dbName())) {
+        if (auto status = _checkCacheResidentLimit(session.getSession()); !status.isOK()) {
+            return status;
+        }
+    }
+
     StatusWith<std::string> result =
         WiredTigerRecordStore::generateCreateString(_canonicalName,
                                                     nss,
@@ -1698,6 +1704,13 @@ Status WiredTigerKVEngine::createSortedDataInterface(OperationContext* opCtx,
                 .str();
     }
 
+    if (wiredTigerGlobalOptions.isCacheResident(nss.dbName())) {
+        WiredTigerSession session(_conn);
+        if (auto status = _checkCacheResidentLimit(session.getSession()); !status.isOK()) {
+            return status;
+        }
+    }
+
     StatusWith<std::string> result =
         WiredTigerIndex::generateCreateString(_canonicalName,
                                               _indexOptions,
@@ -2805,6 +2818,63 @@ size_t WiredTigerKVEngine::getCacheSizeMB() const {
     return _cacheSizeMB;
 }
 
+Status WiredTigerKVEngine::_checkCacheResidentLimit(WT_SESSION* session) const {
+    if (_cacheSizeMB == 0) {
+        return Status::OK();
+    }
+
+    // The cache_resident setting is stored in the configuration of each table's file.
+    WT_CURSOR* cursor;
+    invariantWTOK(session->open_cursor(session, "metadata:", nullptr, nullptr, &cursor), session);
+    ON_BLOCK_EXIT([&] { cursor->close(cursor); });
+
+    long long residentBytes = 0;
+    int ret;
+    while ((ret = cursor->next(cursor)) == 0) {
+        const char* key;
+        const char* value;
+        invariantWTOK(cursor->get_key(cursor, &key), session);
+        invariantWTOK(cursor->get_value(cursor, &value), session);
+        if (!StringData(key).startsWith("file:") ||
+            StringData(value).find("cache_resident=true") == std::string::npos) {
+            continue;
+        }
+        auto bytes = WiredTigerUtil::getStatisticsValue(session,
+                                                        std::string("statistics:") + key,
+                                                        "statistics=(fast)",
+                                                        WT_STAT_DSRC_CACHE_BYTES_INUSE);
+        if (bytes.isOK()) {
+            residentBytes += bytes.getValue();
+        }
+    }
+    invariantWTOK(ret == WT_NOTFOUND ? 0 : ret, session);
+
+    const double maxBytes =
+        _cacheSizeMB * 1024.0 * 1024.0 * wiredTigerGlobalOptions.cacheResidentMaxCachePct / 100;
+    if (residentBytes > maxBytes) {
+        return {ErrorCodes::ExceededMemoryLimit,
+                str::stream() << "Cannot create a cache resident table: cache resident tables use "
+                              << residentBytes << " bytes of the cache, more than "
+                              << wiredTigerGlobalOptions.cacheResidentMaxCachePct
+                              << "% allowed by cacheResidentMaxCachePct"};
+    }
+    return Status::OK();
+}
+
+double WiredTigerKVEngine::getCacheDirtyFraction() const {
+    if (_cacheSizeMB == 0) {
+        return 0.0;
+    }
+
+    auto session = _sessionCache->getSession();
+    auto dirtyBytes = WiredTigerUtil::getStatisticsValue(
+        session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    if (!dirtyBytes.isOK()) {
+        return 0.0;
+    }
+    return static_cast<double>(dirtyBytes.getValue()) / (_cacheSizeMB * 1024.0 * 1024.0);
+}
+
 BSONObj WiredTigerKVEngine::getSanitizedStorageOptionsForSecondaryReplication(
     const BSONObj& options) const {
 
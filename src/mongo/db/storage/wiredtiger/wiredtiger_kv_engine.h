@@ -527,6 +527,8 @@ public:
 
     size_t getCacheSizeMB() const override;
 
+    double getCacheDirtyFraction() const override;
+
     // TODO SERVER-81069: Remove this since it's intrinsically tied to encryption options only.
     BSONObj getSanitizedStorageOptionsForSecondaryReplication(
         const BSONObj& options) const override;
@@ -616,6 +618,12 @@ private:
     Status _salvageIfNeeded(const char* uri);
     void _ensureIdentPath(StringData ident);
 
+    /**
+     * Returns ExceededMemoryLimit if the cache resident tables already use more than
+     * 'cacheResidentMaxCachePct' percent of the cache, so that no more tables should be pinned.
+     */
+    Status _checkCacheResidentLimit(WT_SESSION* session) const;
+
     /**
      * Recreates a WiredTiger ident from the provided URI by dropping and recreating the ident.
      * This moves aside the existing data file, if one exists, with an added ".corrupt" suffix.
@@ -60,6 +60,7 @@
 #include "mongo/db/storage/record_data.h"
 #include "mongo/db/storage/storage_engine_impl.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
@@ -450,6 +451,54 @@ TEST_F(WiredTigerKVEngineTest, IdentDrop) {
     ASSERT(boost::filesystem::exists(renamedFilePath));
 }
 
+TEST_F(WiredTigerKVEngineTest, CacheResidentTablesAreLimitedToAFractionOfTheCache) {
+    const auto originalDatabases = wiredTigerGlobalOptions.cacheResidentDatabases;
+    const auto originalMaxCachePct = wiredTigerGlobalOptions.cacheResidentMaxCachePct;
+    ON_BLOCK_EXIT([&] {
+        wiredTigerGlobalOptions.cacheResidentDatabases = originalDatabases;
+        wiredTigerGlobalOptions.cacheResidentMaxCachePct = originalMaxCachePct;
+    });
+    wiredTigerGlobalOptions.cacheResidentDatabases = {"pinned"};
+    // The engine has a 1MB cache, so cache resident tables may use about 10KB of it.
+    wiredTigerGlobalOptions.cacheResidentMaxCachePct = 1;
+
+    auto opCtxPtr = _makeOperationContext();
+    auto engine = _helper.getWiredTigerKVEngine();
+    CollectionOptions defaultCollectionOptions;
+
+    auto nss = NamespaceString::createNamespaceString_forTest("pinned.a");
+    ASSERT_OK(engine->createRecordStore(
+        opCtxPtr.get(), nss, "collection-pinned-a", defaultCollectionOptions));
+    auto rs = engine->getRecordStore(
+        opCtxPtr.get(), nss, "collection-pinned-a", defaultCollectionOptions);
+    ASSERT(rs);
+
+    const std::string record(1024, 'x');
+    {
+        WriteUnitOfWork uow(opCtxPtr.get());
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_OK(
+                rs->insertRecord(opCtxPtr.get(), record.c_str(), record.length() + 1, Timestamp())
+                    .getStatus());
+        }
+        uow.commit();
+    }
+
+    ASSERT_EQ(engine
+                  ->createRecordStore(opCtxPtr.get(),
+                                      NamespaceString::createNamespaceString_forTest("pinned.b"),
+                                      "collection-pinned-b",
+                                      defaultCollectionOptions)
+                  .code(),
+              ErrorCodes::ExceededMemoryLimit);
+
+    // Tables that are not cache resident are not limited.
+    ASSERT_OK(engine->createRecordStore(opCtxPtr.get(),
+                                        NamespaceString::createNamespaceString_forTest("other.c"),
+                                        "collection-other-c",
+                                        defaultCollectionOptions));
+}
+
 TEST_F(WiredTigerKVEngineTest, TestBasicPinOldestTimestamp) {
     auto opCtxRaii = _makeOperationContext();
     const Timestamp initTs = Timestamp(1, 0);
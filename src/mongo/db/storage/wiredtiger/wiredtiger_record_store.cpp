@@ -212,6 +212,13 @@ void setKey(WT_CURSOR* cursor, const WiredTigerRecordStore::CursorKey* key) {
 }
 
 auto& boundRetries = *MetricBuilder<Counter64>("wiredTiger.recordStoreCursorBoundRetries");
+
+// Counts how document updates are written to WiredTiger: as damages computed by the update system,
+// as a delta computed against the old value, or as a full copy of the new document.
+auto& updatesWithDamages = *MetricBuilder<Counter64>("wiredTiger.recordStoreUpdates.damages");
+auto& updatesWithModify = *MetricBuilder<Counter64>("wiredTiger.recordStoreUpdates.modify");
+auto& updatesWithFullDocument =
+    *MetricBuilder<Counter64>("wiredTiger.recordStoreUpdates.fullDocument");
 }  // namespace
 
 MONGO_FAIL_POINT_DEFINE(WTCompactRecordStoreEBUSY);
@@ -600,6 +607,9 @@ StatusWith<std::string> WiredTigerRecordStore::generateCreateString(
         ss << "prefix_compression,";
     }
 
+    // Blocks are compressed independently when written to disk and are held uncompressed in the
+    // cache. A collection can choose another compressor through its 'storageEngine' creation
+    // options, which are appended after these defaults.
     ss << "block_compressor=";
     if (options.timeseries) {
         // Time-series collections use zstd compression by default.
@@ -613,6 +623,12 @@ StatusWith<std::string> WiredTigerRecordStore::generateCreateString(
     ss << WiredTigerCustomizationHooks::get(getGlobalServiceContext())
               ->getTableCreateConfig(NamespaceStringUtil::serializeForCatalog(nss));
 
+    if (!nss.isOplog() && wiredTigerGlobalOptions.isCacheResident(nss.dbName())) {
+        // This is permanent for the table, whatever the option is set to on later restarts.
+        LOGV2(9601101, "Creating cache resident collection table", logAttrs(nss));
+        ss << "cache_resident=true,";
+    }
+
     ss << extraStrings << ",";
 
     StatusWith<std::string> customOptions =
@@ -1372,6 +1388,7 @@ Status WiredTigerRecordStore::doUpdateRecord(OperationContext* opCtx,
                     (c->get_value(c, &new_value) == 0 && new_value.size == value.size &&
                      memcmp(data, new_value.data, len) == 0));
             skip_update = true;
+            updatesWithModify.increment();
         } else if (ret != WT_NOTFOUND) {
             invariantWTOK(ret, c->session);
         }
@@ -1380,6 +1397,7 @@ Status WiredTigerRecordStore::doUpdateRecord(OperationContext* opCtx,
     if (!skip_update) {
         c->set_value(c, value.Get());
         ret = WT_OP_CHECK(wiredTigerCursorInsert(*WiredTigerRecoveryUnit::get(opCtx), c));
+        updatesWithFullDocument.increment();
     }
     invariantWTOK(ret, c->session);
 
@@ -1429,6 +1447,7 @@ StatusWith<RecordData> WiredTigerRecordStore::doUpdateWithDamages(
         invariantWTOK(WT_OP_CHECK(wiredTigerCursorModify(
                           *WiredTigerRecoveryUnit::get(opCtx), c, entries.data(), nentries)),
                       c->session);
+    updatesWithDamages.increment();
 
 
     WT_ITEM value;
@@ -91,6 +91,12 @@ public:
     // efficiently truncate records with WiredTiger by skipping over tombstones, etc.
     RecordId firstRecord;
 
+    /**
+     * Builds the initial set of markers when the oplog is opened at startup. Markers are not
+     * persisted, so they are rebuilt on every restart. Large oplogs are sampled, which costs
+     * roughly kRandomSamplesPerMarker random reads per marker rather than a full scan; the number
+     * of markers is bounded by 'maxOplogTruncationPointsDuringStartup'.
+     */
     static std::shared_ptr<WiredTigerRecordStore::OplogTruncateMarkers> createOplogTruncateMarkers(
         OperationContext* opCtx, WiredTigerRecordStore* rs, const NamespaceString& ns);
     //
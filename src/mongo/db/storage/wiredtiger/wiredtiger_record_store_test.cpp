@@ -53,6 +53,7 @@
 #include "mongo/db/storage/kv/kv_engine.h"
 #include "mongo/db/storage/record_store_test_harness.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
@@ -117,6 +118,27 @@ TEST(WiredTigerRecordStoreTest, GenerateCreateStringValidConfigStringOption) {
               std::string("prefix_compression=true,"));
 }
 
+TEST(WiredTigerRecordStoreTest, GenerateCreateStringCacheResidentDatabase) {
+    const std::unique_ptr<RecordStoreHarnessHelper> harnessHelper(newRecordStoreHarnessHelper());
+    const auto originalDatabases = wiredTigerGlobalOptions.cacheResidentDatabases;
+    ON_BLOCK_EXIT([&] { wiredTigerGlobalOptions.cacheResidentDatabases = originalDatabases; });
+    wiredTigerGlobalOptions.cacheResidentDatabases = {"hot"};
+
+    auto createString = [](StringData ns) {
+        const auto nss = NamespaceString::createNamespaceString_forTest(ns);
+        return unittest::assertGet(
+            WiredTigerRecordStore::generateCreateString(std::string{kWiredTigerEngineName},
+                                                        nss,
+                                                        "",
+                                                        CollectionOptions(),
+                                                        "",
+                                                        KeyFormat::Long,
+                                                        WiredTigerUtil::useTableLogging(nss)));
+    };
+    ASSERT_STRING_CONTAINS(createString("hot.coll"), "cache_resident=true");
+    ASSERT_STRING_OMITS(createString("cold.coll"), "cache_resident=true");
+}
+
 TEST(WiredTigerRecordStoreTest, Isolation1) {
     const auto harnessHelper(newRecordStoreHarnessHelper());
     std::unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
@@ -45,6 +45,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/storage_options.h"
@@ -198,6 +199,24 @@ void WiredTigerRecoveryUnit::setPrefetching(bool enable) {
     session->reconfigure(config.str(), "prefetch=(enabled=false)");
 }
 
+bool WiredTigerRecoveryUnit::enablePrefetchingIfIdle() {
+    // The connection only makes pre-fetching available under the feature flag, and never when it
+    // is in-memory.
+    if (!gFeatureFlagPrefetch.isEnabled(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot()) ||
+        _sessionCache->isEphemeral()) {
+        return false;
+    }
+
+    // A session can only be reconfigured outside of a transaction.
+    if (_inUnitOfWork() || _isActive() || getSessionNoTxn()->cursorsOut() != 0) {
+        return false;
+    }
+
+    setPrefetching(true);
+    return true;
+}
+
 bool WiredTigerRecoveryUnit::waitUntilDurable(OperationContext* opCtx) {
     invariant(!_inUnitOfWork(), toString(_getState()));
     invariant(!shard_role_details::getLocker(opCtx)->isLocked() || storageGlobalParams.repair);
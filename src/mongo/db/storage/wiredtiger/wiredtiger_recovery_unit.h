@@ -128,6 +128,8 @@ public:
      */
     void setPrefetching(bool enable) override;
 
+    bool enablePrefetchingIfIdle() override;
+
     void allowOneUntimestampedWrite() override {
         invariant(!_isActive());
         _untimestampedWriteAssertionLevel =
@@ -224,6 +224,19 @@ TEST_F(WiredTigerRecoveryUnitTestFixture, SetReadSource) {
     ASSERT_EQ(Timestamp(1, 1), ru1->getPointInTimeReadTimestamp(clientAndCtx1.second.get()));
 }
 
+TEST_F(WiredTigerRecoveryUnitTestFixture, EnablePrefetchingIfIdle) {
+    // Storage engine operations require at least Global IS.
+    Lock::GlobalLock lk(clientAndCtx1.second.get(), MODE_IS);
+
+    // A session can't be reconfigured while it has a transaction open.
+    ru1->getSession();
+    ASSERT_FALSE(ru1->enablePrefetchingIfIdle());
+
+    ru1->abandonSnapshot();
+    ASSERT_TRUE(ru1->enablePrefetchingIfIdle());
+    ASSERT(ru1->getSessionNoTxn()->getUndoConfigStrings().count("prefetch=(enabled=false)"));
+}
+
 TEST_F(WiredTigerRecoveryUnitTestFixture, NoOverlapReadSource) {
     OperationContext* opCtx1 = clientAndCtx1.second.get();
     OperationContext* opCtx2 = clientAndCtx2.second.get();
@@ -121,6 +121,16 @@ BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                           Timestamp(engine->getOplogManager()->getOplogReadTimestamp()));
     }
 
+    {
+        BSONObjBuilder subsection(bob.subobjStart("session cache"));
+        WiredTigerRecoveryUnit::get(opCtx)->getSessionCache()->appendStats(&subsection);
+    }
+
+    {
+        BSONObjBuilder subsection(bob.subobjStart("journal group commit"));
+        WiredTigerRecoveryUnit::get(opCtx)->getSessionCache()->appendGroupCommitStats(&subsection);
+    }
+
     return bob.obj();
 }
 
@@ -28,10 +28,17 @@
  */
 
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <utility>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
@@ -50,8 +57,10 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
@@ -61,6 +70,7 @@ namespace mongo {
 
 WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn, uint64_t epoch, uint64_t cursorEpoch)
     : _epoch(epoch),
+      _cursorEpoch(cursorEpoch),
       _session(nullptr),
       _cursorGen(0),
       _cursorsOut(0),
@@ -74,6 +84,7 @@ WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn,
                                      uint64_t epoch,
                                      uint64_t cursorEpoch)
     : _epoch(epoch),
+      _cursorEpoch(cursorEpoch),
       _session(nullptr),
       _cursorGen(0),
       _cursorsOut(0),
@@ -239,7 +250,11 @@ WiredTigerSessionCache::WiredTigerSessionCache(WiredTigerKVEngine* engine)
 WiredTigerSessionCache::WiredTigerSessionCache(WT_CONNECTION* conn,
                                                ClockSource* cs,
                                                WiredTigerKVEngine* engine)
-    : _conn(conn), _clockSource(cs), _engine(engine) {
+    : _conn(conn),
+      _clockSource(cs),
+      _engine(engine),
+      _numPartitions(std::max(1u, ProcessInfo::getNumLogicalCores())),
+      _partitions(new CachePartition[_numPartitions]) {
     uassertStatusOK(_compiledConfigurations.compileAll(_conn));
 }
 
@@ -314,26 +329,50 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
 
     auto [journalListener, token] = _getJournalListenerWithToken(opCtx, useListener);
 
-    uint32_t start = _lastSyncTime.load();
-    // Do the remainder in a critical section that ensures only a single thread at a time
-    // will attempt to synchronize.
+    Timer waitTimer;
     stdx::unique_lock<Latch> lk(_lastSyncMutex);
-    uint32_t current = _lastSyncTime.loadRelaxed();  // synchronized with writes through mutex
-    if (current != start) {
-        // Someone else synced already since we read lastSyncTime, so we're done!
 
-        // Unconditionally unlock mutex here to run operations that do not require synchronization.
-        // The JournalListener is the only operation that meets this criteria currently.
-        lk.unlock();
-        if (token) {
-            journalListener->onDurable(token.value());
+    // A flush that starts after this point makes all of our writes durable.
+    const uint64_t flush = _flushesStarted + 1;
+    ++_nextBatchSize;
+    while (_flushesCompleted < flush) {
+        if (_flushInProgress) {
+            _lastSyncCond.wait(lk);
+        } else {
+            _flushJournal(lk);
         }
+    }
 
-        return;
+    // Unconditionally unlock mutex here to run operations that do not require synchronization.
+    // The JournalListener is the only operation that meets this criteria currently.
+    lk.unlock();
+    _groupCommitWaitMicros.increment(durationCount<Microseconds>(waitTimer.elapsed()));
+    if (token) {
+        journalListener->onDurable(token.value());
     }
-    _lastSyncTime.store(current + 1);
+}
 
-    // Nobody has synched yet, so we have to sync ourselves.
+void WiredTigerSessionCache::_flushJournal(stdx::unique_lock<Latch>& lk) {
+    invariant(!_flushInProgress);
+    _flushInProgress = true;
+
+    // If the previous flush was shared, other waiters are likely to arrive shortly, so give them a
+    // chance to join this flush. Waiting no longer than the previous flush took keeps the latency
+    // of a lone waiter within a small factor of a flush.
+    if (_lastBatchSize > 1) {
+        auto window = std::min(_lastFlushDuration,
+                               Microseconds(gWiredTigerJournalGroupCommitWindowMicros.load()));
+        if (window > Microseconds(0)) {
+            _lastSyncCond.wait_for(lk, window.toSystemDuration());
+        }
+    }
+
+    const uint64_t flush = ++_flushesStarted;
+    const int64_t batchSize = std::exchange(_nextBatchSize, 0);
+    lk.unlock();
+
+    // Only the leader of a flush uses the session, and there is one flush at a time.
+    Timer flushTimer;
 
     // Initialize on first use.
     if (!_waitUntilDurableSession) {
@@ -345,7 +384,7 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
     // Flush the journal.
     invariantWTOK(_waitUntilDurableSession->log_flush(_waitUntilDurableSession, "sync=on"),
                   _waitUntilDurableSession);
-    LOGV2_DEBUG(22419, 4, "flushed journal");
+    LOGV2_DEBUG(22419, 4, "flushed journal", "waiters"_attr = batchSize);
 
     // The session is reset periodically so that WT doesn't consider it a rogue session and log
     // about it. The session doesn't actually pin any resources that need to be released.
@@ -354,12 +393,15 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
         _timeSinceLastDurabilitySessionReset.reset();
     }
 
-    // Unconditionally unlock mutex here to run operations that do not require synchronization.
-    // The JournalListener is the only operation that meets this criteria currently.
-    lk.unlock();
-    if (token) {
-        journalListener->onDurable(token.value());
-    }
+    const auto flushDuration = flushTimer.elapsed();
+    _groupCommitBatchSizes.increment(batchSize);
+
+    lk.lock();
+    _flushInProgress = false;
+    _flushesCompleted = flush;
+    _lastBatchSize = batchSize;
+    _lastFlushDuration = flushDuration;
+    _lastSyncCond.notify_all();
 }
 
 void WiredTigerSessionCache::waitUntilPreparedUnitOfWorkCommitsOrAborts(
@@ -387,16 +429,110 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 }
 
 
+size_t WiredTigerSessionCache::_currentPartition() const {
+#if defined(__linux__)
+    if (int cpu = sched_getcpu(); cpu >= 0) {
+        return cpu % _numPartitions;
+    }
+#endif
+    return std::hash<stdx::thread::id>{}(stdx::this_thread::get_id()) % _numPartitions;
+}
+
+stdx::unique_lock<Latch> WiredTigerSessionCache::_lockPartition(CachePartition& partition) {
+    stdx::unique_lock<Latch> lock(partition.lock, stdx::try_to_lock);
+    if (!lock.owns_lock()) {
+        partition.lockWaits.fetchAndAddRelaxed(1);
+        lock.lock();
+    }
+    return lock;
+}
+
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    {
+        stdx::lock_guard<Latch> lock(_invalidatedUrisMutex);
+        _invalidatedUris.emplace_back(_cursorEpoch.addAndFetch(1), uri);
+        if (_invalidatedUris.size() > kMaxInvalidatedUris) {
+            _invalidatedUris.pop_front();
+        }
+    }
+
+    // Sessions in use catch up with the invalidation above in _closeInvalidatedCursors(), but idle
+    // sessions are brought up to date here so that a drop of 'uri' isn't blocked by their cursors.
+    // This also advances their cursor epoch, so they don't close the same cursors again when they
+    // are next used.
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        auto& partition = _partitions[i];
+        auto lock = _lockPartition(partition);
+        for (auto session : partition.sessions) {
+            _closeInvalidatedCursors(session);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        auto& partition = _partitions[i];
+        auto lock = _lockPartition(partition);
+        count += partition.sessions.size();
+    }
+    return count;
+}
+
+void WiredTigerSessionCache::appendGroupCommitStats(BSONObjBuilder* bob) const {
+    appendHistogram(*bob, _groupCommitBatchSizes, "waiters per flush");
+    appendHistogram(*bob, _groupCommitWaitMicros, "wait micros");
+}
+
+void WiredTigerSessionCache::_closeInvalidatedCursors(WiredTigerSession* session) {
+    // Any cursor the session cached before it was brought up to date may be on a dropped table.
+    if (session->_cursorEpoch == _cursorEpoch.load()) {
+        return;
+    }
+
+    std::vector<std::string> uris;
+    uint64_t cursorEpoch;
+    {
+        stdx::lock_guard<Latch> lock(_invalidatedUrisMutex);
+        cursorEpoch = _cursorEpoch.load();
+        if (_invalidatedUris.empty() ||
+            _invalidatedUris.front().first > session->_cursorEpoch + 1) {
+            // Some of the invalidations since the session was brought up to date are no longer
+            // recorded.
+            uris.emplace_back("");
+        } else {
+            for (const auto& [epoch, uri] : _invalidatedUris) {
+                if (epoch > session->_cursorEpoch) {
+                    uris.push_back(uri);
+                }
+            }
+        }
+    }
+
+    for (const auto& uri : uris) {
+        session->closeAllCursors(uri);
+    }
+    session->_cursorEpoch = cursorEpoch;
+}
+
+void WiredTigerSessionCache::appendStats(BSONObjBuilder* bob) const {
+    long long hits = 0;
+    long long steals = 0;
+    long long misses = 0;
+    long long lockWaits = 0;
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        const auto& partition = _partitions[i];
+        hits += partition.hits.loadRelaxed();
+        steals += partition.steals.loadRelaxed();
+        misses += partition.misses.loadRelaxed();
+        lockWaits += partition.lockWaits.loadRelaxed();
+    }
+
+    bob->append("partitions", static_cast<long long>(_numPartitions));
+    bob->append("sessions reused from the same core", hits);
+    bob->append("sessions stolen from another core", steals);
+    bob->append("sessions opened because none were idle", misses);
+    bob->append("partition lock waits", lockWaits);
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -408,19 +544,21 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        auto& partition = _partitions[i];
+        auto lock = _lockPartition(partition);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = partition.sessions.begin(); it != partition.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = partition.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
             }
         }
+        partition.numSessions.store(partition.sessions.size());
     }
 
     // Closing expired idle sessions is expensive, so do it outside of the cache mutex. This helps
@@ -431,13 +569,18 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
+    // Increment the epoch as we are now closing all sessions with this epoch. This happens before
+    // any partition is emptied, so that a session released to a partition after it is emptied sees
+    // the new epoch when it rechecks under the partition lock, and gets deleted.
     SessionCache swap;
-
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    _epoch.fetchAndAdd(1);
+
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        auto& partition = _partitions[i];
+        auto lock = _lockPartition(partition);
+        swap.insert(swap.end(), partition.sessions.begin(), partition.sessions.end());
+        partition.sessions.clear();
+        partition.numSessions.store(0);
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -454,21 +597,38 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            // Reset the idle time
-            cachedSession->setIdleExpireTime(Date_t::min());
-            return UniqueWiredTigerSession(cachedSession);
+    // Start with the partition of this core, whose sessions are the most likely to be in its CPU
+    // cache, and then try the others in turn.
+    const size_t home = _currentPartition();
+    for (size_t i = 0; i < _numPartitions; ++i) {
+        auto& partition = _partitions[(home + i) % _numPartitions];
+        if (i != 0 && partition.numSessions.loadRelaxed() == 0) {
+            continue;
         }
+
+        auto lock = _lockPartition(partition);
+        if (partition.sessions.empty()) {
+            continue;
+        }
+
+        // Get the most recently used session so that if we discard sessions, we're
+        // discarding older ones
+        WiredTigerSession* cachedSession = partition.sessions.back();
+        partition.sessions.pop_back();
+        partition.numSessions.store(partition.sessions.size());
+        (i == 0 ? partition.hits : partition.steals).fetchAndAddRelaxed(1);
+        lock.unlock();
+
+        // Reset the idle time
+        cachedSession->setIdleExpireTime(Date_t::min());
+        _closeInvalidatedCursors(cachedSession);
+        return UniqueWiredTigerSession(cachedSession);
     }
 
     // Outside of the cache partition lock, but on release will be put back on the cache
-    return UniqueWiredTigerSession(new WiredTigerSession(_conn, this, _epoch.load()));
+    _partitions[home].misses.fetchAndAddRelaxed(1);
+    return UniqueWiredTigerSession(
+        new WiredTigerSession(_conn, this, _epoch.load(), _cursorEpoch.load()));
 }
 
 void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
@@ -502,6 +662,8 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
         // be cached at the WiredTiger level.
         if (gWiredTigerCursorCacheSize.load() < 0) {
             session->closeAllCursors("");
+        } else {
+            _closeInvalidatedCursors(session);
         }
 
         session->resetSessionConfiguration();
@@ -515,10 +677,12 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& partition = _partitions[_currentPartition()];
+        auto lock = _lockPartition(partition);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            partition.sessions.push_back(session);
+            partition.numSessions.store(partition.sessions.size());
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -31,12 +31,15 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <list>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 #include <wiredtiger.h>
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/journal_listener.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_compiled_configuration.h"
@@ -44,7 +47,9 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/clock_source.h"
+#include "mongo/util/histogram.h"
 #include "mongo/util/time_support.h"
 #include "mongo/util/timer.h"
 
@@ -216,6 +221,9 @@ private:
     }
 
     const uint64_t _epoch;
+    // The cursor invalidation of the session cache that this session's cached cursors are current
+    // with. Used internally by WiredTigerSessionCache.
+    uint64_t _cursorEpoch;
     WT_SESSION* _session;  // owned
     CursorCache _cursors;  // owned
     uint64_t _cursorGen;
@@ -305,6 +313,18 @@ public:
      */
     size_t getIdleSessionsCount();
 
+    /**
+     * Appends counters of how getSession() found its sessions, and of how often it or
+     * releaseSession() had to wait for a partition of the cache, for serverStatus output.
+     */
+    void appendStats(BSONObjBuilder* bob) const;
+
+    /**
+     * Appends histograms of the number of waiters made durable by each journal flush, and of the
+     * time each spent in waitUntilDurable, for serverStatus output.
+     */
+    void appendGroupCommitStats(BSONObjBuilder* bob) const;
+
     /**
      * Closes all cached sessions whose idle expiration time has been reached.
      */
@@ -319,6 +339,10 @@ public:
     /**
      * Closes all cached cursors matching the uri.  If the uri is empty,
      * all cached cursors are closed.
+     *
+     * Cursors cached by sessions that are in use are closed when the session is next released or
+     * handed out, so that a session never serves a cursor on a dropped table and cursors on other
+     * tables stay cached.
      */
     void closeAllCursors(const std::string& uri);
 
@@ -420,6 +444,18 @@ private:
     std::pair<JournalListener*, boost::optional<JournalListener::Token>>
     _getJournalListenerWithToken(OperationContext* opCtx, UseJournalListener useListener);
 
+    /**
+     * Closes the cached cursors of 'session' on every uri passed to closeAllCursors() since the
+     * session was last brought up to date, or all of them if that is too far back to tell.
+     */
+    void _closeInvalidatedCursors(WiredTigerSession* session);
+
+    /**
+     * Leads the next journal flush for waitUntilDurable, and wakes the waiters it made durable.
+     * Must be called with 'lk' held on _lastSyncMutex and no flush in progress.
+     */
+    void _flushJournal(stdx::unique_lock<Latch>& lk);
+
     WT_CONNECTION* _conn;             // not owned
     ClockSource* const _clockSource;  // not owned
     WiredTigerKVEngine* _engine;      // not owned, might be NULL
@@ -432,16 +468,65 @@ private:
     AtomicWord<unsigned> _shuttingDown{0};
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // Idle sessions are partitioned by the core that released them, so that threads running on
+    // different cores don't contend on one mutex. A thread whose partition is empty takes a
+    // session from another partition before it opens a new one.
+    struct alignas(stdx::hardware_destructive_interference_size) CachePartition {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::CachePartition::lock");
+        SessionCache sessions;
+
+        // The size of 'sessions', so that other threads can skip an empty partition without
+        // taking its lock.
+        AtomicWord<size_t> numSessions{0};
+
+        // Sessions taken from this partition by a thread on its own core or on another core, and
+        // sessions opened because no partition had one.
+        AtomicWord<long long> hits{0};
+        AtomicWord<long long> steals{0};
+        AtomicWord<long long> misses{0};
+
+        // Acquisitions of 'lock' that found it held by another thread.
+        AtomicWord<long long> lockWaits{0};
+    };
+
+    /** Returns the index of the partition for the core the calling thread runs on. */
+    size_t _currentPartition() const;
+
+    /** Locks 'partition', counting the acquisition if it has to wait. */
+    static stdx::unique_lock<Latch> _lockPartition(CachePartition& partition);
+
+    const size_t _numPartitions;
+    std::unique_ptr<CachePartition[]> _partitions;
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
 
-    // Counter and critical section mutex for waitUntilDurable
-    AtomicWord<unsigned> _lastSyncTime;
+    // Bumped by each call to closeAllCursors(), which records its uri with the new value in
+    // '_invalidatedUris'. Only the most recent kMaxInvalidatedUris are kept.
+    static constexpr size_t kMaxInvalidatedUris = 128;
+    Mutex _invalidatedUrisMutex =
+        MONGO_MAKE_LATCH("WiredTigerSessionCache::_invalidatedUrisMutex");
+    AtomicWord<unsigned long long> _cursorEpoch{0};  // atomic so we can check it without the lock
+    std::deque<std::pair<uint64_t, std::string>> _invalidatedUris;
+
+    // Journal flushes for waitUntilDurable are group committed. The first waiter to find no flush
+    // in progress leads the next one, and every waiter that arrives before that flush starts is
+    // made durable by it. The members below are protected by _lastSyncMutex.
     Mutex _lastSyncMutex = MONGO_MAKE_LATCH("WiredTigerSessionCache::_lastSyncMutex");
+    stdx::condition_variable _lastSyncCond;
+    bool _flushInProgress = false;
+    uint64_t _flushesStarted = 0;
+    uint64_t _flushesCompleted = 0;
+    int64_t _nextBatchSize = 0;  // Waiters for the flush that starts next
+    int64_t _lastBatchSize = 0;
+    Microseconds _lastFlushDuration{0};
+
+    // Waiters per journal flush, and the time each waiter spent in waitUntilDurable.
+    Histogram<int64_t> _groupCommitBatchSizes{{2, 4, 8, 16, 32, 64, 128, 256, 512, 1024}};
+    Histogram<int64_t> _groupCommitWaitMicros{
+        {100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000}};
 
     // Mutex and cond var for waiting on prepare commit or abort.
     Mutex _prepareCommittedOrAbortedMutex =
@@ -37,6 +37,8 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/unittest/temp_dir.h"
@@ -116,6 +118,101 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, IdleSessionsAreCountedAcrossPartitions) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+    {
+        UniqueWiredTigerSession first = sessionCache->getSession();
+        UniqueWiredTigerSession second = sessionCache->getSession();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 2U);
+
+    // Reusing a released session, whichever partition it was released to, does not open a new one.
+    {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 2U);
+
+    BSONObjBuilder bob;
+    sessionCache->appendStats(&bob);
+    BSONObj stats = bob.obj();
+    ASSERT_GTE(stats["partitions"].numberLong(), 1);
+    ASSERT_EQUALS(stats["sessions opened because none were idle"].numberLong(), 2);
+    ASSERT_EQUALS(stats["sessions reused from the same core"].numberLong() +
+                      stats["sessions stolen from another core"].numberLong(),
+                  1);
+
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
+// Test that closing the cursors on a uri while a session is in use closes that session's cached
+// cursors on the uri once it is released, without closing its cursors on other uris.
+TEST(WiredTigerSessionCacheTest, CloseAllCursorsReachesSessionsInUse) {
+    RAIIServerParameterControllerForTest cursorCacheSize("wiredTigerCursorCacheSize", 100);
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+    const std::string droppedUri = "table:dropped";
+    const std::string otherUri = "table:other";
+    const auto droppedTableId = WiredTigerSession::genTableId();
+    const auto otherTableId = WiredTigerSession::genTableId();
+    {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        WT_SESSION* wtSession = session->getSession();
+        ASSERT_OK(wtRCToStatus(wtSession->create(wtSession, droppedUri.c_str(), nullptr), nullptr));
+        ASSERT_OK(wtRCToStatus(wtSession->create(wtSession, otherUri.c_str(), nullptr), nullptr));
+
+        session->releaseCursor(droppedTableId, session->getNewCursor(droppedUri), "");
+        session->releaseCursor(otherTableId, session->getNewCursor(otherUri), "");
+        ASSERT_EQUALS(session->cachedCursors(), 2);
+
+        // The session is in use, so its cursors are closed when it is released.
+        sessionCache->closeAllCursors(droppedUri);
+        ASSERT_EQUALS(session->cachedCursors(), 2);
+    }
+
+    UniqueWiredTigerSession session = sessionCache->getSession();
+    ASSERT_EQUALS(session->cachedCursors(), 1);
+    ASSERT(session->getCachedCursor(droppedTableId, "") == nullptr);
+    WT_CURSOR* cursor = session->getCachedCursor(otherTableId, "");
+    ASSERT(cursor);
+    session->releaseCursor(otherTableId, cursor, "");
+}
+
+// Test that concurrent durability waiters all return, and that each is made durable by exactly one
+// journal flush.
+TEST(WiredTigerSessionCacheTest, WaitUntilDurableGroupCommits) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("log=(enabled=true)");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+    const int kWaiters = 16;
+    const int kWaitsPerWaiter = 10;
+
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kWaiters; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kWaitsPerWaiter; ++j) {
+                sessionCache->waitUntilDurable(nullptr,
+                                               WiredTigerSessionCache::Fsync::kJournal,
+                                               WiredTigerSessionCache::UseJournalListener::kSkip);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    BSONObjBuilder bob;
+    sessionCache->appendGroupCommitStats(&bob);
+    BSONObj stats = bob.obj();
+    ASSERT_EQUALS(stats["wait micros"]["totalCount"].numberLong(), kWaiters * kWaitsPerWaiter);
+
+    // Waiters that arrive while a flush is in progress share the next one.
+    auto flushes = stats["waiters per flush"]["totalCount"].numberLong();
+    ASSERT_GTE(flushes, 1);
+    ASSERT_LTE(flushes, kWaiters * kWaitsPerWaiter);
+}
+
 TEST(WiredTigerSessionCacheTest, ReleaseCursorDuringShutdown) {
     WiredTigerSessionCacheHarnessHelper harnessHelper("");
     WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
@@ -0,0 +1,272 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <fmt/format.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <wiredtiger.h>
+
+#include "mongo/base/init.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/mutable/damage_vector.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/key_string.h"
+#include "mongo/db/storage/record_data.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_index.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_record_store_test_harness.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/transaction_resources.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/timer.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+namespace {
+
+using namespace fmt::literals;
+
+MONGO_INITIALIZER_GENERAL(CoreOptions_Store, (), ())
+(InitializerContext* context) {
+    // Dummy initializer to fill in the initializer graph
+}
+
+MONGO_INITIALIZER_GENERAL(DisableLogging, (), ())
+(InitializerContext*) {
+    auto& lv2Manager = logv2::LogManager::global();
+    logv2::LogDomainGlobal::ConfigurationOptions lv2Config;
+    lv2Config.makeDisabled();
+    uassertStatusOK(lv2Manager.getGlobalDomainInternal().configure(lv2Config));
+}
+
+static constexpr int kOpsPerThread = 1000;
+static constexpr int kRecordSize = 256;
+// Every 'kUpdateEvery'th operation updates a record the thread inserted earlier instead of
+// inserting a new one.
+static constexpr int kUpdateEvery = 4;
+
+enum class Durability { kNone, kJournal };
+
+/**
+ * An on-disk WiredTigerKVEngine with a configurable cache size, holding one record store and one
+ * secondary index over it.
+ */
+class WritePathFixture {
+public:
+    explicit WritePathFixture(int cacheSizeMB)
+        : _harness("cache_size={}M"_format(cacheSizeMB)),
+          _rs(_harness.newRecordStore(_nss.toString_forTest())) {
+        auto opCtx = _harness.newOperationContext();
+        BSONObj spec = BSON("key" << BSON("a" << 1) << "name"
+                                  << "a_1"
+                                  << "v" << static_cast<int>(IndexDescriptor::kLatestIndexVersion));
+        _desc = std::make_unique<IndexDescriptor>("", spec);
+
+        const bool isLogged = WiredTigerUtil::useTableLogging(_nss);
+        auto config = uassertStatusOK(WiredTigerIndex::generateCreateString(
+            std::string{kWiredTigerEngineName}, "", "", _nss, *_desc, isLogged));
+        const std::string uri = "table:write_path_a_1";
+        uassertStatusOK(WiredTigerIndex::create(opCtx.get(), uri, config));
+        _index = std::make_unique<WiredTigerIndexStandard>(opCtx.get(),
+                                                           uri,
+                                                           UUID::gen(),
+                                                           "" /* ident */,
+                                                           KeyFormat::Long,
+                                                           _desc.get(),
+                                                           isLogged);
+    }
+
+    const NamespaceString& nss() const {
+        return _nss;
+    }
+
+    WiredTigerHarnessHelper& harness() {
+        return _harness;
+    }
+
+    RecordStore* rs() {
+        return _rs.get();
+    }
+
+    SortedDataInterface* index() {
+        return _index.get();
+    }
+
+    /**
+     * Returns the current value of a WiredTiger connection statistic.
+     */
+    int64_t connectionStat(int statKey) {
+        auto opCtx = _harness.newOperationContext();
+        auto session = WiredTigerRecoveryUnit::get(opCtx.get())->getSessionNoTxn()->getSession();
+        return uassertStatusOK(WiredTigerUtil::getStatisticsValue(
+            session, "statistics:", "statistics=(fast)", statKey));
+    }
+
+private:
+    const NamespaceString _nss = NamespaceString::createNamespaceString_forTest("test.write_path");
+    WiredTigerHarnessHelper _harness;
+    std::unique_ptr<RecordStore> _rs;
+    std::unique_ptr<IndexDescriptor> _desc;
+    std::unique_ptr<SortedDataInterface> _index;
+};
+
+/**
+ * Performs 'kOpsPerThread' write operations, each in its own WriteUnitOfWork which is retried on
+ * write conflicts with the other writers, and appends the latency of each operation in
+ * microseconds to 'latencies'. Inserts add a record and its index key. Updates modify the record
+ * in place through updateWithDamages() and move its index key.
+ */
+void runWriter(WritePathFixture& fixture,
+               int threadId,
+               Durability durability,
+               std::vector<int64_t>& latencies) {
+    ThreadClient tc("writer-{}"_format(threadId), fixture.harness().serviceContext()->getService());
+    auto opCtx = fixture.harness().newOperationContext(tc.get());
+    auto rs = fixture.rs();
+    auto index = fixture.index();
+
+    const auto keyFor = [&](int64_t value, const RecordId& rid) {
+        key_string::Builder builder(
+            index->getKeyStringVersion(), BSON("" << value), index->getOrdering());
+        builder.appendRecordId(rid);
+        return builder.getValueCopy();
+    };
+
+    char record[kRecordSize];
+    std::memset(record, 'x', sizeof(record));
+    std::vector<std::pair<RecordId, int64_t>> inserted;
+    inserted.reserve(kOpsPerThread);
+
+    latencies.reserve(latencies.size() + kOpsPerThread);
+    for (int i = 0; i < kOpsPerThread; ++i) {
+        const int64_t value = static_cast<int64_t>(threadId) * kOpsPerThread + i;
+        Timer timer;
+        writeConflictRetry(opCtx.get(), "runWriter", fixture.nss(), [&] {
+            WriteUnitOfWork wuow(opCtx.get());
+            if (i % kUpdateEvery == kUpdateEvery - 1 && !inserted.empty()) {
+                auto& [rid, oldValue] = inserted[value % inserted.size()];
+                RecordData oldRec(record, sizeof(record));
+                mutablebson::DamageVector damages{
+                    mutablebson::DamageEvent(0, sizeof(value), 0, sizeof(value))};
+                uassertStatusOK(rs->updateWithDamages(
+                    opCtx.get(), rid, oldRec, reinterpret_cast<const char*>(&value), damages));
+                index->unindex(opCtx.get(), keyFor(oldValue, rid), true /* dupsAllowed */);
+                uassertStatusOK(index->insert(opCtx.get(), keyFor(value, rid), true));
+                wuow.commit();
+                oldValue = value;
+            } else {
+                std::memcpy(record, &value, sizeof(value));
+                auto rid = uassertStatusOK(
+                    rs->insertRecord(opCtx.get(), record, sizeof(record), Timestamp()));
+                uassertStatusOK(index->insert(opCtx.get(), keyFor(value, rid), true));
+                wuow.commit();
+                inserted.emplace_back(rid, value);
+            }
+        });
+        if (durability == Durability::kJournal) {
+            shard_role_details::getRecoveryUnit(opCtx.get())->waitUntilDurable(opCtx.get());
+        }
+        latencies.push_back(timer.micros());
+    }
+}
+
+/**
+ * Runs concurrent writers against a shared record store and index.
+ *
+ * Arguments: the number of writer threads, the WiredTiger cache size in megabytes, and whether
+ * each operation waits for its write to be journaled. Reports write throughput, per-operation
+ * latency percentiles, and the eviction activity WiredTiger performed during the run.
+ */
+void BM_WiredTigerConcurrentWrites(benchmark::State& state) {
+    const int numThreads = state.range(0);
+    const int cacheSizeMB = state.range(1);
+    const auto durability = static_cast<Durability>(state.range(2));
+
+    WritePathFixture fixture(cacheSizeMB);
+    const auto evictedDirtyBefore = fixture.connectionStat(WT_STAT_CONN_CACHE_EVICTION_DIRTY);
+    const auto evictedCleanBefore = fixture.connectionStat(WT_STAT_CONN_CACHE_EVICTION_CLEAN);
+    const auto appEvictMicrosBefore = fixture.connectionStat(WT_STAT_CONN_CACHE_EVICTION_APP_TIME);
+
+    std::vector<std::vector<int64_t>> latencies(numThreads);
+    for (auto _ : state) {
+        std::vector<stdx::thread> writers;
+        writers.reserve(numThreads);
+        for (int t = 0; t < numThreads; ++t) {
+            writers.emplace_back([&, t] { runWriter(fixture, t, durability, latencies[t]); });
+        }
+        for (auto& writer : writers) {
+            writer.join();
+        }
+    }
+
+    std::vector<int64_t> all;
+    for (auto& threadLatencies : latencies) {
+        all.insert(all.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    std::sort(all.begin(), all.end());
+    const auto percentile = [&](double p) {
+        return all.empty() ? 0 : all[std::min(all.size() - 1, size_t(p * all.size()))];
+    };
+
+    state.SetItemsProcessed(all.size());
+    state.counters["p50_us"] = percentile(0.50);
+    state.counters["p95_us"] = percentile(0.95);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["max_us"] = all.empty() ? 0 : all.back();
+    state.counters["evicted_dirty_pages"] =
+        fixture.connectionStat(WT_STAT_CONN_CACHE_EVICTION_DIRTY) - evictedDirtyBefore;
+    state.counters["evicted_clean_pages"] =
+        fixture.connectionStat(WT_STAT_CONN_CACHE_EVICTION_CLEAN) - evictedCleanBefore;
+    state.counters["app_evict_us"] =
+        fixture.connectionStat(WT_STAT_CONN_CACHE_EVICTION_APP_TIME) - appEvictMicrosBefore;
+}
+
+BENCHMARK(BM_WiredTigerConcurrentWrites)
+    ->ArgNames({"threads", "cacheMB", "durable"})
+    ->ArgsProduct({{1, 4, 16}, {16, 1024}, {0, 1}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace mongo
@@ -184,7 +184,9 @@ public:
 
     /**
      * In-memory state of each committed data field. Enables fewer complete round-trips of
-     * decompression + compression.
+     * decompression + compression. Measurements are only held here in compressed form, so with
+     * always-compressed buckets the memory an open bucket costs beyond 'minmax' and 'schema' is
+     * close to the compressed size of its data fields.
      */
     MeasurementMap measurementMap;
 };
@@ -293,7 +293,7 @@ StatusWith<InsertResult> tryInsert(OperationContext* opCtx,
     // Buckets are spread across independently-lockable stripes to improve parallelism. We map a
     // bucket to a stripe by hashing the BucketKey.
     auto& stripe = *catalog.stripes[insertContext.stripeNumber];
-    stdx::lock_guard stripeLock{stripe.mutex};
+    auto stripeLock = internal::lockStripe(stripe);
 
     Bucket* bucket = internal::useBucket(opCtx,
                                          catalog,
@@ -406,7 +406,7 @@ StatusWith<InsertResult> insertWithReopeningContext(OperationContext* opCtx,
     // Buckets are spread across independently-lockable stripes to improve parallelism. We map a
     // bucket to a stripe by hashing the BucketKey.
     auto& stripe = *catalog.stripes[insertContext.stripeNumber];
-    stdx::lock_guard stripeLock{stripe.mutex};
+    auto stripeLock = internal::lockStripe(stripe);
 
     // Can safely clear reentrant coordination state now that we have acquired the lock.
     reopeningContext.clear(stripeLock);
@@ -499,7 +499,7 @@ StatusWith<InsertResult> insert(OperationContext* opCtx,
                                 InsertContext& insertContext,
                                 const Date_t& time) {
     auto& stripe = *catalog.stripes[insertContext.stripeNumber];
-    stdx::lock_guard stripeLock{stripe.mutex};
+    auto stripeLock = internal::lockStripe(stripe);
 
     Bucket* bucket = useBucket(opCtx,
                                catalog,
@@ -550,7 +550,7 @@ Status prepareCommit(BucketCatalog& catalog,
     auto& stripe = *catalog.stripes[batch->bucketHandle.stripe];
     internal::waitToCommitBatch(catalog.bucketStateRegistry, stripe, batch);
 
-    stdx::lock_guard stripeLock{stripe.mutex};
+    auto stripeLock = internal::lockStripe(stripe);
 
     if (isWriteBatchFinished(*batch)) {
         // Someone may have aborted it while we were waiting. Since we have the prepared batch, we
@@ -593,7 +593,7 @@ boost::optional<ClosedBucket> finish(OperationContext* opCtx,
     finishWriteBatch(*batch, info);
 
     auto& stripe = *catalog.stripes[batch->bucketHandle.stripe];
-    stdx::lock_guard stripeLock{stripe.mutex};
+    auto stripeLock = internal::lockStripe(stripe);
 
     if (MONGO_unlikely(runPostCommitDebugChecks.shouldFail() && opCtx)) {
         Bucket* bucket = internal::useBucket(catalog.bucketStateRegistry,
@@ -691,7 +691,7 @@ void abort(BucketCatalog& catalog, std::shared_ptr<WriteBatch> batch, const Stat
     }
 
     auto& stripe = *catalog.stripes[batch->bucketHandle.stripe];
-    stdx::lock_guard stripeLock{stripe.mutex};
+    auto stripeLock = internal::lockStripe(stripe);
 
     internal::abort(catalog, stripe, stripeLock, batch, status);
 }
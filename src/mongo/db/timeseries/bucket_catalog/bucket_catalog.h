@@ -151,6 +151,10 @@ struct Stripe {
     mutable Mutex mutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(1), "BucketCatalog::Stripe::mutex");
 
+    // Number of times a write found 'mutex' held by another thread and had to wait for it. Does
+    // not require 'mutex'.
+    mutable AtomicWord<long long> numLockWaits;
+
     // All buckets currently open in the catalog, including buckets which are full or pending
     // closure but not yet committed, indexed by BucketId. Owning pointers.
     tracked_unordered_map<BucketId, unique_tracked_ptr<Bucket>, BucketHasher> openBucketsById;
@@ -191,6 +191,15 @@ StripeNumber getStripeNumber(const BucketKey& key, size_t numberOfStripes) {
     return key.hash % numberOfStripes;
 }
 
+stdx::unique_lock<Mutex> lockStripe(const Stripe& stripe) {
+    stdx::unique_lock stripeLock{stripe.mutex, stdx::try_to_lock};
+    if (!stripeLock.owns_lock()) {
+        stripe.numLockWaits.fetchAndAddRelaxed(1);
+        stripeLock.lock();
+    }
+    return stripeLock;
+}
+
 StatusWith<std::pair<BucketKey, Date_t>> extractBucketingParameters(
     TrackingContext& trackingContext,
     const UUID& collectionUUID,
@@ -56,6 +56,8 @@
 #include "mongo/db/timeseries/bucket_catalog/rollover.h"
 #include "mongo/db/timeseries/bucket_catalog/write_batch.h"
 #include "mongo/db/timeseries/timeseries_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/time_support.h"
 
@@ -99,6 +101,12 @@ enum class AllowQueryBasedReopening { kAllow, kDisallow };
  */
 StripeNumber getStripeNumber(const BucketKey& key, size_t numberOfStripes);
 
+/**
+ * Locks 'stripe.mutex', counting the acquisition in 'stripe.numLockWaits' if it was held by another
+ * thread.
+ */
+stdx::unique_lock<Mutex> lockStripe(const Stripe& stripe);
+
 /**
  * Extracts the information from the input 'doc' that is used to map the document to a bucket.
  */
@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -71,6 +72,23 @@ class BucketCatalogServerStatus : public ServerStatusSection {
         return sum;
     }
 
+    struct StripeLockWaits {
+        long long total = 0;
+        long long max = 0;
+    };
+
+    // A 'max' close to 'total' means most of the contention is on a single stripe, typically
+    // because the writes are for few distinct metadata values.
+    StripeLockWaits _getStripeLockWaits(const BucketCatalog& catalog) const {
+        StripeLockWaits waits;
+        for (auto const& stripe : catalog.stripes) {
+            auto numLockWaits = stripe->numLockWaits.loadRelaxed();
+            waits.total += numLockWaits;
+            waits.max = std::max(waits.max, numLockWaits);
+        }
+        return waits;
+    }
+
 public:
     using ServerStatusSection::ServerStatusSection;
 
@@ -95,6 +113,9 @@ public:
         builder.appendNumber("numIdleBuckets", static_cast<long long>(counts.idle));
         builder.appendNumber("numArchivedBuckets", static_cast<long long>(numActive - counts.open));
         builder.appendNumber("memoryUsage", static_cast<long long>(getMemoryUsage(bucketCatalog)));
+        auto stripeLockWaits = _getStripeLockWaits(bucketCatalog);
+        builder.appendNumber("numStripeLockWaits", stripeLockWaits.total);
+        builder.appendNumber("maxStripeLockWaits", stripeLockWaits.max);
         getDetailedMemoryUsage(bucketCatalog, builder);
 
         // Append the global execution stats for all namespaces.
@@ -484,6 +484,25 @@ TEST_F(BucketCatalogTest, GetMetadataReturnsEmptyDocOnMissingBucket) {
     ASSERT_BSONOBJ_EQ(BSONObj(), getMetadata(*_bucketCatalog, bucket));
 }
 
+TEST_F(BucketCatalogTest, LockStripeCountsWaitsForContendedStripes) {
+    auto& stripe = *_bucketCatalog->stripes[0];
+    {
+        auto stripeLock = internal::lockStripe(stripe);
+    }
+    ASSERT_EQ(stripe.numLockWaits.load(), 0);
+
+    stdx::unique_lock stripeLock{stripe.mutex};
+    stdx::thread waiter([&] { auto waiterLock = internal::lockStripe(stripe); });
+
+    // The wait is counted before the waiter blocks on the mutex.
+    while (stripe.numLockWaits.load() == 0) {
+        stdx::this_thread::yield();
+    }
+    stripeLock.unlock();
+    waiter.join();
+    ASSERT_EQ(stripe.numLockWaits.load(), 1);
+}
+
 TEST_F(BucketCatalogTest, InsertIntoDifferentBuckets) {
     auto result1 = _insertOneHelper(_opCtx,
                                     *_bucketCatalog,
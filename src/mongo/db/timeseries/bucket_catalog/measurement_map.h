@@ -43,6 +43,11 @@ namespace mongo::timeseries::bucket_catalog {
 /**
  * A map that stores measurements by field names to compressed column builders, and fills in skips
  * for missing data fields.
+ *
+ * A bucket keeps its map for as long as it is open, moving it into each WriteBatch it commits and
+ * back afterwards. A reopened bucket restores the builders from its compressed columns with
+ * initBuilders(), so new measurements are appended to the existing columns and committed as the
+ * binary diffs returned by intermediate(), without decompressing or recompressing the bucket.
  */
 class MeasurementMap {
 public:
@@ -217,6 +217,11 @@ public:
      * operations, their assignments to "applyOps" entries, and the number of oplog slots to be used
      * for writing pre- and post- image oplog entries for the transaction consisting of
      * 'operations'. The 'prepare' indicates if the function is called when preparing a transaction.
+     *
+     * Operations are serialized here, once, when the transaction commits or prepares, rather than
+     * as they are added: the packing into "applyOps" entries depends on limits that are only known
+     * once the full set of operations is, and transactions that abort never pay for it. Callers
+     * then reserve all 'numberOfOplogSlotsRequired' oplog slots in a single request.
      */
     ApplyOpsInfo getApplyOpsInfo(std::size_t oplogEntryCountLimit,
                                  std::size_t oplogEntrySizeLimitBytes,
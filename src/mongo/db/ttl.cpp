@@ -847,7 +847,9 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     const bool batchingEnabled = isBatchingEnabled(collection.getCollectionPtr());
 
     // Deletes records using a bounded collection scan from the beginning of time to the
-    // expiration time (inclusive).
+    // expiration time (inclusive). Time-series buckets share a single record store, so expiring
+    // them is a per-bucket delete rather than a drop of a whole time range; each expired bucket
+    // still produces one delete oplog entry.
     Timer timer;
     auto exec = InternalPlanner::deleteWithCollectionScan(
         opCtx,
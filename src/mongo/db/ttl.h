@@ -59,6 +59,13 @@ void startTTLMonitor(ServiceContext* serviceContext);
  */
 void shutdownTTLMonitor(ServiceContext* serviceContext);
 
+/**
+ * Background job which deletes expired documents from TTL indexes. All deletes are done serially
+ * on a single thread. To keep one collection with many expired documents from starving the
+ * others, each sub-pass bounds the work done per index by 'ttlIndexDeleteTargetDocs' and
+ * 'ttlIndexDeleteTargetTimeMS', and the whole sub-pass by 'ttlMonitorSubPassTargetSecs', before
+ * moving on to the next index.
+ */
 class TTLMonitor : public BackgroundJob {
 public:
     TTLMonitor();
@@ -157,6 +164,11 @@ private:
      * On time-series buckets collections, TTL operates on type 'ObjectId'. On general purpose
      * collections, TTL operates on type 'Date'.
      *
+     * Although the expired documents form a contiguous RecordId range, they are deleted one at a
+     * time rather than with a storage-level range truncate. Every deletion is replicated as its
+     * own delete oplog entry because the expiry cut-off depends on this node's clock, and the
+     * secondary indexes and change stream pre-images must be updated document by document.
+     *
      * Returns true if there are more expired documents to delete through the clustered index at
      * this time. False otherwise.
      *
@@ -35,6 +35,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/bsontypes.h"
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/d_concurrency.h"
@@ -44,6 +45,7 @@
 #include "mongo/db/ops/insert.h"
 #include "mongo/db/service_context.h"
 #include "mongo/unittest/assert.h"
+#include "mongo/unittest/bson_test_util.h"
 #include "mongo/unittest/framework.h"
 
 namespace mongo {
@@ -108,5 +110,23 @@ TEST_F(InsertTest, FixDocumentForInsertFailsOnDeeplyNestedDocuments) {
                                    makeNestedArray(BSONDepth::getMaxDepthForUserStorage() + 1)),
               ErrorCodes::Overflow);
 }
+
+TEST_F(InsertTest, FixDocumentForInsertMovesIdFirstAndGeneratesMissingId) {
+    auto fixed = fixDocumentForInsert(getOperationContext(), BSON("a" << 1 << "_id" << 2));
+    ASSERT_OK(fixed);
+    ASSERT_BSONOBJ_EQ(fixed.getValue(), BSON("_id" << 2 << "a" << 1));
+
+    fixed = fixDocumentForInsert(getOperationContext(), BSON("a" << 1));
+    ASSERT_OK(fixed);
+    ASSERT_EQ(fixed.getValue().nFields(), 2);
+    ASSERT_EQ(fixed.getValue().firstElement().type(), jstOID);
+    ASSERT_EQ(fixed.getValue().firstElementFieldNameStringData(), "_id");
+    ASSERT_EQ(fixed.getValue()["a"].numberInt(), 1);
+
+    // Documents that already start with their _id are inserted as-is.
+    fixed = fixDocumentForInsert(getOperationContext(), BSON("_id" << 1 << "a" << 1));
+    ASSERT_OK(fixed);
+    ASSERT_TRUE(fixed.getValue().isEmpty());
+}
 }  // namespace
 }  // namespace mongo
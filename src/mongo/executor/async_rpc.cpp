@@ -133,7 +133,7 @@ public:
                 return Status{AsyncRPCErrorInfo(s, {}), "Remote command execution failed"};
             })
             .then([targeter](TaskExecutor::RemoteCommandOnAnyCallbackArgs cbargs) {
-                auto r = cbargs.response;
+                auto& r = cbargs.response;
                 auto s = makeErrorIfNeeded(r, r.target);
                 // Update targeter for errors.
                 if (!s.isOK() && s.code() == ErrorCodes::RemoteCommandExecutionError && r.target) {
@@ -148,7 +148,8 @@ public:
                     }
                 }
                 uassertStatusOK(s);
-                return AsyncRPCInternalResponse{r.data, r.target.get(), *r.elapsed};
+                return AsyncRPCInternalResponse{
+                    std::move(r.data), std::move(r.target.get()), *r.elapsed};
             });
     }
 };
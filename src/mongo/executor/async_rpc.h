@@ -183,8 +183,8 @@ public:
  * Returns a RemoteCommandExecutionError with ErrorExtraInfo populated to contain
  * details about any error, local or remote, contained in `r`.
  */
-inline Status makeErrorIfNeeded(TaskExecutor::ResponseOnAnyStatus r,
-                                boost::optional<HostAndPort> targetAttempted) {
+inline Status makeErrorIfNeeded(const TaskExecutor::ResponseOnAnyStatus& r,
+                                const boost::optional<HostAndPort>& targetAttempted) {
     if (r.status.isOK() && getStatusFromCommandResult(r.data).isOK() &&
         getWriteConcernStatusFromCommandResult(r.data).isOK() &&
         getFirstWriteErrorStatusFromCommandResult(r.data).isOK()) {
@@ -299,10 +299,11 @@ public:
     void updateState();
 
     /**
-     * Gets a connection from the specific pool. Sinks a unique_lock from the
-     * parent to preserve the lock on _mutex
+     * Gets a connection from the specific pool. 'requestedAt' is the time the caller asked for
+     * the connection, which is taken before the parent's _mutex so there is no need to read the
+     * clock again while holding it.
      */
-    Future<ConnectionHandle> getConnection(Milliseconds timeout, bool lease);
+    Future<ConnectionHandle> getConnection(Milliseconds timeout, bool lease, Date_t requestedAt);
 
     /**
      * Triggers the shutdown procedure. This function sets isShutdown to true
@@ -707,7 +708,7 @@ SemiFuture<ConnectionPool::ConnectionHandle> ConnectionPool::_get(const HostAndP
         timeout = _controller->pendingTimeout();
     }
 
-    auto connFuture = pool->getConnection(timeout, lease);
+    auto connFuture = pool->getConnection(timeout, lease, connRequestedAt);
     pool->updateState();
 
     // Only count connections being checked-out for ordinary use, not lease, towards cumulative wait
@@ -821,14 +822,14 @@ size_t ConnectionPool::SpecificPool::requestsPending() const {
 }
 
 Future<ConnectionPool::ConnectionHandle> ConnectionPool::SpecificPool::getConnection(
-    Milliseconds timeout, bool lease) {
+    Milliseconds timeout, bool lease, Date_t requestedAt) {
     if (MONGO_unlikely(connectionPoolReturnsErrorOnGet.shouldFail())) {
         return Future<ConnectionPool::ConnectionHandle>::makeReady(
             Status(ErrorCodes::SocketException, "test"));
     }
 
     // Reset our activity timestamp
-    auto now = _parent->_factory->now();
+    const auto now = requestedAt;
     _lastActiveTime = now;
 
     if (auto sfp = forceExecutorConnectionPoolTimeout.scoped(); MONGO_unlikely(sfp.isActive())) {
@@ -80,6 +80,11 @@ struct ConnectionPoolStats;
  *
  * The overall workflow here is to manage separate pools for each unique
  * HostAndPort. See comments on the various Options for how the pool operates.
+ *
+ * All the SpecificPools of a ConnectionPool are guarded by its single mutex, so work done while
+ * checking out or returning a connection should be kept to a minimum. Splitting the pool across
+ * cores is done one level up, by giving each executor of a TaskExecutorPool its own
+ * ConnectionPool; on Linux that pool has a single executor because more of them regressed.
  */
 class ConnectionPool : public EgressConnectionCloser,
                        public std::enable_shared_from_this<ConnectionPool> {
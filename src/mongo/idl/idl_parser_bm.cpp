@@ -112,6 +112,42 @@ void BM_FIND_ONE_OP_MSG(benchmark::State& state) {
 
 BENCHMARK(BM_FIND_ONE_OP_MSG)->Arg(10)->Arg(100)->Unit(benchmark::kNanosecond);
 
+// A find using many of the optional fields, including ones declared late in find_command.idl and
+// several generic arguments, so that per-field name dispatch dominates the parse.
+BSONObj getFindDocWithManyOptions() {
+    auto u = UUID::parse("d4965626-a298-4b09-b80b-8d98d17d02d2").getValue();
+
+    return BSON("find"
+                << "lineitem"
+                << "filter" << BSON("l_quantity" << BSON("$lt" << 24)) << "projection"
+                << BSON("l_extendedprice" << 1 << "l_discount" << 1) << "sort"
+                << BSON("l_shipdate" << 1) << "hint" << BSON("l_shipdate" << 1) << "collation"
+                << BSON("locale"
+                        << "simple")
+                << "skip" << 10 << "limit" << 100 << "batchSize" << 101 << "allowDiskUse" << true
+                << "showRecordId" << false << "noCursorTimeout" << false << "allowPartialResults"
+                << false << "let" << BSON("threshold" << 24) << "readOnce" << false << "comment"
+                << "tpch"
+                << "maxTimeMS" << 1000 << "readConcern"
+                << BSON("level"
+                        << "majority")
+                << "$db"
+                << "tpch"
+                << "lsid" << BSON("id" << u) << "$clusterTime" << getClusterTime());
+}
+
+void BM_FIND_MANY_OPTIONS_BSON(benchmark::State& state) {
+    // Perform setup here
+    auto doc = getFindDocWithManyOptions();
+
+    for (auto _ : state) {
+        // This code gets timed
+        benchmark::DoNotOptimize(FindCommandRequestBase::parse(IDLParserContext("foo"), doc));
+    }
+}
+
+BENCHMARK(BM_FIND_MANY_OPTIONS_BSON)->Unit(benchmark::kNanosecond);
+
 
 char field_bytes[] = {0x34, 0x27, 0x33, 0x27, 0x32, 0x26, 0x26, 0x2d, 0x3b, 0x21, 0x23, 0x36, 0x25,
                       0x3f, 0x2d, 0x32, 0x3b, 0x3e, 0x36, 0x3b, 0x20, 0x35, 0x30, 0x34, 0x2f, 0x25,
@@ -250,6 +286,21 @@ void BM_IS_GENERIC_ARG(benchmark::State& state) {
 
 BENCHMARK(BM_IS_GENERIC_ARG)->Arg(10)->Arg(100)->Unit(benchmark::kNanosecond);
 
+void BM_IS_NOT_GENERIC_ARG(benchmark::State& state) {
+    // Command-specific fields miss every generic argument, which is the common case when a parser
+    // checks unknown fields.
+    auto arg = "allowPartialResults"_sd;
+    int i = 0;
+
+    for (auto _ : state) {
+        // This code gets timed
+        i += (int)isGenericArgument(arg);
+    }
+    benchmark::DoNotOptimize(i);
+}
+
+BENCHMARK(BM_IS_NOT_GENERIC_ARG)->Unit(benchmark::kNanosecond);
+
 // API Version parses all requests but is often not present. So test API Version against a query
 // where it is not present
 void BM_API_VERSION_BSON(benchmark::State& state) {
@@ -116,15 +116,21 @@ std::vector<std::shared_ptr<ChunkInfo>> flatten(const std::vector<ChunkType>& ch
     flattened.reserve(changedChunkInfos.size());
     flattened.emplace_back(std::move(changedChunkInfos[0]));
 
+    // Since the chunks are visited in descending order of their maximum bound, 'chunk' overlaps
+    // the last flattened chunk if and only if its maximum is above the last chunk's minimum. The
+    // KeyString of that minimum is computed once per flattened chunk rather than once per check.
+    auto lastMinKeyString = ShardKeyPattern::toKeyString(flattened.back()->getMin());
     for (size_t i = 1; i < changedChunkInfos.size(); ++i) {
         auto& chunk = changedChunkInfos[i];
-        if (chunk->overlapsWith(*flattened.back())) {
+        if (chunk->getMaxKeyString() > lastMinKeyString) {
             if (flattened.back()->getLastmod().isOlderThan(chunk->getLastmod())) {
                 flattened.pop_back();
                 flattened.emplace_back(std::move(chunk));
+                lastMinKeyString = ShardKeyPattern::toKeyString(flattened.back()->getMin());
             }
         } else {
             flattened.emplace_back(std::move(chunk));
+            lastMinKeyString = ShardKeyPattern::toKeyString(flattened.back()->getMin());
         }
     }
 
@@ -975,6 +975,10 @@ bool CollectionRoutingInfoTargeter::isTargetedCollectionSharded() const {
     return _cri.cm.isSharded();
 }
 
+const ShardKeyPattern* CollectionRoutingInfoTargeter::getShardKeyPattern() const {
+    return _cri.cm.isSharded() ? &_cri.cm.getShardKeyPattern() : nullptr;
+}
+
 bool CollectionRoutingInfoTargeter::isTrackedTimeSeriesBucketsNamespace() const {
     // Used for testing purposes to force that we always have a tracked timeseries bucket namespace.
     if (MONGO_unlikely(isTrackedTimeSeriesBucketsNamespaceAlwaysTrue.shouldFail())) {
@@ -182,6 +182,8 @@ public:
 
     bool isTargetedCollectionSharded() const override;
 
+    const ShardKeyPattern* getShardKeyPattern() const override;
+
     bool isTrackedTimeSeriesBucketsNamespace() const override;
 
     bool isUpdateOneWithIdWithoutShardKeyEnabled() const override;
@@ -42,6 +42,14 @@
 
 namespace mongo {
 
+/**
+ * Loads routing information by querying the config server. Refreshes are pulled: each router asks
+ * for the chunks changed since the version it has cached, and concurrent refreshes for the same
+ * collection within a process are joined by the CatalogCache. Nothing is pushed from the config
+ * server, so after a large migration every router issues its own query. That load can be spread
+ * over the config server secondaries with the configServerReadPreferenceForCatalogQueries cluster
+ * parameter.
+ */
 class ConfigServerCatalogCacheLoader final : public CatalogCacheLoader {
 public:
     ConfigServerCatalogCacheLoader();
@@ -32,12 +32,15 @@
 #include <set>
 #include <vector>
 
+#include <boost/optional/optional.hpp>
+
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/chunk_manager.h"
 #include "mongo/s/ns_targeter.h"
+#include "mongo/s/shard_key_pattern.h"
 #include "mongo/s/stale_exception.h"
 #include "mongo/s/write_ops/batched_command_request.h"
 #include "mongo/unittest/assert.h"
@@ -167,6 +170,14 @@ public:
         return false;
     }
 
+    const ShardKeyPattern* getShardKeyPattern() const override {
+        return _shardKeyPattern.get_ptr();
+    }
+
+    void setShardKeyPattern(const ShardKeyPattern& shardKeyPattern) {
+        _shardKeyPattern.emplace(shardKeyPattern);
+    }
+
     bool isTrackedTimeSeriesBucketsNamespace() const override {
         return _isTrackedTimeSeriesBucketsNamespace;
     }
@@ -196,6 +207,8 @@ private:
 
     std::vector<MockRange> _mockRanges;
 
+    boost::optional<ShardKeyPattern> _shardKeyPattern;
+
     bool _isTrackedTimeSeriesBucketsNamespace = false;
 
     bool _isUpdateOneWithIdWithoutShardKeyEnabled = false;
@@ -200,6 +200,11 @@ public:
      * Returns whether the targeted collection is sharded or not
      */
     virtual bool isTargetedCollectionSharded() const = 0;
+
+    /**
+     * Returns the shard key pattern of the targeted collection, or nullptr if it is not sharded.
+     */
+    virtual const ShardKeyPattern* getShardKeyPattern() const = 0;
 };
 
 }  // namespace mongo
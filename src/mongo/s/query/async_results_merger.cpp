@@ -140,8 +140,7 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // support a default value for an enum. The default tailable mode should be 'kNormal', but
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(_params.getTailableMode().value_or(TailableModeEnum::kNormal)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _mergeQueue(MergingComparator(_params.getSort().value_or(BSONObj()))),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (_params.getTxnNumber()) {
         invariant(_params.getSessionId());
@@ -359,10 +358,7 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
         return false;
     }
 
-    auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
-    auto keyWeWantToReturn =
-        extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
+    const auto& keyWeWantToReturn = _mergeQueue.top().first;
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
     auto minPromisedSortKey = _getMinPromisedSortKey(lk);
     invariant(minPromisedSortKey);
@@ -404,7 +400,22 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
         return {ClusterQueryResult()};
     }
 
-    return _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
+    if (_params.getSort()) {
+        return _nextReadySorted(lk);
+    }
+
+    auto result = _nextReadyUnsorted(lk);
+
+    // An unsorted merge stays ready for as long as any remote has buffered results, so a remote
+    // whose buffer has just drained would otherwise sit idle until the other remotes are drained
+    // as well. Request its next batch now so that it arrives while the others are consumed. Any
+    // error is recorded on the remote and surfaced by the next call to ready() or nextEvent().
+    if (_tailableMode == TailableModeEnum::kNormal && _opCtx &&
+        internalQueryARMPrefetchGetMores.load()) {
+        _scheduleGetMores(lk).ignore();
+    }
+
+    return result;
 }
 
 void AsyncResultsMerger::_processAdditionalTransactionParticipants(OperationContext* opCtx) {
@@ -417,7 +428,7 @@ void AsyncResultsMerger::_processAdditionalTransactionParticipants(OperationCont
     }
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
@@ -425,19 +436,19 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
         return {};
     }
 
-    size_t smallestRemote = _mergeQueue.top();
+    size_t smallestRemote = _mergeQueue.top().second;
     _mergeQueue.pop();
 
     invariant(!_remotes[smallestRemote].docBuffer.empty());
     invariant(_remotes[smallestRemote].status.isOK());
 
-    ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
+    ClusterQueryResult front = std::move(_remotes[smallestRemote].docBuffer.front());
     _remotes[smallestRemote].docBuffer.pop();
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
     // next result.
     if (!_remotes[smallestRemote].docBuffer.empty()) {
-        _mergeQueue.push(smallestRemote);
+        _pushToMergeQueue(lk, smallestRemote);
     }
 
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
@@ -451,6 +462,12 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     return front;
 }
 
+void AsyncResultsMerger::_pushToMergeQueue(WithLock, size_t remoteIndex) {
+    const auto& front = _remotes[remoteIndex].docBuffer.front();
+    _mergeQueue.push(
+        {extractSortKey(*front.getResult(), _params.getCompareWholeSortKey()), remoteIndex});
+}
+
 ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
@@ -458,7 +475,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
         invariant(_remotes[_gettingFromRemote].status.isOK());
 
         if (_remotes[_gettingFromRemote].hasNext()) {
-            ClusterQueryResult front = _remotes[_gettingFromRemote].docBuffer.front();
+            ClusterQueryResult front = std::move(_remotes[_gettingFromRemote].docBuffer.front());
             _remotes[_gettingFromRemote].docBuffer.pop();
 
             if (_tailableMode == TailableModeEnum::kTailable &&
@@ -917,15 +934,14 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             }
         }
 
-        ClusterQueryResult result(obj, remote.shardId);
-        remote.docBuffer.push(result);
+        remote.docBuffer.emplace(obj, remote.shardId);
         ++remote.fetchedCount;
     }
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
     // queue.
     if (_params.getSort() && !response.getBatch().empty()) {
-        _mergeQueue.push(remoteIndex);
+        _pushToMergeQueue(lk, remoteIndex);
     }
     return true;
 }
@@ -1087,13 +1103,9 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 // AsyncResultsMerger::MergingComparator
 //
 
-bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+bool AsyncResultsMerger::MergingComparator::operator()(const SortKeyRemoteIdPair& lhs,
+                                                       const SortKeyRemoteIdPair& rhs) const {
+    return compareSortKeys(lhs.first, rhs.first, _sort) > 0;
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
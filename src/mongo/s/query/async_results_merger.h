@@ -364,24 +364,19 @@ private:
         bool invalidated = false;
     };
 
+    // The sort key of the first buffered document of a remote, paired with the remote's index in
+    // '_remotes'. The sort key is extracted once, when the remote is pushed onto '_mergeQueue', and
+    // points into the document at the front of the remote's 'docBuffer'.
+    using SortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
+
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(BSONObj sort) : _sort(std::move(sort)) {}
 
-        bool operator()(const size_t& lhs, const size_t& rhs);
+        bool operator()(const SortKeyRemoteIdPair& lhs, const SortKeyRemoteIdPair& rhs) const;
 
     private:
-        const std::vector<RemoteCursorData>& _remotes;
-
-        const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
+        BSONObj _sort;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -437,6 +432,11 @@ private:
     ClusterQueryResult _nextReadySorted(WithLock);
     ClusterQueryResult _nextReadyUnsorted(WithLock);
 
+    /**
+     * Pushes the remote at 'remoteIndex', which must have a buffered document, onto '_mergeQueue'.
+     */
+    void _pushToMergeQueue(WithLock, size_t remoteIndex);
+
     using CbData = executor::TaskExecutor::RemoteCommandCallbackArgs;
     using CbResponse = executor::TaskExecutor::ResponseStatus;
 
@@ -552,9 +552,10 @@ private:
     // List of pending responses to be processed for additional participants.
     std::queue<RemoteResponse> _remoteResponses;
 
-    // The top of this priority queue is the index into '_remotes' for the remote host that has the
-    // next document to return, according to the sort order. Used only if there is a sort.
-    std::priority_queue<size_t, std::vector<size_t>, MergingComparator> _mergeQueue;
+    // The top of this priority queue holds the index into '_remotes' for the remote host that has
+    // the next document to return, according to the sort order. Used only if there is a sort.
+    std::priority_queue<SortKeyRemoteIdPair, std::vector<SortKeyRemoteIdPair>, MergingComparator>
+        _mergeQueue;
 
     // The index into '_remotes' for the remote from which we are currently retrieving results.
     // Used only if there is *not* a sort.
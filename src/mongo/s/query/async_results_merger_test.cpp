@@ -36,6 +36,7 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <system_error>
 
@@ -556,6 +557,44 @@ TEST_F(AsyncResultsMergerTest, HasFirstBatch) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, PrefetchGetMoreForDrainedRemoteWhileOthersBuffered) {
+    RAIIServerParameterControllerForTest prefetchController("internalQueryARMPrefetchGetMores",
+                                                            true);
+
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {fromjson("{_id: 1}")})));
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[1],
+        kTestShardHosts[1],
+        CursorResponse(kTestNss, 0, {fromjson("{_id: 2}"), fromjson("{_id: 3}")})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    // Returning the only buffered result from the first remote schedules its next getMore, even
+    // though the merger is still ready to return results buffered from the second remote.
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(networkHasReadyRequests());
+
+    std::vector<CursorResponse> responses;
+    responses.emplace_back(kTestNss, CursorId(0), std::vector<BSONObj>{fromjson("{_id: 4}")});
+    scheduleNetworkResponses(std::move(responses));
+    ASSERT_TRUE(arm->remotesExhausted());
+
+    std::set<int> ids;
+    while (arm->ready()) {
+        auto next = unittest::assertGet(arm->nextReady());
+        if (next.isEOF()) {
+            break;
+        }
+        ids.insert((*next.getResult())["_id"].numberInt());
+    }
+    ASSERT(ids == (std::set<int>{2, 3, 4}));
+}
+
 TEST_F(AsyncResultsMergerTest, OneShardHasInitialBatchOtherShardExhausted) {
     std::vector<BSONObj> firstBatch = {
         fromjson("{_id: 1}"), fromjson("{_id: 2}"), fromjson("{_id: 3}")};
@@ -384,10 +384,14 @@ Status dispatchMergingPipeline(const boost::intrusive_ptr<ExpressionContext>& ex
         requestQueryStatsFromRemotes);
 
     // First, check whether we can merge on the mongoS. If the merge pipeline MUST run on mongoS,
-    // then ignore the internalQueryProhibitMergingOnMongoS parameter.
+    // then ignore the internalQueryProhibitMergingOnMongoS and
+    // internalQueryMaxShardsToMergeOnMongoS parameters.
+    const auto maxShardsToMergeOnMongos = internalQueryMaxShardsToMergeOnMongoS.load();
+    const bool tooManyShardsToMergeOnMongos = maxShardsToMergeOnMongos > 0 &&
+        targetedShards.size() > static_cast<size_t>(maxShardsToMergeOnMongos);
     if (mergePipeline->requiredToRunOnMongos() ||
-        (!internalQueryProhibitMergingOnMongoS.load() && mergePipeline->canRunOnMongos().isOK() &&
-         !shardDispatchResults.mergeShardId)) {
+        (!internalQueryProhibitMergingOnMongoS.load() && !tooManyShardsToMergeOnMongos &&
+         mergePipeline->canRunOnMongos().isOK() && !shardDispatchResults.mergeShardId)) {
         return runPipelineOnMongoS(namespaces,
                                    batchSize,
                                    std::move(shardDispatchResults.splitPipeline->mergePipeline),
@@ -64,6 +64,11 @@ class OperationContext;
  * Both the targeter and dispatcher are assumed to be dedicated to this particular
  * BatchWriteExec instance.
  *
+ * The batch runs in rounds: each round targets the remaining writes, sends one child batch per
+ * shard and processes all of the responses before retargeting what still has to be retried. In the
+ * common case of a single round, the client response is therefore available only once the slowest
+ * targeted shard has replied, however the child batches are scheduled, since there is a single
+ * reply per client batch.
  */
 class BatchWriteExec {
 public:
@@ -61,6 +61,8 @@
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/write_concern_options.h"
 #include "mongo/s/collection_uuid_mismatch.h"
+#include "mongo/s/mongod_and_mongos_server_parameters_gen.h"
+#include "mongo/s/shard_key_pattern.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/s/write_ops/batch_write_op.h"
 #include "mongo/s/write_ops/write_without_shard_key_util.h"
@@ -598,6 +600,25 @@ StatusWith<WriteType> BatchWriteOp::targetBatch(const NSTargeter& targeter,
         return targetStatus;
     }
 
+    // The documents of an unordered insert may be applied in any order, so send each shard its
+    // documents in shard key order. The shard key is always indexed, so this turns a batch of
+    // scattered index insertions into a mostly sequential one. Response items are matched back
+    // to their writes by position in the batch, so the reordering is invisible to the client.
+    // Documents inserted into a time-series collection are measurements and do not contain the
+    // shard key of the buckets collection.
+    const auto shardKeyPattern = targeter.getShardKeyPattern();
+    if (!ordered && _clientRequest.getBatchType() == BatchedCommandRequest::BatchType_Insert &&
+        shardKeyPattern && !targeter.isTrackedTimeSeriesBucketsNamespace() &&
+        gSortUnorderedInsertsByShardKey.load()) {
+        const auto& docs = _clientRequest.getInsertRequest().getDocuments();
+        for (auto& [_, batch] : *targetedBatches) {
+            batch->sortWrites([&](const TargetedWrite& write) {
+                return ShardKeyPattern::toKeyString(
+                    shardKeyPattern->extractShardKeyFromDoc(docs.at(write.writeOpRef.first)));
+            });
+        }
+    }
+
     // Note: It is fine to use 'getAproxNShardsOwningChunks' here because the result is only used to
     // update stats.
     _nShardsOwningChunks = targeter.getAproxNShardsOwningChunks();
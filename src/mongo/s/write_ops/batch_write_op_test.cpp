@@ -1006,6 +1006,60 @@ TEST_F(BatchWriteOpTest, MultiOpSingleShardErrorUnordered) {
     ASSERT_EQUALS(clientResponse.getErrDetailsAt(0).getIndex(), 1);
 }
 
+// Unordered insert into a sharded collection with sorting by shard key enabled. The shard should
+// receive its documents in shard key order and errors should be reported at their original index.
+TEST_F(BatchWriteOpTest, MultiOpUnorderedInsertSortedByShardKey) {
+    RAIIServerParameterControllerForTest sortInserts("sortUnorderedInsertsByShardKey", true);
+
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("foo.bar");
+    ShardEndpoint endpoint(ShardId("shard"),
+                           ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                           boost::none);
+
+    auto targeter = initTargeterFullRange(nss, endpoint);
+    targeter.setShardKeyPattern(ShardKeyPattern(BSON("x" << 1)));
+
+    BatchedCommandRequest request([&] {
+        write_ops::InsertCommandRequest insertOp(nss);
+        insertOp.setWriteCommandRequestBase([] {
+            write_ops::WriteCommandRequestBase wcb;
+            wcb.setOrdered(false);
+            return wcb;
+        }());
+        insertOp.setDocuments({BSON("x" << 3), BSON("x" << 1), BSON("x" << 2)});
+        return insertOp;
+    }());
+
+    BatchWriteOp batchOp(_opCtx, request);
+
+    std::map<ShardId, std::unique_ptr<TargetedWriteBatch>> targeted;
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 1u);
+
+    BatchedCommandRequest targetBatch =
+        batchOp.buildBatchRequest(*targeted.begin()->second, targeter, boost::none);
+    const auto& docs = targetBatch.getInsertRequest().getDocuments();
+    ASSERT_EQUALS(docs.size(), 3u);
+    ASSERT_BSONOBJ_EQ(docs[0], BSON("x" << 1));
+    ASSERT_BSONOBJ_EQ(docs[1], BSON("x" << 2));
+    ASSERT_BSONOBJ_EQ(docs[2], BSON("x" << 3));
+
+    // The shard fails the first document it was sent, which is the second one of the client.
+    BatchedCommandResponse response;
+    buildResponse(2, &response);
+    addError(ErrorCodes::UnknownError, "mock error", 0, &response);
+
+    batchOp.noteBatchResponse(*targeted.begin()->second, response, nullptr);
+    ASSERT(batchOp.isFinished());
+
+    BatchedCommandResponse clientResponse;
+    batchOp.buildClientResponse(&clientResponse);
+    ASSERT(clientResponse.getOk());
+    ASSERT_EQUALS(clientResponse.getN(), 2);
+    ASSERT_EQUALS(clientResponse.sizeErrDetails(), 1u);
+    ASSERT_EQUALS(clientResponse.getErrDetailsAt(0).getIndex(), 1);
+}
+
 // Multi-op targeting test where two ops go to two separate shards and there's an error on each op
 // on each shard. There should be one set of two batches to each shard and and two errors reported.
 TEST_F(BatchWriteOpTest, MultiOpTwoShardErrorsUnordered) {
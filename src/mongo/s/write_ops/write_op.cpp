@@ -37,6 +37,8 @@
 #include <boost/none.hpp>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
@@ -557,4 +559,22 @@ void TargetedWriteBatch::addWrite(std::unique_ptr<TargetedWrite> targetedWrite,
     _estimatedSizeBytes += estWriteSize;
 }
 
+void TargetedWriteBatch::sortWrites(
+    const std::function<std::string(const TargetedWrite&)>& getSortKey) {
+    std::vector<std::pair<std::string, std::unique_ptr<TargetedWrite>>> keyedWrites;
+    keyedWrites.reserve(_writes.size());
+    for (auto& write : _writes) {
+        auto sortKey = getSortKey(*write);
+        keyedWrites.emplace_back(std::move(sortKey), std::move(write));
+    }
+
+    std::stable_sort(keyedWrites.begin(), keyedWrites.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    for (size_t i = 0; i < keyedWrites.size(); ++i) {
+        _writes[i] = std::move(keyedWrites[i].second);
+    }
+}
+
 }  // namespace mongo
@@ -31,7 +31,9 @@
 
 #include <absl/container/flat_hash_set.h>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -386,6 +388,13 @@ public:
      */
     void addWrite(std::unique_ptr<TargetedWrite> targetedWrite, int estWriteSize);
 
+    /**
+     * Stably reorders the writes in this batch by the key 'getSortKey' returns for each of them,
+     * which is computed once per write. Responses are matched to writes by their position in the
+     * batch, so this may only be called before the batch request is built.
+     */
+    void sortWrites(const std::function<std::string(const TargetedWrite&)>& getSortKey);
+
 private:
     // Where to send the batch
     const ShardId _shardId;
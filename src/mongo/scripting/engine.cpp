@@ -38,6 +38,7 @@
 #include <cstring>
 #include <deque>
 #include <mutex>
+#include <string_view>
 
 #include <boost/optional/optional.hpp>
 #include <boost/type_traits/decay.hpp>
@@ -342,13 +343,15 @@ ScriptingFunction Scope::createFunction(const char* code) {
         }
     }
 
-    FunctionCacheMap::iterator i = _cachedFunctions.find(code);
+    // Measure the source once, rather than in every comparison made by the lookup.
+    const std::string_view source(code);
+    FunctionCacheMap::iterator i = _cachedFunctions.find(source);
     if (i != _cachedFunctions.end())
         return i->second;
 
     // Get a function number, so the cache can be utilized to lookup the source on an exception
     ScriptingFunction functionNumber = _createFunction(code);
-    _cachedFunctions[code] = functionNumber;
+    _cachedFunctions.emplace(source, functionNumber);
     return functionNumber;
 }
 
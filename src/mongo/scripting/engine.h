@@ -56,7 +56,8 @@
 namespace mongo {
 typedef unsigned long long ScriptingFunction;
 typedef BSONObj (*NativeFunction)(const BSONObj& args, void* data);
-typedef std::map<std::string, ScriptingFunction> FunctionCacheMap;
+// Transparent comparator so lookups by raw source text do not copy it into a std::string.
+typedef std::map<std::string, ScriptingFunction, std::less<>> FunctionCacheMap;
 
 class DBClientBase;
 class OperationContext;
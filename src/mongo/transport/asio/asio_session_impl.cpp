@@ -39,6 +39,7 @@
 #include "mongo/transport/asio/asio_utils.h"
 #include "mongo/transport/proxy_protocol_header_parser.h"
 #include "mongo/transport/session_util.h"
+#include "mongo/transport/transport_options_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/future_util.h"
 #include "mongo/util/net/socket_utils.h"
@@ -113,6 +114,24 @@ Status makeCanceledStatus() {
     return {ErrorCodes::CallbackCanceled, "Operation was canceled"};
 }
 
+Status validateMessageLength(size_t msgLen) {
+    static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
+    if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
+        StringBuilder sb;
+        sb << "recv(): message msgLen " << msgLen << " is invalid. "
+           << "Min " << kHeaderSize << " Max: " << MaxMessageSizeBytes;
+        const auto str = sb.str();
+        LOGV2(4615638,
+              "recv(): message mstLen is invalid.",
+              "msgLen"_attr = msgLen,
+              "min"_attr = kHeaderSize,
+              "max"_attr = MaxMessageSizeBytes);
+
+        return Status(ErrorCodes::ProtocolError, str);
+    }
+    return Status::OK();
+}
+
 auto& totalIngressTLSConnections =  //
     *MetricBuilder<Counter64>("network.totalIngressTLSConnections");
 auto& totalIngressTLSHandshakeTimeMillis =  //
@@ -226,6 +245,9 @@ Future<Message> CommonAsioSession::asyncSourceMessage(const BatonHandle& baton)
 
 Status CommonAsioSession::waitForData() noexcept try {
     ensureSync();
+    if (readAheadBytes() > 0) {
+        return Status::OK();
+    }
     asio::error_code ec;
     getSocket().wait(asio::ip::tcp::socket::wait_read, ec);
     return errorCodeToStatus(ec, "waitForData");
@@ -235,11 +257,24 @@ Status CommonAsioSession::waitForData() noexcept try {
 
 Future<void> CommonAsioSession::asyncWaitForData() noexcept try {
     ensureAsync();
-    return getSocket().async_wait(asio::ip::tcp::socket::wait_read, UseFuture{});
+    return asyncWaitForDataImpl();
+} catch (const DBException& ex) {
+    return ex.toStatus();
+}
+
+Future<void> SyncAsioSession::asyncWaitForData() noexcept try {
+    return asyncWaitForDataImpl();
 } catch (const DBException& ex) {
     return ex.toStatus();
 }
 
+Future<void> CommonAsioSession::asyncWaitForDataImpl() {
+    if (readAheadBytes() > 0) {
+        return Future<void>::makeReady();
+    }
+    return getSocket().async_wait(asio::ip::tcp::socket::wait_read, UseFuture{});
+}
+
 Status CommonAsioSession::sinkMessage(Message message) noexcept try {
     ensureSync();
     return sinkMessageImpl(std::move(message)).getNoThrow();
@@ -469,6 +504,15 @@ ExecutorFuture<void> CommonAsioSession::parseProxyProtocolHeader(const ReactorHa
 Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
     static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
+    if (useReadAhead()) {
+        _asyncOpState.start();
+        return sourceMessageFromReadAhead(baton).onCompletion(
+            [this](StatusWith<Message> swMessage) {
+                _asyncOpState.complete();
+                return swMessage;
+            });
+    }
+
     auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
     auto ptr = headerBuffer.get();
     _asyncOpState.start();
@@ -479,18 +523,8 @@ Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
             }
 
             const auto msgLen = size_t(MSGHEADER::View(headerBuffer.get()).getMessageLength());
-            if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
-                StringBuilder sb;
-                sb << "recv(): message msgLen " << msgLen << " is invalid. "
-                   << "Min " << kHeaderSize << " Max: " << MaxMessageSizeBytes;
-                const auto str = sb.str();
-                LOGV2(4615638,
-                      "recv(): message mstLen is invalid.",
-                      "msgLen"_attr = msgLen,
-                      "min"_attr = kHeaderSize,
-                      "max"_attr = MaxMessageSizeBytes);
-
-                return Future<Message>::makeReady(Status(ErrorCodes::ProtocolError, str));
+            if (auto status = validateMessageLength(msgLen); !status.isOK()) {
+                return Future<Message>::makeReady(std::move(status));
             }
 
             if (msgLen == kHeaderSize) {
@@ -519,6 +553,133 @@ Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
         });
 }
 
+bool CommonAsioSession::useReadAhead() const {
+    if (readAheadBytes() > 0) {
+        return true;
+    }
+#ifdef MONGO_CONFIG_SSL
+    if (!_sslSocket && !_ranHandshake) {
+        return false;
+    }
+#endif
+    return gAsioReadAheadBytes > 0;
+}
+
+Future<Message> CommonAsioSession::sourceMessageFromReadAhead(const BatonHandle& baton) {
+    static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
+
+    auto headerReady = readAheadBytes() >= kHeaderSize ? Future<void>::makeReady()
+                                                       : fillReadAhead(kHeaderSize, baton);
+    return std::move(headerReady).then([this, baton]() -> Future<Message> {
+        const char* data = _readAheadBuffer.get() + _readAheadBegin;
+        if (checkForHTTPRequest(asio::buffer(data, kHeaderSize))) {
+            return sendHTTPResponse(baton);
+        }
+
+        const auto msgLen = size_t(MSGHEADER::ConstView(data).getMessageLength());
+        if (auto status = validateMessageLength(msgLen); !status.isOK()) {
+            return Future<Message>::makeReady(std::move(status));
+        }
+
+        auto buffer = SharedBuffer::allocate(msgLen);
+        const auto bytesFromReadAhead = std::min(msgLen, readAheadBytes());
+        memcpy(buffer.get(), data, bytesFromReadAhead);
+        _readAheadBegin += bytesFromReadAhead;
+        if (readAheadBytes() == 0) {
+            _readAheadBuffer = {};
+            _readAheadBegin = _readAheadEnd = 0;
+        }
+
+        // Whatever the read-ahead buffer did not pick up of a large message is read directly into
+        // the message.
+        auto bodyReady = bytesFromReadAhead == msgLen
+            ? Future<void>::makeReady()
+            : read(asio::buffer(buffer.get() + bytesFromReadAhead, msgLen - bytesFromReadAhead),
+                   baton);
+        return std::move(bodyReady).then([this, buffer = std::move(buffer), msgLen]() mutable {
+            if (_isIngressSession) {
+                networkCounter.hitPhysicalIn(msgLen);
+            }
+            return Message(std::move(buffer));
+        });
+    });
+}
+
+Future<void> CommonAsioSession::fillReadAhead(size_t minBytes, const BatonHandle& baton) {
+    if (!_readAheadBuffer) {
+        _readAheadBuffer =
+            SharedBuffer::allocate(std::max(static_cast<size_t>(gAsioReadAheadBytes), minBytes));
+    } else if (_readAheadBegin > 0) {
+        memmove(_readAheadBuffer.get(), _readAheadBuffer.get() + _readAheadBegin, readAheadBytes());
+        _readAheadEnd -= _readAheadBegin;
+        _readAheadBegin = 0;
+    }
+    invariant(_readAheadBuffer.capacity() >= minBytes);
+
+    std::error_code ec;
+#ifdef MONGO_CONFIG_SSL
+    const auto size =
+        _sslSocket ? readSomeIntoReadAhead(*_sslSocket, ec) : readSomeIntoReadAhead(_socket, ec);
+#else
+    const auto size = readSomeIntoReadAhead(_socket, ec);
+#endif
+    _readAheadEnd += size;
+
+    if (readAheadBytes() >= minBytes) {
+        return Future<void>::makeReady();
+    }
+    if (!ec) {
+        return fillReadAhead(minBytes, baton);
+    }
+    if (((ec == asio::error::would_block) || (ec == asio::error::try_again)) &&
+        (_blockingMode == async)) {
+        return waitForReadable(baton).then(
+            [this, minBytes, baton] { return fillReadAhead(minBytes, baton); });
+    }
+    return futurize(ec);
+}
+
+template <typename Stream>
+size_t CommonAsioSession::readSomeIntoReadAhead(Stream& stream, std::error_code& ec) {
+    asioTransportLayerBlockBeforeOpportunisticRead.pauseWhileSet();
+
+    auto buffer = asio::buffer(_readAheadBuffer.get() + _readAheadEnd,
+                               _readAheadBuffer.capacity() - _readAheadEnd);
+    if (MONGO_unlikely(asioTransportLayerShortOpportunisticReadWrite.shouldFail()) &&
+        _blockingMode == async) {
+        buffer = asio::buffer(buffer.data(), 1);
+    }
+
+    size_t size;
+    do {
+        size = stream.read_some(buffer, ec);
+    } while (ec == asio::error::interrupted);  // retry syscall EINTR
+    return size;
+}
+
+Future<void> CommonAsioSession::waitForReadable(const BatonHandle& baton) {
+    stdx::lock_guard lk(_asyncOpMutex);
+    if (_asyncOpState.isCanceled())
+        return makeCanceledStatus();
+    if (auto networkingBaton = baton ? baton->networking() : nullptr;
+        networkingBaton && networkingBaton->canWait()) {
+        asioTransportLayerBlockBeforeAddSession.pauseWhileSet();
+        return networkingBaton->addSession(*this, NetworkingBaton::Type::In)
+            .onError([](Status error) {
+                if (ErrorCodes::isShutdownError(error)) {
+                    // If the baton has detached, it will cancel its polling. We catch that error
+                    // here and return Status::OK so that the caller reads again and then waits
+                    // through the reactor below.
+                    return Status::OK();
+                }
+
+                return error;
+            });
+    }
+
+    return getSocket().async_wait(GenericSocket::wait_read, UseFuture{});
+}
+
 template <typename MutableBufferSequence>
 Future<void> CommonAsioSession::read(const MutableBufferSequence& buffers,
                                      const BatonHandle& baton) {
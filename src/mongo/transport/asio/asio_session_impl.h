@@ -132,6 +132,12 @@ protected:
     GenericSocket& getSocket() override;
     ExecutorFuture<void> parseProxyProtocolHeader(const ReactorHandle& reactor) override;
 
+    /**
+     * Waits on the reactor of the socket for it to become readable, or returns a ready future if
+     * read-ahead already holds unread bytes. Doesn't change the blocking mode of the socket.
+     */
+    Future<void> asyncWaitForDataImpl();
+
     const RestrictionEnvironment& getAuthEnvironment() const override {
         return _restrictionEnvironment;
     }
@@ -248,6 +254,35 @@ protected:
      */
     Future<Message> sendHTTPResponse(const BatonHandle& baton = nullptr);
 
+    /**
+     * Returns true if the next message should be sourced through the read-ahead buffer. Sessions
+     * that may still need to detect a TLS handshake read the first header exactly instead.
+     */
+    bool useReadAhead() const;
+
+    /**
+     * Sources a message through the read-ahead buffer, which a single read from the socket may
+     * fill with both the header and body of a message, or with several pipelined messages.
+     */
+    Future<Message> sourceMessageFromReadAhead(const BatonHandle& baton);
+
+    /**
+     * Reads from the socket until the read-ahead buffer holds at least 'minBytes' bytes.
+     */
+    Future<void> fillReadAhead(size_t minBytes, const BatonHandle& baton);
+
+    template <typename Stream>
+    size_t readSomeIntoReadAhead(Stream& stream, std::error_code& ec);
+
+    /**
+     * Returns a future that becomes ready once the socket has data to read.
+     */
+    Future<void> waitForReadable(const BatonHandle& baton);
+
+    size_t readAheadBytes() const {
+        return _readAheadEnd - _readAheadBegin;
+    }
+
     bool shouldOverrideMaxConns(
         const std::vector<std::variant<CIDR, std::string>>& exemptions) const override;
 
@@ -294,6 +329,13 @@ protected:
 
     AsyncOperationState _asyncOpState;
 
+    // Bytes read from the socket ahead of the message being sourced, in the range
+    // [_readAheadBegin, _readAheadEnd). The buffer is released once drained so that idle sessions
+    // do not hold on to it.
+    SharedBuffer _readAheadBuffer;
+    size_t _readAheadBegin = 0;
+    size_t _readAheadEnd = 0;
+
     /**
      * Strictly orders the start and cancellation of asynchronous operations:
      * - Holding the mutex while starting asynchronous operations (e.g., adding the session to the
@@ -336,7 +378,8 @@ protected:
 /**
  * This is an AsioSession which is intended to only use the `sourceMessage`, `sinkMessage`, and
  * `waitForData` subset of the Session's read/write/wait interface. Usage of async counterparts of
- * these functions causes an invariant to be triggered.
+ * these functions causes an invariant to be triggered, except for `asyncWaitForData`, which
+ * borrowed thread service executors use to wait for the next request without holding a thread.
  *
  * NOTE: See AsyncAsioSession's note explaining the current state and purpose of the separation.
  */
@@ -348,6 +391,12 @@ public:
         end();
     }
 
+    /**
+     * Waiting for the socket to become readable doesn't read from it, so this leaves the socket
+     * in blocking mode for the synchronous reads and writes that follow.
+     */
+    Future<void> asyncWaitForData() noexcept override;
+
 protected:
     void ensureSync() override;
     void ensureAsync() override;
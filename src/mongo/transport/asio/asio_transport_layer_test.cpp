@@ -32,6 +32,7 @@
 #include <exception>
 #include <fstream>
 #include <queue>
+#include <string>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -458,6 +459,44 @@ TEST(AsioTransportLayer, SourceSyncTimeoutSucceeds) {
     ASSERT_OK(received.get().getStatus());
 }
 
+/** Messages that arrive together are split correctly out of the session's read-ahead buffer. */
+TEST(AsioTransportLayer, SourcePipelinedMessages) {
+    const int kNumMessages = 10;
+    TestFixture tf;
+    Notification<std::vector<StatusWith<Message>>> received;
+    tf.sessionManager().setOnStartSession([&](test::SessionThread& st) {
+        st.schedule([&](auto& session) {
+            std::vector<StatusWith<Message>> messages;
+            for (int i = 0; i < kNumMessages; ++i) {
+                messages.push_back(session.sourceMessage());
+            }
+            received.set(std::move(messages));
+        });
+    });
+
+    std::string pipelined;
+    for (int i = 0; i < kNumMessages; ++i) {
+        OpMsgBuilder builder;
+        builder.setBody(BSON("ping" << 1 << "i" << i));
+        Message msg = builder.finish();
+        msg.header().setResponseToMsgId(0);
+        msg.header().setId(i);
+        pipelined.append(msg.buf(), msg.size());
+    }
+    SyncClient conn(tf.tla().listenerPort());
+    auto ec = conn.write(pipelined.data(), pipelined.size());
+    ASSERT_FALSE(ec) << errorMessage(ec);
+
+    auto messages = received.get();
+    ASSERT_EQ(messages.size(), static_cast<size_t>(kNumMessages));
+    for (int i = 0; i < kNumMessages; ++i) {
+        ASSERT_OK(messages[i].getStatus());
+        const auto& msg = messages[i].getValue();
+        ASSERT_EQ(msg.header().getId(), i);
+        ASSERT_EQ(OpMsg::parse(msg).body["i"].numberInt(), i);
+    }
+}
+
 /** Switching from timeouts to no timeouts must reset the timeout to unlimited. */
 TEST(AsioTransportLayer, SwitchTimeoutModes) {
     TestFixture tf;
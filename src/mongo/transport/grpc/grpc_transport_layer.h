@@ -45,6 +45,10 @@ namespace mongo::transport::grpc {
  * but other arbitrary gRPC services can be used in the ingress portion. Such services can be
  * registered with this transport layer via registerService() before setup() is called.
  *
+ * Egress sessions multiplex many streams over a small number of channels per remote host, but
+ * egress is not yet used for intra-cluster traffic: mongos-to-shard and replication connections
+ * are still made by the ASIO transport layer through the NetworkInterface and its ConnectionPool.
+ *
  * On shutdown, it cancels all outstanding RPCs (both ingress and egress) and blocks until they have
  * completed. If egress mode is enabled, this entails waiting for all sessions to be destructed. If
  * ingress mode is enabled, this entails waiting for all RPC handlers to return.
@@ -29,6 +29,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include <zstd.h>
 
 #include <boost/move/utility_core.hpp>
@@ -37,11 +39,81 @@
 #include "mongo/base/init.h"  // IWYU pragma: keep
 #include "mongo/base/initializer.h"
 #include "mongo/base/status.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/mutex.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_zstd.h"
+#include "mongo/util/static_immortal.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
+namespace {
+
+// ZSTD_compress() and ZSTD_decompress() create and free a new context for every message. The
+// compressor is shared by all connections, so instead a small pool of contexts of each kind is
+// shared by all threads, falling back to the one-shot functions if a context could not be
+// allocated. A context keeps the memory it needed for the largest message it has handled, so a
+// context which grew past kMaxPooledContextBytes is freed rather than returned to the pool.
+// Messages are still compressed independently of each other.
+constexpr size_t kMaxPooledContexts = 16;
+constexpr size_t kMaxPooledContextBytes = 4 * 1024 * 1024;
+
+template <typename Ctx,
+          Ctx* (*createContext)(),
+          size_t (*freeContext)(Ctx*),
+          size_t (*sizeofContext)(const Ctx*)>
+class ZstdContextPool {
+public:
+    struct Deleter {
+        void operator()(Ctx* ctx) const {
+            freeContext(ctx);
+        }
+    };
+    using ContextPtr = std::unique_ptr<Ctx, Deleter>;
+
+    ContextPtr acquire() {
+        {
+            stdx::lock_guard lk(_mutex);
+            if (!_contexts.empty()) {
+                auto ctx = std::move(_contexts.back());
+                _contexts.pop_back();
+                return ctx;
+            }
+        }
+        return ContextPtr(createContext());
+    }
+
+    void release(ContextPtr ctx) {
+        if (!ctx || sizeofContext(ctx.get()) > kMaxPooledContextBytes) {
+            return;
+        }
+        stdx::lock_guard lk(_mutex);
+        if (_contexts.size() < kMaxPooledContexts) {
+            _contexts.push_back(std::move(ctx));
+        }
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("ZstdContextPool::_mutex");
+    std::vector<ContextPtr> _contexts;
+};
+
+using ZstdCompressionContextPool =
+    ZstdContextPool<ZSTD_CCtx, ZSTD_createCCtx, ZSTD_freeCCtx, ZSTD_sizeof_CCtx>;
+using ZstdDecompressionContextPool =
+    ZstdContextPool<ZSTD_DCtx, ZSTD_createDCtx, ZSTD_freeDCtx, ZSTD_sizeof_DCtx>;
+
+ZstdCompressionContextPool& compressionContexts() {
+    static StaticImmortal<ZstdCompressionContextPool> pool;
+    return *pool;
+}
+
+ZstdDecompressionContextPool& decompressionContexts() {
+    static StaticImmortal<ZstdDecompressionContextPool> pool;
+    return *pool;
+}
+
+}  // namespace
 
 ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
 
@@ -51,11 +123,19 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    auto cctx = compressionContexts().acquire();
+    size_t ret = cctx ? ZSTD_compressCCtx(cctx.get(),
+                                          const_cast<char*>(output.data()),
+                                          output.length(),
+                                          input.data(),
+                                          input.length(),
+                                          ZSTD_CLEVEL_DEFAULT)
+                      : ZSTD_compress(const_cast<char*>(output.data()),
+                                      output.length(),
+                                      input.data(),
+                                      input.length(),
+                                      ZSTD_CLEVEL_DEFAULT);
+    compressionContexts().release(std::move(cctx));
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -67,8 +147,17 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    auto dctx = decompressionContexts().acquire();
+    size_t ret = dctx ? ZSTD_decompressDCtx(dctx.get(),
+                                            const_cast<char*>(output.data()),
+                                            output.length(),
+                                            input.data(),
+                                            input.length())
+                      : ZSTD_decompress(const_cast<char*>(output.data()),
+                                        output.length(),
+                                        input.data(),
+                                        input.length());
+    decompressionContexts().release(std::move(dctx));
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
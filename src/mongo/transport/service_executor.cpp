@@ -41,6 +41,7 @@
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/service_executor_reserved.h"
 #include "mongo/transport/service_executor_synchronous.h"
+#include "mongo/transport/service_executor_work_stealing.h"
 #include "mongo/transport/session_manager.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/util/assert_util_core.h"
@@ -99,6 +100,7 @@ void forEachServiceExecutor(ServiceContext* svcCtx, const Func& func) {
     call(std::type_identity<ServiceExecutorSynchronous>{});
     call(std::type_identity<ServiceExecutorReserved>{});
     call(std::type_identity<ServiceExecutorInline>{});
+    call(std::type_identity<ServiceExecutorWorkStealing>{});
 }
 
 }  // namespace
@@ -124,7 +126,7 @@ void ServiceExecutorContext::set(Client* client,
                 kDiagnosticLogLevel,
                 "Setting initial ServiceExecutor context for client",
                 "client"_attr = client->desc(),
-                "usesDedicatedThread"_attr = true,
+                "usesDedicatedThread"_attr = seCtx._threadModel != ThreadModel::kBorrowed,
                 "canUseReserved"_attr = seCtx._canUseReserved);
     serviceExecutorContext = std::move(seCtxPtr);
 }
@@ -172,12 +174,14 @@ ServiceExecutor* ServiceExecutorContext::getServiceExecutor() {
     if (_getServiceExecutorForTest)
         return _getServiceExecutorForTest();
 
+    auto svcCtx = _client->getServiceContext();
     switch (_threadModel) {
         case ThreadModel::kInline:
-            return ServiceExecutorInline::get(_client->getServiceContext());
-        case ThreadModel::kSynchronous: {
+            return ServiceExecutorInline::get(svcCtx);
+        case ThreadModel::kSynchronous:
+        case ThreadModel::kBorrowed: {
             if (_canUseReserved && !_hasUsedSynchronous && shouldUseReserved(_client)) {
-                if (auto exec = ServiceExecutorReserved::get(_client->getServiceContext())) {
+                if (auto exec = ServiceExecutorReserved::get(svcCtx)) {
                     // All conditions are met:
                     // * We are allowed to use the reserved
                     // * We have not used the synchronous
@@ -187,10 +191,15 @@ ServiceExecutor* ServiceExecutorContext::getServiceExecutor() {
                 }
             }
 
-            // Once we use the ServiceExecutorSynchronous, we shouldn't use the
-            // ServiceExecutorReserved.
+            // Once we use the ServiceExecutorSynchronous or the ServiceExecutorWorkStealing, we
+            // shouldn't use the ServiceExecutorReserved.
             _hasUsedSynchronous = true;
-            return ServiceExecutorSynchronous::get(_client->getServiceContext());
+            if (_threadModel == ThreadModel::kBorrowed) {
+                if (auto exec = ServiceExecutorWorkStealing::get(svcCtx)) {
+                    return exec;
+                }
+            }
+            return ServiceExecutorSynchronous::get(svcCtx);
         }
     }
 
@@ -103,6 +103,14 @@ public:
     /** Appends statistics about task scheduling to a BSONObjBuilder for serverStatus output. */
     virtual void appendStats(BSONObjBuilder* bob) const = 0;
 
+    /**
+     * Returns true if a client keeps the thread its tasks run on while it waits for data. Clients
+     * of other executors must wait with TaskRunner::runOnDataAvailable() to release the thread.
+     */
+    virtual bool usesDedicatedThreads() const {
+        return true;
+    }
+
     /** Yield if this executor controls more threads than we have cores. */
     void yieldIfAppropriate() const;
 
@@ -119,9 +127,11 @@ public:
 class ServiceExecutorContext {
 public:
     // Roughly a 1:1 mapping to the ServiceExecutor type which will be used.
-    // ThreadModel::kSynchronous + canUseReserved may result in ServiceExecutorReserved.
+    // ThreadModel::kSynchronous or kBorrowed + canUseReserved may result in
+    // ServiceExecutorReserved.
     enum class ThreadModel {
         kSynchronous,
+        kBorrowed,
         kInline,
     };
 
@@ -129,6 +139,7 @@ public:
     // As our toolchain is updated, we may be able to replace this with a simple:
     // `using enum ThreadModel;`
     static constexpr inline auto kSynchronous = ThreadModel::kSynchronous;
+    static constexpr inline auto kBorrowed = ThreadModel::kBorrowed;
     static constexpr inline auto kInline = ThreadModel::kInline;
 
     /**
@@ -188,7 +199,7 @@ private:
     Client* _client = nullptr;
 
     bool _canUseReserved = false;
-    bool _hasUsedSynchronous = false;
+    bool _hasUsedSynchronous = false;  // Or the borrowed executor.
     ThreadModel _threadModel{ThreadModel::kSynchronous};
 
     /** For tests to override the behavior of `getServiceExecutor()`. */
@@ -29,19 +29,29 @@
 
 #include <benchmark/benchmark.h>
 // IWYU pragma: no_include "cxxabi.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/transport/mock_session.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/service_executor_synchronous.h"
+#include "mongo/transport/service_executor_work_stealing.h"
+#include "mongo/transport/transport_layer_mock.h"
 #include "mongo/unittest/barrier.h"
+#include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/processinfo.h"
+#include "mongo/util/scopeguard.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT mongo::logv2::LogComponent::kTest
 
@@ -55,10 +65,12 @@ namespace {
 #if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
 const auto kMaxThreads = 1;
 const auto kMaxChainSize = 1;
+const std::vector<int64_t> kClientCounts{100};
 #else
 /** 2x to benchmark the case of more threads than cores for curiosity's sake. */
 const auto kMaxThreads = 2 * ProcessInfo::getNumLogicalCores();
 const auto kMaxChainSize = 64;
+const std::vector<int64_t> kClientCounts{10'000, 50'000, 100'000};
 #endif
 
 struct Notification {
@@ -180,6 +192,196 @@ BENCHMARK_DEFINE_F(ServiceExecutorSynchronousBm, DummyBenchmark)(benchmark::Stat
     }
 }
 
+/** Counts down to zero from any thread, and lets one thread wait for zero. */
+class Countdown {
+public:
+    void reset(size_t count) {
+        _remaining.store(count);
+    }
+
+    void countDown() {
+        if (_remaining.subtractAndFetch(1) == 0) {
+            stdx::lock_guard lk{_mu};
+            _cv.notify_all();
+        }
+    }
+
+    void wait() {
+        stdx::unique_lock lk{_mu};
+        _cv.wait(lk, [&] { return _remaining.load() == 0; });
+    }
+
+private:
+    AtomicWord<size_t> _remaining{0};
+    stdx::mutex _mu;  // NOLINT
+    stdx::condition_variable _cv;
+};
+
+/**
+ * Emulates many connected clients that each wait for a request, run it, and wait for the next one,
+ * the way SessionWorkflow drives a session. Clients of an executor with dedicated threads block
+ * their thread while they wait, and other clients release it with runOnDataAvailable().
+ *
+ * Each round delivers one request to every client, so the throughput is the number of clients
+ * served per second. The latency of a request is the time from its delivery until its task starts
+ * on the executor, and its percentiles are reported as counters.
+ */
+class ManyClients {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ManyClients(ServiceExecutor* exec, size_t count) : _exec{exec}, _clients(count) {}
+
+    /** Starts every client and waits for those which started to wait for data. */
+    void start() {
+        _waiting.reset(_clients.size());
+        ScopeGuard waitForStarted = [&] {
+            for (size_t i = _started; i != _clients.size(); ++i)
+                _waiting.countDown();
+            _waiting.wait();
+        };
+        for (size_t i = 0; i != _clients.size(); ++i) {
+            auto& client = _clients[i];
+            client.session = std::dynamic_pointer_cast<MockSession>(_tl.createSession());
+            client.runner = _exec->makeTaskRunner();
+            if (_exec->usesDedicatedThreads()) {
+                client.runner->schedule([this, i](Status st) {
+                    if (st.isOK())
+                        _runDedicated(i);
+                });
+            } else {
+                _waitBorrowed(i);
+            }
+            ++_started;
+        }
+    }
+
+    /** Delivers one request to every client and waits until all of them are waiting again. */
+    void runRound() {
+        _waiting.reset(_started);
+        for (size_t i = 0; i != _started; ++i) {
+            _clients[i].sent = Clock::now();
+            _clients[i].session->signalAvailableData();
+        }
+        _waiting.wait();
+    }
+
+    /** Releases the clients which were started and waits for them to finish. */
+    void stop() {
+        _stopping.store(true);
+        _waiting.reset(_started);
+        for (size_t i = 0; i != _started; ++i)
+            _clients[i].session->signalAvailableData();
+        _waiting.wait();
+        _clients.clear();
+    }
+
+    /** Reports request latency percentiles, in microseconds. */
+    void reportLatency(benchmark::State& state) {
+        if (_latencies.empty())
+            return;
+        std::sort(_latencies.begin(), _latencies.end());
+        auto percentile = [&](double p) {
+            auto i = std::min(_latencies.size() - 1, size_t(p * _latencies.size()));
+            return std::chrono::duration<double, std::micro>(_latencies[i]).count();
+        };
+        state.counters["p50Micros"] = percentile(0.5);
+        state.counters["p99Micros"] = percentile(0.99);
+        state.counters["p999Micros"] = percentile(0.999);
+    }
+
+    /** Collects the latencies of the last round from the clients. */
+    void collectLatency() {
+        for (size_t i = 0; i != _started; ++i)
+            _latencies.push_back(_clients[i].latency);
+    }
+
+private:
+    struct Client {
+        std::shared_ptr<MockSession> session;
+        std::unique_ptr<ServiceExecutor::TaskRunner> runner;
+        Clock::time_point sent;
+        Clock::duration latency{};
+    };
+
+    void _onRequest(size_t i) {
+        auto& client = _clients[i];
+        client.latency = Clock::now() - client.sent;
+    }
+
+    /** Runs client `i` on its dedicated thread, blocking it while waiting for data. */
+    void _runDedicated(size_t i) {
+        auto session = _clients[i].session;
+        while (true) {
+            auto dataAvailable = session->asyncWaitForData();
+            _waiting.countDown();
+            if (!dataAvailable.getNoThrow().isOK() || _stopping.load()) {
+                _waiting.countDown();
+                return;
+            }
+            _onRequest(i);
+        }
+    }
+
+    /** Waits for data for client `i` without holding a thread. */
+    void _waitBorrowed(size_t i) {
+        auto& client = _clients[i];
+        client.runner->runOnDataAvailable(client.session, [this, i](Status st) {
+            if (!st.isOK() || _stopping.load()) {
+                _waiting.countDown();
+                return;
+            }
+            _onRequest(i);
+            _waitBorrowed(i);
+        });
+        _waiting.countDown();
+    }
+
+    ServiceExecutor* _exec;
+    TransportLayerMock _tl;
+    std::vector<Client> _clients;
+    size_t _started = 0;
+    Countdown _waiting;
+    AtomicWord<bool> _stopping{false};
+    std::vector<Clock::duration> _latencies;
+};
+
+void runManyClients(benchmark::State& state, ServiceExecutor* exec) {
+    exec->start();
+    ManyClients clients(exec, state.range(0));
+    try {
+        clients.start();
+    } catch (const DBException& ex) {
+        // Thread per connection can run out of threads long before it runs out of clients.
+        state.SkipWithError(ex.toString().c_str());
+    }
+    if (!state.error_occurred()) {
+        for (auto _ : state) {
+            clients.runRound();
+            state.PauseTiming();
+            clients.collectLatency();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        clients.reportLatency(state);
+    }
+    clients.stop();
+    (void)exec->shutdown(Hours{1});
+}
+
+void BM_ManyClientsSynchronous(benchmark::State& state) {
+    ServiceExecutorSynchronous exec;
+    runManyClients(state, &exec);
+}
+
+void BM_ManyClientsWorkStealing(benchmark::State& state) {
+    ServiceExecutorWorkStealing exec("benchmark", ProcessInfo::getNumAvailableCores());
+    runManyClients(state, &exec);
+}
+
+BENCHMARK(BM_ManyClientsSynchronous)->ArgsProduct({kClientCounts})->UseRealTime();
+BENCHMARK(BM_ManyClientsWorkStealing)->ArgsProduct({kClientCounts})->UseRealTime();
+
 #if !__has_feature(address_sanitizer) && !__has_feature(thread_sanitizer)
 BENCHMARK_REGISTER_F(ServiceExecutorSynchronousBm, ScheduleTask)->ThreadRange(1, kMaxThreads);
 BENCHMARK_REGISTER_F(ServiceExecutorSynchronousBm, ScheduleAndWait)->ThreadRange(1, kMaxThreads);
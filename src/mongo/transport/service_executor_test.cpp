@@ -37,6 +37,7 @@
 #include <new>
 #include <thread>
 #include <utility>
+#include <vector>
 
 // IWYU pragma: no_include "asio/impl/dispatch.hpp"
 // IWYU pragma: no_include "asio/impl/io_context.hpp"
@@ -58,6 +59,7 @@
 #include "mongo/transport/mock_session.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/service_executor_synchronous.h"
+#include "mongo/transport/service_executor_work_stealing.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/transport/transport_layer_mock.h"
 #include "mongo/unittest/assert.h"
@@ -164,6 +166,11 @@ public:
     ServiceExecutorSynchronous executor;
 };
 
+class ServiceExecutorWorkStealingTest : public unittest::Test {
+public:
+    ServiceExecutorWorkStealing executor{"test", 2};
+};
+
 TEST_F(ServiceExecutorInlineTest, MakeTaskRunnerFailsBeforeStartup) {
     ASSERT_THROWS(executor.makeTaskRunner(), DBException);
 }
@@ -172,6 +179,10 @@ TEST_F(ServiceExecutorSynchronousTest, MakeTaskRunnerFailsBeforeStartup) {
     ASSERT_THROWS(executor.makeTaskRunner(), DBException);
 }
 
+TEST_F(ServiceExecutorWorkStealingTest, MakeTaskRunnerFailsBeforeStartup) {
+    ASSERT_THROWS(executor.makeTaskRunner(), DBException);
+}
+
 // Schedule a task and ensure it has been executed.
 stdx::thread::id doBasicTaskRunTest(ServiceExecutor* executor) {
     boost::optional<stdx::thread::id> taskid;
@@ -202,6 +213,13 @@ TEST_F(ServiceExecutorInlineTest, BasicTaskRuns) {
     ASSERT(callerid == taskid);
 }
 
+TEST_F(ServiceExecutorWorkStealingTest, BasicTaskRuns) {
+    auto callerid = stdx::this_thread::get_id();
+    auto taskid = doBasicTaskRunTest(&executor);
+    // Task runs on a worker thread.
+    ASSERT(callerid != taskid);
+}
+
 /** Implements a threadsafe 1-shot pause and resume. */
 class Breakpoint {
 public:
@@ -281,6 +299,79 @@ TEST_F(ServiceExecutorInlineTest, TaskQueueing) {
     doTestTaskQueueing(&executor);
 }
 
+TEST_F(ServiceExecutorWorkStealingTest, TaskQueueing) {
+    doTestTaskQueueing(&executor);
+}
+
+// A client which is ready to run must not wait behind a worker which is busy with another client.
+TEST_F(ServiceExecutorWorkStealingTest, IdleWorkerStealsReadyClient) {
+    executor.start();
+    auto busyRunner = executor.makeTaskRunner();
+    auto readyRunner = executor.makeTaskRunner();
+
+    PromiseAndFuture<void> stolen;
+    PromiseAndFuture<void> done;
+    busyRunner->schedule([&](Status st) {
+        // Scheduled from a worker, so it is queued behind this task on the same worker.
+        readyRunner->schedule([&](Status st) { stolen.promise.setFrom(st); });
+        // Only another worker can run the task scheduled above.
+        stolen.future.get();
+        done.promise.setFrom(st);
+    });
+    ASSERT_DOES_NOT_THROW(done.future.get());
+
+    BSONObjBuilder bob;
+    executor.appendStats(&bob);
+    ASSERT_GTE(bob.obj()["borrowed"]["clientsStolen"].numberLong(), 1);
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+}
+
+// Waiting for data must not hold a worker, and the callback runs on a worker once data arrives.
+TEST_F(ServiceExecutorWorkStealingTest, RunOnDataAvailableReleasesWorker) {
+    TransportLayerMock tl;
+    executor.start();
+
+    // Wait on as many sessions as there are workers.
+    std::vector<std::shared_ptr<MockSession>> sessions;
+    std::vector<std::unique_ptr<ServiceExecutor::TaskRunner>> waitingRunners;
+    std::vector<PromiseAndFuture<stdx::thread::id>> dataAvailable(2);
+    for (auto& pf : dataAvailable) {
+        sessions.push_back(std::dynamic_pointer_cast<MockSession>(tl.createSession()));
+        ASSERT(sessions.back());
+        waitingRunners.push_back(executor.makeTaskRunner());
+        waitingRunners.back()->runOnDataAvailable(sessions.back(), [&pf](Status st) {
+            pf.promise.setWith([&] {
+                uassertStatusOK(st);
+                return stdx::this_thread::get_id();
+            });
+        });
+    }
+
+    // The waits hold no worker, so the tasks of other clients still run.
+    auto runner = executor.makeTaskRunner();
+    PromiseAndFuture<void> pf;
+    runner->schedule([&](Status st) { pf.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(pf.future.get());
+
+    for (size_t i = 0; i < sessions.size(); ++i) {
+        ASSERT_FALSE(dataAvailable[i].future.isReady());
+        sessions[i]->signalAvailableData();
+        ASSERT(dataAvailable[i].future.get() != stdx::this_thread::get_id());
+    }
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+}
+
+// Tasks left queued at shutdown are called with an error rather than dropped.
+TEST_F(ServiceExecutorWorkStealingTest, QueuedTasksFailAfterShutdown) {
+    executor.start();
+    auto runner = executor.makeTaskRunner();
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+
+    PromiseAndFuture<void> pf;
+    runner->schedule([&](Status st) { pf.promise.setFrom(st); });
+    ASSERT_EQ(pf.future.getNoThrow(), ErrorCodes::ShutdownInProgress);
+}
+
 /** Ensure that tasks queued after a task queue has emptied will still run. */
 void doTestTaskPostQueueing(ServiceExecutor* executor) {
     executor->start();
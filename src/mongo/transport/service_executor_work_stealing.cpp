@@ -0,0 +1,411 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/transport/service_executor_work_stealing.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/logv2/log.h"
+#include "mongo/logv2/log_attr.h"
+#include "mongo/logv2/log_component.h"
+#include "mongo/transport/service_executor_gen.h"
+#include "mongo/transport/service_executor_utils.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/functional.h"
+#include "mongo/util/future.h"
+#include "mongo/util/out_of_line_executor.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kExecutor
+
+
+namespace mongo::transport {
+namespace {
+
+constexpr auto kExecutorName = "borrowed"_sd;
+
+constexpr auto kThreadsRunning = "threadsRunning"_sd;
+constexpr auto kClientsInTotal = "clientsInTotal"_sd;
+constexpr auto kClientsRunning = "clientsRunning"_sd;
+constexpr auto kClientsWaiting = "clientsWaitingForData"_sd;
+constexpr auto kClientsStolen = "clientsStolen"_sd;
+
+// How long a reactor thread waits for events before checking whether the executor still runs.
+constexpr auto kReactorPollInterval = Milliseconds{100};
+
+const Status kShutdownStatus{ErrorCodes::ShutdownInProgress, "Executor is not running"};
+
+size_t getWorkerCount() {
+    size_t workers = borrowedServiceExecutorThreads > 0
+        ? static_cast<size_t>(borrowedServiceExecutorThreads)
+        : ProcessInfo::getNumAvailableCores();
+    return std::min(workers, static_cast<size_t>(fixedServiceExecutorThreadLimit - 1));
+}
+
+const auto getServiceExecutorWorkStealing =
+    ServiceContext::declareDecoration<std::unique_ptr<ServiceExecutorWorkStealing>>();
+
+const auto serviceExecutorWorkStealingRegisterer = ServiceContext::ConstructorActionRegisterer{
+    "ServiceExecutorWorkStealing", [](ServiceContext* ctx) {
+        if (!gServiceExecutorUseBorrowedThreads) {
+            return;
+        }
+
+        getServiceExecutorWorkStealing(ctx) = std::make_unique<ServiceExecutorWorkStealing>(
+            "borrowed thread connections", getWorkerCount());
+    }};
+
+/** Identifies the worker running on the current thread, if any. */
+struct WorkerThreadInfo {
+    const ServiceExecutorWorkStealing* executor = nullptr;
+    size_t workerId = 0;
+};
+
+thread_local WorkerThreadInfo workerThreadInfoTls;
+
+}  // namespace
+
+/**
+ * The tasks scheduled on one TaskRunner. A Runner is queued on a worker when it has a task ready
+ * to run, and is never queued more than once at a time, so that its tasks run in order.
+ */
+class ServiceExecutorWorkStealing::Runner : public std::enable_shared_from_this<Runner> {
+public:
+    explicit Runner(ServiceExecutorWorkStealing* executor) : _executor{executor} {}
+
+    void schedule(Task task) {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _tasks.push_back(std::move(task));
+            if (_isQueued) {
+                return;
+            }
+            _isQueued = true;
+        }
+        _executor->_enqueue(shared_from_this());
+    }
+
+    /**
+     * Runs the oldest task with 'status'. Returns true if more tasks are ready, in which case the
+     * caller must queue this again.
+     */
+    bool runOne(Status status) {
+        Task task;
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            invariant(!_tasks.empty());
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        task(std::move(status));
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_tasks.empty()) {
+            _isQueued = false;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    ServiceExecutorWorkStealing* const _executor;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ServiceExecutorWorkStealing::Runner::_mutex");
+    std::deque<Task> _tasks;
+    bool _isQueued = false;
+};
+
+/** Schedules on a Runner of this, and counts the clients of this. */
+class ServiceExecutorWorkStealing::ForwardingTaskRunner : public TaskRunner {
+public:
+    explicit ForwardingTaskRunner(ServiceExecutorWorkStealing* e)
+        : _e{e}, _runner{std::make_shared<Runner>(e)} {
+        _e->_numClients.fetchAndAdd(1);
+    }
+
+    ~ForwardingTaskRunner() override {
+        _e->_numClients.fetchAndSubtract(1);
+    }
+
+    void schedule(Task task) override {
+        _runner->schedule(std::move(task));
+    }
+
+    /**
+     * Waits for data without holding a worker. The callback is scheduled whether or not the wait
+     * succeeds, so that it always runs on a worker thread.
+     */
+    void runOnDataAvailable(std::shared_ptr<Session> session, Task task) override {
+        invariant(session);
+        auto dataAvailable = session->asyncWaitForData();
+        if (!dataAvailable.isReady()) {
+            // The wait completes on the reactor of the session, which must be running.
+            _e->_pollReactorFor(*session);
+        }
+        _e->_numWaitingForData.fetchAndAdd(1);
+        std::move(dataAvailable)
+            .getAsync([e = _e, runner = _runner, task = std::move(task)](Status status) mutable {
+                e->_numWaitingForData.fetchAndSubtract(1);
+                runner->schedule([task = std::move(task), status = std::move(status)](
+                                     Status st) mutable { task(st.isOK() ? status : st); });
+            });
+    }
+
+private:
+    ServiceExecutorWorkStealing* const _e;
+    const std::shared_ptr<Runner> _runner;
+};
+
+ServiceExecutorWorkStealing::ServiceExecutorWorkStealing(std::string name, size_t numWorkers)
+    : _name(std::move(name)) {
+    invariant(numWorkers > 0);
+    _workers.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; ++i) {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+}
+
+ServiceExecutorWorkStealing::~ServiceExecutorWorkStealing() = default;
+
+ServiceExecutorWorkStealing* ServiceExecutorWorkStealing::get(ServiceContext* ctx) {
+    auto& ref = getServiceExecutorWorkStealing(ctx);
+
+    // The ServiceExecutorWorkStealing could be absent, so nullptr is okay.
+    return ref.get();
+}
+
+void ServiceExecutorWorkStealing::start() {
+    _stillRunning.store(true);
+
+    LOGV2(9601000,
+          "Starting worker threads for service executor",
+          "name"_attr = _name,
+          "workers"_attr = _workers.size());
+    for (size_t i = 0; i < _workers.size(); ++i) {
+        uassertStatusOK(_startWorker(i));
+    }
+}
+
+Status ServiceExecutorWorkStealing::_startWorker(size_t workerId) {
+    _numRunningThreads.addAndFetch(1);
+    auto status = launchServiceWorkerThread([this, workerId] {
+        ScopeGuard numRunningGuard([&] {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _numRunningThreads.subtractAndFetch(1);
+            _shutdownCondition.notify_all();
+        });
+
+        _runWorker(workerId);
+
+        LOGV2_DEBUG(9601001,
+                    3,
+                    "Exiting worker thread in service executor",
+                    "name"_attr = _name,
+                    "workerId"_attr = workerId);
+    });
+    if (!status.isOK()) {
+        _numRunningThreads.subtractAndFetch(1);
+    }
+    return status;
+}
+
+void ServiceExecutorWorkStealing::_runWorker(size_t workerId) {
+    workerThreadInfoTls = {this, workerId};
+    ScopeGuard resetTlsGuard([] { workerThreadInfoTls = {}; });
+
+    while (_stillRunning.load()) {
+        auto runner = _dequeue(workerId);
+        if (!runner) {
+            _waitForWork();
+            continue;
+        }
+
+        _numRunningTasks.fetchAndAdd(1);
+        bool hasMoreTasks = runner->runOne(Status::OK());
+        _numRunningTasks.fetchAndSubtract(1);
+
+        // Go to the back of the queue so that the other ready clients of this worker run first.
+        if (hasMoreTasks) {
+            _enqueue(std::move(runner));
+        }
+    }
+
+    _failReadyRunners(workerId);
+}
+
+void ServiceExecutorWorkStealing::_enqueue(std::shared_ptr<Runner> runner) {
+    auto workerId = workerThreadInfoTls.executor == this
+        ? workerThreadInfoTls.workerId
+        : _nextWorker.fetchAndAdd(1) % _workers.size();
+
+    // Count the runner before it can be taken so that the count never underflows.
+    _numReadyRunners.fetchAndAdd(1);
+    {
+        auto& worker = *_workers[workerId];
+        stdx::lock_guard<Latch> lk(worker.mutex);
+        worker.readyRunners.push_back(std::move(runner));
+    }
+
+    if (MONGO_unlikely(!_stillRunning.load())) {
+        // The workers may have already failed their queues, so fail this one here.
+        _failReadyRunners(workerId);
+        return;
+    }
+
+    if (_numSleepingWorkers.load()) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _threadWakeup.notify_one();
+    }
+}
+
+std::shared_ptr<ServiceExecutorWorkStealing::Runner> ServiceExecutorWorkStealing::_takeReadyRunner(
+    size_t workerId) {
+    std::shared_ptr<Runner> runner;
+    {
+        auto& worker = *_workers[workerId];
+        stdx::lock_guard<Latch> lk(worker.mutex);
+        if (worker.readyRunners.empty()) {
+            return nullptr;
+        }
+        runner = std::move(worker.readyRunners.front());
+        worker.readyRunners.pop_front();
+    }
+    _numReadyRunners.fetchAndSubtract(1);
+    return runner;
+}
+
+std::shared_ptr<ServiceExecutorWorkStealing::Runner> ServiceExecutorWorkStealing::_dequeue(
+    size_t workerId) {
+    if (auto runner = _takeReadyRunner(workerId)) {
+        return runner;
+    }
+
+    // Start with the next worker so that every worker isn't robbing the same one.
+    for (size_t i = 1; i < _workers.size() && _numReadyRunners.load(); ++i) {
+        if (auto runner = _takeReadyRunner((workerId + i) % _workers.size())) {
+            _numStolenRunners.fetchAndAdd(1);
+            return runner;
+        }
+    }
+    return nullptr;
+}
+
+void ServiceExecutorWorkStealing::_waitForWork() {
+    stdx::unique_lock<Latch> lk(_mutex);
+    _numSleepingWorkers.fetchAndAdd(1);
+    ScopeGuard sleepingGuard([&] { _numSleepingWorkers.fetchAndSubtract(1); });
+    _threadWakeup.wait(lk, [&] { return !_stillRunning.load() || _numReadyRunners.load() > 0; });
+}
+
+void ServiceExecutorWorkStealing::_failReadyRunners(size_t workerId) {
+    while (auto runner = _takeReadyRunner(workerId)) {
+        while (runner->runOne(kShutdownStatus)) {
+        }
+    }
+}
+
+void ServiceExecutorWorkStealing::_pollReactorFor(const Session& session) {
+    auto tl = session.getTransportLayer();
+    auto reactor = tl ? tl->getReactor(TransportLayer::kIngress) : nullptr;
+    if (!reactor) {
+        // The session completes its own waits, as mock sessions do.
+        return;
+    }
+    if (_lastPolledReactor.load() == reactor.get()) {
+        return;
+    }
+
+    // The transport layer never runs its ingress reactor (see AsioTransportLayer), so the waits
+    // registered by runOnDataAvailable() only complete if this executor runs it. Workers can't
+    // run it while idle, because a worker inside Reactor::runFor() doesn't notice TaskRunners
+    // that become ready until the poll interval ends. One thread per reactor, started with the
+    // first wait, completes the waits of every idle client, and getWorkerCount() keeps a slot
+    // for it under fixedServiceExecutorThreadLimit.
+    stdx::lock_guard<Latch> reactorsLk(_mutex);
+    if (std::find(_reactors.begin(), _reactors.end(), reactor) == _reactors.end()) {
+        LOGV2(9601002, "Starting reactor thread for service executor", "name"_attr = _name);
+        _numRunningThreads.addAndFetch(1);
+        auto status = launchServiceWorkerThread([this, reactor] {
+            ScopeGuard numRunningGuard([&] {
+                stdx::lock_guard<Latch> lk(_mutex);
+                _numRunningThreads.subtractAndFetch(1);
+                _shutdownCondition.notify_all();
+            });
+
+            while (_stillRunning.load()) {
+                reactor->runFor(kReactorPollInterval);
+            }
+        });
+        if (!status.isOK()) {
+            _numRunningThreads.subtractAndFetch(1);
+            uassertStatusOK(status);
+        }
+        _reactors.push_back(reactor);
+    }
+    _lastPolledReactor.store(reactor.get());
+}
+
+Status ServiceExecutorWorkStealing::shutdown(Milliseconds timeout) {
+    LOGV2_DEBUG(9601003, 3, "Shutting down borrowed thread executor");
+
+    stdx::unique_lock<Latch> lock(_mutex);
+    _stillRunning.store(false);
+    _threadWakeup.notify_all();
+
+    bool result = _shutdownCondition.wait_for(lock, timeout.toSystemDuration(), [this]() {
+        return _numRunningThreads.load() == 0;
+    });
+
+    return result ? Status::OK()
+                  : Status(ErrorCodes::Error::ExceededTimeLimit,
+                           "borrowed thread executor couldn't shutdown all worker threads within "
+                           "time limit.");
+}
+
+void ServiceExecutorWorkStealing::appendStats(BSONObjBuilder* bob) const {
+    BSONObjBuilder subbob = bob->subobjStart(kExecutorName);
+    subbob.append(kThreadsRunning, static_cast<int>(_numRunningThreads.loadRelaxed()));
+    subbob.append(kClientsInTotal, static_cast<int>(_numClients.loadRelaxed()));
+    subbob.append(kClientsRunning, static_cast<int>(_numRunningTasks.loadRelaxed()));
+    subbob.append(kClientsWaiting, static_cast<int>(_numWaitingForData.loadRelaxed()));
+    subbob.append(kClientsStolen, _numStolenRunners.loadRelaxed());
+}
+
+auto ServiceExecutorWorkStealing::makeTaskRunner() -> std::unique_ptr<TaskRunner> {
+    iassert(ErrorCodes::ShutdownInProgress, "Executor is not running", _stillRunning.load());
+    return std::make_unique<ForwardingTaskRunner>(this);
+}
+
+}  // namespace mongo::transport
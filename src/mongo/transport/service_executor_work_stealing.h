@@ -0,0 +1,154 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/transport/service_executor.h"
+#include "mongo/transport/session.h"
+#include "mongo/transport/transport_layer.h"
+#include "mongo/util/duration.h"
+
+namespace mongo::transport {
+
+/**
+ * Runs the tasks of all clients on a fixed pool of worker threads, one per core by default,
+ * instead of dedicating a thread to each client.
+ *
+ * Each worker owns a queue of ready TaskRunners. A TaskRunner scheduled from a worker thread is
+ * queued on that worker, and one scheduled from any other thread is queued on the workers in
+ * turn. A worker with an empty queue steals the oldest ready TaskRunner from the other workers
+ * before going to sleep. Tasks scheduled on the same TaskRunner are run in order, one at a time,
+ * and a TaskRunner goes to the back of the queue after each of its tasks so that one client can't
+ * hold a worker while others wait.
+ *
+ * Idle clients don't hold a thread: runOnDataAvailable() registers an asynchronous wait with the
+ * reactor of the session's transport layer, and the executor runs that reactor on a thread of its
+ * own. Tasks still run synchronously once they start, so a task that blocks, for example on a
+ * storage or network operation, holds its worker until it completes.
+ */
+class ServiceExecutorWorkStealing final : public ServiceExecutor {
+public:
+    ServiceExecutorWorkStealing(std::string name, size_t numWorkers);
+    ~ServiceExecutorWorkStealing() override;
+
+    /** Returns nullptr unless the server was configured to use borrowed threads. */
+    static ServiceExecutorWorkStealing* get(ServiceContext* ctx);
+
+    void start() override;
+    Status shutdown(Milliseconds timeout) override;
+
+    std::unique_ptr<TaskRunner> makeTaskRunner() override;
+
+    size_t getRunningThreads() const override {
+        return _numRunningThreads.loadRelaxed();
+    }
+
+    void appendStats(BSONObjBuilder* bob) const override;
+
+    bool usesDedicatedThreads() const override {
+        return false;
+    }
+
+    StringData getName() const override {
+        return "ServiceExecutorWorkStealing"_sd;
+    }
+
+private:
+    class Runner;
+    class ForwardingTaskRunner;
+
+    struct Worker {
+        Mutex mutex = MONGO_MAKE_LATCH("ServiceExecutorWorkStealing::Worker::mutex");
+        std::deque<std::shared_ptr<Runner>> readyRunners;
+    };
+
+    Status _startWorker(size_t workerId);
+
+    void _runWorker(size_t workerId);
+
+    /** Queues a TaskRunner which has tasks ready to run and wakes a worker to run it. */
+    void _enqueue(std::shared_ptr<Runner> runner);
+
+    /** Takes the oldest ready TaskRunner of 'workerId', or else steals one from another worker. */
+    std::shared_ptr<Runner> _dequeue(size_t workerId);
+
+    /** Takes the oldest ready TaskRunner of 'workerId' only. Returns nullptr if there is none. */
+    std::shared_ptr<Runner> _takeReadyRunner(size_t workerId);
+
+    /** Fails the tasks of every TaskRunner left in the queue of 'workerId' after shutdown. */
+    void _failReadyRunners(size_t workerId);
+
+    /** Sleeps until a TaskRunner is ready to run or the executor is shut down. */
+    void _waitForWork();
+
+    /** Makes sure a thread of this executor runs the reactor that completes waits for 'session'. */
+    void _pollReactorFor(const Session& session);
+
+    AtomicWord<bool> _stillRunning{false};
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    // Incremented before a worker is notified, and read by a worker after it declares itself
+    // sleeping, so that a worker can't go to sleep without seeing a TaskRunner that is ready.
+    AtomicWord<size_t> _numReadyRunners{0};
+    AtomicWord<size_t> _numSleepingWorkers{0};
+    AtomicWord<size_t> _nextWorker{0};
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("ServiceExecutorWorkStealing::_mutex");
+    stdx::condition_variable _threadWakeup;
+    stdx::condition_variable _shutdownCondition;
+
+    // Reactors run by this executor, guarded by '_mutex'. The last one is cached so that waiting
+    // for data doesn't take the mutex.
+    std::vector<ReactorHandle> _reactors;
+    AtomicWord<Reactor*> _lastPolledReactor{nullptr};
+
+    AtomicWord<unsigned> _numRunningThreads{0};
+    AtomicWord<size_t> _numClients{0};
+    AtomicWord<size_t> _numRunningTasks{0};
+    AtomicWord<size_t> _numWaitingForData{0};
+    AtomicWord<long long> _numStolenRunners{0};
+
+    const std::string _name;
+};
+
+}  // namespace mongo::transport
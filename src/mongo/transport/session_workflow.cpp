@@ -793,15 +793,24 @@ Future<void> SessionWorkflow::Impl::_doOneIteration() {
 
 void SessionWorkflow::Impl::_scheduleIteration() try {
     _work = nullptr;
-    taskRunner()->schedule(_captureContext([&](Status status) {
+    auto runner = taskRunner();
+    auto iteration = _captureContext([&](Status status) {
         if (MONGO_unlikely(!status.isOK())) {
             _cleanupSession(status);
             return;
         }
 
         try {
-            // All available service executors use dedicated threads, so it's okay to
-            // run eager futures in an ordinary loop to bypass scheduler overhead.
+            if (!executor()->usesDedicatedThreads()) {
+                // Run one iteration, then release the borrowed thread until the next request
+                // arrives.
+                _doOneIteration().get();
+                _scheduleIteration();
+                return;
+            }
+
+            // The executor uses dedicated threads, so it's okay to run eager futures in an
+            // ordinary loop to bypass scheduler overhead.
             while (true) {
                 _doOneIteration().get();
                 _work = nullptr;
@@ -809,7 +818,14 @@ void SessionWorkflow::Impl::_scheduleIteration() try {
         } catch (const DBException& ex) {
             _onLoopError(ex.toStatus());
         }
-    }));
+    });
+
+    // An exhaust response has already produced the next request, so there is no data to wait for.
+    if (!_nextWork && !_taskRunner.source->usesDedicatedThreads()) {
+        runner->runOnDataAvailable(session(), std::move(iteration));
+    } else {
+        runner->schedule(std::move(iteration));
+    }
 } catch (const DBException& ex) {
     auto error = ex.toStatus();
     LOGV2_WARNING_OPTIONS(22993,
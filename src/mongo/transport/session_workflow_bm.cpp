@@ -60,6 +60,7 @@
 #include "mongo/transport/asio/asio_session_manager.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/service_executor.h"
+#include "mongo/transport/service_executor_gen.h"
 #include "mongo/transport/service_executor_synchronous.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/session_workflow_test_util.h"
@@ -128,7 +129,7 @@ public:
             return Status::OK();
         }
         Future<void> asyncWaitForData() noexcept override {
-            return {};
+            return Future<void>::makeReady();
         }
         StatusWith<Message> sourceMessage() noexcept override {
             LOGV2_DEBUG(7015132, 3, "sourceMessage", "rounds"_attr = _rounds);
@@ -215,16 +216,20 @@ public:
         size_t argIndex = 0;
         int exhaustRounds = state.range(argIndex++);
         int reserved = state.range(argIndex++);
+        bool borrowed = state.range(argIndex++);
 
         LOGV2_DEBUG(7015135,
                     3,
                     "SetUp (first)",
                     "exhaustRounds"_attr = exhaustRounds,
-                    "reserved"_attr = reserved);
+                    "reserved"_attr = reserved,
+                    "borrowed"_attr = borrowed);
 
 #if TRANSITIONAL_SERVICE_EXECUTOR_SYNCHRONOUS_HAS_RESERVE
         _savedDefaultReserved.emplace(ServiceExecutorSynchronous::defaultReserved, reserved);
 #endif
+        // Read when the ServiceContext and each session are set up.
+        _savedUseBorrowedThreads.emplace(gServiceExecutorUseBorrowedThreads, borrowed);
         setGlobalServiceContext(ServiceContext::make());
         auto sc = getGlobalServiceContext();
         _coordinator = std::make_unique<MockCoordinator>(sc, exhaustRounds + 1);
@@ -260,6 +265,7 @@ public:
         ServiceExecutor::shutdownAll(getGlobalServiceContext(), Seconds(1));
         setGlobalServiceContext({});
         _savedDefaultReserved.reset();
+        _savedUseBorrowedThreads.reset();
     }
 
     void run(benchmark::State& state) {
@@ -283,6 +289,7 @@ private:
     Mutex _setupMutex;
     int _configuredThreads = 0;
     boost::optional<ScopedValueOverride<size_t>> _savedDefaultReserved;
+    boost::optional<ScopedValueOverride<bool>> _savedUseBorrowedThreads;
     std::unique_ptr<MockCoordinator> _coordinator;
     AsioSessionManager* _sessionManager;
     test::TransportLayerMockWithReactor* _transportLayer{nullptr};
@@ -306,14 +313,15 @@ BENCHMARK_DEFINE_F(SessionWorkflowBm, Loop)(benchmark::State& state) {
 }
 
 BENCHMARK_REGISTER_F(SessionWorkflowBm, Loop)->Apply([](auto* b) {
-    b->ArgNames({"ExhaustRounds", "ReservedThreads"});
+    b->ArgNames({"ExhaustRounds", "ReservedThreads", "BorrowedThreads"});
     for (int exhaust : exhaustRounds) {
         std::vector<int> res{0};
 #if TRANSITIONAL_SERVICE_EXECUTOR_SYNCHRONOUS_HAS_RESERVE
         res = {0, 1, 4, 16};
 #endif
         for (int reserved : res)
-            b->Args({exhaust, reserved});
+            for (int borrowed : {0, 1})
+                b->Args({exhaust, reserved, borrowed});
     }
     b->ThreadRange(1, kMaxThreads);
 });
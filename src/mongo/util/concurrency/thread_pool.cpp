@@ -117,7 +117,7 @@ public:
     void startup();
     void shutdown();
     void join();
-    void schedule(Task task);
+    void schedule(Task task, bool highPriority);
     void waitForIdle();
     Stats getStats() const;
 
@@ -224,6 +224,9 @@ private:
     // Queue of yet-to-be-executed tasks.
     std::deque<Task> _pendingTasks;
 
+    // Number of tasks at the front of _pendingTasks that were scheduled with high priority.
+    size_t _numHighPriorityPendingTasks = 0;
+
     // List of threads serving as the worker pool.
     std::list<stdx::thread> _threads;
 
@@ -356,7 +359,7 @@ void ThreadPool::Impl::_drainPendingTasks(stdx::unique_lock<Latch>& lk) {
     _cleanUpThread.reset();
 }
 
-void ThreadPool::Impl::schedule(Task task) {
+void ThreadPool::Impl::schedule(Task task, bool highPriority) {
     stdx::unique_lock<Latch> lk(_mutex);
 
     switch (_state) {
@@ -378,7 +381,12 @@ void ThreadPool::Impl::schedule(Task task) {
         default:
             MONGO_UNREACHABLE;
     }
-    _pendingTasks.emplace_back(std::move(task));
+    if (highPriority) {
+        _pendingTasks.emplace(_pendingTasks.begin() + _numHighPriorityPendingTasks++,
+                              std::move(task));
+    } else {
+        _pendingTasks.emplace_back(std::move(task));
+    }
     if (_state == preStart) {
         return;
     }
@@ -533,6 +541,9 @@ void ThreadPool::Impl::_doOneTask(stdx::unique_lock<Latch>* lk) noexcept {
         23109, 3, "Executing a task on behalf of pool", "poolName"_attr = _options.poolName);
     Task task = std::move(_pendingTasks.front());
     _pendingTasks.pop_front();
+    if (_numHighPriorityPendingTasks > 0) {
+        --_numHighPriorityPendingTasks;
+    }
     --_numIdleThreads;
 
     lk->unlock();
@@ -623,7 +634,11 @@ void ThreadPool::join() {
 }
 
 void ThreadPool::schedule(Task task) {
-    _impl->schedule(std::move(task));
+    _impl->schedule(std::move(task), false);
+}
+
+void ThreadPool::scheduleHighPriority(Task task) {
+    _impl->schedule(std::move(task), true);
 }
 
 void ThreadPool::waitForIdle() {
@@ -148,6 +148,14 @@ public:
     // from OutOfLineExecutor (base of ThreadPoolInterface)
     void schedule(Task task) override;
 
+    /**
+     * Like schedule(), but the task is queued ahead of every task scheduled with schedule() that
+     * has not started yet. High priority tasks run in the order they were scheduled. Use this for
+     * latency-sensitive work, such as heartbeat or routing responses, that must not wait behind
+     * bulk work sharing the pool.
+     */
+    void scheduleHighPriority(Task task);
+
     // from ThreadPoolInterface
     void startup() override;
     void shutdown() override;
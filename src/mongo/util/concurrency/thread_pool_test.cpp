@@ -347,4 +347,30 @@ TEST(ThreadPoolTest, SafeToCallWaitForIdleBeforeShutdown) {
     pool.waitForIdle();
 }
 
+TEST(ThreadPoolTest, HighPriorityTasksRunBeforeNormalTasks) {
+    ThreadPool::Options options;
+    options.minThreads = 1;
+    options.maxThreads = 1;
+    ThreadPool pool(options);
+
+    // Tasks queue up until startup(), and the single thread then runs them in queue order.
+    std::string journal;
+    auto record = [&](std::string name) {
+        return [&journal, name](Status status) {
+            ASSERT_OK(status);
+            journal += "[{}]"_format(name);
+        };
+    };
+    pool.schedule(record("normal0"));
+    pool.scheduleHighPriority(record("high0"));
+    pool.schedule(record("normal1"));
+    pool.scheduleHighPriority(record("high1"));
+    ASSERT_EQ(pool.getStats().numPendingTasks, 4);
+
+    pool.startup();
+    pool.shutdown();
+    pool.join();
+    ASSERT_EQUALS(journal, "[high0][high1][normal0][normal1]");
+}
+
 }  // namespace
@@ -145,14 +145,16 @@ bool TicketPool<Queue>::acquire(AdmissionContext* admCtx, Date_t deadline) {
 
     {
         stdx::unique_lock<Mutex> lk(_mutex);
-        // It is important to check for a ticket one more time before queueing, as a ticket may have
-        // just become available.
+        // Count ourselves as queued before checking for a ticket one more time, as a ticket may
+        // have just become available. A releaser that does not see us in '_queued' has made its
+        // ticket available before this check.
+        _queued.addAndFetch(1);
         if (tryAcquire()) {
+            _queued.subtractAndFetch(1);
             return true;
         }
         _waiters.push(waiter);
     }
-    _queued.addAndFetch(1);
 
     auto res = atomic_wait(waiter->futexWord, TicketWaiter::State::Waiting, deadline);
     if (res == stdx::cv_status::timeout) {
@@ -186,7 +188,7 @@ std::shared_ptr<TicketWaiter> TicketPool<Queue>::_popWaiterOrAddTicketToPool() {
 }
 
 template <class Queue>
-void TicketPool<Queue>::_release() {
+void TicketPool<Queue>::_handOffTicket() {
     while (auto waiter = _popWaiterOrAddTicketToPool()) {
         _queued.subtractAndFetch(1);
         auto state = static_cast<uint32_t>(TicketWaiter::State::Waiting);
@@ -200,6 +202,25 @@ void TicketPool<Queue>::_release() {
     }
 }
 
+template <class Queue>
+void TicketPool<Queue>::_release() {
+    // While anyone is queued, the ticket goes straight to the head of the queue so that a thread
+    // calling tryAcquire() cannot take it ahead of the waiters.
+    if (_queued.load() > 0) {
+        _handOffTicket();
+        return;
+    }
+
+    // When nobody is queued, return the ticket to the pool without taking the queue mutex. If a
+    // waiter is queueing concurrently, either its last check for a ticket sees this one, or we see
+    // it in '_queued' below and take the ticket back to hand over. Failing to take it back means
+    // another thread already acquired it.
+    _available.addAndFetch(1);
+    if (_queued.load() > 0 && tryAcquire()) {
+        _handOffTicket();
+    }
+}
+
 template <class Queue>
 void TicketPool<Queue>::release() {
     _release();
@@ -244,6 +244,11 @@ private:
      */
     void _release();
 
+    /**
+     * Gives the ticket to the next waiter that has not timed out, and otherwise to the pool.
+     */
+    void _handOffTicket();
+
     /**
      * Removes the next waiter from the queue. If there are no waiters, adds the ticket to the pool.
      * Ensures that no new waiters queue while this is happening.
@@ -252,8 +257,8 @@ private:
 
     AtomicWord<int32_t> _available;
 
-    // This counter is redundant with the _waiters queue length, but provides the releaseIfWaiters()
-    // a fast-path that avoids taking the queue mutex.
+    // Number of waiters in the _waiters queue, plus those about to queue. Provides release() a
+    // fast-path that avoids taking the queue mutex when nobody is waiting.
     AtomicWord<int32_t> _queued;
 
     // This mutex protects the _waiters queue by preventing items from being added and removed, but
@@ -144,4 +144,51 @@ TEST(TicketPoolTest, HandOverWorks) {
         }
     }
 }
+
+TEST(TicketPoolTest, ReleaseHandsTicketToWaiterBeforeTryAcquire) {
+    TicketPool<FifoTicketQueue> pool(0);
+
+    stdx::thread waitingThread([&] {
+        MockAdmissionContext ctx;
+        ASSERT_TRUE(pool.acquire(&ctx, Date_t::now() + Seconds{10}));
+    });
+
+    assertSoon([&] {
+        ASSERT_SOON_EXP(pool.queued() == 1);
+        return true;
+    });
+
+    // The released ticket belongs to the waiter, so it never becomes available to other threads.
+    pool.release();
+    ASSERT_FALSE(pool.tryAcquire());
+
+    waitingThread.join();
+    ASSERT_EQ(pool.available(), 0);
+    ASSERT_EQ(pool.queued(), 0);
+}
+
+TEST(TicketPoolTest, ContendedAcquireAndReleaseLosesNoTickets) {
+    static constexpr auto numTickets = 4;
+    static constexpr auto threadsToTest = 32;
+    static constexpr auto iterations = 1000;
+    TicketPool<FifoTicketQueue> pool(numTickets);
+
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < threadsToTest; i++) {
+        threads.emplace_back([&] {
+            MockAdmissionContext ctx;
+            for (int j = 0; j < iterations; j++) {
+                ASSERT_TRUE(pool.acquire(&ctx, Date_t::now() + kWaitTimeout));
+                pool.release();
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(pool.available(), numTickets);
+    ASSERT_EQ(pool.queued(), 0);
+}
 }  // namespace
@@ -61,6 +61,9 @@ namespace mongo {
  * Cannot be shallow copied because child memory trackers point to the address of the inline
  * base tracker of the class.
  *
+ * Each stage that can spill owns its own tracker, and the memory limit is enforced per tracker.
+ * There is no operation-wide tracker that these roll up into.
+ *
  * TODO SERVER-80007: move implementation to .cpp to save on compilation time.
  */
 class MemoryUsageTracker {
@@ -2513,7 +2513,10 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
         }
     }
 
-    // We use the address of the context as the session id context.
+    // We use the address of the context as the session id context. The server side keeps
+    // OpenSSL's default session cache and session tickets, so clients which offer a session may
+    // resume it. Outgoing connections do not keep sessions and always perform a full handshake,
+    // so that the peer's certificate is validated and inspected afresh for every connection.
     if (0 ==
         ::SSL_CTX_set_session_id_context(
             context, reinterpret_cast<unsigned char*>(&context), sizeof(context))) {
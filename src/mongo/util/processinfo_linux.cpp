@@ -959,6 +959,11 @@ void ProcessInfo::getExtraInfo(BSONObjBuilder& info) {
 
 /**
  * If the process is running with (cc)NUMA enabled, return the number of NUMA nodes. Else, return 0.
+ *
+ * The count is only reported and used for the startup warning. The server has no NUMA placement
+ * policy of its own and expects memory to be interleaved across nodes (e.g. numactl
+ * --interleave=all), because the WiredTiger cache and most shared structures are accessed from
+ * every worker thread.
  */
 unsigned long countNumaNodes() {
     bool hasMultipleNodes = false;